@@ -1,4 +1,17 @@
 call Libs\vulkan\glslc.exe Shaders\shader.vert -o Shaders\output\vert.spv
 call Libs\vulkan\glslc.exe Shaders\shader.frag -o Shaders\output\frag.spv
+call Libs\vulkan\glslc.exe Shaders\mesh.vert -o Shaders\output\mesh_vert.spv
+call Libs\vulkan\glslc.exe Shaders\bindless.vert -o Shaders\output\bindless_vert.spv
+call Libs\vulkan\glslc.exe Shaders\bindless.frag -o Shaders\output\bindless_frag.spv
+call Libs\vulkan\glslc.exe Shaders\depth.vert -o Shaders\output\depth_vert.spv
+call Libs\vulkan\glslc.exe Shaders\meshlet_cull.comp -o Shaders\output\meshlet_cull_comp.spv
+call Libs\vulkan\glslc.exe Shaders\gpu_cull.comp -o Shaders\output\gpu_cull_comp.spv
+call Libs\vulkan\glslc.exe Shaders\gpu_driven.vert -o Shaders\output\gpu_driven_vert.spv
+call Libs\vulkan\glslc.exe Shaders\gpu_driven_depth.vert -o Shaders\output\gpu_driven_depth_vert.spv
+call Libs\vulkan\glslc.exe Shaders\instanced.vert -o Shaders\output\instanced_vert.spv
+call Libs\vulkan\glslc.exe Shaders\hiz_downsample.comp -o Shaders\output\hiz_downsample_comp.spv
+call Libs\vulkan\glslc.exe Shaders\gpu_cull_occlusion.comp -o Shaders\output\gpu_cull_occlusion_comp.spv
+call Libs\vulkan\glslc.exe Shaders\gpu_scene_scatter.comp -o Shaders\output\gpu_scene_scatter_comp.spv
+call Libs\vulkan\glslc.exe Shaders\mip_downsample.comp -o Shaders\output\mip_downsample_comp.spv
 
 pause
\ No newline at end of file
@@ -0,0 +1,15 @@
+#version 450
+#extension GL_GOOGLE_include_directive : require
+
+#include "bindless.glsl"
+
+layout(location = 0) in vec3 fragColour;
+layout(location = 1) in vec2 fragTexCoord;
+layout(location = 2) flat in uint fragTextureIndex;
+
+layout(location = 0) out vec4 outColour;
+
+void main()
+{
+    outColour = vec4(fragColour, 1.0) * SampleBindless(fragTextureIndex, fragTexCoord);
+}
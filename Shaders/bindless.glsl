@@ -0,0 +1,16 @@
+// Bindless resource arrays, must match Nya::VulkanBindlessHeap.
+#extension GL_EXT_nonuniform_qualifier : require
+
+#define BINDLESS_SET 1
+
+layout(set = BINDLESS_SET, binding = 0) uniform sampler2D g_Textures[];
+
+layout(std430, set = BINDLESS_SET, binding = 1) readonly buffer BindlessBuffer
+{
+    uint words[];
+} g_Buffers[];
+
+vec4 SampleBindless(uint textureIndex, vec2 uv)
+{
+    return texture(g_Textures[nonuniformEXT(textureIndex)], uv);
+}
@@ -0,0 +1,20 @@
+#version 450
+#extension GL_GOOGLE_include_directive : require
+
+#include "push_constants.glsl"
+
+layout(location = 0) in vec2 vertPosition;
+layout(location = 1) in vec3 vertColour;
+
+layout(location = 0) out vec3 fragColour;
+layout(location = 1) out vec2 fragTexCoord;
+layout(location = 2) flat out uint fragTextureIndex;
+
+void main()
+{
+    gl_Position = frame.proj * frame.view * draw.model * vec4(vertPosition, 0.0, 1.0);
+    fragColour = vertColour;
+    fragTexCoord = vertPosition + vec2(0.5);
+    // Material slot comes from push constants, so no descriptor has to change per draw.
+    fragTextureIndex = draw.materialIndex;
+}
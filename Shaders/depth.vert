@@ -0,0 +1,12 @@
+#version 450
+#extension GL_GOOGLE_include_directive : require
+
+#include "push_constants.glsl"
+
+// Position stream only (binding 0), for depth and shadow passes.
+layout(location = 0) in vec2 vertPosition;
+
+void main()
+{
+    gl_Position = frame.proj * frame.view * draw.model * vec4(vertPosition, 0.0, 1.0);
+}
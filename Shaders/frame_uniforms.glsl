@@ -0,0 +1,7 @@
+// Per-frame data, must match Src/ShaderData.h.
+
+layout(set = 0, binding = 0) uniform FrameUniforms
+{
+    mat4 view;
+    mat4 proj;
+} frame;
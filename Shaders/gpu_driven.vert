@@ -0,0 +1,32 @@
+#version 450
+#extension GL_GOOGLE_include_directive : require
+
+#include "frame_uniforms.glsl"
+#include "gpu_scene.glsl"
+
+// Per-object data comes from the instance buffer, indexed by the firstInstance the cull pass wrote.
+// Shares set 0 with the frame uniforms, see MeowRenderer.
+layout(std430, set = 0, binding = 1) readonly buffer Instances
+{
+    Instance instances[];
+};
+
+layout(location = 0) in vec2 vertPosition;
+layout(location = 1) in vec3 vertColour;
+
+// Interface of bindless.frag, which samples the material's texture from the bindless heap.
+layout(location = 0) out vec3 fragColour;
+layout(location = 1) out vec2 fragTexCoord;
+layout(location = 2) flat out uint fragTextureIndex;
+
+// Depth must match the prepass in gpu_driven_depth.vert exactly.
+invariant gl_Position;
+
+void main()
+{
+    Instance instance = instances[gl_InstanceIndex];
+    gl_Position = frame.proj * frame.view * instance.model * vec4(vertPosition, 0.0, 1.0);
+    fragColour = vertColour;
+    fragTexCoord = vertPosition + vec2(0.5);
+    fragTextureIndex = instance.materialIndex;
+}
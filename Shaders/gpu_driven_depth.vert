@@ -0,0 +1,22 @@
+#version 450
+#extension GL_GOOGLE_include_directive : require
+
+#include "frame_uniforms.glsl"
+#include "gpu_scene.glsl"
+
+// Depth prepass of the GPU scene, the position stream (binding 0) is all it fetches.
+layout(std430, set = 0, binding = 1) readonly buffer Instances
+{
+    Instance instances[];
+};
+
+layout(location = 0) in vec2 vertPosition;
+
+// Same expression as gpu_driven.vert, so the colour pass' depth test sees exactly the prepass depth.
+invariant gl_Position;
+
+void main()
+{
+    Instance instance = instances[gl_InstanceIndex];
+    gl_Position = frame.proj * frame.view * instance.model * vec4(vertPosition, 0.0, 1.0);
+}
@@ -0,0 +1,46 @@
+// GPU scene data, must match GpuInstance, GpuInstanceUpdate and GpuMesh in Src/ShaderData.h.
+
+struct Instance
+{
+    mat4 model;
+    uint mesh;
+    uint batch;
+    uint materialIndex;
+    uint objectID;
+};
+
+struct InstanceUpdate
+{
+    Instance instance;
+    uint index;
+    uint padding0;
+    uint padding1;
+    uint padding2;
+};
+
+struct Mesh
+{
+    vec3 center;
+    float radius;
+    uint indexCount;
+    uint firstIndex;
+    int vertexOffset;
+    uint padding;
+};
+
+struct DrawIndexedIndirectCommand
+{
+    uint indexCount;
+    uint instanceCount;
+    uint firstIndex;
+    int vertexOffset;
+    uint firstInstance;
+};
+
+// World space bounding sphere (center, radius), radius scaled by the largest axis scale.
+vec4 InstanceSphere(Instance instance, Mesh mesh)
+{
+    vec3 center = (instance.model * vec4(mesh.center, 1.0)).xyz;
+    float scale = max(max(length(instance.model[0].xyz), length(instance.model[1].xyz)), length(instance.model[2].xyz));
+    return vec4(center, mesh.radius * scale);
+}
@@ -0,0 +1,31 @@
+#version 450
+#extension GL_GOOGLE_include_directive : require
+
+#include "push_constants.glsl"
+
+// Mesh streams, see Src/VulkanMeshBuffer.h.
+layout(location = 0) in vec2 vertPosition;
+layout(location = 1) in vec3 vertColour;
+
+// Instance stream (VK_VERTEX_INPUT_RATE_INSTANCE), must match InstanceData::Layout in Src/Vertex.h.
+layout(location = 2) in vec4 instanceRow0;
+layout(location = 3) in vec4 instanceRow1;
+layout(location = 4) in vec4 instanceRow2;
+layout(location = 5) in vec4 instanceColour;
+layout(location = 6) in uint instanceMaterial;
+
+// Interface of bindless.frag, which samples the material's texture from the bindless heap.
+layout(location = 0) out vec3 fragColour;
+layout(location = 1) out vec2 fragTexCoord;
+layout(location = 2) flat out uint fragTextureIndex;
+
+void main()
+{
+    // Rows of an affine transform, transposed back into a column-major matrix.
+    mat4 model = transpose(mat4(instanceRow0, instanceRow1, instanceRow2, vec4(0.0, 0.0, 0.0, 1.0)));
+
+    gl_Position = frame.proj * frame.view * model * vec4(vertPosition, 0.0, 1.0);
+    fragColour = vertColour * instanceColour.rgb;
+    fragTexCoord = vertPosition + vec2(0.5);
+    fragTextureIndex = instanceMaterial;
+}
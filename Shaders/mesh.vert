@@ -0,0 +1,15 @@
+#version 450
+#extension GL_GOOGLE_include_directive : require
+
+#include "push_constants.glsl"
+
+layout(location = 0) in vec2 vertPosition;
+layout(location = 1) in vec3 vertColour;
+
+layout(location = 0) out vec3 fragColour;
+
+void main()
+{
+    gl_Position = frame.proj * frame.view * draw.model * vec4(vertPosition, 0.0, 1.0);
+    fragColour = vertColour;
+}
@@ -0,0 +1,10 @@
+// Per-draw data, must match Src/ShaderData.h. Pipelines without a DrawPushConstants range include frame_uniforms.glsl alone.
+
+#include "frame_uniforms.glsl"
+
+layout(push_constant) uniform DrawPushConstants
+{
+    mat4 model;
+    uint objectID;
+    uint materialIndex;
+} draw;
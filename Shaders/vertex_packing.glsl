@@ -0,0 +1,11 @@
+// Decoders for quantized vertex attributes, must match Src/VertexLayout.h.
+// Half, snorm and unorm formats are expanded to float by vertex fetch, only octahedral normals need decoding.
+
+vec3 OctDecode(vec2 e)
+{
+    vec3 n = vec3(e.xy, 1.0 - abs(e.x) - abs(e.y));
+    float t = max(-n.z, 0.0);
+    n.x += n.x >= 0.0 ? -t : t;
+    n.y += n.y >= 0.0 ? -t : t;
+    return normalize(n);
+}
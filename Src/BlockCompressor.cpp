@@ -0,0 +1,1066 @@
+﻿/*!
+\file		BlockCompressor.cpp
+\date		19/10/2026
+
+\author		Adrian Tan
+\email		t.xingkhiangadrian\@digipen.edu
+
+\brief		Contains implementation of BlockCompressor class.
+
+\copyright	All content © 2023 DigiPen (SINGAPORE) Corporation, all rights reserved.
+			Reproduction or disclosure of this file or its contents without the
+			prior written consent of DigiPen Institute of Technology is prohibited.
+__________________________________________________________________________________*/
+
+#include "meowpch.h"
+
+#include "BlockCompressor.h"
+#include "Simd.h"
+#include "ThreadPool.h"
+
+#include <cfloat>
+#include <cstring>
+#include <limits>
+
+namespace Nya
+{
+	//-- Kernels.
+	namespace
+	{
+
+		// Interpolation weights out of 64, as the BC7 spec defines them.
+		constexpr uint32_t s_Weights2[4] = { 0, 21, 43, 64 };
+		constexpr uint32_t s_Weights4[16] = { 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+		// Position of each BC1 index between endpoint 0 and 1.
+		constexpr float s_Bc1Weights[4] = { 0.f, 1.f, 1.f / 3.f, 2.f / 3.f };
+
+		constexpr float s_RgbWeights[4] = { 1.f, 1.f, 1.f, 0.f };
+		constexpr float s_AlphaWeights[4] = { 0.f, 0.f, 0.f, 1.f };
+		constexpr float s_RgbaWeights[4] = { 1.f, 1.f, 1.f, 1.f };
+
+		// One block's 16 pixels per channel, so the SIMD paths load them directly.
+		struct BlockPixels
+		{
+			alignas(32) float m_Channels[4][16];
+		};
+
+		// Decoded values a block's indices select from, one entry per index.
+		struct BlockPalette
+		{
+			alignas(32) float m_Channels[4][16]{};
+			uint32_t m_Size = 0;
+		};
+
+		// Writes the palette entry nearest each pixel by weighted squared distance, the first one on ties,
+		// and returns the summed distance. Every path adds in the same order, so they pick the same indices.
+		float FindIndicesScalar(const BlockPixels& pixels, const BlockPalette& palette, const float weights[4], uint8_t indices[16])
+		{
+			float total = 0.f;
+			for (uint32_t i = 0; i < 16; ++i)
+			{
+				float best = FLT_MAX;
+				uint32_t bestEntry = 0;
+				for (uint32_t entry = 0; entry < palette.m_Size; ++entry)
+				{
+					float distance = 0.f;
+					for (uint32_t c = 0; c < 4; ++c)
+					{
+						const float d = pixels.m_Channels[c][i] - palette.m_Channels[c][entry];
+						distance += weights[c] * d * d;
+					}
+					if (distance < best)
+					{
+						best = distance;
+						bestEntry = entry;
+					}
+				}
+				indices[i] = static_cast<uint8_t>(bestEntry);
+				total += best;
+			}
+			return total;
+		}
+
+#ifdef NYA_SIMD_SSE2
+		// 4 pixels per iteration against one palette entry at a time.
+		float FindIndicesSse(const BlockPixels& pixels, const BlockPalette& palette, const float weights[4], uint8_t indices[16])
+		{
+			alignas(16) float best[16];
+			alignas(16) int32_t bestEntries[16];
+
+			__m128 channelWeights[4];
+			for (uint32_t c = 0; c < 4; ++c)
+				channelWeights[c] = _mm_set1_ps(weights[c]);
+
+			for (uint32_t i = 0; i < 16; i += 4)
+			{
+				__m128 values[4];
+				for (uint32_t c = 0; c < 4; ++c)
+					values[c] = _mm_load_ps(&pixels.m_Channels[c][i]);
+
+				__m128 bestDistance = _mm_set1_ps(FLT_MAX);
+				__m128i bestEntry = _mm_setzero_si128();
+				for (uint32_t entry = 0; entry < palette.m_Size; ++entry)
+				{
+					__m128 distance = _mm_setzero_ps();
+					for (uint32_t c = 0; c < 4; ++c)
+					{
+						const __m128 d = _mm_sub_ps(values[c], _mm_set1_ps(palette.m_Channels[c][entry]));
+						distance = _mm_add_ps(distance, _mm_mul_ps(_mm_mul_ps(channelWeights[c], d), d));
+					}
+					const __m128i closer = _mm_castps_si128(_mm_cmplt_ps(distance, bestDistance));
+					bestDistance = _mm_min_ps(distance, bestDistance);
+					bestEntry = _mm_or_si128(_mm_and_si128(closer, _mm_set1_epi32(static_cast<int32_t>(entry))), _mm_andnot_si128(closer, bestEntry));
+				}
+				_mm_store_ps(best + i, bestDistance);
+				_mm_store_si128(reinterpret_cast<__m128i*>(bestEntries + i), bestEntry);
+			}
+
+			float total = 0.f;
+			for (uint32_t i = 0; i < 16; ++i)
+			{
+				indices[i] = static_cast<uint8_t>(bestEntries[i]);
+				total += best[i];
+			}
+			return total;
+		}
+#endif
+
+#ifdef NYA_SIMD_AVX2
+NYA_SIMD_BEGIN_AVX2
+		float FindIndicesAvx2(const BlockPixels& pixels, const BlockPalette& palette, const float weights[4], uint8_t indices[16])
+		{
+			alignas(32) float best[16];
+			alignas(32) int32_t bestEntries[16];
+
+			__m256 channelWeights[4];
+			for (uint32_t c = 0; c < 4; ++c)
+				channelWeights[c] = _mm256_set1_ps(weights[c]);
+
+			for (uint32_t i = 0; i < 16; i += 8)
+			{
+				__m256 values[4];
+				for (uint32_t c = 0; c < 4; ++c)
+					values[c] = _mm256_load_ps(&pixels.m_Channels[c][i]);
+
+				__m256 bestDistance = _mm256_set1_ps(FLT_MAX);
+				__m256i bestEntry = _mm256_setzero_si256();
+				for (uint32_t entry = 0; entry < palette.m_Size; ++entry)
+				{
+					__m256 distance = _mm256_setzero_ps();
+					for (uint32_t c = 0; c < 4; ++c)
+					{
+						const __m256 d = _mm256_sub_ps(values[c], _mm256_set1_ps(palette.m_Channels[c][entry]));
+						distance = _mm256_add_ps(distance, _mm256_mul_ps(_mm256_mul_ps(channelWeights[c], d), d));
+					}
+					const __m256 closer = _mm256_cmp_ps(distance, bestDistance, _CMP_LT_OQ);
+					bestDistance = _mm256_min_ps(distance, bestDistance);
+					bestEntry = _mm256_castps_si256(_mm256_blendv_ps(_mm256_castsi256_ps(bestEntry), _mm256_castsi256_ps(_mm256_set1_epi32(static_cast<int32_t>(entry))), closer));
+				}
+				_mm256_store_ps(best + i, bestDistance);
+				_mm256_store_si256(reinterpret_cast<__m256i*>(bestEntries + i), bestEntry);
+			}
+
+			float total = 0.f;
+			for (uint32_t i = 0; i < 16; ++i)
+			{
+				indices[i] = static_cast<uint8_t>(bestEntries[i]);
+				total += best[i];
+			}
+			return total;
+		}
+NYA_SIMD_END
+#endif
+
+		float FindIndices(const BlockPixels& pixels, const BlockPalette& palette, const float weights[4], uint8_t indices[16], const SimdPath path)
+		{
+			switch (path)
+			{
+#ifdef NYA_SIMD_AVX2
+			case SimdPath::Avx2:
+				return FindIndicesAvx2(pixels, palette, weights, indices);
+#endif
+#ifdef NYA_SIMD_SSE2
+			case SimdPath::Sse:
+				return FindIndicesSse(pixels, palette, weights, indices);
+#endif
+			default:
+				return FindIndicesScalar(pixels, palette, weights, indices);
+			}
+		}
+	}
+
+
+	//-- Endpoint fitting.
+	namespace
+	{
+		// Loads block (blockX, blockY), clamping reads past the image edge to the last row and column.
+		void LoadBlock(const uint8_t* rgba, const uint32_t width, const uint32_t height, const uint32_t blockX, const uint32_t blockY, BlockPixels& pixels)
+		{
+			for (uint32_t y = 0; y < 4; ++y)
+			{
+				const uint32_t sourceY = std::min(blockY * 4 + y, height - 1);
+				for (uint32_t x = 0; x < 4; ++x)
+				{
+					const uint32_t sourceX = std::min(blockX * 4 + x, width - 1);
+					const uint8_t* texel = rgba + (static_cast<size_t>(sourceY) * width + sourceX) * 4;
+					for (uint32_t c = 0; c < 4; ++c)
+						pixels.m_Channels[c][y * 4 + x] = static_cast<float>(texel[c]);
+				}
+			}
+		}
+
+		uint32_t Round(const float value, const uint32_t max)
+		{
+			return static_cast<uint32_t>(std::clamp(value + 0.5f, 0.f, static_cast<float>(max)));
+		}
+
+		// Endpoints at the extremes of the pixels' principal axis over channels [first, first + count), found by power iteration.
+		void FitPrincipalAxis(const BlockPixels& pixels, const uint32_t first, const uint32_t count, float endpoint0[4], float endpoint1[4])
+		{
+			float mean[4]{};
+			for (uint32_t c = first; c < first + count; ++c)
+			{
+				for (uint32_t i = 0; i < 16; ++i)
+					mean[c] += pixels.m_Channels[c][i];
+				mean[c] /= 16.f;
+			}
+
+			float covariance[4][4]{};
+			for (uint32_t a = first; a < first + count; ++a)
+				for (uint32_t b = first; b < first + count; ++b)
+					for (uint32_t i = 0; i < 16; ++i)
+						covariance[a][b] += (pixels.m_Channels[a][i] - mean[a]) * (pixels.m_Channels[b][i] - mean[b]);
+
+			// Start from the column of the widest channel, it cannot be orthogonal to the principal axis.
+			uint32_t widest = first;
+			for (uint32_t c = first; c < first + count; ++c)
+				if (covariance[c][c] > covariance[widest][widest])
+					widest = c;
+
+			float axis[4]{};
+			if (covariance[widest][widest] > 1e-3f)
+			{
+				for (uint32_t c = first; c < first + count; ++c)
+					axis[c] = covariance[c][widest];
+
+				for (uint32_t iteration = 0; iteration < 8; ++iteration)
+				{
+					float next[4]{};
+					float length = 0.f;
+					for (uint32_t a = first; a < first + count; ++a)
+					{
+						for (uint32_t b = first; b < first + count; ++b)
+							next[a] += covariance[a][b] * axis[b];
+						length += next[a] * next[a];
+					}
+					length = std::sqrt(length);
+					if (length < 1e-6f)
+						break;
+					for (uint32_t c = first; c < first + count; ++c)
+						axis[c] = next[c] / length;
+				}
+			}
+
+			float minT = 0.f, maxT = 0.f;
+			for (uint32_t i = 0; i < 16; ++i)
+			{
+				float t = 0.f;
+				for (uint32_t c = first; c < first + count; ++c)
+					t += (pixels.m_Channels[c][i] - mean[c]) * axis[c];
+				minT = std::min(minT, t);
+				maxT = std::max(maxT, t);
+			}
+
+			for (uint32_t c = first; c < first + count; ++c)
+			{
+				endpoint0[c] = std::clamp(mean[c] + minT * axis[c], 0.f, 255.f);
+				endpoint1[c] = std::clamp(mean[c] + maxT * axis[c], 0.f, 255.f);
+			}
+		}
+
+		// Bounding box corners, with channels that fall as the widest one rises swapped onto the other diagonal.
+		void FitBoundingBox(const BlockPixels& pixels, const uint32_t first, const uint32_t count, float endpoint0[4], float endpoint1[4])
+		{
+			float mean[4]{};
+			uint32_t widest = first;
+			for (uint32_t c = first; c < first + count; ++c)
+			{
+				endpoint0[c] = 255.f;
+				endpoint1[c] = 0.f;
+				for (uint32_t i = 0; i < 16; ++i)
+				{
+					endpoint0[c] = std::min(endpoint0[c], pixels.m_Channels[c][i]);
+					endpoint1[c] = std::max(endpoint1[c], pixels.m_Channels[c][i]);
+					mean[c] += pixels.m_Channels[c][i];
+				}
+				mean[c] /= 16.f;
+				if (endpoint1[c] - endpoint0[c] > endpoint1[widest] - endpoint0[widest])
+					widest = c;
+			}
+
+			for (uint32_t c = first; c < first + count; ++c)
+			{
+				float covariance = 0.f;
+				for (uint32_t i = 0; i < 16; ++i)
+					covariance += (pixels.m_Channels[c][i] - mean[c]) * (pixels.m_Channels[widest][i] - mean[widest]);
+				if (covariance < 0.f)
+					std::swap(endpoint0[c], endpoint1[c]);
+			}
+		}
+
+		// Best endpoints for fixed indices over channels [first, first + count), weights[index] being the fraction of endpoint 1.
+		// Returns false when every index has the same weight and the system has no single solution.
+		bool RefineEndpoints(const BlockPixels& pixels, const uint32_t first, const uint32_t count, const uint8_t indices[16], const float* weights,
+			float endpoint0[4], float endpoint1[4])
+		{
+			float aa = 0.f, ab = 0.f, bb = 0.f;
+			float ax[4]{}, bx[4]{};
+			for (uint32_t i = 0; i < 16; ++i)
+			{
+				const float b = weights[indices[i]];
+				const float a = 1.f - b;
+				aa += a * a;
+				ab += a * b;
+				bb += b * b;
+				for (uint32_t c = first; c < first + count; ++c)
+				{
+					ax[c] += a * pixels.m_Channels[c][i];
+					bx[c] += b * pixels.m_Channels[c][i];
+				}
+			}
+
+			const float determinant = aa * bb - ab * ab;
+			if (std::abs(determinant) < 1e-6f)
+				return false;
+
+			for (uint32_t c = first; c < first + count; ++c)
+			{
+				endpoint0[c] = std::clamp((bb * ax[c] - ab * bx[c]) / determinant, 0.f, 255.f);
+				endpoint1[c] = std::clamp((aa * bx[c] - ab * ax[c]) / determinant, 0.f, 255.f);
+			}
+			return true;
+		}
+
+		// Little endian bit stream over a 16 byte block, the order BC7 fields are packed in.
+		class BlockBits
+		{
+			uint8_t* m_Data;
+			uint32_t m_Offset = 0;
+
+		public:
+			explicit BlockBits(uint8_t* data) : m_Data(data) {}
+
+			void Write(const uint32_t value, const uint32_t bitCount)
+			{
+				for (uint32_t bit = 0; bit < bitCount; ++bit, ++m_Offset)
+					m_Data[m_Offset >> 3] |= static_cast<uint8_t>(((value >> bit) & 1) << (m_Offset & 7));
+			}
+
+			uint32_t Read(const uint32_t bitCount)
+			{
+				uint32_t value = 0;
+				for (uint32_t bit = 0; bit < bitCount; ++bit, ++m_Offset)
+					value |= ((m_Data[m_Offset >> 3] >> (m_Offset & 7)) & 1u) << bit;
+				return value;
+			}
+		};
+	}
+
+
+	//-- BC1 and BC3.
+	namespace
+	{
+		uint16_t Quantize565(const float color[4])
+		{
+			return static_cast<uint16_t>((Round(color[0] * 31.f / 255.f, 31) << 11) | (Round(color[1] * 63.f / 255.f, 63) << 5) | Round(color[2] * 31.f / 255.f, 31));
+		}
+
+		void Expand565(const uint16_t color, uint32_t rgb[3])
+		{
+			const uint32_t r = color >> 11, g = (color >> 5) & 63, b = color & 31;
+			rgb[0] = (r << 3) | (r >> 2);
+			rgb[1] = (g << 2) | (g >> 4);
+			rgb[2] = (b << 3) | (b >> 2);
+		}
+
+		// Four colour palette in index order: endpoint 0, endpoint 1, then the thirds.
+		float EvaluateBc1(const BlockPixels& pixels, const uint16_t color0, const uint16_t color1, uint8_t indices[16], const SimdPath path)
+		{
+			uint32_t rgb0[3], rgb1[3];
+			Expand565(color0, rgb0);
+			Expand565(color1, rgb1);
+
+			BlockPalette palette;
+			palette.m_Size = 4;
+			for (uint32_t c = 0; c < 3; ++c)
+			{
+				palette.m_Channels[c][0] = static_cast<float>(rgb0[c]);
+				palette.m_Channels[c][1] = static_cast<float>(rgb1[c]);
+				palette.m_Channels[c][2] = static_cast<float>((2 * rgb0[c] + rgb1[c]) / 3);
+				palette.m_Channels[c][3] = static_cast<float>((rgb0[c] + 2 * rgb1[c]) / 3);
+			}
+			return FindIndices(pixels, palette, s_RgbWeights, indices, path);
+		}
+
+		// Always four colour mode, so the same block is valid inside BC3.
+		void EncodeBc1(const BlockPixels& pixels, uint8_t* block, const SimdPath path)
+		{
+			//-- Principal axis, inset a sixteenth from each end since the extremes rarely land on an endpoint.
+			float endpoint0[4], endpoint1[4];
+			FitPrincipalAxis(pixels, 0, 3, endpoint0, endpoint1);
+			for (uint32_t c = 0; c < 3; ++c)
+			{
+				const float inset = (endpoint1[c] - endpoint0[c]) / 16.f;
+				endpoint0[c] += inset;
+				endpoint1[c] -= inset;
+			}
+
+			uint16_t color0 = Quantize565(endpoint0);
+			uint16_t color1 = Quantize565(endpoint1);
+			uint8_t indices[16];
+			float error = EvaluateBc1(pixels, color0, color1, indices, path);
+
+			//-- One least squares pass over the chosen indices.
+			if (RefineEndpoints(pixels, 0, 3, indices, s_Bc1Weights, endpoint0, endpoint1))
+			{
+				const uint16_t refined0 = Quantize565(endpoint0);
+				const uint16_t refined1 = Quantize565(endpoint1);
+				uint8_t refinedIndices[16];
+				const float refinedError = EvaluateBc1(pixels, refined0, refined1, refinedIndices, path);
+				if (refinedError < error)
+				{
+					color0 = refined0;
+					color1 = refined1;
+					std::copy_n(refinedIndices, 16, indices);
+				}
+			}
+
+			//-- Four colour mode needs color0 > color1. Swapping the endpoints swaps indices 0 and 1, and 2 and 3.
+			if (color0 < color1)
+			{
+				std::swap(color0, color1);
+				for (uint8_t& index : indices)
+					index ^= 1;
+			}
+			else if (color0 == color1)
+				std::fill_n(indices, 16, uint8_t{ 0 });
+
+			uint32_t packed = 0;
+			for (uint32_t i = 0; i < 16; ++i)
+				packed |= static_cast<uint32_t>(indices[i]) << (i * 2);
+
+			memcpy(block, &color0, 2);
+			memcpy(block + 2, &color1, 2);
+			memcpy(block + 4, &packed, 4);
+		}
+
+		// Eight value mode with alpha0 the maximum, so 0 and 255 stay exact.
+		void EncodeBc3Alpha(const BlockPixels& pixels, uint8_t* block, const SimdPath path)
+		{
+			const float* alpha = pixels.m_Channels[3];
+			const uint32_t alpha0 = static_cast<uint32_t>(*std::max_element(alpha, alpha + 16));
+			const uint32_t alpha1 = static_cast<uint32_t>(*std::min_element(alpha, alpha + 16));
+
+			uint8_t indices[16]{};
+			if (alpha0 != alpha1)
+			{
+				BlockPalette palette;
+				palette.m_Size = 8;
+				palette.m_Channels[3][0] = static_cast<float>(alpha0);
+				palette.m_Channels[3][1] = static_cast<float>(alpha1);
+				for (uint32_t code = 2; code < 8; ++code)
+					palette.m_Channels[3][code] = static_cast<float>(((8 - code) * alpha0 + (code - 1) * alpha1) / 7);
+				FindIndices(pixels, palette, s_AlphaWeights, indices, path);
+			}
+
+			uint64_t packed = 0;
+			for (uint32_t i = 0; i < 16; ++i)
+				packed |= static_cast<uint64_t>(indices[i]) << (i * 3);
+
+			block[0] = static_cast<uint8_t>(alpha0);
+			block[1] = static_cast<uint8_t>(alpha1);
+			for (uint32_t byte = 0; byte < 6; ++byte)
+				block[2 + byte] = static_cast<uint8_t>(packed >> (byte * 8));
+		}
+	}
+
+
+	//-- BC7.
+	namespace
+	{
+		constexpr float s_Bc7Weights4[16] =
+		{
+			0.f / 64.f, 4.f / 64.f, 9.f / 64.f, 13.f / 64.f, 17.f / 64.f, 21.f / 64.f, 26.f / 64.f, 30.f / 64.f,
+			34.f / 64.f, 38.f / 64.f, 43.f / 64.f, 47.f / 64.f, 51.f / 64.f, 55.f / 64.f, 60.f / 64.f, 64.f / 64.f
+		};
+		constexpr float s_Bc7Weights2[4] = { 0.f / 64.f, 21.f / 64.f, 43.f / 64.f, 64.f / 64.f };
+
+		uint32_t Interpolate(const uint32_t endpoint0, const uint32_t endpoint1, const uint32_t weight)
+		{
+			return ((64 - weight) * endpoint0 + weight * endpoint1 + 32) >> 6;
+		}
+
+		// Mode 6: one subset, RGBA endpoints of 7 bits plus a p-bit each, 4 bit indices.
+		struct Mode6Block
+		{
+			uint32_t m_Endpoints[2][4]{};		// 7 bit values.
+			uint32_t m_PBits[2]{};
+			uint8_t m_Indices[16]{};
+			float m_Error = FLT_MAX;
+		};
+
+		// Quantizes both endpoints with the given p-bits, and keeps the result in best if it has less error.
+		void TryMode6(const BlockPixels& pixels, const float endpoint0[4], const float endpoint1[4], const uint32_t pBit0, const uint32_t pBit1,
+			Mode6Block& best, const SimdPath path)
+		{
+			Mode6Block candidate;
+			candidate.m_PBits[0] = pBit0;
+			candidate.m_PBits[1] = pBit1;
+
+			uint32_t decoded[2][4];
+			for (uint32_t c = 0; c < 4; ++c)
+			{
+				candidate.m_Endpoints[0][c] = Round((endpoint0[c] - static_cast<float>(pBit0)) / 2.f, 127);
+				candidate.m_Endpoints[1][c] = Round((endpoint1[c] - static_cast<float>(pBit1)) / 2.f, 127);
+				decoded[0][c] = (candidate.m_Endpoints[0][c] << 1) | pBit0;
+				decoded[1][c] = (candidate.m_Endpoints[1][c] << 1) | pBit1;
+			}
+
+			BlockPalette palette;
+			palette.m_Size = 16;
+			for (uint32_t entry = 0; entry < 16; ++entry)
+				for (uint32_t c = 0; c < 4; ++c)
+					palette.m_Channels[c][entry] = static_cast<float>(Interpolate(decoded[0][c], decoded[1][c], s_Weights4[entry]));
+
+			candidate.m_Error = FindIndices(pixels, palette, s_RgbaWeights, candidate.m_Indices, path);
+			if (candidate.m_Error < best.m_Error)
+				best = candidate;
+		}
+
+		// The p-bit that quantizes an endpoint closest, judged on the endpoint alone.
+		uint32_t ChoosePBit(const float endpoint[4])
+		{
+			float errors[2]{};
+			for (uint32_t pBit = 0; pBit < 2; ++pBit)
+			{
+				for (uint32_t c = 0; c < 4; ++c)
+				{
+					const float decoded = static_cast<float>((Round((endpoint[c] - static_cast<float>(pBit)) / 2.f, 127) << 1) | pBit);
+					errors[pBit] += (decoded - endpoint[c]) * (decoded - endpoint[c]);
+				}
+			}
+			return errors[1] < errors[0] ? 1 : 0;
+		}
+
+		void EvaluateMode6(const BlockPixels& pixels, const float endpoint0[4], const float endpoint1[4], const bool allPBits, Mode6Block& best, const SimdPath path)
+		{
+			if (allPBits)
+			{
+				for (uint32_t pBits = 0; pBits < 4; ++pBits)
+					TryMode6(pixels, endpoint0, endpoint1, pBits & 1, pBits >> 1, best, path);
+			}
+			else
+				TryMode6(pixels, endpoint0, endpoint1, ChoosePBit(endpoint0), ChoosePBit(endpoint1), best, path);
+		}
+
+		Mode6Block FitMode6(const BlockPixels& pixels, const Bc7Quality quality, const SimdPath path)
+		{
+			Mode6Block best;
+			float endpoint0[4], endpoint1[4];
+			if (quality == Bc7Quality::Fast)
+			{
+				FitBoundingBox(pixels, 0, 4, endpoint0, endpoint1);
+				EvaluateMode6(pixels, endpoint0, endpoint1, false, best, path);
+				return best;
+			}
+
+			const bool allPBits = quality == Bc7Quality::High;
+			FitPrincipalAxis(pixels, 0, 4, endpoint0, endpoint1);
+			EvaluateMode6(pixels, endpoint0, endpoint1, allPBits, best, path);
+
+			const uint32_t refinements = quality == Bc7Quality::High ? 2 : 1;
+			for (uint32_t refinement = 0; refinement < refinements; ++refinement)
+			{
+				if (!RefineEndpoints(pixels, 0, 4, best.m_Indices, s_Bc7Weights4, endpoint0, endpoint1))
+					break;
+				EvaluateMode6(pixels, endpoint0, endpoint1, allPBits, best, path);
+			}
+			return best;
+		}
+
+		void WriteMode6(Mode6Block block, uint8_t* data)
+		{
+			// The first index is stored without its top bit, so it must be below 8.
+			if (block.m_Indices[0] >= 8)
+			{
+				std::swap(block.m_Endpoints[0], block.m_Endpoints[1]);
+				std::swap(block.m_PBits[0], block.m_PBits[1]);
+				for (uint8_t& index : block.m_Indices)
+					index = static_cast<uint8_t>(15 - index);
+			}
+
+			memset(data, 0, 16);
+			BlockBits bits(data);
+			bits.Write(1 << 6, 7);
+			for (uint32_t c = 0; c < 4; ++c)
+			{
+				bits.Write(block.m_Endpoints[0][c], 7);
+				bits.Write(block.m_Endpoints[1][c], 7);
+			}
+			bits.Write(block.m_PBits[0], 1);
+			bits.Write(block.m_PBits[1], 1);
+			for (uint32_t i = 0; i < 16; ++i)
+				bits.Write(block.m_Indices[i], i == 0 ? 3 : 4);
+		}
+
+		// Mode 5: RGB endpoints of 7 bits and alpha endpoints of 8, each with their own 2 bit indices, no rotation.
+		struct Mode5Block
+		{
+			uint32_t m_Colors[2][3]{};		// 7 bit values.
+			uint32_t m_Alphas[2]{};
+			uint8_t m_ColorIndices[16]{};
+			uint8_t m_AlphaIndices[16]{};
+			float m_Error = FLT_MAX;
+		};
+
+		float EvaluateMode5Color(const BlockPixels& pixels, const float endpoint0[4], const float endpoint1[4], uint32_t colors[2][3], uint8_t indices[16],
+			const SimdPath path)
+		{
+			BlockPalette palette;
+			palette.m_Size = 4;
+			for (uint32_t c = 0; c < 3; ++c)
+			{
+				colors[0][c] = Round(endpoint0[c] * 127.f / 255.f, 127);
+				colors[1][c] = Round(endpoint1[c] * 127.f / 255.f, 127);
+				const uint32_t decoded0 = (colors[0][c] << 1) | (colors[0][c] >> 6);
+				const uint32_t decoded1 = (colors[1][c] << 1) | (colors[1][c] >> 6);
+				for (uint32_t entry = 0; entry < 4; ++entry)
+					palette.m_Channels[c][entry] = static_cast<float>(Interpolate(decoded0, decoded1, s_Weights2[entry]));
+			}
+			return FindIndices(pixels, palette, s_RgbWeights, indices, path);
+		}
+
+		float EvaluateMode5Alpha(const BlockPixels& pixels, const float endpoint0[4], const float endpoint1[4], uint32_t alphas[2], uint8_t indices[16],
+			const SimdPath path)
+		{
+			alphas[0] = Round(endpoint0[3], 255);
+			alphas[1] = Round(endpoint1[3], 255);
+
+			BlockPalette palette;
+			palette.m_Size = 4;
+			for (uint32_t entry = 0; entry < 4; ++entry)
+				palette.m_Channels[3][entry] = static_cast<float>(Interpolate(alphas[0], alphas[1], s_Weights2[entry]));
+			return FindIndices(pixels, palette, s_AlphaWeights, indices, path);
+		}
+
+		Mode5Block FitMode5(const BlockPixels& pixels, const SimdPath path)
+		{
+			Mode5Block block;
+			float endpoint0[4], endpoint1[4];
+
+			//-- Color on its principal axis, then one least squares pass.
+			FitPrincipalAxis(pixels, 0, 3, endpoint0, endpoint1);
+			float colorError = EvaluateMode5Color(pixels, endpoint0, endpoint1, block.m_Colors, block.m_ColorIndices, path);
+			if (RefineEndpoints(pixels, 0, 3, block.m_ColorIndices, s_Bc7Weights2, endpoint0, endpoint1))
+			{
+				uint32_t colors[2][3];
+				uint8_t indices[16];
+				const float error = EvaluateMode5Color(pixels, endpoint0, endpoint1, colors, indices, path);
+				if (error < colorError)
+				{
+					colorError = error;
+					memcpy(block.m_Colors, colors, sizeof(colors));
+					std::copy_n(indices, 16, block.m_ColorIndices);
+				}
+			}
+
+			//-- Alpha from its range, then the same pass.
+			endpoint0[3] = *std::min_element(pixels.m_Channels[3], pixels.m_Channels[3] + 16);
+			endpoint1[3] = *std::max_element(pixels.m_Channels[3], pixels.m_Channels[3] + 16);
+			float alphaError = EvaluateMode5Alpha(pixels, endpoint0, endpoint1, block.m_Alphas, block.m_AlphaIndices, path);
+			if (RefineEndpoints(pixels, 3, 1, block.m_AlphaIndices, s_Bc7Weights2, endpoint0, endpoint1))
+			{
+				uint32_t alphas[2];
+				uint8_t indices[16];
+				const float error = EvaluateMode5Alpha(pixels, endpoint0, endpoint1, alphas, indices, path);
+				if (error < alphaError)
+				{
+					alphaError = error;
+					block.m_Alphas[0] = alphas[0];
+					block.m_Alphas[1] = alphas[1];
+					std::copy_n(indices, 16, block.m_AlphaIndices);
+				}
+			}
+
+			block.m_Error = colorError + alphaError;
+			return block;
+		}
+
+		void WriteMode5(Mode5Block block, uint8_t* data)
+		{
+			// Both first indices are stored without their top bit.
+			if (block.m_ColorIndices[0] >= 2)
+			{
+				std::swap(block.m_Colors[0], block.m_Colors[1]);
+				for (uint8_t& index : block.m_ColorIndices)
+					index = static_cast<uint8_t>(3 - index);
+			}
+			if (block.m_AlphaIndices[0] >= 2)
+			{
+				std::swap(block.m_Alphas[0], block.m_Alphas[1]);
+				for (uint8_t& index : block.m_AlphaIndices)
+					index = static_cast<uint8_t>(3 - index);
+			}
+
+			memset(data, 0, 16);
+			BlockBits bits(data);
+			bits.Write(1 << 5, 6);
+			bits.Write(0, 2);
+			for (uint32_t c = 0; c < 3; ++c)
+			{
+				bits.Write(block.m_Colors[0][c], 7);
+				bits.Write(block.m_Colors[1][c], 7);
+			}
+			bits.Write(block.m_Alphas[0], 8);
+			bits.Write(block.m_Alphas[1], 8);
+			for (uint32_t i = 0; i < 16; ++i)
+				bits.Write(block.m_ColorIndices[i], i == 0 ? 1 : 2);
+			for (uint32_t i = 0; i < 16; ++i)
+				bits.Write(block.m_AlphaIndices[i], i == 0 ? 1 : 2);
+		}
+
+		void EncodeBc7(const BlockPixels& pixels, uint8_t* data, const Bc7Quality quality, const SimdPath path)
+		{
+			const Mode6Block mode6 = FitMode6(pixels, quality, path);
+			if (quality == Bc7Quality::High && mode6.m_Error > 0.f)
+			{
+				const Mode5Block mode5 = FitMode5(pixels, path);
+				if (mode5.m_Error < mode6.m_Error)
+				{
+					WriteMode5(mode5, data);
+					return;
+				}
+			}
+			WriteMode6(mode6, data);
+		}
+	}
+
+
+	//-- Decoding.
+	namespace
+	{
+		// fourColor is set inside BC3, where the colour block ignores endpoint order.
+		void DecodeBc1(const uint8_t* block, uint8_t pixels[16][4], const bool fourColor)
+		{
+			uint16_t color0, color1;
+			uint32_t packed;
+			memcpy(&color0, block, 2);
+			memcpy(&color1, block + 2, 2);
+			memcpy(&packed, block + 4, 4);
+
+			uint32_t palette[4][4];
+			Expand565(color0, palette[0]);
+			Expand565(color1, palette[1]);
+			palette[0][3] = palette[1][3] = 255;
+			for (uint32_t c = 0; c < 3; ++c)
+			{
+				if (fourColor || color0 > color1)
+				{
+					palette[2][c] = (2 * palette[0][c] + palette[1][c]) / 3;
+					palette[3][c] = (palette[0][c] + 2 * palette[1][c]) / 3;
+				}
+				else
+				{
+					palette[2][c] = (palette[0][c] + palette[1][c]) / 2;
+					palette[3][c] = 0;
+				}
+			}
+			palette[2][3] = 255;
+			palette[3][3] = fourColor || color0 > color1 ? 255 : 0;
+
+			for (uint32_t i = 0; i < 16; ++i)
+				for (uint32_t c = 0; c < 4; ++c)
+					pixels[i][c] = static_cast<uint8_t>(palette[(packed >> (i * 2)) & 3][c]);
+		}
+
+		void DecodeBc3Alpha(const uint8_t* block, uint8_t pixels[16][4])
+		{
+			const uint32_t alpha0 = block[0], alpha1 = block[1];
+			uint32_t palette[8] = { alpha0, alpha1 };
+			for (uint32_t code = 2; code < 8; ++code)
+			{
+				if (alpha0 > alpha1)
+					palette[code] = ((8 - code) * alpha0 + (code - 1) * alpha1) / 7;
+				else if (code < 6)
+					palette[code] = ((6 - code) * alpha0 + (code - 1) * alpha1) / 5;
+				else
+					palette[code] = code == 6 ? 0 : 255;
+			}
+
+			uint64_t packed = 0;
+			for (uint32_t byte = 0; byte < 6; ++byte)
+				packed |= static_cast<uint64_t>(block[2 + byte]) << (byte * 8);
+			for (uint32_t i = 0; i < 16; ++i)
+				pixels[i][3] = static_cast<uint8_t>(palette[(packed >> (i * 3)) & 7]);
+		}
+
+		void DecodeBc7(const uint8_t* block, uint8_t pixels[16][4])
+		{
+			uint8_t data[16];
+			memcpy(data, block, 16);
+			BlockBits bits(data);
+
+			uint32_t mode = 0;
+			while (mode < 8 && bits.Read(1) == 0)
+				++mode;
+
+			if (mode == 6)
+			{
+				uint32_t endpoints[2][4];
+				for (uint32_t c = 0; c < 4; ++c)
+				{
+					endpoints[0][c] = bits.Read(7) << 1;
+					endpoints[1][c] = bits.Read(7) << 1;
+				}
+				const uint32_t pBit0 = bits.Read(1), pBit1 = bits.Read(1);
+				for (uint32_t c = 0; c < 4; ++c)
+				{
+					endpoints[0][c] |= pBit0;
+					endpoints[1][c] |= pBit1;
+				}
+				for (uint32_t i = 0; i < 16; ++i)
+				{
+					const uint32_t index = bits.Read(i == 0 ? 3 : 4);
+					for (uint32_t c = 0; c < 4; ++c)
+						pixels[i][c] = static_cast<uint8_t>(Interpolate(endpoints[0][c], endpoints[1][c], s_Weights4[index]));
+				}
+			}
+			else if (mode == 5)
+			{
+				const uint32_t rotation = bits.Read(2);
+				uint32_t colors[2][3], alphas[2];
+				for (uint32_t c = 0; c < 3; ++c)
+				{
+					colors[0][c] = bits.Read(7);
+					colors[1][c] = bits.Read(7);
+					colors[0][c] = (colors[0][c] << 1) | (colors[0][c] >> 6);
+					colors[1][c] = (colors[1][c] << 1) | (colors[1][c] >> 6);
+				}
+				alphas[0] = bits.Read(8);
+				alphas[1] = bits.Read(8);
+
+				for (uint32_t i = 0; i < 16; ++i)
+				{
+					const uint32_t index = bits.Read(i == 0 ? 1 : 2);
+					for (uint32_t c = 0; c < 3; ++c)
+						pixels[i][c] = static_cast<uint8_t>(Interpolate(colors[0][c], colors[1][c], s_Weights2[index]));
+				}
+				for (uint32_t i = 0; i < 16; ++i)
+				{
+					const uint32_t index = bits.Read(i == 0 ? 1 : 2);
+					pixels[i][3] = static_cast<uint8_t>(Interpolate(alphas[0], alphas[1], s_Weights2[index]));
+				}
+				if (rotation != 0)
+					for (uint32_t i = 0; i < 16; ++i)
+						std::swap(pixels[i][3], pixels[i][rotation - 1]);
+			}
+			else
+				throw std::runtime_error("Unsupported BC7 block mode!");
+		}
+
+		// Noise, gradients and hard edges, with an alpha ramp, a fair spread of what runtime textures hold.
+		std::vector<uint8_t> GenerateTestImage(const uint32_t width, const uint32_t height)
+		{
+			std::mt19937 random(1337);
+			std::uniform_int_distribution<int32_t> noise(-12, 12);
+
+			std::vector<uint8_t> pixels(static_cast<size_t>(width) * height * 4);
+			for (uint32_t y = 0; y < height; ++y)
+			{
+				for (uint32_t x = 0; x < width; ++x)
+				{
+					const float u = static_cast<float>(x) / static_cast<float>(width);
+					const float v = static_cast<float>(y) / static_cast<float>(height);
+					const bool checker = ((x / 32) + (y / 32)) % 2 == 0;
+
+					float color[4] =
+					{
+						255.f * u,
+						127.5f + 127.5f * std::sin(u * 20.f + v * 7.f),
+						checker ? 200.f : 40.f + 160.f * v,
+						255.f * std::clamp(1.5f - 2.f * std::hypot(u - 0.5f, v - 0.5f), 0.f, 1.f)
+					};
+
+					uint8_t* texel = &pixels[(static_cast<size_t>(y) * width + x) * 4];
+					for (uint32_t c = 0; c < 4; ++c)
+						texel[c] = static_cast<uint8_t>(std::clamp(color[c] + static_cast<float>(c < 3 ? noise(random) : 0), 0.f, 255.f));
+				}
+			}
+			return pixels;
+		}
+	}
+
+
+	//-- BlockCompressor Functions.
+	uint32_t BlockCompressor::GetBlockBytes(const BlockFormat format)
+	{
+		return format == BlockFormat::Bc1 ? 8 : 16;
+	}
+
+	size_t BlockCompressor::GetCompressedSize(const BlockFormat format, const uint32_t width, const uint32_t height)
+	{
+		return static_cast<size_t>((width + 3) / 4) * ((height + 3) / 4) * GetBlockBytes(format);
+	}
+
+	void BlockCompressor::Compress(const uint8_t* rgba, const uint32_t width, const uint32_t height, uint8_t* blocks, const BlockCompressSettings& settings,
+		const SimdPath path)
+	{
+		if (width == 0 || height == 0)
+			throw std::runtime_error("Cannot block compress an empty image!");
+
+		const uint32_t blocksX = (width + 3) / 4;
+		const uint32_t blocksY = (height + 3) / 4;
+		const uint32_t blockBytes = GetBlockBytes(settings.m_Format);
+		const SimdPath supportedPath = ClampSimdPath(path);
+
+		// One block row per task, rows write disjoint bytes.
+		ThreadPool::Get().ParallelFor(blocksY, 1, [=, &settings](const uint32_t begin, const uint32_t end)
+		{
+			BlockPixels pixels;
+			for (uint32_t blockY = begin; blockY < end; ++blockY)
+			{
+				for (uint32_t blockX = 0; blockX < blocksX; ++blockX)
+				{
+					LoadBlock(rgba, width, height, blockX, blockY, pixels);
+					uint8_t* block = blocks + (static_cast<size_t>(blockY) * blocksX + blockX) * blockBytes;
+					switch (settings.m_Format)
+					{
+					case BlockFormat::Bc1:
+						EncodeBc1(pixels, block, supportedPath);
+						break;
+					case BlockFormat::Bc3:
+						EncodeBc3Alpha(pixels, block, supportedPath);
+						EncodeBc1(pixels, block + 8, supportedPath);
+						break;
+					case BlockFormat::Bc7:
+						EncodeBc7(pixels, block, settings.m_Quality, supportedPath);
+						break;
+					}
+				}
+			}
+		});
+	}
+
+	std::vector<uint8_t> BlockCompressor::Compress(const uint8_t* rgba, const uint32_t width, const uint32_t height, const BlockCompressSettings& settings,
+		const SimdPath path)
+	{
+		std::vector<uint8_t> blocks(GetCompressedSize(settings.m_Format, width, height));
+		Compress(rgba, width, height, blocks.data(), settings, path);
+		return blocks;
+	}
+
+	std::vector<uint8_t> BlockCompressor::Decompress(const uint8_t* blocks, const uint32_t width, const uint32_t height, const BlockFormat format)
+	{
+		const uint32_t blocksX = (width + 3) / 4;
+		const uint32_t blocksY = (height + 3) / 4;
+		const uint32_t blockBytes = GetBlockBytes(format);
+
+		std::vector<uint8_t> rgba(static_cast<size_t>(width) * height * 4);
+		for (uint32_t blockY = 0; blockY < blocksY; ++blockY)
+		{
+			for (uint32_t blockX = 0; blockX < blocksX; ++blockX)
+			{
+				const uint8_t* block = blocks + (static_cast<size_t>(blockY) * blocksX + blockX) * blockBytes;
+				uint8_t pixels[16][4];
+				switch (format)
+				{
+				case BlockFormat::Bc1:
+					DecodeBc1(block, pixels, false);
+					break;
+				case BlockFormat::Bc3:
+					DecodeBc1(block + 8, pixels, true);
+					DecodeBc3Alpha(block, pixels);
+					break;
+				case BlockFormat::Bc7:
+					DecodeBc7(block, pixels);
+					break;
+				}
+
+				//-- Edge blocks only write the pixels inside the image.
+				for (uint32_t y = 0; y < 4 && blockY * 4 + y < height; ++y)
+					for (uint32_t x = 0; x < 4 && blockX * 4 + x < width; ++x)
+						memcpy(&rgba[((static_cast<size_t>(blockY) * 4 + y) * width + blockX * 4 + x) * 4], pixels[y * 4 + x], 4);
+			}
+		}
+		return rgba;
+	}
+
+	double BlockCompressor::ComputePsnr(const uint8_t* reference, const uint8_t* test, const uint32_t pixelCount, const bool includeAlpha)
+	{
+		const uint32_t channels = includeAlpha ? 4 : 3;
+		double squaredError = 0.0;
+		for (size_t i = 0; i < pixelCount; ++i)
+		{
+			for (uint32_t c = 0; c < channels; ++c)
+			{
+				const double d = static_cast<double>(reference[i * 4 + c]) - static_cast<double>(test[i * 4 + c]);
+				squaredError += d * d;
+			}
+		}
+
+		if (squaredError == 0.0)
+			return std::numeric_limits<double>::infinity();
+
+		const double meanSquaredError = squaredError / (static_cast<double>(pixelCount) * channels);
+		return 10.0 * std::log10(255.0 * 255.0 / meanSquaredError);
+	}
+
+	void BlockCompressor::Benchmark(const uint32_t width, const uint32_t height)
+	{
+		const std::vector<uint8_t> image = GenerateTestImage(width, height);
+		const uint32_t pixelCount = width * height;
+
+		struct Config
+		{
+			const char* m_Name;
+			BlockCompressSettings m_Settings;
+			double m_MinPsnr;	// About 2 dB under what the generated image reaches, anything lower is an encoder regression.
+		};
+		const std::array configs =
+		{
+			Config{ "BC1", { BlockFormat::Bc1 }, 31.0 },
+			Config{ "BC3", { BlockFormat::Bc3 }, 32.0 },
+			Config{ "BC7 fast", { BlockFormat::Bc7, Bc7Quality::Fast }, 32.0 },
+			Config{ "BC7 normal", { BlockFormat::Bc7, Bc7Quality::Normal }, 33.0 },
+			Config{ "BC7 high", { BlockFormat::Bc7, Bc7Quality::High }, 33.0 }
+		};
+
+		constexpr std::array paths = { SimdPath::Scalar, SimdPath::Sse, SimdPath::Avx2 };
+		constexpr std::array pathNames = { "scalar", "sse", "avx2" };
+		for (const Config& config : configs)
+		{
+			std::vector<uint8_t> reference;
+			for (uint32_t p = 0; p <= static_cast<uint32_t>(GetBestSimdPath()); ++p)
+			{
+				const auto startTime = std::chrono::high_resolution_clock::now();
+				const std::vector<uint8_t> blocks = Compress(image.data(), width, height, config.m_Settings, paths[p]);
+				const auto endTime = std::chrono::high_resolution_clock::now();
+				const float ms = std::chrono::duration<float, std::chrono::milliseconds::period>(endTime - startTime).count();
+
+				if (p == 0)
+					reference = blocks;
+				else if (blocks != reference)
+					throw std::runtime_error(std::string("Block compress ") + config.m_Name + " (" + pathNames[p] + ") differs from the scalar path!");
+
+				const std::vector<uint8_t> decoded = Decompress(blocks.data(), width, height, config.m_Settings.m_Format);
+				const double psnr = ComputePsnr(image.data(), decoded.data(), pixelCount, config.m_Settings.m_Format != BlockFormat::Bc1);
+				if (psnr < config.m_MinPsnr)
+					throw std::runtime_error(std::string("Block compress ") + config.m_Name + " PSNR " + std::to_string(psnr) + " dB is below "
+						+ std::to_string(config.m_MinPsnr) + " dB!");
+
+				std::cout << "\t" << "Block compress " << config.m_Name << " of " << width << "x" << height << " (" << pathNames[p] << "): " << ms << "ms, "
+					<< static_cast<float>(pixelCount) / (ms * 1000.f) << " MP/s, PSNR " << psnr << " dB" << std::endl;
+			}
+		}
+	}
+}
@@ -0,0 +1,72 @@
+﻿/*!
+\file		BlockCompressor.h
+\date		19/10/2026
+
+\author		Adrian Tan
+\email		t.xingkhiangadrian\@digipen.edu
+
+\brief		Contains definition of BlockCompressor class.
+			Runtime BC1, BC3 and BC7 encoding of RGBA8 images on the CPU, threaded
+			over block rows and SIMD over the pixels of each block.
+
+\copyright	All content © 2023 DigiPen (SINGAPORE) Corporation, all rights reserved.
+			Reproduction or disclosure of this file or its contents without the
+			prior written consent of DigiPen Institute of Technology is prohibited.
+__________________________________________________________________________________*/
+#pragma once
+
+#include "Simd.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace Nya
+{
+	enum class BlockFormat : uint32_t
+	{
+		Bc1,		// RGB, 8 bytes per block. Alpha is dropped.
+		Bc3,		// RGBA, 16 bytes per block, alpha interpolated separately.
+		Bc7			// RGBA, 16 bytes per block.
+	};
+
+	enum class Bc7Quality : uint32_t
+	{
+		Fast,		// Mode 6, bounding box endpoints.
+		Normal,		// Mode 6, principal axis endpoints refined once by least squares.
+		High		// Mode 6 refined twice over every p-bit pair, or mode 5 when separate alpha fits better.
+	};
+
+	struct BlockCompressSettings
+	{
+		BlockFormat m_Format = BlockFormat::Bc7;
+		Bc7Quality m_Quality = Bc7Quality::Normal;
+	};
+
+	// Encodes tightly packed RGBA8 images into 4x4 blocks, stored in row-major block order as the GPU expects.
+	// Block rows are spread over the ThreadPool, and the per-pixel palette search of every block runs on the chosen path.
+	class BlockCompressor
+	{
+	public:
+		static constexpr uint32_t s_BlockSize = 4;
+
+		static uint32_t GetBlockBytes(BlockFormat format);
+		static size_t GetCompressedSize(BlockFormat format, uint32_t width, uint32_t height);
+
+		// Sizes that are not a multiple of 4 repeat the last row and column into the edge blocks.
+		// blocks must hold GetCompressedSize bytes.
+		static void Compress(const uint8_t* rgba, uint32_t width, uint32_t height, uint8_t* blocks, const BlockCompressSettings& settings,
+			SimdPath path = GetBestSimdPath());
+		static std::vector<uint8_t> Compress(const uint8_t* rgba, uint32_t width, uint32_t height, const BlockCompressSettings& settings,
+			SimdPath path = GetBestSimdPath());
+
+		// Decodes back to RGBA8 for quality checks. Handles BC7 modes 5 and 6 only, the ones Compress writes, and throws on others.
+		static std::vector<uint8_t> Decompress(const uint8_t* blocks, uint32_t width, uint32_t height, BlockFormat format);
+
+		// Peak signal to noise ratio in dB over RGB, or RGBA with includeAlpha. Identical images give infinity.
+		static double ComputePsnr(const uint8_t* reference, const uint8_t* test, uint32_t pixelCount, bool includeAlpha);
+
+		// Compresses a generated image with every format, quality and path, and prints megapixels per second and PSNR.
+		// Throws if a path's blocks differ from scalar, or if PSNR falls below the format's floor.
+		static void Benchmark(uint32_t width, uint32_t height);
+	};
+}
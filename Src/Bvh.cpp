@@ -0,0 +1,750 @@
+﻿/*!
+\file		Bvh.cpp
+\date		19/10/2026
+
+\author		Adrian Tan
+\email		t.xingkhiangadrian\@digipen.edu
+
+\brief		Contains implementation for Bvh class functions.
+
+\copyright	All content © 2023 DigiPen (SINGAPORE) Corporation, all rights reserved.
+			Reproduction or disclosure of this file or its contents without the
+			prior written consent of DigiPen Institute of Technology is prohibited.
+__________________________________________________________________________________*/
+
+#include "meowpch.h"
+
+#include "Bvh.h"
+#include "ThreadPool.h"
+
+#include <glm/gtc/matrix_transform.hpp>
+
+namespace Nya
+{
+	//-- Aabb Functions.
+	void Aabb::Grow(const glm::vec3& point)
+	{
+		m_Min = glm::min(m_Min, point);
+		m_Max = glm::max(m_Max, point);
+	}
+
+	void Aabb::Grow(const Aabb& other)
+	{
+		m_Min = glm::min(m_Min, other.m_Min);
+		m_Max = glm::max(m_Max, other.m_Max);
+	}
+
+	glm::vec3 Aabb::GetCenter() const
+	{
+		return (m_Min + m_Max) * 0.5f;
+	}
+
+	float Aabb::GetHalfArea() const
+	{
+		const glm::vec3 size = glm::max(m_Max - m_Min, glm::vec3(0.f));
+		return size.x * size.y + size.y * size.z + size.z * size.x;
+	}
+
+	bool Aabb::Overlaps(const Aabb& other) const
+	{
+		return m_Min.x <= other.m_Max.x && m_Max.x >= other.m_Min.x
+			&& m_Min.y <= other.m_Max.y && m_Max.y >= other.m_Min.y
+			&& m_Min.z <= other.m_Max.z && m_Max.z >= other.m_Min.z;
+	}
+
+
+	//-- Build helpers.
+	namespace
+	{
+		constexpr float s_TraversalCost = 1.f;				// Relative to one object test.
+		constexpr uint32_t s_ParallelBinThreshold = 65536;	// Objects in a node before binning is split across threads.
+		constexpr uint32_t s_BinGrainSize = 16384;
+
+		struct BuildContext
+		{
+			const std::vector<Aabb>& m_Bounds;
+			std::vector<glm::vec3> m_Centers;
+			uint32_t* m_Objects = nullptr;
+		};
+
+		// Bounds of a range's objects and of their centers.
+		struct RangeBounds
+		{
+			Aabb m_Bounds;
+			Aabb m_CenterBounds;
+
+			void Grow(const RangeBounds& other)
+			{
+				m_Bounds.Grow(other.m_Bounds);
+				m_CenterBounds.Grow(other.m_CenterBounds);
+			}
+		};
+
+		struct Bin
+		{
+			RangeBounds m_Bounds;
+			uint32_t m_Count = 0;
+		};
+		using Bins = std::array<std::array<Bin, Bvh::s_BinCount>, 3>;
+
+		struct Split
+		{
+			uint32_t m_Axis = 0;
+			uint32_t m_BinCount = 0;
+			uint32_t m_Bin = 0;			// Objects in bins below this one go left.
+			float m_Cost = FLT_MAX;		// Unnormalized SAH cost of the children.
+			RangeBounds m_Left;			// Child bounds, merged from the bins.
+			RangeBounds m_Right;
+		};
+
+		// Range of the object list that becomes one node.
+		struct BuildRange
+		{
+			uint32_t m_First = 0;
+			uint32_t m_Count = 0;
+			uint32_t m_Depth = 0;
+			RangeBounds m_Bounds;
+		};
+
+		RangeBounds ComputeRangeBounds(const BuildContext& context, const uint32_t first, const uint32_t count)
+		{
+			RangeBounds bounds;
+			for (uint32_t i = first; i < first + count; ++i)
+			{
+				const uint32_t object = context.m_Objects[i];
+				bounds.m_Bounds.Grow(context.m_Bounds[object]);
+				bounds.m_CenterBounds.Grow(context.m_Centers[object]);
+			}
+
+			return bounds;
+		}
+
+		uint32_t GetBin(const float center, const float min, const float scale, const uint32_t binCount)
+		{
+			return std::min(static_cast<uint32_t>((center - min) * scale), binCount - 1);
+		}
+
+		void FillBins(const BuildContext& context, const uint32_t first, const uint32_t count, const Aabb& centerBounds, const glm::vec3& scale, const uint32_t binCount, Bins& bins)
+		{
+			for (uint32_t i = first; i < first + count; ++i)
+			{
+				const uint32_t object = context.m_Objects[i];
+				const glm::vec3& center = context.m_Centers[object];
+				for (uint32_t axis = 0; axis < 3; ++axis)
+				{
+					Bin& bin = bins[axis][GetBin(center[axis], centerBounds.m_Min[axis], scale[axis], binCount)];
+					bin.m_Bounds.m_Bounds.Grow(context.m_Bounds[object]);
+					bin.m_Bounds.m_CenterBounds.Grow(center);
+					++bin.m_Count;
+				}
+			}
+		}
+
+		// Binned SAH over all three axes. Returns a split with FLT_MAX cost if every center is the same.
+		Split FindSplit(const BuildContext& context, const BuildRange& range, const bool parallel)
+		{
+			// Small ranges use fewer bins, most nodes are near the leaves and sweeping every bin dominates there.
+			const uint32_t binCount = std::min(range.m_Count, Bvh::s_BinCount);
+			const Aabb& centerBounds = range.m_Bounds.m_CenterBounds;
+			const glm::vec3 extent = centerBounds.m_Max - centerBounds.m_Min;
+			glm::vec3 scale(0.f);
+			for (uint32_t axis = 0; axis < 3; ++axis)
+				scale[axis] = extent[axis] > 0.f ? static_cast<float>(binCount) / extent[axis] : 0.f;
+
+			Bins bins{};
+			if (parallel && range.m_Count >= s_ParallelBinThreshold)
+			{
+				//-- Bin chunks into their own bins, then merge.
+				std::vector<Bins> chunkBins((range.m_Count + s_BinGrainSize - 1) / s_BinGrainSize);
+				ThreadPool::Get().ParallelFor(range.m_Count, s_BinGrainSize, [&](const uint32_t begin, const uint32_t end)
+				{
+					FillBins(context, range.m_First + begin, end - begin, centerBounds, scale, binCount, chunkBins[begin / s_BinGrainSize]);
+				});
+
+				for (const Bins& chunk : chunkBins)
+				{
+					for (uint32_t axis = 0; axis < 3; ++axis)
+					{
+						for (uint32_t b = 0; b < binCount; ++b)
+						{
+							bins[axis][b].m_Bounds.Grow(chunk[axis][b].m_Bounds);
+							bins[axis][b].m_Count += chunk[axis][b].m_Count;
+						}
+					}
+				}
+			}
+			else
+				FillBins(context, range.m_First, range.m_Count, centerBounds, scale, binCount, bins);
+
+			//-- Sweep each axis from both sides, cost of a split is area times count of both halves.
+			Split best;
+			for (uint32_t axis = 0; axis < 3; ++axis)
+			{
+				if (scale[axis] == 0.f)
+					continue;
+
+				std::array<float, Bvh::s_BinCount> leftCosts{};
+				Aabb left;
+				uint32_t leftCount = 0;
+				for (uint32_t b = 0; b < binCount - 1; ++b)
+				{
+					left.Grow(bins[axis][b].m_Bounds.m_Bounds);
+					leftCount += bins[axis][b].m_Count;
+					leftCosts[b + 1] = leftCount ? left.GetHalfArea() * static_cast<float>(leftCount) : 0.f;
+				}
+
+				Aabb right;
+				uint32_t rightCount = 0;
+				for (uint32_t b = binCount - 1; b > 0; --b)
+				{
+					right.Grow(bins[axis][b].m_Bounds.m_Bounds);
+					rightCount += bins[axis][b].m_Count;
+					if (rightCount == 0 || rightCount == range.m_Count)
+						continue;
+
+					const float cost = leftCosts[b] + right.GetHalfArea() * static_cast<float>(rightCount);
+					if (cost < best.m_Cost)
+					{
+						best.m_Axis = axis;
+						best.m_Bin = b;
+						best.m_Cost = cost;
+					}
+				}
+			}
+
+			best.m_BinCount = binCount;
+			if (best.m_Cost < FLT_MAX)
+			{
+				for (uint32_t b = 0; b < binCount; ++b)
+					(b < best.m_Bin ? best.m_Left : best.m_Right).Grow(bins[best.m_Axis][b].m_Bounds);
+			}
+
+			return best;
+		}
+
+		// Splits a range in two, or returns false if it should be a leaf.
+		bool SplitRange(const BuildContext& context, const BuildRange& range, const bool parallel, BuildRange& left, BuildRange& right)
+		{
+			// Past the depth limit, ranges become leaves whatever their size, so traversal stacks cannot overflow.
+			if (range.m_Count <= 1 || range.m_Depth + 1 >= Bvh::s_MaxDepth)
+				return false;
+
+			const Split split = FindSplit(context, range, parallel);
+			const float nodeArea = range.m_Bounds.m_Bounds.GetHalfArea();
+			const float splitCost = s_TraversalCost + (nodeArea > 0.f ? split.m_Cost / nodeArea : static_cast<float>(range.m_Count));
+			if (range.m_Count <= Bvh::s_MaxLeafObjects && static_cast<float>(range.m_Count) <= splitCost)
+				return false;
+
+			uint32_t* begin = context.m_Objects + range.m_First;
+			uint32_t* end = begin + range.m_Count;
+			uint32_t* middle = begin + range.m_Count / 2;
+			if (split.m_Cost < FLT_MAX)
+			{
+				const Aabb& centerBounds = range.m_Bounds.m_CenterBounds;
+				const float min = centerBounds.m_Min[split.m_Axis];
+				const float scale = static_cast<float>(split.m_BinCount) / (centerBounds.m_Max[split.m_Axis] - min);
+				middle = std::partition(begin, end, [&](const uint32_t object)
+				{
+					return GetBin(context.m_Centers[object][split.m_Axis], min, scale, split.m_BinCount) < split.m_Bin;
+				});
+			}
+			// Identical centers: no split separates them, halve the list to keep leaves small.
+
+			left.m_First = range.m_First;
+			left.m_Count = static_cast<uint32_t>(middle - begin);
+			left.m_Depth = range.m_Depth + 1;
+			right.m_First = left.m_First + left.m_Count;
+			right.m_Count = range.m_Count - left.m_Count;
+			right.m_Depth = range.m_Depth + 1;
+
+			if (split.m_Cost < FLT_MAX)
+			{
+				left.m_Bounds = split.m_Left;
+				right.m_Bounds = split.m_Right;
+			}
+			else
+			{
+				left.m_Bounds = ComputeRangeBounds(context, left.m_First, left.m_Count);
+				right.m_Bounds = ComputeRangeBounds(context, right.m_First, right.m_Count);
+			}
+
+			return true;
+		}
+
+		BvhNode MakeNode(const Aabb& bounds, const uint32_t index, const uint32_t count)
+		{
+			return { bounds.m_Min, index, bounds.m_Max, count };
+		}
+
+		// Appends a subtree depth first. Right child indices are relative to the start of nodes.
+		void BuildSubtree(const BuildContext& context, const BuildRange& range, std::vector<BvhNode>& nodes)
+		{
+			const uint32_t index = static_cast<uint32_t>(nodes.size());
+			nodes.push_back(MakeNode(range.m_Bounds.m_Bounds, range.m_First, range.m_Count));
+
+			BuildRange left, right;
+			if (!SplitRange(context, range, false, left, right))
+				return;
+
+			BuildSubtree(context, left, nodes);
+			nodes[index].m_Index = static_cast<uint32_t>(nodes.size());
+			nodes[index].m_Count = 0;
+			BuildSubtree(context, right, nodes);
+		}
+
+		// Top of a parallel build, split on the calling thread until each range is small enough to be one task.
+		struct TopNode
+		{
+			BuildRange m_Range;
+			uint32_t m_Left = UINT32_MAX;
+			uint32_t m_Right = UINT32_MAX;
+			uint32_t m_Subtree = UINT32_MAX;
+		};
+
+		void EmitTopNode(const std::vector<TopNode>& topNodes, const uint32_t topIndex, const std::vector<std::vector<BvhNode>>& subtrees, std::vector<BvhNode>& nodes)
+		{
+			const TopNode& top = topNodes[topIndex];
+			if (top.m_Subtree != UINT32_MAX)
+			{
+				const uint32_t offset = static_cast<uint32_t>(nodes.size());
+				for (BvhNode node : subtrees[top.m_Subtree])
+				{
+					if (!node.IsLeaf())
+						node.m_Index += offset;
+					nodes.push_back(node);
+				}
+				return;
+			}
+
+			const uint32_t index = static_cast<uint32_t>(nodes.size());
+			nodes.push_back(MakeNode(top.m_Range.m_Bounds.m_Bounds, 0, 0));
+			EmitTopNode(topNodes, top.m_Left, subtrees, nodes);
+			nodes[index].m_Index = static_cast<uint32_t>(nodes.size());
+			EmitTopNode(topNodes, top.m_Right, subtrees, nodes);
+		}
+
+		float RayAabb(const glm::vec3& origin, const glm::vec3& inverseDirection, const glm::vec3& min, const glm::vec3& max, const float maxDistance)
+		{
+			const glm::vec3 t0 = (min - origin) * inverseDirection;
+			const glm::vec3 t1 = (max - origin) * inverseDirection;
+			const glm::vec3 tMin = glm::min(t0, t1);
+			const glm::vec3 tMax = glm::max(t0, t1);
+			const float enter = std::max(std::max(tMin.x, tMin.y), std::max(tMin.z, 0.f));
+			const float exit = std::min(std::min(tMax.x, tMax.y), std::min(tMax.z, maxDistance));
+			return enter <= exit ? enter : FLT_MAX;
+		}
+
+		enum class Containment
+		{
+			Outside,
+			Intersecting,
+			Inside
+		};
+
+		Containment ClassifyAabb(const Frustum& frustum, const glm::vec3& min, const glm::vec3& max)
+		{
+			const glm::vec3 center = (min + max) * 0.5f;
+			const glm::vec3 extent = (max - min) * 0.5f;
+
+			Containment result = Containment::Inside;
+			for (const glm::vec4& plane : frustum.m_Planes)
+			{
+				const float distance = glm::dot(glm::vec3(plane), center) + plane.w;
+				const float radius = glm::dot(glm::abs(glm::vec3(plane)), extent);
+				if (distance < -radius)
+					return Containment::Outside;
+				if (distance < radius)
+					result = Containment::Intersecting;
+			}
+
+			return result;
+		}
+	}
+
+
+	//-- Bvh Functions.
+	void Bvh::Build(const std::vector<Aabb>& bounds, const bool parallel)
+	{
+		const uint32_t objectCount = static_cast<uint32_t>(bounds.size());
+		m_ObjectBounds = bounds;
+		m_Objects.resize(objectCount);
+		m_Nodes.clear();
+		m_BuildCost = 0.f;
+		if (objectCount == 0)
+			return;
+
+		BuildContext context{ m_ObjectBounds, std::vector<glm::vec3>(objectCount), m_Objects.data() };
+		ThreadPool::Get().ParallelFor(objectCount, parallel ? s_BinGrainSize : objectCount, [&](const uint32_t begin, const uint32_t end)
+		{
+			for (uint32_t i = begin; i < end; ++i)
+			{
+				m_Objects[i] = i;
+				context.m_Centers[i] = m_ObjectBounds[i].GetCenter();
+			}
+		});
+
+		BuildRange root{ 0, objectCount, 0, ComputeRangeBounds(context, 0, objectCount) };
+		m_Nodes.reserve(static_cast<size_t>(objectCount) * 2);
+
+		const uint32_t concurrency = ThreadPool::Get().GetConcurrency();
+		if (!parallel || concurrency == 1)
+			BuildSubtree(context, root, m_Nodes);
+		else
+		{
+			//-- Split the top of the tree here until there are several ranges per thread.
+			const uint32_t taskSize = std::max(objectCount / (concurrency * 4), 1024u);
+			std::vector<TopNode> topNodes{ { root } };
+			std::vector<BuildRange> subtreeRanges;
+			for (uint32_t i = 0; i < topNodes.size(); ++i)
+			{
+				BuildRange left, right;
+				if (topNodes[i].m_Range.m_Count <= taskSize || !SplitRange(context, topNodes[i].m_Range, true, left, right))
+				{
+					topNodes[i].m_Subtree = static_cast<uint32_t>(subtreeRanges.size());
+					subtreeRanges.push_back(topNodes[i].m_Range);
+					continue;
+				}
+
+				topNodes[i].m_Left = static_cast<uint32_t>(topNodes.size());
+				topNodes[i].m_Right = topNodes[i].m_Left + 1;
+				topNodes.push_back({ left });
+				topNodes.push_back({ right });
+			}
+
+			//-- Build the ranges as independent subtrees, then stitch them into one depth first array.
+			std::vector<std::vector<BvhNode>> subtrees(subtreeRanges.size());
+			ThreadPool::Get().ParallelFor(static_cast<uint32_t>(subtreeRanges.size()), 1, [&](const uint32_t begin, const uint32_t end)
+			{
+				for (uint32_t i = begin; i < end; ++i)
+				{
+					subtrees[i].reserve(static_cast<size_t>(subtreeRanges[i].m_Count) * 2);
+					BuildSubtree(context, subtreeRanges[i], subtrees[i]);
+				}
+			});
+
+			EmitTopNode(topNodes, 0, subtrees, m_Nodes);
+		}
+
+		m_Nodes.shrink_to_fit();
+		m_BuildCost = GetCost();
+	}
+
+	void Bvh::SetObjectBounds(const uint32_t object, const Aabb& bounds)
+	{
+		m_ObjectBounds[object] = bounds;
+	}
+
+	void Bvh::Refit()
+	{
+		// Children always come after their parent, so one reverse pass updates them first.
+		for (size_t i = m_Nodes.size(); i-- > 0;)
+		{
+			BvhNode& node = m_Nodes[i];
+			Aabb bounds;
+			if (node.IsLeaf())
+			{
+				for (uint32_t j = node.m_Index; j < node.m_Index + node.m_Count; ++j)
+					bounds.Grow(m_ObjectBounds[m_Objects[j]]);
+			}
+			else
+			{
+				const BvhNode& left = m_Nodes[i + 1];
+				const BvhNode& right = m_Nodes[node.m_Index];
+				bounds.m_Min = glm::min(left.m_Min, right.m_Min);
+				bounds.m_Max = glm::max(left.m_Max, right.m_Max);
+			}
+
+			node.m_Min = bounds.m_Min;
+			node.m_Max = bounds.m_Max;
+		}
+	}
+
+	float Bvh::GetCost() const
+	{
+		if (m_Nodes.empty())
+			return 0.f;
+
+		double cost = 0.0;
+		for (const BvhNode& node : m_Nodes)
+		{
+			const float area = Aabb{ node.m_Min, node.m_Max }.GetHalfArea();
+			cost += area * (node.IsLeaf() ? static_cast<float>(node.m_Count) : s_TraversalCost);
+		}
+
+		const float rootArea = Aabb{ m_Nodes[0].m_Min, m_Nodes[0].m_Max }.GetHalfArea();
+		return rootArea > 0.f ? static_cast<float>(cost / rootArea) : 0.f;
+	}
+
+	bool Bvh::NeedsRebuild(const float threshold) const
+	{
+		return GetCost() > m_BuildCost * threshold;
+	}
+
+	void Bvh::QueryFrustum(const Frustum& frustum, std::vector<uint32_t>& objects) const
+	{
+		if (m_Nodes.empty())
+			return;
+
+		// Nodes on the stack with their top bit set are fully inside the frustum.
+		constexpr uint32_t insideBit = 1u << 31;
+		uint32_t stack[s_MaxDepth];
+		uint32_t stackSize = 0;
+		stack[stackSize++] = 0;
+
+		while (stackSize > 0)
+		{
+			const uint32_t entry = stack[--stackSize];
+			const uint32_t index = entry & ~insideBit;
+			const BvhNode& node = m_Nodes[index];
+
+			bool inside = entry & insideBit;
+			if (!inside)
+			{
+				const Containment containment = ClassifyAabb(frustum, node.m_Min, node.m_Max);
+				if (containment == Containment::Outside)
+					continue;
+				inside = containment == Containment::Inside;
+			}
+
+			if (node.IsLeaf())
+			{
+				for (uint32_t i = node.m_Index; i < node.m_Index + node.m_Count; ++i)
+				{
+					const uint32_t object = m_Objects[i];
+					if (inside || frustum.IntersectsAabb(m_ObjectBounds[object].m_Min, m_ObjectBounds[object].m_Max))
+						objects.push_back(object);
+				}
+				continue;
+			}
+
+			const uint32_t flag = inside ? insideBit : 0;
+			stack[stackSize++] = node.m_Index | flag;
+			stack[stackSize++] = (index + 1) | flag;
+		}
+	}
+
+	void Bvh::QueryAabb(const Aabb& box, std::vector<uint32_t>& objects) const
+	{
+		if (m_Nodes.empty())
+			return;
+
+		uint32_t stack[s_MaxDepth];
+		uint32_t stackSize = 0;
+		stack[stackSize++] = 0;
+
+		while (stackSize > 0)
+		{
+			const uint32_t index = stack[--stackSize];
+			const BvhNode& node = m_Nodes[index];
+			if (!box.Overlaps({ node.m_Min, node.m_Max }))
+				continue;
+
+			if (node.IsLeaf())
+			{
+				for (uint32_t i = node.m_Index; i < node.m_Index + node.m_Count; ++i)
+				{
+					if (box.Overlaps(m_ObjectBounds[m_Objects[i]]))
+						objects.push_back(m_Objects[i]);
+				}
+				continue;
+			}
+
+			stack[stackSize++] = node.m_Index;
+			stack[stackSize++] = index + 1;
+		}
+	}
+
+	BvhRayHit Bvh::Raycast(const glm::vec3& origin, const glm::vec3& direction, const float maxDistance,
+		const std::function<float(uint32_t object, float maxDistance)>& intersect) const
+	{
+		BvhRayHit hit;
+		hit.m_Distance = maxDistance;
+		if (m_Nodes.empty())
+			return {};
+
+		const glm::vec3 inverseDirection = 1.f / direction;
+		struct StackEntry
+		{
+			uint32_t m_Node;
+			float m_Distance;
+		};
+		StackEntry stack[s_MaxDepth];
+		uint32_t stackSize = 0;
+
+		const float rootDistance = RayAabb(origin, inverseDirection, m_Nodes[0].m_Min, m_Nodes[0].m_Max, hit.m_Distance);
+		if (rootDistance != FLT_MAX)
+			stack[stackSize++] = { 0, rootDistance };
+
+		while (stackSize > 0)
+		{
+			const StackEntry entry = stack[--stackSize];
+			if (entry.m_Distance > hit.m_Distance)
+				continue;
+
+			const BvhNode& node = m_Nodes[entry.m_Node];
+			if (node.IsLeaf())
+			{
+				for (uint32_t i = node.m_Index; i < node.m_Index + node.m_Count; ++i)
+				{
+					const uint32_t object = m_Objects[i];
+					const float distance = intersect ? intersect(object, hit.m_Distance)
+						: RayAabb(origin, inverseDirection, m_ObjectBounds[object].m_Min, m_ObjectBounds[object].m_Max, hit.m_Distance);
+					if (distance < hit.m_Distance)
+					{
+						hit.m_Object = object;
+						hit.m_Distance = distance;
+					}
+				}
+				continue;
+			}
+
+			//-- Push the far child first so the near one is visited first.
+			const uint32_t leftIndex = entry.m_Node + 1;
+			const uint32_t rightIndex = node.m_Index;
+			const float leftDistance = RayAabb(origin, inverseDirection, m_Nodes[leftIndex].m_Min, m_Nodes[leftIndex].m_Max, hit.m_Distance);
+			const float rightDistance = RayAabb(origin, inverseDirection, m_Nodes[rightIndex].m_Min, m_Nodes[rightIndex].m_Max, hit.m_Distance);
+			const StackEntry near = leftDistance <= rightDistance ? StackEntry{ leftIndex, leftDistance } : StackEntry{ rightIndex, rightDistance };
+			const StackEntry far = leftDistance <= rightDistance ? StackEntry{ rightIndex, rightDistance } : StackEntry{ leftIndex, leftDistance };
+			if (far.m_Distance != FLT_MAX)
+				stack[stackSize++] = far;
+			if (near.m_Distance != FLT_MAX)
+				stack[stackSize++] = near;
+		}
+
+		if (hit.m_Object == UINT32_MAX)
+			return {};
+
+		return hit;
+	}
+
+	const std::vector<BvhNode>& Bvh::GetNodes() const
+	{
+		return m_Nodes;
+	}
+
+	const std::vector<uint32_t>& Bvh::GetObjects() const
+	{
+		return m_Objects;
+	}
+
+	uint32_t Bvh::GetObjectCount() const
+	{
+		return static_cast<uint32_t>(m_ObjectBounds.size());
+	}
+
+	void Bvh::Benchmark(const uint32_t objectCount)
+	{
+		const auto elapsedMs = [](const auto startTime)
+		{
+			return std::chrono::duration<float, std::chrono::milliseconds::period>(std::chrono::high_resolution_clock::now() - startTime).count();
+		};
+
+		//-- Objects scattered in a 1km cube.
+		std::mt19937 random(1337);
+		std::uniform_real_distribution<float> positions(-500.f, 500.f), sizes(0.5f, 5.f), unit(-1.f, 1.f);
+		std::vector<Aabb> bounds(objectCount);
+		for (Aabb& box : bounds)
+		{
+			const glm::vec3 center(positions(random), positions(random), positions(random));
+			const float size = sizes(random);
+			box = { center - size, center + size };
+		}
+
+		Bvh bvh;
+		auto startTime = std::chrono::high_resolution_clock::now();
+		bvh.Build(bounds, false);
+		const float serialMs = elapsedMs(startTime);
+
+		startTime = std::chrono::high_resolution_clock::now();
+		bvh.Build(bounds, true);
+		const float parallelMs = elapsedMs(startTime);
+
+		//-- Move every object a little, then refit.
+		for (uint32_t i = 0; i < objectCount; ++i)
+		{
+			const glm::vec3 offset(unit(random), unit(random), unit(random));
+			bvh.SetObjectBounds(i, { bounds[i].m_Min + offset, bounds[i].m_Max + offset });
+		}
+		startTime = std::chrono::high_resolution_clock::now();
+		bvh.Refit();
+		const float refitMs = elapsedMs(startTime);
+
+		std::cout << "\t" << "BVH of " << objectCount << " objects: " << bvh.GetNodes().size() << " nodes, build " << serialMs << "ms serial, "
+			<< parallelMs << "ms on " << ThreadPool::Get().GetConcurrency() << " threads, refit " << refitMs << "ms (cost x"
+			<< bvh.GetCost() / std::max(bvh.m_BuildCost, FLT_MIN) << ")" << std::endl;
+
+		//-- Queries against brute force over the refitted bounds. Frustum queries may also return objects of fully
+		// contained nodes that the per-object test rounds to outside, so they only need to cover brute force.
+		std::vector<uint32_t> results;
+		std::vector<uint32_t> expected;
+		for (uint32_t i = 0; i < 16; ++i)
+		{
+			const glm::vec3 center(positions(random), positions(random), positions(random));
+			const Aabb box{ center - 50.f, center + 50.f };
+			const glm::mat4 view = glm::lookAt(center, center + glm::vec3(unit(random), unit(random), unit(random) + 0.01f), glm::vec3(0.f, 1.f, 0.f));
+			const Frustum frustum = Frustum::FromMatrix(glm::perspective(glm::radians(60.f), 16.f / 9.f, 0.1f, 200.f) * view);
+
+			results.clear();
+			expected.clear();
+			bvh.QueryAabb(box, results);
+			for (uint32_t object = 0; object < objectCount; ++object)
+			{
+				if (bvh.m_ObjectBounds[object].Overlaps(box))
+					expected.push_back(object);
+			}
+			std::sort(results.begin(), results.end());
+			if (results != expected)
+				throw std::runtime_error("BVH AABB query differs from brute force!");
+
+			results.clear();
+			expected.clear();
+			bvh.QueryFrustum(frustum, results);
+			for (uint32_t object = 0; object < objectCount; ++object)
+			{
+				if (frustum.IntersectsAabb(bvh.m_ObjectBounds[object].m_Min, bvh.m_ObjectBounds[object].m_Max))
+					expected.push_back(object);
+			}
+			std::sort(results.begin(), results.end());
+			if (!std::includes(results.begin(), results.end(), expected.begin(), expected.end()))
+				throw std::runtime_error("BVH frustum query missed objects brute force finds!");
+		}
+
+		//-- Query throughput.
+		constexpr uint32_t queryCount = 1000;
+		size_t resultCount = 0;
+
+		startTime = std::chrono::high_resolution_clock::now();
+		for (uint32_t i = 0; i < queryCount; ++i)
+		{
+			const glm::vec3 eye(positions(random), positions(random), positions(random));
+			const glm::mat4 view = glm::lookAt(eye, eye + glm::vec3(unit(random), unit(random), unit(random) + 0.01f), glm::vec3(0.f, 1.f, 0.f));
+			results.clear();
+			bvh.QueryFrustum(Frustum::FromMatrix(glm::perspective(glm::radians(60.f), 16.f / 9.f, 0.1f, 200.f) * view), results);
+			resultCount += results.size();
+		}
+		const float frustumMs = elapsedMs(startTime);
+
+		uint32_t rayHits = 0;
+		startTime = std::chrono::high_resolution_clock::now();
+		for (uint32_t i = 0; i < queryCount * 100; ++i)
+		{
+			const glm::vec3 origin(positions(random), positions(random), positions(random));
+			const glm::vec3 direction = glm::normalize(glm::vec3(unit(random), unit(random), unit(random)) + glm::vec3(0.f, 0.f, 0.001f));
+			rayHits += bvh.Raycast(origin, direction).m_Object != UINT32_MAX;
+		}
+		const float rayMs = elapsedMs(startTime);
+
+		startTime = std::chrono::high_resolution_clock::now();
+		for (uint32_t i = 0; i < queryCount * 100; ++i)
+		{
+			const glm::vec3 center(positions(random), positions(random), positions(random));
+			results.clear();
+			bvh.QueryAabb({ center - 10.f, center + 10.f }, results);
+			resultCount += results.size();
+		}
+		const float aabbMs = elapsedMs(startTime);
+
+		std::cout << "\t" << "BVH queries: frustum " << frustumMs * 1000.f / queryCount << "us, ray " << rayMs * 10.f / queryCount
+			<< "us (" << rayHits << " hits), aabb " << aabbMs * 10.f / queryCount << "us (" << resultCount << " results)" << std::endl;
+	}
+}
@@ -0,0 +1,103 @@
+﻿/*!
+\file		Bvh.h
+\date		19/10/2026
+
+\author		Adrian Tan
+\email		t.xingkhiangadrian\@digipen.edu
+
+\brief		Contains definition of Bvh class.
+
+\copyright	All content © 2023 DigiPen (SINGAPORE) Corporation, all rights reserved.
+			Reproduction or disclosure of this file or its contents without the
+			prior written consent of DigiPen Institute of Technology is prohibited.
+__________________________________________________________________________________*/
+#pragma once
+
+#include "Frustum.h"
+
+#include <cfloat>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace Nya
+{
+	struct Aabb
+	{
+		glm::vec3 m_Min{ FLT_MAX };
+		glm::vec3 m_Max{ -FLT_MAX };
+
+		void Grow(const glm::vec3& point);
+		void Grow(const Aabb& other);
+		glm::vec3 GetCenter() const;
+		// Half the surface area, all SAH needs.
+		float GetHalfArea() const;
+		bool Overlaps(const Aabb& other) const;
+	};
+
+	// 32 bytes, two per cache line. Nodes are stored depth first, so an interior node's left child
+	// is always the next node and a subtree is one contiguous range.
+	struct BvhNode
+	{
+		glm::vec3 m_Min;
+		uint32_t m_Index;		// Leaf: first entry in the object list. Interior: right child.
+		glm::vec3 m_Max;
+		uint32_t m_Count;		// Leaf: object count. Interior: 0.
+
+		bool IsLeaf() const { return m_Count != 0; }
+	};
+	static_assert(sizeof(BvhNode) == 32, "BvhNode should stay two per cache line!");
+
+	struct BvhRayHit
+	{
+		uint32_t m_Object = UINT32_MAX;		// UINT32_MAX on a miss.
+		float m_Distance = FLT_MAX;
+	};
+
+	// Bounding volume hierarchy over object AABBs. Built top down with binned SAH, optionally across
+	// the ThreadPool. Moving objects are handled with Refit, and a rebuild once NeedsRebuild reports the
+	// refitted tree has degraded too far.
+	class Bvh
+	{
+		std::vector<BvhNode> m_Nodes;
+		std::vector<uint32_t> m_Objects;		// Object ids, grouped by leaf.
+		std::vector<Aabb> m_ObjectBounds;		// Indexed by object id.
+		float m_BuildCost = 0.f;
+
+	public:
+		static constexpr uint32_t s_MaxLeafObjects = 4;
+		static constexpr uint32_t s_BinCount = 16;
+		static constexpr uint32_t s_MaxDepth = 64;		// Also the size of the query traversal stacks.
+
+		// Object ids are indices into bounds.
+		void Build(const std::vector<Aabb>& bounds, bool parallel = true);
+
+		// Updates one object's bounds. Takes effect in queries after the next Refit.
+		void SetObjectBounds(uint32_t object, const Aabb& bounds);
+		// Recomputes every node's bounds bottom up, keeping the topology.
+		void Refit();
+
+		// SAH cost of the current tree, relative to a single node holding every object.
+		float GetCost() const;
+		// True once refits made the tree costlier than threshold times its cost when built.
+		bool NeedsRebuild(float threshold = 1.5f) const;
+
+		// Appends objects whose bounds intersect the frustum. Objects in fully contained subtrees are
+		// appended without further tests.
+		void QueryFrustum(const Frustum& frustum, std::vector<uint32_t>& objects) const;
+		// Appends objects whose bounds overlap box, e.g. for assigning lights to objects.
+		void QueryAabb(const Aabb& box, std::vector<uint32_t>& objects) const;
+		// Nearest hit along a ray, near children first. intersect returns an object's hit distance (or FLT_MAX
+		// to miss) for hits closer than its maxDistance argument, by default the distance to its bounds.
+		BvhRayHit Raycast(const glm::vec3& origin, const glm::vec3& direction, float maxDistance = FLT_MAX,
+			const std::function<float(uint32_t object, float maxDistance)>& intersect = {}) const;
+
+		const std::vector<BvhNode>& GetNodes() const;
+		const std::vector<uint32_t>& GetObjects() const;
+		uint32_t GetObjectCount() const;
+
+		// Times serial and parallel builds, refit and each query type on objectCount random objects, and prints the result.
+		// Throws if AABB or frustum queries disagree with brute force.
+		static void Benchmark(uint32_t objectCount);
+	};
+}
@@ -0,0 +1,235 @@
+﻿/*!
+\file		DrawList.cpp
+\date		19/10/2026
+
+\author		Adrian Tan
+\email		t.xingkhiangadrian\@digipen.edu
+
+\brief		Contains implementation for DrawList class functions.
+
+\copyright	All content © 2023 DigiPen (SINGAPORE) Corporation, all rights reserved.
+			Reproduction or disclosure of this file or its contents without the
+			prior written consent of DigiPen Institute of Technology is prohibited.
+__________________________________________________________________________________*/
+
+#include "meowpch.h"
+
+#include "DrawList.h"
+
+namespace Nya
+{
+	//-- DrawKey Functions.
+	namespace
+	{
+		constexpr uint32_t s_MeshShift = 0;
+		constexpr uint32_t s_OpaqueDepthShift = s_MeshShift + DrawKey::s_MeshBits;
+		constexpr uint32_t s_OpaqueMaterialShift = s_OpaqueDepthShift + DrawKey::s_DepthBits;
+		constexpr uint32_t s_OpaquePipelineShift = s_OpaqueMaterialShift + DrawKey::s_MaterialBits;
+		constexpr uint32_t s_TranslucentMaterialShift = s_MeshShift + DrawKey::s_MeshBits;
+		constexpr uint32_t s_TranslucentPipelineShift = s_TranslucentMaterialShift + DrawKey::s_MaterialBits;
+		constexpr uint32_t s_TranslucentDepthShift = s_TranslucentPipelineShift + DrawKey::s_PipelineBits;
+		constexpr uint32_t s_PassShift = 64 - DrawKey::s_PassBits;
+
+		uint64_t Field(const uint32_t value, const uint32_t bits, const uint32_t shift)
+		{
+			return (static_cast<uint64_t>(value) & ((1ull << bits) - 1)) << shift;
+		}
+	}
+
+	uint32_t DrawKey::QuantizeDepth(const float depth)
+	{
+		constexpr float maxDepth = static_cast<float>((1u << s_DepthBits) - 1);
+		return static_cast<uint32_t>(std::clamp(depth, 0.f, 1.f) * maxDepth + 0.5f);
+	}
+
+	uint64_t DrawKey::MakeOpaque(const uint32_t pass, const uint32_t pipeline, const uint32_t material, const float depth, const uint32_t mesh)
+	{
+		return Field(pass, s_PassBits, s_PassShift)
+			| Field(pipeline, s_PipelineBits, s_OpaquePipelineShift)
+			| Field(material, s_MaterialBits, s_OpaqueMaterialShift)
+			| Field(QuantizeDepth(depth), s_DepthBits, s_OpaqueDepthShift)
+			| Field(mesh, s_MeshBits, s_MeshShift);
+	}
+
+	uint64_t DrawKey::MakeTranslucent(const uint32_t pass, const uint32_t pipeline, const uint32_t material, const float depth, const uint32_t mesh)
+	{
+		const uint32_t invertedDepth = (1u << s_DepthBits) - 1 - QuantizeDepth(depth);
+		return Field(pass, s_PassBits, s_PassShift)
+			| Field(invertedDepth, s_DepthBits, s_TranslucentDepthShift)
+			| Field(pipeline, s_PipelineBits, s_TranslucentPipelineShift)
+			| Field(material, s_MaterialBits, s_TranslucentMaterialShift)
+			| Field(mesh, s_MeshBits, s_MeshShift);
+	}
+
+	uint32_t DrawKey::GetPass(const uint64_t key)
+	{
+		return static_cast<uint32_t>(key >> s_PassShift);
+	}
+
+
+	//-- DrawList Functions.
+	void DrawList::Clear()
+	{
+		m_Packets.clear();
+		m_DrawData.clear();
+		m_Keys.clear();
+		m_Order.clear();
+		m_Sorted = true;
+	}
+
+	void DrawList::Reserve(const size_t packetCount)
+	{
+		m_Packets.reserve(packetCount);
+		m_Keys.reserve(packetCount);
+		m_Order.reserve(packetCount);
+	}
+
+	uint32_t DrawList::AddDrawData(const DrawPushConstants& drawData)
+	{
+		m_DrawData.push_back(drawData);
+		return static_cast<uint32_t>(m_DrawData.size() - 1);
+	}
+
+	void DrawList::Add(const DrawPacket& packet)
+	{
+		m_Keys.push_back(packet.m_Key);
+		m_Order.push_back(static_cast<uint32_t>(m_Packets.size()));
+		m_Packets.push_back(packet);
+		m_Sorted = false;
+	}
+
+	void DrawList::Sort()
+	{
+		if (m_Sorted)
+			return;
+
+		m_KeysScratch.resize(m_Keys.size());
+		m_OrderScratch.resize(m_Order.size());
+		RadixSort(m_Keys.data(), m_Order.data(), m_KeysScratch.data(), m_OrderScratch.data(), m_Keys.size());
+		m_Sorted = true;
+	}
+
+	std::pair<uint32_t, uint32_t> DrawList::GetPassRange(const uint32_t pass) const
+	{
+		const auto first = std::ranges::lower_bound(m_Keys, pass, {}, DrawKey::GetPass);
+		const auto last = std::ranges::upper_bound(first, m_Keys.end(), pass, {}, DrawKey::GetPass);
+		return { static_cast<uint32_t>(first - m_Keys.begin()), static_cast<uint32_t>(last - m_Keys.begin()) };
+	}
+
+	const DrawPacket& DrawList::GetSortedPacket(const uint32_t position) const
+	{
+		return m_Packets[m_Order[position]];
+	}
+
+	const DrawPushConstants& DrawList::GetDrawData(const uint32_t drawData) const
+	{
+		return m_DrawData[drawData];
+	}
+
+	uint32_t DrawList::GetPacketCount() const
+	{
+		return static_cast<uint32_t>(m_Packets.size());
+	}
+
+	void DrawList::RadixSort(uint64_t* keys, uint32_t* values, uint64_t* keysScratch, uint32_t* valuesScratch, const size_t count)
+	{
+		constexpr uint32_t digitBits = 8;
+		constexpr uint32_t passCount = 64 / digitBits;
+		constexpr uint32_t bucketCount = 1u << digitBits;
+
+		if (count < 2)
+			return;
+
+		//-- Histogram every digit in one read of the keys.
+		std::array<std::array<uint32_t, bucketCount>, passCount> histograms{};
+		for (size_t i = 0; i < count; ++i)
+		{
+			const uint64_t key = keys[i];
+			for (uint32_t pass = 0; pass < passCount; ++pass)
+				++histograms[pass][(key >> (pass * digitBits)) & (bucketCount - 1)];
+		}
+
+		//-- Scatter by each digit, least significant first. Digits shared by every key are skipped,
+		//-- which is common for the high (pass, pipeline) bits of a frame's keys.
+		uint64_t* srcKeys = keys;
+		uint32_t* srcValues = values;
+		uint64_t* dstKeys = keysScratch;
+		uint32_t* dstValues = valuesScratch;
+		for (uint32_t pass = 0; pass < passCount; ++pass)
+		{
+			auto& histogram = histograms[pass];
+			const uint32_t shift = pass * digitBits;
+			if (histogram[(srcKeys[0] >> shift) & (bucketCount - 1)] == count)
+				continue;
+
+			uint32_t offset = 0;
+			for (uint32_t& bucket : histogram)
+			{
+				const uint32_t bucketSize = bucket;
+				bucket = offset;
+				offset += bucketSize;
+			}
+
+			for (size_t i = 0; i < count; ++i)
+			{
+				const uint32_t destination = histogram[(srcKeys[i] >> shift) & (bucketCount - 1)]++;
+				dstKeys[destination] = srcKeys[i];
+				dstValues[destination] = srcValues[i];
+			}
+
+			std::swap(srcKeys, dstKeys);
+			std::swap(srcValues, dstValues);
+		}
+
+		//-- An odd number of scatters leaves the result in the scratch arrays.
+		if (srcKeys != keys)
+		{
+			std::copy_n(srcKeys, count, keys);
+			std::copy_n(srcValues, count, values);
+		}
+	}
+
+	void DrawList::BenchmarkSort(const uint32_t packetCount, const uint32_t iterations)
+	{
+		//-- Keys shaped like a real frame: few passes and pipelines, more materials, random depth and mesh.
+		std::mt19937 random(1337);
+		std::uniform_int_distribution<uint32_t> pipelines(0, 31), materials(0, 1023), meshes(0, 4095);
+		std::uniform_real_distribution<float> depths(0.f, 1.f);
+
+		std::vector<uint64_t> sourceKeys(packetCount);
+		for (uint64_t& key : sourceKeys)
+			key = DrawKey::MakeOpaque(random() % 3, pipelines(random), materials(random), depths(random), meshes(random));
+
+		std::vector<uint64_t> keys(packetCount), keysScratch(packetCount);
+		std::vector<uint32_t> values(packetCount), valuesScratch(packetCount);
+		std::vector<std::pair<uint64_t, uint32_t>> pairs(packetCount);
+
+		float radixMs = 0.f;
+		float stdMs = 0.f;
+		for (uint32_t iteration = 0; iteration < iterations; ++iteration)
+		{
+			std::copy(sourceKeys.begin(), sourceKeys.end(), keys.begin());
+			for (uint32_t i = 0; i < packetCount; ++i)
+			{
+				values[i] = i;
+				pairs[i] = { sourceKeys[i], i };
+			}
+
+			auto startTime = std::chrono::high_resolution_clock::now();
+			RadixSort(keys.data(), values.data(), keysScratch.data(), valuesScratch.data(), packetCount);
+			auto endTime = std::chrono::high_resolution_clock::now();
+			radixMs += std::chrono::duration<float, std::chrono::milliseconds::period>(endTime - startTime).count();
+
+			startTime = std::chrono::high_resolution_clock::now();
+			std::sort(pairs.begin(), pairs.end());
+			endTime = std::chrono::high_resolution_clock::now();
+			stdMs += std::chrono::duration<float, std::chrono::milliseconds::period>(endTime - startTime).count();
+
+			if (!std::is_sorted(keys.begin(), keys.end()))
+				throw std::runtime_error("Draw list radix sort produced unsorted keys!");
+		}
+
+		std::cout << "\t" << "Draw list sort of " << packetCount << " packets: radix " << radixMs / iterations << "ms, std::sort "
+			<< stdMs / iterations << "ms" << std::endl;
+	}
+}
@@ -0,0 +1,101 @@
+﻿/*!
+\file		DrawList.h
+\date		19/10/2026
+
+\author		Adrian Tan
+\email		t.xingkhiangadrian\@digipen.edu
+
+\brief		Contains definition of DrawList class.
+
+\copyright	All content © 2023 DigiPen (SINGAPORE) Corporation, all rights reserved.
+			Reproduction or disclosure of this file or its contents without the
+			prior written consent of DigiPen Institute of Technology is prohibited.
+__________________________________________________________________________________*/
+#pragma once
+
+#include "ShaderData.h"
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace Nya
+{
+	// 64-bit draw sort key. Sorting ascending groups draws by pass, then by the state that is most
+	// expensive to change, so consecutive draws share as much bound state as possible.
+	//   Opaque:      pass(4) | pipeline(10) | material(14) | depth(20) | mesh(16)   front to back per material.
+	//   Translucent: pass(4) | depth(20, inverted) | pipeline(10) | material(14) | mesh(16)   back to front.
+	// Ids wider than their field are truncated, which only costs sort quality, never correctness.
+	struct DrawKey
+	{
+		static constexpr uint32_t s_PassBits = 4;
+		static constexpr uint32_t s_PipelineBits = 10;
+		static constexpr uint32_t s_MaterialBits = 14;
+		static constexpr uint32_t s_DepthBits = 20;
+		static constexpr uint32_t s_MeshBits = 16;
+		static_assert(s_PassBits + s_PipelineBits + s_MaterialBits + s_DepthBits + s_MeshBits == 64, "Draw key fields must fill 64 bits!");
+
+		// depth is normalized view depth, 0 at the near plane and 1 at the far plane.
+		static uint32_t QuantizeDepth(float depth);
+
+		static uint64_t MakeOpaque(uint32_t pass, uint32_t pipeline, uint32_t material, float depth, uint32_t mesh);
+		static uint64_t MakeTranslucent(uint32_t pass, uint32_t pipeline, uint32_t material, float depth, uint32_t mesh);
+
+		static uint32_t GetPass(uint64_t key);
+	};
+
+	// One draw, plain data. Resource ids index the tables of the VulkanDrawList that records it.
+	struct DrawPacket
+	{
+		static constexpr uint32_t s_None = UINT32_MAX;
+
+		uint64_t m_Key = 0;
+		uint32_t m_Pipeline = 0;
+		uint32_t m_Material = s_None;		// Descriptor set, s_None to leave the bound one.
+		uint32_t m_Mesh = 0;
+		uint32_t m_DrawData = s_None;		// Push constants in the DrawList, s_None for none.
+		uint32_t m_FirstIndex = 0;
+		uint32_t m_IndexCount = 0;			// 0 draws the whole index buffer.
+		int32_t m_VertexOffset = 0;			// Added to each index, e.g. for a range of a VulkanStaticBatch.
+		uint32_t m_FirstInstance = 0;
+		uint32_t m_InstanceCount = 1;
+	};
+	static_assert(sizeof(DrawPacket) == 48, "DrawPacket should stay compact!");
+
+	// Per-frame list of draw packets. Packets are never moved: sorting only reorders 64-bit keys
+	// and 32-bit packet indices, with an 8-bit LSD radix sort.
+	class DrawList
+	{
+		std::vector<DrawPacket> m_Packets;
+		std::vector<DrawPushConstants> m_DrawData;
+
+		std::vector<uint64_t> m_Keys;
+		std::vector<uint32_t> m_Order;
+		std::vector<uint64_t> m_KeysScratch;
+		std::vector<uint32_t> m_OrderScratch;
+		bool m_Sorted = true;
+
+	public:
+		void Clear();
+		void Reserve(size_t packetCount);
+
+		uint32_t AddDrawData(const DrawPushConstants& drawData);
+		void Add(const DrawPacket& packet);
+
+		void Sort();
+
+		// Sorted positions [first, last) of a pass's packets. Only valid after Sort.
+		std::pair<uint32_t, uint32_t> GetPassRange(uint32_t pass) const;
+
+		// Packet at a sorted position. Only valid after Sort.
+		const DrawPacket& GetSortedPacket(uint32_t position) const;
+		const DrawPushConstants& GetDrawData(uint32_t drawData) const;
+		uint32_t GetPacketCount() const;
+
+		// Stable ascending sort of keys, carrying values along. Scratch arrays must hold count elements.
+		static void RadixSort(uint64_t* keys, uint32_t* values, uint64_t* keysScratch, uint32_t* valuesScratch, size_t count);
+
+		// Times sorting packetCount random packets with RadixSort and std::sort and prints the result.
+		static void BenchmarkSort(uint32_t packetCount, uint32_t iterations = 16);
+	};
+}
@@ -0,0 +1,295 @@
+﻿/*!
+\file		EntityWorld.cpp
+\date		19/10/2026
+
+\author		Adrian Tan
+\email		t.xingkhiangadrian\@digipen.edu
+
+\brief		Contains implementation for EntityWorld class functions.
+
+\copyright	All content © 2023 DigiPen (SINGAPORE) Corporation, all rights reserved.
+			Reproduction or disclosure of this file or its contents without the
+			prior written consent of DigiPen Institute of Technology is prohibited.
+__________________________________________________________________________________*/
+
+#include "meowpch.h"
+
+#include "EntityWorld.h"
+
+#include <atomic>
+#include <bit>
+#include <cstring>
+#include <mutex>
+
+namespace Nya
+{
+	//-- ComponentRegistry Functions.
+	namespace
+	{
+		std::array<ComponentInfo, ComponentRegistry::s_MaxComponents> s_ComponentInfos;
+		std::atomic<uint32_t> s_ComponentCount = 0;
+		std::mutex s_RegistryMutex;
+	}
+
+	uint32_t ComponentRegistry::Register(const uint32_t size, const uint32_t alignment)
+	{
+		std::lock_guard lock(s_RegistryMutex);
+
+		const uint32_t id = s_ComponentCount.load();
+		if (id >= s_MaxComponents)
+			throw std::runtime_error("Too many component types!");
+		if (alignment > Archetype::s_CacheLineSize)
+			throw std::runtime_error("Component alignment is wider than a cache line!");
+
+		s_ComponentInfos[id] = { size, alignment };
+		s_ComponentCount.store(id + 1);
+		return id;
+	}
+
+	const ComponentInfo& ComponentRegistry::GetInfo(const uint32_t component)
+	{
+		return s_ComponentInfos[component];
+	}
+
+
+	//-- Archetype Functions.
+	void Archetype::ChunkDeleter::operator()(std::byte* data) const
+	{
+		::operator delete(data, std::align_val_t{ s_CacheLineSize });
+	}
+
+	void Archetype::Init(const ComponentMask mask)
+	{
+		m_Mask = mask;
+		m_Offsets.fill(UINT32_MAX);
+
+		uint32_t rowSize = sizeof(Entity);
+		for (ComponentMask remaining = mask; remaining != 0; remaining &= remaining - 1)
+		{
+			const uint32_t component = static_cast<uint32_t>(std::countr_zero(remaining));
+			m_Components.push_back(component);
+			rowSize += ComponentRegistry::GetInfo(component).m_Size;
+		}
+
+		//-- Worst case, every array after the entities loses most of a cache line to alignment.
+		const uint32_t padding = static_cast<uint32_t>(m_Components.size()) * s_CacheLineSize;
+		m_Capacity = s_ChunkSize > padding ? (s_ChunkSize - padding) / rowSize : 0;
+		if (m_Capacity == 0)
+			throw std::runtime_error("Archetype components do not fit in a chunk!");
+
+		uint32_t offset = m_Capacity * static_cast<uint32_t>(sizeof(Entity));
+		for (const uint32_t component : m_Components)
+		{
+			offset = (offset + s_CacheLineSize - 1) & ~(s_CacheLineSize - 1);
+			m_Offsets[component] = offset;
+			offset += m_Capacity * ComponentRegistry::GetInfo(component).m_Size;
+		}
+	}
+
+	std::pair<uint32_t, uint32_t> Archetype::AddRow(const Entity entity)
+	{
+		if (m_Chunks.empty() || m_ChunkSizes.back() == m_Capacity)
+		{
+			m_Chunks.emplace_back(static_cast<std::byte*>(::operator new(s_ChunkSize, std::align_val_t{ s_CacheLineSize })));
+			m_ChunkSizes.push_back(0);
+		}
+
+		const uint32_t chunk = static_cast<uint32_t>(m_Chunks.size() - 1);
+		const uint32_t row = m_ChunkSizes[chunk]++;
+		reinterpret_cast<Entity*>(m_Chunks[chunk].get())[row] = entity;
+		++m_EntityCount;
+
+		return { chunk, row };
+	}
+
+	Entity Archetype::RemoveRow(const uint32_t chunk, const uint32_t row)
+	{
+		const uint32_t lastChunk = static_cast<uint32_t>(m_Chunks.size() - 1);
+		const uint32_t lastRow = m_ChunkSizes[lastChunk] - 1;
+
+		Entity moved;
+		if (chunk != lastChunk || row != lastRow)
+		{
+			for (const uint32_t component : m_Components)
+				memcpy(GetComponent(chunk, row, component), GetComponent(lastChunk, lastRow, component), ComponentRegistry::GetInfo(component).m_Size);
+
+			Entity* entities = reinterpret_cast<Entity*>(m_Chunks[chunk].get());
+			entities[row] = GetEntities(lastChunk)[lastRow];
+			moved = entities[row];
+		}
+
+		if (--m_ChunkSizes[lastChunk] == 0)
+		{
+			m_Chunks.pop_back();
+			m_ChunkSizes.pop_back();
+		}
+		--m_EntityCount;
+
+		return moved;
+	}
+
+	void* Archetype::GetComponent(const uint32_t chunk, const uint32_t row, const uint32_t component)
+	{
+		return m_Chunks[chunk].get() + m_Offsets[component] + static_cast<size_t>(row) * ComponentRegistry::GetInfo(component).m_Size;
+	}
+
+	const Entity* Archetype::GetEntities(const uint32_t chunk) const
+	{
+		return reinterpret_cast<const Entity*>(m_Chunks[chunk].get());
+	}
+
+	bool Archetype::HasComponent(const uint32_t component) const
+	{
+		return (m_Mask >> component) & 1;
+	}
+
+	ComponentMask Archetype::GetMask() const
+	{
+		return m_Mask;
+	}
+
+	const std::vector<uint32_t>& Archetype::GetComponents() const
+	{
+		return m_Components;
+	}
+
+	uint32_t Archetype::GetCapacity() const
+	{
+		return m_Capacity;
+	}
+
+	uint32_t Archetype::GetChunkCount() const
+	{
+		return static_cast<uint32_t>(m_Chunks.size());
+	}
+
+	uint32_t Archetype::GetChunkSize(const uint32_t chunk) const
+	{
+		return m_ChunkSizes[chunk];
+	}
+
+	uint32_t Archetype::GetEntityCount() const
+	{
+		return m_EntityCount;
+	}
+
+
+	//-- EntityWorld Functions.
+	Archetype& EntityWorld::GetOrCreateArchetype(const ComponentMask mask)
+	{
+		std::unique_ptr<Archetype>& archetype = m_ArchetypeMap[mask];
+		if (!archetype)
+		{
+			archetype = std::make_unique<Archetype>();
+			archetype->Init(mask);
+			m_Archetypes.push_back(archetype.get());
+		}
+
+		return *archetype;
+	}
+
+	EntityWorld::EntityRecord& EntityWorld::GetRecord(const Entity entity)
+	{
+		return const_cast<EntityRecord&>(std::as_const(*this).GetRecord(entity));
+	}
+
+	const EntityWorld::EntityRecord& EntityWorld::GetRecord(const Entity entity) const
+	{
+		if (!IsAlive(entity))
+			throw std::runtime_error("Entity is not alive!");
+
+		return m_Records[entity.m_Index];
+	}
+
+	Entity EntityWorld::AllocateEntity()
+	{
+		Entity entity;
+		if (!m_FreeIndices.empty())
+		{
+			entity.m_Index = m_FreeIndices.back();
+			m_FreeIndices.pop_back();
+		}
+		else
+		{
+			entity.m_Index = static_cast<uint32_t>(m_Records.size());
+			m_Records.emplace_back();
+		}
+
+		entity.m_Generation = m_Records[entity.m_Index].m_Generation;
+		++m_EntityCount;
+		return entity;
+	}
+
+	void EntityWorld::RemoveFromArchetype(const EntityRecord& record)
+	{
+		const Entity moved = record.m_Archetype->RemoveRow(record.m_Chunk, record.m_Row);
+		if (moved.m_Index == Entity::s_Invalid)
+			return;
+
+		m_Records[moved.m_Index].m_Chunk = record.m_Chunk;
+		m_Records[moved.m_Index].m_Row = record.m_Row;
+	}
+
+	void EntityWorld::MoveEntity(const Entity entity, const ComponentMask newMask)
+	{
+		EntityRecord& record = GetRecord(entity);
+		Archetype& from = *record.m_Archetype;
+		Archetype& to = GetOrCreateArchetype(newMask);
+
+		const auto [chunk, row] = to.AddRow(entity);
+		for (const uint32_t component : to.GetComponents())
+		{
+			if (from.HasComponent(component))
+				memcpy(to.GetComponent(chunk, row, component), from.GetComponent(record.m_Chunk, record.m_Row, component), ComponentRegistry::GetInfo(component).m_Size);
+		}
+
+		RemoveFromArchetype(record);
+		record.m_Archetype = &to;
+		record.m_Chunk = chunk;
+		record.m_Row = row;
+	}
+
+	void EntityWorld::DestroyEntity(const Entity entity)
+	{
+		EntityRecord& record = GetRecord(entity);
+		RemoveFromArchetype(record);
+
+		record.m_Archetype = nullptr;
+		++record.m_Generation;
+		m_FreeIndices.push_back(entity.m_Index);
+		--m_EntityCount;
+	}
+
+	bool EntityWorld::IsAlive(const Entity entity) const
+	{
+		return entity.m_Index < m_Records.size() && m_Records[entity.m_Index].m_Archetype != nullptr && m_Records[entity.m_Index].m_Generation == entity.m_Generation;
+	}
+
+	void EntityWorld::Clear()
+	{
+		// Records stay, with bumped generations, so old handles never match a new entity.
+		for (uint32_t index = 0; index < m_Records.size(); ++index)
+		{
+			if (m_Records[index].m_Archetype == nullptr)
+				continue;
+
+			m_Records[index].m_Archetype = nullptr;
+			++m_Records[index].m_Generation;
+			m_FreeIndices.push_back(index);
+		}
+
+		m_ArchetypeMap.clear();
+		m_Archetypes.clear();
+		m_EntityCount = 0;
+	}
+
+	uint32_t EntityWorld::GetEntityCount() const
+	{
+		return m_EntityCount;
+	}
+
+	uint32_t EntityWorld::GetArchetypeCount() const
+	{
+		return static_cast<uint32_t>(m_Archetypes.size());
+	}
+}
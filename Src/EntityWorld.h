@@ -0,0 +1,293 @@
+﻿/*!
+\file		EntityWorld.h
+\date		19/10/2026
+
+\author		Adrian Tan
+\email		t.xingkhiangadrian\@digipen.edu
+
+\brief		Contains definition of EntityWorld class.
+			Archetype based entity component storage: entities with the same set of
+			components share chunks of contiguous, cache line aligned component arrays.
+
+\copyright	All content © 2023 DigiPen (SINGAPORE) Corporation, all rights reserved.
+			Reproduction or disclosure of this file or its contents without the
+			prior written consent of DigiPen Institute of Technology is prohibited.
+__________________________________________________________________________________*/
+#pragma once
+
+#include "ThreadPool.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace Nya
+{
+	// One bit per component type.
+	using ComponentMask = uint64_t;
+
+	struct ComponentInfo
+	{
+		uint32_t m_Size = 0;
+		uint32_t m_Alignment = 0;
+	};
+
+	// Hands out component ids on first use. Components must be plain data: they are moved between
+	// chunks with memcpy and never destroyed.
+	class ComponentRegistry
+	{
+	public:
+		static constexpr uint32_t s_MaxComponents = 64;
+
+		static uint32_t Register(uint32_t size, uint32_t alignment);
+		static const ComponentInfo& GetInfo(uint32_t component);
+
+		template <typename T>
+		static uint32_t GetId()
+		{
+			static_assert(std::is_trivially_copyable_v<T> && std::is_trivially_destructible_v<T>, "Components must be plain data!");
+			static const uint32_t id = Register(sizeof(T), alignof(T));
+			return id;
+		}
+	};
+
+	// Mask of every component in Ts, const or not.
+	template <typename... Ts>
+	ComponentMask MakeComponentMask()
+	{
+		return (ComponentMask{ 0 } | ... | (ComponentMask{ 1 } << ComponentRegistry::GetId<std::remove_const_t<Ts>>()));
+	}
+
+	// Index and generation, so a handle to a destroyed entity is never mistaken for the one reusing its slot.
+	struct Entity
+	{
+		static constexpr uint32_t s_Invalid = UINT32_MAX;
+
+		uint32_t m_Index = s_Invalid;
+		uint32_t m_Generation = 0;
+
+		bool operator==(const Entity& other) const = default;
+	};
+
+	// Every entity with exactly one set of components. Entities live in fixed size chunks; a chunk holds an
+	// array of entity handles, then one array per component, each starting on its own cache line. Rows are
+	// kept dense, removing one moves the archetype's last row into the hole.
+	class Archetype
+	{
+		struct ChunkDeleter
+		{
+			void operator()(std::byte* data) const;
+		};
+
+		ComponentMask m_Mask = 0;
+		std::vector<uint32_t> m_Components;	// Ascending ids.
+		std::array<uint32_t, ComponentRegistry::s_MaxComponents> m_Offsets{};	// Byte offset of each component's array, by id.
+		uint32_t m_Capacity = 0;			// Rows per chunk.
+
+		std::vector<std::unique_ptr<std::byte[], ChunkDeleter>> m_Chunks;
+		std::vector<uint32_t> m_ChunkSizes;
+		uint32_t m_EntityCount = 0;
+
+	public:
+		static constexpr uint32_t s_ChunkSize = 16 * 1024;
+		static constexpr uint32_t s_CacheLineSize = 64;
+
+		void Init(ComponentMask mask);
+
+		// Appends a row for entity, components uninitialized. Returns its chunk and row.
+		std::pair<uint32_t, uint32_t> AddRow(Entity entity);
+		// Removes a row and returns the entity moved into it, or an invalid entity if it was the last row.
+		Entity RemoveRow(uint32_t chunk, uint32_t row);
+
+		void* GetComponent(uint32_t chunk, uint32_t row, uint32_t component);
+		const Entity* GetEntities(uint32_t chunk) const;
+
+		// T may be const, for read only access.
+		template <typename T>
+		T* GetArray(const uint32_t chunk)
+		{
+			return reinterpret_cast<T*>(m_Chunks[chunk].get() + m_Offsets[ComponentRegistry::GetId<std::remove_const_t<T>>()]);
+		}
+
+		bool HasComponent(uint32_t component) const;
+		ComponentMask GetMask() const;
+		const std::vector<uint32_t>& GetComponents() const;
+		uint32_t GetCapacity() const;
+		uint32_t GetChunkCount() const;
+		uint32_t GetChunkSize(uint32_t chunk) const;
+		uint32_t GetEntityCount() const;
+	};
+
+	// Creates and destroys entities, moves them between archetypes as components come and go, and runs
+	// queries that stream through the chunks of every archetype with the requested components.
+	class EntityWorld
+	{
+		struct EntityRecord
+		{
+			Archetype* m_Archetype = nullptr;
+			uint32_t m_Chunk = 0;
+			uint32_t m_Row = 0;
+			uint32_t m_Generation = 0;
+		};
+
+		std::unordered_map<ComponentMask, std::unique_ptr<Archetype>> m_ArchetypeMap;
+		std::vector<Archetype*> m_Archetypes;	// Creation order, so queries visit chunks in a fixed order.
+		std::vector<EntityRecord> m_Records;
+		std::vector<uint32_t> m_FreeIndices;
+		uint32_t m_EntityCount = 0;
+
+		Archetype& GetOrCreateArchetype(ComponentMask mask);
+		EntityRecord& GetRecord(Entity entity);
+		const EntityRecord& GetRecord(Entity entity) const;
+		Entity AllocateEntity();
+		void RemoveFromArchetype(const EntityRecord& record);
+		// Moves an entity to the archetype of newMask, copying the components both archetypes have.
+		void MoveEntity(Entity entity, ComponentMask newMask);
+
+	public:
+		template <typename... Ts>
+		Entity CreateEntity(const Ts&... components);
+		void DestroyEntity(Entity entity);
+		bool IsAlive(Entity entity) const;
+
+		// Adds the component, or overwrites it if the entity already has one.
+		template <typename T>
+		void AddComponent(Entity entity, const T& component);
+		template <typename T>
+		void RemoveComponent(Entity entity);
+		template <typename T>
+		bool HasComponent(Entity entity) const;
+		// Null if the entity has no such component. Valid until the entity's components change or an entity is destroyed.
+		template <typename T>
+		T* GetComponent(Entity entity);
+
+		// Calls function(const Entity* entities, uint32_t count, Ts*... components) once per chunk of every archetype
+		// with all of Ts. Declare a component const to only read it. Entities must not be created, destroyed or
+		// change components inside function.
+		template <typename... Ts, typename F>
+		void ForEachChunk(F&& function);
+		// Same, with chunks spread across the ThreadPool. Chunks never share rows, so only state outside the
+		// world needs synchronizing.
+		template <typename... Ts, typename F>
+		void ParallelForEachChunk(F&& function);
+
+		// Entities with all of Ts.
+		template <typename... Ts>
+		uint32_t Count() const;
+
+		void Clear();
+		uint32_t GetEntityCount() const;
+		uint32_t GetArchetypeCount() const;
+	};
+
+	template <typename... Ts>
+	Entity EntityWorld::CreateEntity(const Ts&... components)
+	{
+		const Entity entity = AllocateEntity();
+		Archetype& archetype = GetOrCreateArchetype(MakeComponentMask<Ts...>());
+		const auto [chunk, row] = archetype.AddRow(entity);
+		(new (archetype.GetComponent(chunk, row, ComponentRegistry::GetId<Ts>())) Ts(components), ...);
+
+		EntityRecord& record = m_Records[entity.m_Index];
+		record.m_Archetype = &archetype;
+		record.m_Chunk = chunk;
+		record.m_Row = row;
+		return entity;
+	}
+
+	template <typename T>
+	void EntityWorld::AddComponent(const Entity entity, const T& component)
+	{
+		const uint32_t id = ComponentRegistry::GetId<T>();
+		if (!GetRecord(entity).m_Archetype->HasComponent(id))
+			MoveEntity(entity, GetRecord(entity).m_Archetype->GetMask() | (ComponentMask{ 1 } << id));
+
+		const EntityRecord& record = GetRecord(entity);
+		new (record.m_Archetype->GetComponent(record.m_Chunk, record.m_Row, id)) T(component);
+	}
+
+	template <typename T>
+	void EntityWorld::RemoveComponent(const Entity entity)
+	{
+		const uint32_t id = ComponentRegistry::GetId<T>();
+		const Archetype* archetype = GetRecord(entity).m_Archetype;
+		if (archetype->HasComponent(id))
+			MoveEntity(entity, archetype->GetMask() & ~(ComponentMask{ 1 } << id));
+	}
+
+	template <typename T>
+	bool EntityWorld::HasComponent(const Entity entity) const
+	{
+		return GetRecord(entity).m_Archetype->HasComponent(ComponentRegistry::GetId<T>());
+	}
+
+	template <typename T>
+	T* EntityWorld::GetComponent(const Entity entity)
+	{
+		const uint32_t id = ComponentRegistry::GetId<std::remove_const_t<T>>();
+		const EntityRecord& record = GetRecord(entity);
+		if (!record.m_Archetype->HasComponent(id))
+			return nullptr;
+
+		return static_cast<T*>(record.m_Archetype->GetComponent(record.m_Chunk, record.m_Row, id));
+	}
+
+	template <typename... Ts, typename F>
+	void EntityWorld::ForEachChunk(F&& function)
+	{
+		const ComponentMask mask = MakeComponentMask<Ts...>();
+		for (Archetype* archetype : m_Archetypes)
+		{
+			if ((archetype->GetMask() & mask) != mask)
+				continue;
+
+			for (uint32_t chunk = 0; chunk < archetype->GetChunkCount(); ++chunk)
+				function(archetype->GetEntities(chunk), archetype->GetChunkSize(chunk), archetype->template GetArray<Ts>(chunk)...);
+		}
+	}
+
+	template <typename... Ts, typename F>
+	void EntityWorld::ParallelForEachChunk(F&& function)
+	{
+		const ComponentMask mask = MakeComponentMask<Ts...>();
+		std::vector<std::pair<Archetype*, uint32_t>> chunks;
+		for (Archetype* archetype : m_Archetypes)
+		{
+			if ((archetype->GetMask() & mask) != mask)
+				continue;
+
+			for (uint32_t chunk = 0; chunk < archetype->GetChunkCount(); ++chunk)
+				chunks.emplace_back(archetype, chunk);
+		}
+
+		ThreadPool::Get().ParallelFor(static_cast<uint32_t>(chunks.size()), 1, [&chunks, &function](const uint32_t begin, const uint32_t end)
+		{
+			for (uint32_t i = begin; i < end; ++i)
+			{
+				Archetype* archetype = chunks[i].first;
+				const uint32_t chunk = chunks[i].second;
+				function(archetype->GetEntities(chunk), archetype->GetChunkSize(chunk), archetype->template GetArray<Ts>(chunk)...);
+			}
+		});
+	}
+
+	template <typename... Ts>
+	uint32_t EntityWorld::Count() const
+	{
+		const ComponentMask mask = MakeComponentMask<Ts...>();
+		uint32_t count = 0;
+		for (const Archetype* archetype : m_Archetypes)
+		{
+			if ((archetype->GetMask() & mask) == mask)
+				count += archetype->GetEntityCount();
+		}
+
+		return count;
+	}
+}
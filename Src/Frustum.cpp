@@ -0,0 +1,63 @@
+﻿/*!
+\file		Frustum.cpp
+\date		19/10/2026
+
+\author		Adrian Tan
+\email		t.xingkhiangadrian\@digipen.edu
+
+\brief		Contains implementation for Frustum class functions.
+
+\copyright	All content © 2023 DigiPen (SINGAPORE) Corporation, all rights reserved.
+			Reproduction or disclosure of this file or its contents without the
+			prior written consent of DigiPen Institute of Technology is prohibited.
+__________________________________________________________________________________*/
+
+#include "meowpch.h"
+
+#include "Frustum.h"
+
+namespace Nya
+{
+	Frustum Frustum::FromMatrix(const glm::mat4& matrix)
+	{
+		// Gribb/Hartmann: each plane is a sum of the clip space w row and another row.
+		const glm::mat4 m = glm::transpose(matrix);
+
+		Frustum frustum;
+		frustum.m_Planes[Left] = m[3] + m[0];
+		frustum.m_Planes[Right] = m[3] - m[0];
+		frustum.m_Planes[Bottom] = m[3] + m[1];
+		frustum.m_Planes[Top] = m[3] - m[1];
+		frustum.m_Planes[Near] = m[2];			// z >= 0, Vulkan depth starts at 0 instead of -w.
+		frustum.m_Planes[Far] = m[3] - m[2];
+
+		for (glm::vec4& plane : frustum.m_Planes)
+			plane /= glm::length(glm::vec3(plane));
+
+		return frustum;
+	}
+
+	bool Frustum::IntersectsSphere(const glm::vec3& center, const float radius) const
+	{
+		for (const glm::vec4& plane : m_Planes)
+		{
+			if (glm::dot(glm::vec3(plane), center) + plane.w < -radius)
+				return false;
+		}
+
+		return true;
+	}
+
+	bool Frustum::IntersectsAabb(const glm::vec3& min, const glm::vec3& max) const
+	{
+		for (const glm::vec4& plane : m_Planes)
+		{
+			// Corner furthest along the plane normal.
+			const glm::vec3 positive(plane.x >= 0.f ? max.x : min.x, plane.y >= 0.f ? max.y : min.y, plane.z >= 0.f ? max.z : min.z);
+			if (glm::dot(glm::vec3(plane), positive) + plane.w < 0.f)
+				return false;
+		}
+
+		return true;
+	}
+}
@@ -0,0 +1,48 @@
+﻿/*!
+\file		Frustum.h
+\date		19/10/2026
+
+\author		Adrian Tan
+\email		t.xingkhiangadrian\@digipen.edu
+
+\brief		Contains definition of Frustum class.
+
+\copyright	All content © 2023 DigiPen (SINGAPORE) Corporation, all rights reserved.
+			Reproduction or disclosure of this file or its contents without the
+			prior written consent of DigiPen Institute of Technology is prohibited.
+__________________________________________________________________________________*/
+#pragma once
+
+#define GLM_FORCE_RADIANS
+#define GLM_FORCE_DEPTH_ZERO_TO_ONE
+#include <glm/glm.hpp>
+
+#include <array>
+
+namespace Nya
+{
+	// Six inward-facing planes (xyz normal, w distance), normalized so plane distances are in world units.
+	class Frustum
+	{
+	public:
+		enum Plane : uint32_t
+		{
+			Left,
+			Right,
+			Bottom,
+			Top,
+			Near,
+			Far,
+			PlaneCount
+		};
+
+		std::array<glm::vec4, PlaneCount> m_Planes{};
+
+		// Extracts the planes of a projection * view (* model) matrix, for Vulkan's 0..1 depth range.
+		// Passing proj * view * model gives the frustum in that model's object space.
+		static Frustum FromMatrix(const glm::mat4& matrix);
+
+		bool IntersectsSphere(const glm::vec3& center, float radius) const;
+		bool IntersectsAabb(const glm::vec3& min, const glm::vec3& max) const;
+	};
+}
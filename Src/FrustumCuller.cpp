@@ -0,0 +1,404 @@
+﻿/*!
+\file		FrustumCuller.cpp
+\date		19/10/2026
+
+\author		Adrian Tan
+\email		t.xingkhiangadrian\@digipen.edu
+
+\brief		Contains implementation for FrustumCuller class functions.
+
+\copyright	All content © 2023 DigiPen (SINGAPORE) Corporation, all rights reserved.
+			Reproduction or disclosure of this file or its contents without the
+			prior written consent of DigiPen Institute of Technology is prohibited.
+__________________________________________________________________________________*/
+
+#include "meowpch.h"
+
+#include "FrustumCuller.h"
+#include "Simd.h"
+
+#include <glm/gtc/matrix_transform.hpp>
+
+namespace Nya
+{
+	//-- SphereBoundsSoA Functions.
+	uint32_t SphereBoundsSoA::Add(const glm::vec3& center, const float radius)
+	{
+		m_CenterX.push_back(center.x);
+		m_CenterY.push_back(center.y);
+		m_CenterZ.push_back(center.z);
+		m_Radius.push_back(radius);
+		return GetCount() - 1;
+	}
+
+	void SphereBoundsSoA::Set(const uint32_t object, const glm::vec3& center, const float radius)
+	{
+		m_CenterX[object] = center.x;
+		m_CenterY[object] = center.y;
+		m_CenterZ[object] = center.z;
+		m_Radius[object] = radius;
+	}
+
+	void SphereBoundsSoA::Reserve(const size_t count)
+	{
+		m_CenterX.reserve(count);
+		m_CenterY.reserve(count);
+		m_CenterZ.reserve(count);
+		m_Radius.reserve(count);
+	}
+
+	void SphereBoundsSoA::Clear()
+	{
+		m_CenterX.clear();
+		m_CenterY.clear();
+		m_CenterZ.clear();
+		m_Radius.clear();
+	}
+
+	uint32_t SphereBoundsSoA::GetCount() const
+	{
+		return static_cast<uint32_t>(m_Radius.size());
+	}
+
+
+	//-- AabbBoundsSoA Functions.
+	uint32_t AabbBoundsSoA::Add(const glm::vec3& min, const glm::vec3& max)
+	{
+		const glm::vec3 center = (min + max) * 0.5f;
+		const glm::vec3 extent = (max - min) * 0.5f;
+		m_CenterX.push_back(center.x);
+		m_CenterY.push_back(center.y);
+		m_CenterZ.push_back(center.z);
+		m_ExtentX.push_back(extent.x);
+		m_ExtentY.push_back(extent.y);
+		m_ExtentZ.push_back(extent.z);
+		return GetCount() - 1;
+	}
+
+	void AabbBoundsSoA::Set(const uint32_t object, const glm::vec3& min, const glm::vec3& max)
+	{
+		const glm::vec3 center = (min + max) * 0.5f;
+		const glm::vec3 extent = (max - min) * 0.5f;
+		m_CenterX[object] = center.x;
+		m_CenterY[object] = center.y;
+		m_CenterZ[object] = center.z;
+		m_ExtentX[object] = extent.x;
+		m_ExtentY[object] = extent.y;
+		m_ExtentZ[object] = extent.z;
+	}
+
+	void AabbBoundsSoA::Reserve(const size_t count)
+	{
+		m_CenterX.reserve(count);
+		m_CenterY.reserve(count);
+		m_CenterZ.reserve(count);
+		m_ExtentX.reserve(count);
+		m_ExtentY.reserve(count);
+		m_ExtentZ.reserve(count);
+	}
+
+	void AabbBoundsSoA::Clear()
+	{
+		m_CenterX.clear();
+		m_CenterY.clear();
+		m_CenterZ.clear();
+		m_ExtentX.clear();
+		m_ExtentY.clear();
+		m_ExtentZ.clear();
+	}
+
+	uint32_t AabbBoundsSoA::GetCount() const
+	{
+		return static_cast<uint32_t>(m_ExtentX.size());
+	}
+
+
+	//-- Kernels.
+	namespace
+	{
+		// Bounds of one object, the scalar path and the SIMD tails share these.
+		bool SphereVisible(const Frustum& frustum, const float x, const float y, const float z, const float radius)
+		{
+			for (const glm::vec4& plane : frustum.m_Planes)
+			{
+				if (plane.x * x + plane.y * y + plane.z * z + plane.w < -radius)
+					return false;
+			}
+
+			return true;
+		}
+
+		bool AabbVisible(const Frustum& frustum, const float x, const float y, const float z, const float ex, const float ey, const float ez)
+		{
+			for (const glm::vec4& plane : frustum.m_Planes)
+			{
+				// Box extent projected on the plane normal.
+				const float radius = std::abs(plane.x) * ex + std::abs(plane.y) * ey + std::abs(plane.z) * ez;
+				if (plane.x * x + plane.y * y + plane.z * z + plane.w < -radius)
+					return false;
+			}
+
+			return true;
+		}
+
+		// Appends the set lanes of mask without branching, visible must have room for every lane.
+		uint32_t AppendVisible(uint32_t* visible, uint32_t written, const uint32_t object, const uint32_t mask, const uint32_t laneCount)
+		{
+			for (uint32_t lane = 0; lane < laneCount; ++lane)
+			{
+				visible[written] = object + lane;
+				written += (mask >> lane) & 1;
+			}
+
+			return written;
+		}
+
+#ifdef NYA_SIMD_SSE2
+		// Culls whole groups of 4 in [object, end), returns the first object not processed.
+		uint32_t CullSpheresSse(const SphereBoundsSoA& bounds, uint32_t object, const uint32_t end, const Frustum& frustum, uint32_t* visible, uint32_t& written)
+		{
+			__m128 planes[Frustum::PlaneCount][4];
+			for (uint32_t p = 0; p < Frustum::PlaneCount; ++p)
+			{
+				for (uint32_t c = 0; c < 4; ++c)
+					planes[p][c] = _mm_set1_ps(frustum.m_Planes[p][c]);
+			}
+
+			const __m128 zero = _mm_setzero_ps();
+			for (; object + 4 <= end; object += 4)
+			{
+				const __m128 x = _mm_loadu_ps(bounds.m_CenterX.data() + object);
+				const __m128 y = _mm_loadu_ps(bounds.m_CenterY.data() + object);
+				const __m128 z = _mm_loadu_ps(bounds.m_CenterZ.data() + object);
+				const __m128 negRadius = _mm_sub_ps(zero, _mm_loadu_ps(bounds.m_Radius.data() + object));
+
+				__m128 outside = zero;
+				for (const auto& plane : planes)
+				{
+					const __m128 distance = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(plane[0], x), _mm_mul_ps(plane[1], y)), _mm_mul_ps(plane[2], z)), plane[3]);
+					outside = _mm_or_ps(outside, _mm_cmplt_ps(distance, negRadius));
+				}
+
+				written = AppendVisible(visible, written, object, ~_mm_movemask_ps(outside) & 0xF, 4);
+			}
+
+			return object;
+		}
+
+		uint32_t CullAabbsSse(const AabbBoundsSoA& bounds, uint32_t object, const uint32_t end, const Frustum& frustum, uint32_t* visible, uint32_t& written)
+		{
+			__m128 planes[Frustum::PlaneCount][4];
+			__m128 absPlanes[Frustum::PlaneCount][3];
+			for (uint32_t p = 0; p < Frustum::PlaneCount; ++p)
+			{
+				for (uint32_t c = 0; c < 4; ++c)
+					planes[p][c] = _mm_set1_ps(frustum.m_Planes[p][c]);
+				for (uint32_t c = 0; c < 3; ++c)
+					absPlanes[p][c] = _mm_set1_ps(std::abs(frustum.m_Planes[p][c]));
+			}
+
+			const __m128 zero = _mm_setzero_ps();
+			for (; object + 4 <= end; object += 4)
+			{
+				const __m128 x = _mm_loadu_ps(bounds.m_CenterX.data() + object);
+				const __m128 y = _mm_loadu_ps(bounds.m_CenterY.data() + object);
+				const __m128 z = _mm_loadu_ps(bounds.m_CenterZ.data() + object);
+				const __m128 ex = _mm_loadu_ps(bounds.m_ExtentX.data() + object);
+				const __m128 ey = _mm_loadu_ps(bounds.m_ExtentY.data() + object);
+				const __m128 ez = _mm_loadu_ps(bounds.m_ExtentZ.data() + object);
+
+				__m128 outside = zero;
+				for (uint32_t p = 0; p < Frustum::PlaneCount; ++p)
+				{
+					const __m128 radius = _mm_add_ps(_mm_add_ps(_mm_mul_ps(absPlanes[p][0], ex), _mm_mul_ps(absPlanes[p][1], ey)), _mm_mul_ps(absPlanes[p][2], ez));
+					const __m128 distance = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(planes[p][0], x), _mm_mul_ps(planes[p][1], y)), _mm_mul_ps(planes[p][2], z)), planes[p][3]);
+					outside = _mm_or_ps(outside, _mm_cmplt_ps(distance, _mm_sub_ps(zero, radius)));
+				}
+
+				written = AppendVisible(visible, written, object, ~_mm_movemask_ps(outside) & 0xF, 4);
+			}
+
+			return object;
+		}
+#endif
+
+#ifdef NYA_SIMD_AVX2
+NYA_SIMD_BEGIN_AVX2
+		uint32_t CullSpheresAvx2(const SphereBoundsSoA& bounds, uint32_t object, const uint32_t end, const Frustum& frustum, uint32_t* visible, uint32_t& written)
+		{
+			__m256 planes[Frustum::PlaneCount][4];
+			for (uint32_t p = 0; p < Frustum::PlaneCount; ++p)
+			{
+				for (uint32_t c = 0; c < 4; ++c)
+					planes[p][c] = _mm256_set1_ps(frustum.m_Planes[p][c]);
+			}
+
+			const __m256 zero = _mm256_setzero_ps();
+			for (; object + 8 <= end; object += 8)
+			{
+				const __m256 x = _mm256_loadu_ps(bounds.m_CenterX.data() + object);
+				const __m256 y = _mm256_loadu_ps(bounds.m_CenterY.data() + object);
+				const __m256 z = _mm256_loadu_ps(bounds.m_CenterZ.data() + object);
+				const __m256 negRadius = _mm256_sub_ps(zero, _mm256_loadu_ps(bounds.m_Radius.data() + object));
+
+				__m256 outside = zero;
+				for (const auto& plane : planes)
+				{
+					const __m256 distance = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(plane[0], x), _mm256_mul_ps(plane[1], y)), _mm256_mul_ps(plane[2], z)), plane[3]);
+					outside = _mm256_or_ps(outside, _mm256_cmp_ps(distance, negRadius, _CMP_LT_OQ));
+				}
+
+				written = AppendVisible(visible, written, object, ~_mm256_movemask_ps(outside) & 0xFF, 8);
+			}
+
+			return object;
+		}
+
+		uint32_t CullAabbsAvx2(const AabbBoundsSoA& bounds, uint32_t object, const uint32_t end, const Frustum& frustum, uint32_t* visible, uint32_t& written)
+		{
+			__m256 planes[Frustum::PlaneCount][4];
+			__m256 absPlanes[Frustum::PlaneCount][3];
+			for (uint32_t p = 0; p < Frustum::PlaneCount; ++p)
+			{
+				for (uint32_t c = 0; c < 4; ++c)
+					planes[p][c] = _mm256_set1_ps(frustum.m_Planes[p][c]);
+				for (uint32_t c = 0; c < 3; ++c)
+					absPlanes[p][c] = _mm256_set1_ps(std::abs(frustum.m_Planes[p][c]));
+			}
+
+			const __m256 zero = _mm256_setzero_ps();
+			for (; object + 8 <= end; object += 8)
+			{
+				const __m256 x = _mm256_loadu_ps(bounds.m_CenterX.data() + object);
+				const __m256 y = _mm256_loadu_ps(bounds.m_CenterY.data() + object);
+				const __m256 z = _mm256_loadu_ps(bounds.m_CenterZ.data() + object);
+				const __m256 ex = _mm256_loadu_ps(bounds.m_ExtentX.data() + object);
+				const __m256 ey = _mm256_loadu_ps(bounds.m_ExtentY.data() + object);
+				const __m256 ez = _mm256_loadu_ps(bounds.m_ExtentZ.data() + object);
+
+				__m256 outside = zero;
+				for (uint32_t p = 0; p < Frustum::PlaneCount; ++p)
+				{
+					const __m256 radius = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(absPlanes[p][0], ex), _mm256_mul_ps(absPlanes[p][1], ey)), _mm256_mul_ps(absPlanes[p][2], ez));
+					const __m256 distance = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(planes[p][0], x), _mm256_mul_ps(planes[p][1], y)), _mm256_mul_ps(planes[p][2], z)), planes[p][3]);
+					outside = _mm256_or_ps(outside, _mm256_cmp_ps(distance, _mm256_sub_ps(zero, radius), _CMP_LT_OQ));
+				}
+
+				written = AppendVisible(visible, written, object, ~_mm256_movemask_ps(outside) & 0xFF, 8);
+			}
+
+			return object;
+		}
+NYA_SIMD_END
+#endif
+	}
+
+
+	//-- FrustumCuller Functions.
+	uint32_t FrustumCuller::CullSpheres(const SphereBoundsSoA& bounds, uint32_t first, const uint32_t count, const Frustum& frustum, uint32_t* visible, const SimdPath path)
+	{
+		const uint32_t end = first + count;
+		uint32_t written = 0;
+
+		// Paths the CPU lacks fall through to the next narrower one.
+#ifdef NYA_SIMD_AVX2
+		if (path == SimdPath::Avx2 && GetSimdFeatures().m_Avx2)
+			first = CullSpheresAvx2(bounds, first, end, frustum, visible, written);
+#endif
+#ifdef NYA_SIMD_SSE2
+		if (path != SimdPath::Scalar)
+			first = CullSpheresSse(bounds, first, end, frustum, visible, written);
+#endif
+
+		for (uint32_t object = first; object < end; ++object)
+		{
+			visible[written] = object;
+			written += SphereVisible(frustum, bounds.m_CenterX[object], bounds.m_CenterY[object], bounds.m_CenterZ[object], bounds.m_Radius[object]);
+		}
+
+		return written;
+	}
+
+	uint32_t FrustumCuller::CullAabbs(const AabbBoundsSoA& bounds, uint32_t first, const uint32_t count, const Frustum& frustum, uint32_t* visible, const SimdPath path)
+	{
+		const uint32_t end = first + count;
+		uint32_t written = 0;
+
+#ifdef NYA_SIMD_AVX2
+		if (path == SimdPath::Avx2 && GetSimdFeatures().m_Avx2)
+			first = CullAabbsAvx2(bounds, first, end, frustum, visible, written);
+#endif
+#ifdef NYA_SIMD_SSE2
+		if (path != SimdPath::Scalar)
+			first = CullAabbsSse(bounds, first, end, frustum, visible, written);
+#endif
+
+		for (uint32_t object = first; object < end; ++object)
+		{
+			visible[written] = object;
+			written += AabbVisible(frustum, bounds.m_CenterX[object], bounds.m_CenterY[object], bounds.m_CenterZ[object],
+				bounds.m_ExtentX[object], bounds.m_ExtentY[object], bounds.m_ExtentZ[object]);
+		}
+
+		return written;
+	}
+
+	void FrustumCuller::CullSpheres(const SphereBoundsSoA& bounds, const Frustum& frustum, std::vector<uint32_t>& visible, const SimdPath path)
+	{
+		visible.resize(bounds.GetCount());
+		visible.resize(CullSpheres(bounds, 0, bounds.GetCount(), frustum, visible.data(), path));
+	}
+
+	void FrustumCuller::CullAabbs(const AabbBoundsSoA& bounds, const Frustum& frustum, std::vector<uint32_t>& visible, const SimdPath path)
+	{
+		visible.resize(bounds.GetCount());
+		visible.resize(CullAabbs(bounds, 0, bounds.GetCount(), frustum, visible.data(), path));
+	}
+
+	void FrustumCuller::BenchmarkCull(const uint32_t objectCount, const uint32_t iterations)
+	{
+		//-- Objects scattered around a camera at the origin looking down -z.
+		std::mt19937 random(1337);
+		std::uniform_real_distribution<float> positions(-500.f, 500.f), sizes(0.5f, 5.f);
+
+		SphereBoundsSoA spheres;
+		AabbBoundsSoA aabbs;
+		spheres.Reserve(objectCount);
+		aabbs.Reserve(objectCount);
+		for (uint32_t i = 0; i < objectCount; ++i)
+		{
+			const glm::vec3 center(positions(random), positions(random), positions(random));
+			const float size = sizes(random);
+			spheres.Add(center, size);
+			aabbs.Add(center - size, center + size);
+		}
+
+		const glm::mat4 proj = glm::perspective(glm::radians(60.f), 16.f / 9.f, 0.1f, 1000.f);
+		const glm::mat4 view = glm::lookAt(glm::vec3(0.f), glm::vec3(0.f, 0.f, -1.f), glm::vec3(0.f, 1.f, 0.f));
+		const Frustum frustum = Frustum::FromMatrix(proj * view);
+
+		std::vector<uint32_t> visible;
+		constexpr std::array paths = { SimdPath::Scalar, SimdPath::Sse, SimdPath::Avx2 };
+		constexpr std::array pathNames = { "scalar", "sse", "avx2" };
+		for (uint32_t p = 0; p <= static_cast<uint32_t>(GetBestSimdPath()); ++p)
+		{
+			float sphereMs = 0.f;
+			float aabbMs = 0.f;
+			for (uint32_t iteration = 0; iteration < iterations; ++iteration)
+			{
+				auto startTime = std::chrono::high_resolution_clock::now();
+				CullSpheres(spheres, frustum, visible, paths[p]);
+				auto endTime = std::chrono::high_resolution_clock::now();
+				sphereMs += std::chrono::duration<float, std::chrono::milliseconds::period>(endTime - startTime).count();
+
+				startTime = std::chrono::high_resolution_clock::now();
+				CullAabbs(aabbs, frustum, visible, paths[p]);
+				endTime = std::chrono::high_resolution_clock::now();
+				aabbMs += std::chrono::duration<float, std::chrono::milliseconds::period>(endTime - startTime).count();
+			}
+
+			std::cout << "\t" << "Frustum cull of " << objectCount << " objects (" << pathNames[p] << "): spheres " << sphereMs / iterations
+				<< "ms, aabbs " << aabbMs / iterations << "ms, " << visible.size() << " visible" << std::endl;
+		}
+	}
+}
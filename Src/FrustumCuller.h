@@ -0,0 +1,74 @@
+﻿/*!
+\file		FrustumCuller.h
+\date		19/10/2026
+
+\author		Adrian Tan
+\email		t.xingkhiangadrian\@digipen.edu
+
+\brief		Contains definition of FrustumCuller class.
+
+\copyright	All content © 2023 DigiPen (SINGAPORE) Corporation, all rights reserved.
+			Reproduction or disclosure of this file or its contents without the
+			prior written consent of DigiPen Institute of Technology is prohibited.
+__________________________________________________________________________________*/
+#pragma once
+
+#include "Frustum.h"
+#include "Simd.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace Nya
+{
+	// Bounding spheres as structure of arrays, so SIMD kernels load 4 or 8 objects per register.
+	// An object's id is its index.
+	struct SphereBoundsSoA
+	{
+		std::vector<float> m_CenterX;
+		std::vector<float> m_CenterY;
+		std::vector<float> m_CenterZ;
+		std::vector<float> m_Radius;
+
+		uint32_t Add(const glm::vec3& center, float radius);
+		void Set(uint32_t object, const glm::vec3& center, float radius);
+		void Reserve(size_t count);
+		void Clear();
+		uint32_t GetCount() const;
+	};
+
+	// Axis aligned boxes as center and half extents, structure of arrays.
+	struct AabbBoundsSoA
+	{
+		std::vector<float> m_CenterX;
+		std::vector<float> m_CenterY;
+		std::vector<float> m_CenterZ;
+		std::vector<float> m_ExtentX;
+		std::vector<float> m_ExtentY;
+		std::vector<float> m_ExtentZ;
+
+		uint32_t Add(const glm::vec3& min, const glm::vec3& max);
+		void Set(uint32_t object, const glm::vec3& min, const glm::vec3& max);
+		void Reserve(size_t count);
+		void Clear();
+		uint32_t GetCount() const;
+	};
+
+	// Tests SoA bounds against the six frustum planes and writes the ids of visible objects, in order.
+	// Every path gives the same result as Frustum::IntersectsSphere, and as Frustum::IntersectsAabb up to float rounding.
+	class FrustumCuller
+	{
+	public:
+		// Culls objects [first, first + count) into visible, which must hold count ids. Returns the number written.
+		// Disjoint ranges can be culled on separate threads.
+		static uint32_t CullSpheres(const SphereBoundsSoA& bounds, uint32_t first, uint32_t count, const Frustum& frustum, uint32_t* visible, SimdPath path = GetBestSimdPath());
+		static uint32_t CullAabbs(const AabbBoundsSoA& bounds, uint32_t first, uint32_t count, const Frustum& frustum, uint32_t* visible, SimdPath path = GetBestSimdPath());
+
+		// Culls every object, replacing the contents of visible with the ids of visible ones.
+		static void CullSpheres(const SphereBoundsSoA& bounds, const Frustum& frustum, std::vector<uint32_t>& visible, SimdPath path = GetBestSimdPath());
+		static void CullAabbs(const AabbBoundsSoA& bounds, const Frustum& frustum, std::vector<uint32_t>& visible, SimdPath path = GetBestSimdPath());
+
+		// Times every path the CPU runs on objectCount random objects and prints the result. Needs no GPU.
+		static void BenchmarkCull(uint32_t objectCount, uint32_t iterations = 16);
+	};
+}
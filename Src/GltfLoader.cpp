@@ -0,0 +1,644 @@
+﻿/*!
+\file		GltfLoader.cpp
+\date		19/10/2026
+
+\author		Adrian Tan
+\email		t.xingkhiangadrian\@digipen.edu
+
+\brief		Contains implementation for GltfLoader class functions.
+
+\copyright	All content © 2023 DigiPen (SINGAPORE) Corporation, all rights reserved.
+			Reproduction or disclosure of this file or its contents without the
+			prior written consent of DigiPen Institute of Technology is prohibited.
+__________________________________________________________________________________*/
+
+#include "meowpch.h"
+
+#include "GltfLoader.h"
+#include "Json.h"
+
+#include <glm/gtc/type_ptr.hpp>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <Windows.h>
+#include <Psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+namespace Nya
+{
+	//-- Helpers.
+	namespace
+	{
+		constexpr uint32_t s_GlbMagic = 0x46546C67;		// "glTF"
+		constexpr uint32_t s_GlbChunkJson = 0x4E4F534A;	// "JSON"
+		constexpr uint32_t s_GlbChunkBin = 0x004E4942;	// "BIN\0"
+
+		uint32_t ReadU32(const uint8_t* data)
+		{
+			uint32_t value;
+			memcpy(&value, data, sizeof(value));
+			return value;
+		}
+
+		uint32_t ComponentCountFromType(const std::string& type)
+		{
+			if (type == "SCALAR") return 1;
+			if (type == "VEC2") return 2;
+			if (type == "VEC3") return 3;
+			if (type == "VEC4") return 4;
+			if (type == "MAT2") return 4;
+			if (type == "MAT3") return 9;
+			if (type == "MAT4") return 16;
+
+			throw std::runtime_error("Unknown glTF accessor type [" + type + "]!");
+		}
+
+		glm::vec3 ReadVec3(const JsonValue& json, const glm::vec3& defaultValue)
+		{
+			if (json.Size() < 3)
+				return defaultValue;
+
+			return { json[0].AsFloat(), json[1].AsFloat(), json[2].AsFloat() };
+		}
+
+		int ReadTextureIndex(const JsonValue& textureInfo)
+		{
+			return textureInfo["index"].AsCheckedIndex("textureInfo.index");
+		}
+
+		// Overflow safe, offset + length could wrap around.
+		bool InRange(const size_t offset, const size_t length, const size_t size)
+		{
+			return offset <= size && length <= size - offset;
+		}
+
+		void ParseBuffers(GltfScene& scene, const JsonValue& json, const uint8_t* binChunk, const size_t binChunkSize, const std::filesystem::path& directory)
+		{
+			for (const auto& bufferJson : json["buffers"].AsArray())
+			{
+				GltfBuffer buffer;
+				buffer.m_ByteLength = bufferJson["byteLength"].AsCheckedSize("buffer.byteLength");
+
+				if (!bufferJson.Contains("uri"))
+				{
+					// GLB-stored buffer, lives in the BIN chunk.
+					if (binChunk == nullptr || buffer.m_ByteLength > binChunkSize)
+						throw std::runtime_error("glTF buffer references a missing or too small BIN chunk!");
+					buffer.m_Data = binChunk;
+				}
+				else
+				{
+					const std::string& uri = bufferJson["uri"].AsString();
+					if (uri.starts_with("data:"))
+						throw std::runtime_error("glTF data URIs are not supported, re-export as .glb!");
+
+					// External buffer, mapped the same way as the .glb itself.
+					MappedFile& file = scene.m_Files.emplace_back((directory / uri).string());
+					if (buffer.m_ByteLength > file.GetSize())
+						throw std::runtime_error("glTF buffer [" + uri + "] is smaller than its byteLength!");
+					buffer.m_Data = file.GetData();
+				}
+
+				scene.m_Buffers.push_back(buffer);
+			}
+		}
+
+		void ParseBufferViews(GltfScene& scene, const JsonValue& json)
+		{
+			for (const auto& viewJson : json["bufferViews"].AsArray())
+			{
+				GltfBufferView view;
+				view.m_Buffer = viewJson["buffer"].AsCheckedUInt("bufferView.buffer");
+				view.m_ByteOffset = viewJson["byteOffset"].AsCheckedSize("bufferView.byteOffset", 0);
+				view.m_ByteLength = viewJson["byteLength"].AsCheckedSize("bufferView.byteLength");
+				view.m_ByteStride = viewJson["byteStride"].AsCheckedUInt("bufferView.byteStride", 0);
+				view.m_Target = viewJson["target"].AsCheckedUInt("bufferView.target", 0);
+
+				if (view.m_Buffer >= scene.m_Buffers.size() || !InRange(view.m_ByteOffset, view.m_ByteLength, scene.m_Buffers[view.m_Buffer].m_ByteLength))
+					throw std::runtime_error("glTF buffer view is out of range of its buffer!");
+				// The spec's limit, which also keeps accessor extents from overflowing.
+				if (view.m_ByteStride > 252)
+					throw std::runtime_error("glTF buffer view stride is larger than 252 bytes!");
+
+				scene.m_BufferViews.push_back(view);
+			}
+		}
+
+		void ParseAccessors(GltfScene& scene, const JsonValue& json)
+		{
+			for (const auto& accessorJson : json["accessors"].AsArray())
+			{
+				if (accessorJson.Contains("sparse"))
+					throw std::runtime_error("Sparse glTF accessors are not supported!");
+
+				// Accessors without a buffer view are all zeros, which nothing here reads, so the view is required.
+				if (!accessorJson.Contains("bufferView"))
+					throw std::runtime_error("glTF accessors without a buffer view are not supported!");
+
+				GltfAccessor accessor;
+				accessor.m_BufferView = accessorJson["bufferView"].AsCheckedIndex("accessor.bufferView");
+				accessor.m_ByteOffset = accessorJson["byteOffset"].AsCheckedSize("accessor.byteOffset", 0);
+				accessor.m_ComponentType = static_cast<GltfComponentType>(accessorJson["componentType"].AsCheckedUInt("accessor.componentType"));
+				accessor.m_Normalized = accessorJson["normalized"].AsBool();
+				accessor.m_Count = accessorJson["count"].AsCheckedUInt("accessor.count");
+				accessor.m_ComponentCount = ComponentCountFromType(accessorJson["type"].AsString());
+
+				// Throws for unknown component types.
+				accessor.GetComponentSize();
+				if (static_cast<size_t>(accessor.m_BufferView) >= scene.m_BufferViews.size())
+					throw std::runtime_error("glTF accessor references a missing buffer view!");
+
+				if (accessorJson["min"].Size() >= 3 && accessorJson["max"].Size() >= 3)
+				{
+					accessor.m_HasBounds = true;
+					accessor.m_Min = ReadVec3(accessorJson["min"], glm::vec3(0.f));
+					accessor.m_Max = ReadVec3(accessorJson["max"], glm::vec3(0.f));
+				}
+
+				scene.m_Accessors.push_back(accessor);
+			}
+		}
+
+		void ParseMeshes(GltfScene& scene, const JsonValue& json)
+		{
+			for (const auto& meshJson : json["meshes"].AsArray())
+			{
+				GltfMesh mesh;
+				mesh.m_Name = meshJson["name"].AsString();
+
+				for (const auto& primitiveJson : meshJson["primitives"].AsArray())
+				{
+					GltfPrimitive primitive;
+					for (const auto& [semantic, accessor] : primitiveJson["attributes"].AsObject())
+						primitive.m_Attributes.emplace_back(semantic, accessor.AsCheckedIndex("primitive.attributes." + semantic));
+
+					primitive.m_Indices = primitiveJson["indices"].AsCheckedIndex("primitive.indices");
+					primitive.m_Material = primitiveJson["material"].AsCheckedIndex("primitive.material");
+					primitive.m_Mode = primitiveJson["mode"].AsCheckedUInt("primitive.mode", g_GltfModeTriangles);
+
+					mesh.m_Primitives.push_back(std::move(primitive));
+				}
+
+				scene.m_Meshes.push_back(std::move(mesh));
+			}
+		}
+
+		// Later passes (vertex cache and overdraw optimization, meshlets, LODs) index vertex data unchecked,
+		// so every attribute must fit in its buffer view and hold one element per POSITION, and every index
+		// must address a POSITION element.
+		void ValidateMeshes(const GltfScene& scene)
+		{
+			const auto isAccessor = [&scene](const int accessor) { return accessor >= 0 && static_cast<size_t>(accessor) < scene.m_Accessors.size(); };
+
+			for (const GltfMesh& mesh : scene.m_Meshes)
+			{
+				for (const GltfPrimitive& primitive : mesh.m_Primitives)
+				{
+					const int position = primitive.FindAttribute("POSITION");
+					for (const auto& [semantic, accessor] : primitive.m_Attributes)
+					{
+						if (!isAccessor(accessor))
+							throw std::runtime_error("glTF attribute [" + semantic + "] references a missing accessor!");
+
+						// Throws if the accessor reads past its buffer view.
+						scene.GetAccessorView(accessor);
+						if (isAccessor(position) && scene.m_Accessors[accessor].m_Count != scene.m_Accessors[position].m_Count)
+							throw std::runtime_error("glTF attribute [" + semantic + "] count differs from the POSITION count!");
+					}
+
+					if (primitive.m_Indices < 0)
+						continue;
+					if (!isAccessor(primitive.m_Indices) || position < 0)
+						throw std::runtime_error("Indexed glTF primitive has a missing index accessor or no POSITION attribute!");
+
+					const GltfAccessorView indices = scene.GetAccessorView(primitive.m_Indices);
+					const auto findMaxIndex = [&indices]<typename T>()
+					{
+						uint32_t maxIndex = 0;
+						for (uint32_t i = 0; i < indices.m_Count; ++i)
+						{
+							T index;
+							memcpy(&index, indices[i], sizeof(index));
+							maxIndex = std::max<uint32_t>(maxIndex, index);
+						}
+						return maxIndex;
+					};
+
+					uint32_t maxIndex = 0;
+					switch (scene.m_Accessors[primitive.m_Indices].m_ComponentType)
+					{
+					case GltfComponentType::UnsignedByte:
+						maxIndex = findMaxIndex.operator()<uint8_t>();
+						break;
+					case GltfComponentType::UnsignedShort:
+						maxIndex = findMaxIndex.operator()<uint16_t>();
+						break;
+					case GltfComponentType::UnsignedInt:
+						maxIndex = findMaxIndex.operator()<uint32_t>();
+						break;
+					default:
+						throw std::runtime_error("Invalid glTF index component type!");
+					}
+
+					const uint32_t vertexCount = scene.m_Accessors[position].m_Count;
+					if (indices.m_Count > 0 && maxIndex >= vertexCount)
+						throw std::runtime_error("glTF index " + std::to_string(maxIndex) + " is out of range of its " + std::to_string(vertexCount) + " vertices!");
+				}
+			}
+		}
+
+		void ParseMaterials(GltfScene& scene, const JsonValue& json)
+		{
+			for (const auto& materialJson : json["materials"].AsArray())
+			{
+				GltfMaterial material;
+				material.m_Name = materialJson["name"].AsString();
+
+				const JsonValue& pbr = materialJson["pbrMetallicRoughness"];
+				if (const JsonValue& factor = pbr["baseColorFactor"]; factor.Size() >= 4)
+					material.m_BaseColorFactor = { factor[0].AsFloat(), factor[1].AsFloat(), factor[2].AsFloat(), factor[3].AsFloat() };
+				material.m_BaseColorTexture = ReadTextureIndex(pbr["baseColorTexture"]);
+				material.m_MetallicFactor = pbr["metallicFactor"].AsFloat(1.f);
+				material.m_RoughnessFactor = pbr["roughnessFactor"].AsFloat(1.f);
+				material.m_MetallicRoughnessTexture = ReadTextureIndex(pbr["metallicRoughnessTexture"]);
+
+				material.m_NormalTexture = ReadTextureIndex(materialJson["normalTexture"]);
+				material.m_OcclusionTexture = ReadTextureIndex(materialJson["occlusionTexture"]);
+				material.m_EmissiveTexture = ReadTextureIndex(materialJson["emissiveTexture"]);
+				material.m_EmissiveFactor = ReadVec3(materialJson["emissiveFactor"], glm::vec3(0.f));
+
+				if (materialJson.Contains("alphaMode"))
+					material.m_AlphaMode = materialJson["alphaMode"].AsString();
+				material.m_AlphaCutoff = materialJson["alphaCutoff"].AsFloat(0.5f);
+				material.m_DoubleSided = materialJson["doubleSided"].AsBool();
+
+				scene.m_Materials.push_back(std::move(material));
+			}
+		}
+
+		void ParseTexturesAndImages(GltfScene& scene, const JsonValue& json)
+		{
+			for (const auto& textureJson : json["textures"].AsArray())
+			{
+				GltfTexture texture;
+				texture.m_Image = textureJson["source"].AsCheckedIndex("texture.source");
+				texture.m_Sampler = textureJson["sampler"].AsCheckedIndex("texture.sampler");
+				scene.m_Textures.push_back(texture);
+			}
+
+			for (const auto& imageJson : json["images"].AsArray())
+			{
+				GltfImage image;
+				image.m_Uri = imageJson["uri"].AsString();
+				image.m_BufferView = imageJson["bufferView"].AsCheckedIndex("image.bufferView");
+				image.m_MimeType = imageJson["mimeType"].AsString();
+				scene.m_Images.push_back(std::move(image));
+			}
+		}
+
+		void ParseNodes(GltfScene& scene, const JsonValue& json)
+		{
+			for (const auto& nodeJson : json["nodes"].AsArray())
+			{
+				GltfNode node;
+				node.m_Name = nodeJson["name"].AsString();
+				node.m_Mesh = nodeJson["mesh"].AsCheckedIndex("node.mesh");
+				if (node.m_Mesh >= static_cast<int>(scene.m_Meshes.size()))
+					throw std::runtime_error("glTF node references a missing mesh!");
+				for (const auto& child : nodeJson["children"].AsArray())
+					node.m_Children.push_back(child.AsCheckedIndex("node.children"));
+
+				if (const JsonValue& matrix = nodeJson["matrix"]; matrix.Size() == 16)
+				{
+					// Column-major, same as glm.
+					float values[16];
+					for (size_t i = 0; i < 16; ++i)
+						values[i] = matrix[i].AsFloat();
+					node.m_LocalMatrix = glm::make_mat4(values);
+				}
+				else
+				{
+					node.m_Translation = ReadVec3(nodeJson["translation"], glm::vec3(0.f));
+					node.m_Scale = ReadVec3(nodeJson["scale"], glm::vec3(1.f));
+					// glTF stores quaternions as xyzw, glm constructs as wxyz.
+					if (const JsonValue& rotation = nodeJson["rotation"]; rotation.Size() == 4)
+						node.m_Rotation = glm::quat(rotation[3].AsFloat(), rotation[0].AsFloat(), rotation[1].AsFloat(), rotation[2].AsFloat());
+
+					node.m_LocalMatrix = glm::translate(glm::mat4(1.f), node.m_Translation) * glm::mat4_cast(node.m_Rotation) * glm::scale(glm::mat4(1.f), node.m_Scale);
+				}
+
+				scene.m_Nodes.push_back(std::move(node));
+			}
+
+			// Link parents. The hierarchy must be a forest: with one parent per node and parentless roots, a cycle
+			// can never be reached from a root, so the traversal below terminates.
+			for (size_t i = 0; i < scene.m_Nodes.size(); ++i)
+			{
+				for (const int child : scene.m_Nodes[i].m_Children)
+				{
+					if (static_cast<size_t>(child) >= scene.m_Nodes.size())
+						throw std::runtime_error("glTF node references a missing child!");
+					if (scene.m_Nodes[child].m_Parent >= 0)
+						throw std::runtime_error("glTF node " + std::to_string(child) + " has more than one parent!");
+					scene.m_Nodes[child].m_Parent = static_cast<int>(i);
+				}
+			}
+
+			// Roots come from the default scene, or are every parentless node if there isn't one.
+			const JsonValue& scenes = json["scenes"];
+			if (scenes.Size() > 0)
+			{
+				const size_t sceneIndex = json["scene"].AsCheckedSize("scene", 0);
+				if (sceneIndex >= scenes.Size())
+					throw std::runtime_error("glTF default scene is out of range!");
+
+				for (const auto& rootJson : scenes[sceneIndex]["nodes"].AsArray())
+				{
+					const int root = rootJson.AsCheckedIndex("scene.nodes");
+					if (root < 0 || static_cast<size_t>(root) >= scene.m_Nodes.size())
+						throw std::runtime_error("glTF scene references a missing node!");
+					if (scene.m_Nodes[root].m_Parent >= 0)
+						throw std::runtime_error("glTF scene root node " + std::to_string(root) + " has a parent!");
+					scene.m_RootNodes.push_back(root);
+				}
+			}
+			else
+			{
+				for (size_t i = 0; i < scene.m_Nodes.size(); ++i)
+				{
+					if (scene.m_Nodes[i].m_Parent < 0)
+						scene.m_RootNodes.push_back(static_cast<int>(i));
+				}
+			}
+
+			// Propagate world transforms, parents before children.
+			std::vector<int> stack(scene.m_RootNodes.rbegin(), scene.m_RootNodes.rend());
+			while (!stack.empty())
+			{
+				GltfNode& node = scene.m_Nodes[stack.back()];
+				stack.pop_back();
+
+				node.m_WorldMatrix = node.m_Parent >= 0 ? scene.m_Nodes[node.m_Parent].m_WorldMatrix * node.m_LocalMatrix : node.m_LocalMatrix;
+				stack.insert(stack.end(), node.m_Children.rbegin(), node.m_Children.rend());
+			}
+		}
+	}
+
+
+	//-- GltfAccessor Functions.
+	uint32_t GltfAccessor::GetComponentSize() const
+	{
+		switch (m_ComponentType)
+		{
+		case GltfComponentType::Byte:
+		case GltfComponentType::UnsignedByte:
+			return 1;
+		case GltfComponentType::Short:
+		case GltfComponentType::UnsignedShort:
+			return 2;
+		case GltfComponentType::UnsignedInt:
+		case GltfComponentType::Float:
+			return 4;
+		}
+
+		throw std::runtime_error("Unknown glTF component type!");
+	}
+
+	uint32_t GltfAccessor::GetElementSize() const
+	{
+		return GetComponentSize() * m_ComponentCount;
+	}
+
+
+	//-- GltfPrimitive Functions.
+	int GltfPrimitive::FindAttribute(const std::string_view semantic) const
+	{
+		for (const auto& [name, accessor] : m_Attributes)
+		{
+			if (name == semantic)
+				return accessor;
+		}
+
+		return -1;
+	}
+
+
+	//-- GltfScene Functions.
+	GltfAccessorView GltfScene::GetAccessorView(const int accessorIndex) const
+	{
+		const GltfAccessor& accessor = m_Accessors.at(accessorIndex);
+		if (accessor.m_BufferView < 0)
+			throw std::runtime_error("glTF accessor without a buffer view is not supported!");
+
+		const GltfBufferView& view = m_BufferViews.at(accessor.m_BufferView);
+
+		GltfAccessorView accessorView;
+		accessorView.m_ElementSize = accessor.GetElementSize();
+		accessorView.m_Stride = view.m_ByteStride != 0 ? view.m_ByteStride : accessorView.m_ElementSize;
+		accessorView.m_Count = accessor.m_Count;
+
+		// Last element must end inside the buffer view. Strides are at most 252 bytes, so the extent can't overflow.
+		const size_t extent = accessor.m_Count > 0 ? static_cast<size_t>(accessor.m_Count - 1) * accessorView.m_Stride + accessorView.m_ElementSize : 0;
+		if (!InRange(accessor.m_ByteOffset, extent, view.m_ByteLength))
+			throw std::runtime_error("glTF accessor reads past the end of its buffer view!");
+
+		accessorView.m_Data = m_Buffers[view.m_Buffer].m_Data + view.m_ByteOffset + accessor.m_ByteOffset;
+
+		return accessorView;
+	}
+
+
+	//-- GltfLoader Functions.
+	GltfScene GltfLoader::LoadGlb(const std::string& filePath)
+	{
+#ifdef _DEBUG
+		const auto startTime = std::chrono::high_resolution_clock::now();
+#endif
+
+		GltfScene scene;
+		const MappedFile& file = scene.m_Files.emplace_back(filePath);
+		const uint8_t* data = file.GetData();
+		const size_t size = file.GetSize();
+
+		//-- Header.
+		if (size < 12 || ReadU32(data) != s_GlbMagic)
+			throw std::runtime_error("File [" + filePath + "] is not a glTF binary!");
+		if (ReadU32(data + 4) != 2)
+			throw std::runtime_error("File [" + filePath + "] is not glTF version 2!");
+		if (ReadU32(data + 8) > size)
+			throw std::runtime_error("File [" + filePath + "] is truncated!");
+
+		//-- Chunks, JSON first and then an optional BIN.
+		std::string_view jsonText;
+		const uint8_t* binChunk = nullptr;
+		size_t binChunkSize = 0;
+
+		size_t offset = 12;
+		while (offset + 8 <= size)
+		{
+			const uint32_t chunkLength = ReadU32(data + offset);
+			const uint32_t chunkType = ReadU32(data + offset + 4);
+			if (offset == 12 && chunkType != s_GlbChunkJson)
+				throw std::runtime_error("File [" + filePath + "] does not start with a JSON chunk!");
+			offset += 8;
+
+			if (!InRange(offset, chunkLength, size))
+				throw std::runtime_error("File [" + filePath + "] has a truncated chunk!");
+
+			if (chunkType == s_GlbChunkJson && jsonText.empty())
+				jsonText = std::string_view(reinterpret_cast<const char*>(data + offset), chunkLength);
+			else if (chunkType == s_GlbChunkBin && binChunk == nullptr)
+			{
+				binChunk = data + offset;
+				binChunkSize = chunkLength;
+			}
+
+			// Chunks are 4-byte aligned.
+			offset += (chunkLength + 3u) & ~3u;
+		}
+
+		if (jsonText.empty())
+			throw std::runtime_error("File [" + filePath + "] has no JSON chunk!");
+
+		//-- Scene description.
+		const JsonValue json = JsonValue::Parse(jsonText);
+		if (!json["asset"]["version"].AsString().starts_with("2"))
+			throw std::runtime_error("File [" + filePath + "] is not glTF version 2!");
+
+		ParseBuffers(scene, json, binChunk, binChunkSize, std::filesystem::path(filePath).parent_path());
+		ParseBufferViews(scene, json);
+		ParseAccessors(scene, json);
+		ParseMeshes(scene, json);
+		ValidateMeshes(scene);
+		ParseMaterials(scene, json);
+		ParseTexturesAndImages(scene, json);
+		ParseNodes(scene, json);
+
+#ifdef _DEBUG
+		const auto endTime = std::chrono::high_resolution_clock::now();
+		std::cout << "\t" << "Loaded [" << filePath << "] (" << size / 1024 << " KB mapped, " << scene.m_Meshes.size() << " meshes, " << scene.m_Nodes.size() << " nodes) in "
+			<< std::chrono::duration<float, std::chrono::milliseconds::period>(endTime - startTime).count() << "ms" << std::endl;
+#endif
+
+		return scene;
+	}
+
+
+	namespace
+	{
+		size_t GetPeakResidentBytes()
+		{
+#ifdef _WIN32
+			PROCESS_MEMORY_COUNTERS counters{};
+			counters.cb = sizeof(counters);
+			return GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)) ? counters.PeakWorkingSetSize : 0;
+#else
+			rusage usage{};
+			getrusage(RUSAGE_SELF, &usage);
+			return static_cast<size_t>(usage.ru_maxrss) * 1024;	// Kilobytes on Linux.
+#endif
+		}
+
+		// One grid mesh of gridSize^2 vertices, instanced by nodeCount children of a single root node. The binary
+		// chunk is streamed a row at a time, so the generator doesn't set the peak RSS the benchmark reports.
+		void WriteSyntheticGlb(const std::filesystem::path& filePath, const uint32_t gridSize, const uint32_t nodeCount)
+		{
+			const size_t indexOffset = static_cast<size_t>(gridSize) * gridSize * sizeof(glm::vec3);
+			const size_t indexCount = static_cast<size_t>(gridSize - 1) * (gridSize - 1) * 6;
+			const size_t binSize = indexOffset + indexCount * sizeof(uint32_t);	// Already 4-byte aligned.
+
+			std::string json = "{\"asset\":{\"version\":\"2.0\"},\"scene\":0,\"scenes\":[{\"nodes\":[0]}],"
+				"\"buffers\":[{\"byteLength\":" + std::to_string(binSize) + "}],"
+				"\"bufferViews\":[{\"buffer\":0,\"byteLength\":" + std::to_string(indexOffset) + ",\"target\":34962},"
+				"{\"buffer\":0,\"byteOffset\":" + std::to_string(indexOffset) + ",\"byteLength\":" + std::to_string(binSize - indexOffset) + ",\"target\":34963}],"
+				"\"accessors\":[{\"bufferView\":0,\"componentType\":5126,\"count\":" + std::to_string(gridSize * gridSize) + ",\"type\":\"VEC3\","
+				"\"min\":[0,0,0],\"max\":[" + std::to_string(gridSize - 1) + ",0," + std::to_string(gridSize - 1) + "]},"
+				"{\"bufferView\":1,\"componentType\":5125,\"count\":" + std::to_string(indexCount) + ",\"type\":\"SCALAR\"}],"
+				"\"meshes\":[{\"primitives\":[{\"attributes\":{\"POSITION\":0},\"indices\":1}]}],"
+				"\"nodes\":[{\"children\":[";
+			for (uint32_t i = 1; i < nodeCount; ++i)
+				json += (i > 1 ? "," : "") + std::to_string(i);
+			json += "]}";
+			for (uint32_t i = 1; i < nodeCount; ++i)
+				json += ",{\"mesh\":0,\"translation\":[" + std::to_string(i % 128) + ",0," + std::to_string(i / 128) + "]}";
+			json += "]}";
+
+			// Chunks are 4-byte aligned, JSON is padded with spaces.
+			json.resize((json.size() + 3) & ~size_t(3), ' ');
+
+			std::ofstream file(filePath, std::ios::binary);
+			const auto writeU32 = [&file](const uint32_t value) { file.write(reinterpret_cast<const char*>(&value), sizeof(value)); };
+			writeU32(s_GlbMagic);
+			writeU32(2);
+			writeU32(static_cast<uint32_t>(12 + 8 + json.size() + 8 + binSize));
+			writeU32(static_cast<uint32_t>(json.size()));
+			writeU32(s_GlbChunkJson);
+			file.write(json.data(), static_cast<std::streamsize>(json.size()));
+			writeU32(static_cast<uint32_t>(binSize));
+			writeU32(s_GlbChunkBin);
+
+			std::vector<glm::vec3> positions(gridSize);
+			for (uint32_t y = 0; y < gridSize; ++y)
+			{
+				for (uint32_t x = 0; x < gridSize; ++x)
+					positions[x] = glm::vec3(static_cast<float>(x), 0.f, static_cast<float>(y));
+				file.write(reinterpret_cast<const char*>(positions.data()), static_cast<std::streamsize>(positions.size() * sizeof(glm::vec3)));
+			}
+
+			std::vector<uint32_t> indices;
+			for (uint32_t y = 0; y + 1 < gridSize; ++y)
+			{
+				indices.clear();
+				for (uint32_t x = 0; x + 1 < gridSize; ++x)
+				{
+					const uint32_t i = y * gridSize + x;
+					indices.insert(indices.end(), { i, i + gridSize, i + 1, i + 1, i + gridSize, i + gridSize + 1 });
+				}
+				file.write(reinterpret_cast<const char*>(indices.data()), static_cast<std::streamsize>(indices.size() * sizeof(uint32_t)));
+			}
+
+			if (!file)
+				throw std::runtime_error("Failed to write [" + filePath.string() + "]!");
+		}
+	}
+
+
+	void GltfLoader::Benchmark(const std::string& filePath, const uint32_t iterations)
+	{
+		std::filesystem::path path = filePath;
+		const bool synthetic = filePath.empty();
+		if (synthetic)
+		{
+			path = std::filesystem::temp_directory_path() / "nya_gltf_benchmark.glb";
+			WriteSyntheticGlb(path, 1024, 16384);
+		}
+
+		// Peak RSS is process wide, so the growth over the baseline is what loading (and the generator) added.
+		const size_t baselineBytes = GetPeakResidentBytes();
+		float bestMs = FLT_MAX, totalMs = 0.f;
+		size_t meshCount = 0, nodeCount = 0;
+		for (uint32_t i = 0; i < iterations; ++i)
+		{
+			const auto startTime = std::chrono::high_resolution_clock::now();
+			const GltfScene scene = LoadGlb(path.string());
+			const float ms = std::chrono::duration<float, std::chrono::milliseconds::period>(std::chrono::high_resolution_clock::now() - startTime).count();
+
+			bestMs = std::min(bestMs, ms);
+			totalMs += ms;
+			meshCount = scene.m_Meshes.size();
+			nodeCount = scene.m_Nodes.size();
+		}
+		const size_t peakBytes = GetPeakResidentBytes();
+
+		std::cout << "\t" << "glTF load of [" << path.filename().string() << "] (" << std::filesystem::file_size(path) / 1024 << " KB, " << meshCount << " meshes, "
+			<< nodeCount << " nodes): best " << bestMs << "ms, mean " << totalMs / std::max(iterations, 1u) << "ms, peak RSS " << peakBytes / (1024 * 1024)
+			<< " MB (+" << (peakBytes - std::min(baselineBytes, peakBytes)) / (1024 * 1024) << " MB)" << std::endl;
+
+		if (synthetic)
+			std::filesystem::remove(path);
+	}
+}
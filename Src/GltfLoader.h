@@ -0,0 +1,180 @@
+﻿/*!
+\file		GltfLoader.h
+\date		19/10/2026
+
+\author		Adrian Tan
+\email		t.xingkhiangadrian\@digipen.edu
+
+\brief		Contains definition of GltfScene struct and GltfLoader class.
+			Loads glTF 2.0 binary (.glb) files by memory-mapping them, accessor
+			data is never copied and points straight into the mapped file.
+
+\copyright	All content © 2023 DigiPen (SINGAPORE) Corporation, all rights reserved.
+			Reproduction or disclosure of this file or its contents without the
+			prior written consent of DigiPen Institute of Technology is prohibited.
+__________________________________________________________________________________*/
+#pragma once
+
+#include "MappedFile.h"
+
+#define GLM_FORCE_RADIANS
+#define GLM_FORCE_DEPTH_ZERO_TO_ONE
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace Nya
+{
+	enum class GltfComponentType : uint32_t
+	{
+		Byte = 5120,
+		UnsignedByte = 5121,
+		Short = 5122,
+		UnsignedShort = 5123,
+		UnsignedInt = 5125,
+		Float = 5126
+	};
+
+	// glTF buffer view targets.
+	constexpr uint32_t g_GltfTargetArrayBuffer = 34962;
+	constexpr uint32_t g_GltfTargetElementArrayBuffer = 34963;
+
+	// glTF primitive mode for plain triangle lists.
+	constexpr uint32_t g_GltfModeTriangles = 4;
+
+	struct GltfBuffer
+	{
+		const uint8_t* m_Data = nullptr;
+		size_t m_ByteLength = 0;
+	};
+
+	struct GltfBufferView
+	{
+		uint32_t m_Buffer = 0;
+		size_t m_ByteOffset = 0;
+		size_t m_ByteLength = 0;
+		uint32_t m_ByteStride = 0;	// 0 means tightly packed.
+		uint32_t m_Target = 0;
+	};
+
+	struct GltfAccessor
+	{
+		int m_BufferView = -1;
+		size_t m_ByteOffset = 0;
+		GltfComponentType m_ComponentType = GltfComponentType::Float;
+		bool m_Normalized = false;
+		uint32_t m_Count = 0;
+		uint32_t m_ComponentCount = 1;	// SCALAR = 1, VEC2 = 2, ..., MAT4 = 16.
+
+		bool m_HasBounds = false;
+		glm::vec3 m_Min{ 0.f };
+		glm::vec3 m_Max{ 0.f };
+
+		uint32_t GetComponentSize() const;
+		uint32_t GetElementSize() const;
+	};
+
+	// Strided view of an accessor's elements inside a mapped buffer.
+	struct GltfAccessorView
+	{
+		const uint8_t* m_Data = nullptr;
+		uint32_t m_Stride = 0;
+		uint32_t m_ElementSize = 0;
+		uint32_t m_Count = 0;
+
+		bool IsTightlyPacked() const { return m_Stride == m_ElementSize; }
+		const uint8_t* operator[](const size_t index) const { return m_Data + index * m_Stride; }
+	};
+
+	struct GltfPrimitive
+	{
+		std::vector<std::pair<std::string, int>> m_Attributes;	// Attribute semantic -> accessor index.
+		int m_Indices = -1;
+		int m_Material = -1;
+		uint32_t m_Mode = g_GltfModeTriangles;
+
+		int FindAttribute(std::string_view semantic) const;
+	};
+
+	struct GltfMesh
+	{
+		std::string m_Name;
+		std::vector<GltfPrimitive> m_Primitives;
+	};
+
+	struct GltfMaterial
+	{
+		std::string m_Name;
+		glm::vec4 m_BaseColorFactor{ 1.f };
+		int m_BaseColorTexture = -1;
+		float m_MetallicFactor = 1.f;
+		float m_RoughnessFactor = 1.f;
+		int m_MetallicRoughnessTexture = -1;
+		int m_NormalTexture = -1;
+		int m_OcclusionTexture = -1;
+		int m_EmissiveTexture = -1;
+		glm::vec3 m_EmissiveFactor{ 0.f };
+		std::string m_AlphaMode = "OPAQUE";
+		float m_AlphaCutoff = 0.5f;
+		bool m_DoubleSided = false;
+	};
+
+	struct GltfTexture
+	{
+		int m_Image = -1;
+		int m_Sampler = -1;
+	};
+
+	struct GltfImage
+	{
+		std::string m_Uri;			// External image, relative to the .glb.
+		int m_BufferView = -1;		// Or embedded in the binary chunk.
+		std::string m_MimeType;
+	};
+
+	struct GltfNode
+	{
+		std::string m_Name;
+		int m_Mesh = -1;
+		int m_Parent = -1;
+		std::vector<int> m_Children;
+
+		glm::vec3 m_Translation{ 0.f };
+		glm::quat m_Rotation{ 1.f, 0.f, 0.f, 0.f };
+		glm::vec3 m_Scale{ 1.f };
+
+		glm::mat4 m_LocalMatrix{ 1.f };
+		glm::mat4 m_WorldMatrix{ 1.f };
+	};
+
+	struct GltfScene
+	{
+		std::vector<MappedFile> m_Files;	// Keeps the mapped .glb (and any external .bin) alive.
+
+		std::vector<GltfBuffer> m_Buffers;
+		std::vector<GltfBufferView> m_BufferViews;
+		std::vector<GltfAccessor> m_Accessors;
+		std::vector<GltfMesh> m_Meshes;
+		std::vector<GltfMaterial> m_Materials;
+		std::vector<GltfTexture> m_Textures;
+		std::vector<GltfImage> m_Images;
+		std::vector<GltfNode> m_Nodes;
+		std::vector<int> m_RootNodes;
+
+		GltfAccessorView GetAccessorView(int accessorIndex) const;
+	};
+
+	class GltfLoader
+	{
+	public:
+		// Throws std::runtime_error if the file is not a valid glTF 2.0 binary.
+		static GltfScene LoadGlb(const std::string& filePath);
+
+		// Times LoadGlb on a file, or on a generated 1M-vertex, 16K-node .glb if the path is empty, and reports peak RSS.
+		static void Benchmark(const std::string& filePath, uint32_t iterations = 8);
+	};
+}
@@ -0,0 +1,405 @@
+﻿/*!
+\file		Json.cpp
+\date		19/10/2026
+
+\author		Adrian Tan
+\email		t.xingkhiangadrian\@digipen.edu
+
+\brief		Contains implementation for JsonValue class functions.
+
+\copyright	All content © 2023 DigiPen (SINGAPORE) Corporation, all rights reserved.
+			Reproduction or disclosure of this file or its contents without the
+			prior written consent of DigiPen Institute of Technology is prohibited.
+__________________________________________________________________________________*/
+
+#include "meowpch.h"
+
+#include "Json.h"
+
+#include <charconv>
+#include <cmath>
+#include <limits>
+
+namespace Nya
+{
+	//-- Helpers.
+	namespace
+	{
+		const JsonValue s_NullValue;
+		const std::string s_EmptyString;
+		const JsonValue::Array s_EmptyArray;
+		const JsonValue::Object s_EmptyObject;
+
+		// Converting a double the integer type cannot hold is undefined, so every conversion goes through this first.
+		template<typename T>
+		bool FitsInteger(const double value)
+		{
+			// Both bounds are powers of two, or zero, so they are exact as doubles.
+			return std::isfinite(value) && value >= static_cast<double>(std::numeric_limits<T>::lowest()) && value < std::ldexp(1.0, std::numeric_limits<T>::digits);
+		}
+
+		template<typename T>
+		T ToCheckedInteger(const JsonValue& json, const std::string_view what)
+		{
+			const double value = json.AsNumber(-1.0);
+			if (!json.IsNumber() || value < 0.0 || std::floor(value) != value || !FitsInteger<T>(value))
+				throw std::runtime_error("JSON field [" + std::string(what) + "] is missing, or not a non-negative integer in range!");
+
+			return static_cast<T>(value);
+		}
+
+		// Recursive descent parser over a string_view.
+		class JsonParser
+		{
+			// Every nested array or object is a recursion, deep enough input would overflow the stack.
+			static constexpr uint32_t s_MaxDepth = 512;
+
+			std::string_view m_Text;
+			size_t m_Pos = 0;
+			uint32_t m_Depth = 0;
+
+			[[noreturn]] void Fail(const char* message) const
+			{
+				throw std::runtime_error("JSON parse error at offset " + std::to_string(m_Pos) + ": " + message);
+			}
+
+			void SkipWhitespace()
+			{
+				while (m_Pos < m_Text.size() && (m_Text[m_Pos] == ' ' || m_Text[m_Pos] == '\t' || m_Text[m_Pos] == '\n' || m_Text[m_Pos] == '\r'))
+					++m_Pos;
+			}
+
+			char Peek()
+			{
+				SkipWhitespace();
+				if (m_Pos >= m_Text.size())
+					Fail("unexpected end of input");
+				return m_Text[m_Pos];
+			}
+
+			void Expect(const char c)
+			{
+				if (Peek() != c)
+					Fail("unexpected character");
+				++m_Pos;
+			}
+
+			void ExpectLiteral(const std::string_view literal)
+			{
+				if (m_Text.substr(m_Pos, literal.size()) != literal)
+					Fail("invalid literal");
+				m_Pos += literal.size();
+			}
+
+			static void AppendUtf8(std::string& out, const uint32_t codepoint)
+			{
+				if (codepoint < 0x80)
+				{
+					out += static_cast<char>(codepoint);
+				}
+				else if (codepoint < 0x800)
+				{
+					out += static_cast<char>(0xC0 | (codepoint >> 6));
+					out += static_cast<char>(0x80 | (codepoint & 0x3F));
+				}
+				else if (codepoint < 0x10000)
+				{
+					out += static_cast<char>(0xE0 | (codepoint >> 12));
+					out += static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F));
+					out += static_cast<char>(0x80 | (codepoint & 0x3F));
+				}
+				else
+				{
+					out += static_cast<char>(0xF0 | (codepoint >> 18));
+					out += static_cast<char>(0x80 | ((codepoint >> 12) & 0x3F));
+					out += static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F));
+					out += static_cast<char>(0x80 | (codepoint & 0x3F));
+				}
+			}
+
+			uint32_t ParseHex4()
+			{
+				if (m_Pos + 4 > m_Text.size())
+					Fail("truncated unicode escape");
+
+				uint32_t value = 0;
+				const auto result = std::from_chars(m_Text.data() + m_Pos, m_Text.data() + m_Pos + 4, value, 16);
+				if (result.ptr != m_Text.data() + m_Pos + 4)
+					Fail("invalid unicode escape");
+
+				m_Pos += 4;
+				return value;
+			}
+
+			std::string ParseString()
+			{
+				Expect('"');
+
+				std::string out;
+				while (true)
+				{
+					if (m_Pos >= m_Text.size())
+						Fail("unterminated string");
+
+					const char c = m_Text[m_Pos++];
+					if (c == '"')
+						break;
+					if (c != '\\')
+					{
+						out += c;
+						continue;
+					}
+
+					if (m_Pos >= m_Text.size())
+						Fail("unterminated escape");
+
+					switch (m_Text[m_Pos++])
+					{
+					case '"': out += '"'; break;
+					case '\\': out += '\\'; break;
+					case '/': out += '/'; break;
+					case 'b': out += '\b'; break;
+					case 'f': out += '\f'; break;
+					case 'n': out += '\n'; break;
+					case 'r': out += '\r'; break;
+					case 't': out += '\t'; break;
+					case 'u':
+					{
+						uint32_t codepoint = ParseHex4();
+						// Surrogate pair.
+						if (codepoint >= 0xD800 && codepoint <= 0xDBFF && m_Text.substr(m_Pos, 2) == "\\u")
+						{
+							m_Pos += 2;
+							const uint32_t low = ParseHex4();
+							codepoint = 0x10000 + ((codepoint - 0xD800) << 10) + (low - 0xDC00);
+						}
+						AppendUtf8(out, codepoint);
+						break;
+					}
+					default:
+						Fail("invalid escape");
+					}
+				}
+
+				return out;
+			}
+
+			double ParseNumber()
+			{
+				const size_t start = m_Pos;
+				while (m_Pos < m_Text.size() && std::string_view("+-0123456789.eE").find(m_Text[m_Pos]) != std::string_view::npos)
+					++m_Pos;
+
+				double value = 0.0;
+				const auto result = std::from_chars(m_Text.data() + start, m_Text.data() + m_Pos, value);
+				if (result.ec != std::errc() || result.ptr != m_Text.data() + m_Pos)
+					Fail("invalid number");
+
+				return value;
+			}
+
+			JsonValue ParseValue()
+			{
+				if (++m_Depth > s_MaxDepth)
+					Fail("nesting too deep");
+
+				JsonValue value = ParseNestedValue();
+				--m_Depth;
+				return value;
+			}
+
+			JsonValue ParseNestedValue()
+			{
+				switch (Peek())
+				{
+				case '{':
+				{
+					++m_Pos;
+					JsonValue::Object object;
+					if (Peek() == '}')
+					{
+						++m_Pos;
+						return JsonValue(std::move(object));
+					}
+
+					while (true)
+					{
+						std::string key = ParseString();
+						Expect(':');
+						object.emplace_back(std::move(key), ParseValue());
+
+						if (Peek() == ',')
+						{
+							++m_Pos;
+							continue;
+						}
+						Expect('}');
+						return JsonValue(std::move(object));
+					}
+				}
+				case '[':
+				{
+					++m_Pos;
+					JsonValue::Array array;
+					if (Peek() == ']')
+					{
+						++m_Pos;
+						return JsonValue(std::move(array));
+					}
+
+					while (true)
+					{
+						array.push_back(ParseValue());
+
+						if (Peek() == ',')
+						{
+							++m_Pos;
+							continue;
+						}
+						Expect(']');
+						return JsonValue(std::move(array));
+					}
+				}
+				case '"':
+					return JsonValue(ParseString());
+				case 't':
+					ExpectLiteral("true");
+					return JsonValue(true);
+				case 'f':
+					ExpectLiteral("false");
+					return JsonValue(false);
+				case 'n':
+					ExpectLiteral("null");
+					return JsonValue();
+				default:
+					return JsonValue(ParseNumber());
+				}
+			}
+
+		public:
+			explicit JsonParser(const std::string_view text) : m_Text(text) {}
+
+			JsonValue ParseDocument()
+			{
+				JsonValue root = ParseValue();
+				SkipWhitespace();
+				if (m_Pos != m_Text.size())
+					Fail("trailing characters after document");
+
+				return root;
+			}
+		};
+	}
+
+
+	//-- JsonValue Functions.
+	JsonValue JsonValue::Parse(const std::string_view text)
+	{
+		return JsonParser(text).ParseDocument();
+	}
+
+	const JsonValue& JsonValue::operator[](const std::string_view key) const
+	{
+		for (const auto& [name, value] : AsObject())
+		{
+			if (name == key)
+				return value;
+		}
+
+		return s_NullValue;
+	}
+
+	const JsonValue& JsonValue::operator[](const size_t index) const
+	{
+		const auto& array = AsArray();
+		return index < array.size() ? array[index] : s_NullValue;
+	}
+
+	bool JsonValue::Contains(const std::string_view key) const
+	{
+		return std::ranges::any_of(AsObject(), [key](const auto& member) { return member.first == key; });
+	}
+
+	size_t JsonValue::Size() const
+	{
+		if (IsArray())
+			return AsArray().size();
+		if (IsObject())
+			return AsObject().size();
+
+		return 0;
+	}
+
+	bool JsonValue::AsBool(const bool defaultValue) const
+	{
+		return IsBool() ? std::get<bool>(m_Value) : defaultValue;
+	}
+
+	double JsonValue::AsNumber(const double defaultValue) const
+	{
+		return IsNumber() ? std::get<double>(m_Value) : defaultValue;
+	}
+
+	float JsonValue::AsFloat(const float defaultValue) const
+	{
+		return static_cast<float>(AsNumber(defaultValue));
+	}
+
+	int JsonValue::AsInt(const int defaultValue) const
+	{
+		const double value = std::trunc(AsNumber(defaultValue));
+		return FitsInteger<int>(value) ? static_cast<int>(value) : defaultValue;
+	}
+
+	uint32_t JsonValue::AsUInt(const uint32_t defaultValue) const
+	{
+		const double value = std::trunc(AsNumber(defaultValue));
+		return FitsInteger<uint32_t>(value) ? static_cast<uint32_t>(value) : defaultValue;
+	}
+
+	size_t JsonValue::AsSize(const size_t defaultValue) const
+	{
+		const double value = std::trunc(AsNumber(static_cast<double>(defaultValue)));
+		return FitsInteger<size_t>(value) ? static_cast<size_t>(value) : defaultValue;
+	}
+
+	uint32_t JsonValue::AsCheckedUInt(const std::string_view what) const
+	{
+		return ToCheckedInteger<uint32_t>(*this, what);
+	}
+
+	uint32_t JsonValue::AsCheckedUInt(const std::string_view what, const uint32_t defaultValue) const
+	{
+		return IsNull() ? defaultValue : ToCheckedInteger<uint32_t>(*this, what);
+	}
+
+	size_t JsonValue::AsCheckedSize(const std::string_view what) const
+	{
+		return ToCheckedInteger<size_t>(*this, what);
+	}
+
+	size_t JsonValue::AsCheckedSize(const std::string_view what, const size_t defaultValue) const
+	{
+		return IsNull() ? defaultValue : ToCheckedInteger<size_t>(*this, what);
+	}
+
+	int JsonValue::AsCheckedIndex(const std::string_view what) const
+	{
+		return IsNull() ? -1 : ToCheckedInteger<int>(*this, what);
+	}
+
+	const std::string& JsonValue::AsString() const
+	{
+		return IsString() ? std::get<std::string>(m_Value) : s_EmptyString;
+	}
+
+	const JsonValue::Array& JsonValue::AsArray() const
+	{
+		return IsArray() ? std::get<Array>(m_Value) : s_EmptyArray;
+	}
+
+	const JsonValue::Object& JsonValue::AsObject() const
+	{
+		return IsObject() ? std::get<Object>(m_Value) : s_EmptyObject;
+	}
+}
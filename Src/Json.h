@@ -0,0 +1,79 @@
+﻿/*!
+\file		Json.h
+\date		19/10/2026
+
+\author		Adrian Tan
+\email		t.xingkhiangadrian\@digipen.edu
+
+\brief		Contains definition of JsonValue class, a small read-only JSON DOM.
+
+\copyright	All content © 2023 DigiPen (SINGAPORE) Corporation, all rights reserved.
+			Reproduction or disclosure of this file or its contents without the
+			prior written consent of DigiPen Institute of Technology is prohibited.
+__________________________________________________________________________________*/
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace Nya
+{
+	class JsonValue
+	{
+	public:
+		using Array = std::vector<JsonValue>;
+		using Object = std::vector<std::pair<std::string, JsonValue>>;	// Small objects, linear lookup is fine.
+
+	private:
+		std::variant<std::nullptr_t, bool, double, std::string, Array, Object> m_Value;
+
+	public:
+		JsonValue() : m_Value(nullptr) {}
+		explicit JsonValue(bool value) : m_Value(value) {}
+		explicit JsonValue(double value) : m_Value(value) {}
+		explicit JsonValue(std::string value) : m_Value(std::move(value)) {}
+		explicit JsonValue(Array value) : m_Value(std::move(value)) {}
+		explicit JsonValue(Object value) : m_Value(std::move(value)) {}
+
+		// Throws std::runtime_error on malformed input.
+		static JsonValue Parse(std::string_view text);
+
+		bool IsNull() const { return std::holds_alternative<std::nullptr_t>(m_Value); }
+		bool IsBool() const { return std::holds_alternative<bool>(m_Value); }
+		bool IsNumber() const { return std::holds_alternative<double>(m_Value); }
+		bool IsString() const { return std::holds_alternative<std::string>(m_Value); }
+		bool IsArray() const { return std::holds_alternative<Array>(m_Value); }
+		bool IsObject() const { return std::holds_alternative<Object>(m_Value); }
+
+		// Lookups return a null value when the key/index is missing, so chains like json["a"][0]["b"] are safe.
+		const JsonValue& operator[](std::string_view key) const;
+		const JsonValue& operator[](size_t index) const;
+		bool Contains(std::string_view key) const;
+		size_t Size() const;
+
+		bool AsBool(bool defaultValue = false) const;
+		double AsNumber(double defaultValue = 0.0) const;
+		float AsFloat(float defaultValue = 0.f) const;
+		// Fractions are truncated. Values the type cannot hold, NaN included, give defaultValue.
+		int AsInt(int defaultValue = 0) const;
+		uint32_t AsUInt(uint32_t defaultValue = 0) const;
+		size_t AsSize(size_t defaultValue = 0) const;
+
+		// Checked integers for untrusted input: throw unless the value is a non-negative integer the type can hold.
+		// what names the field in the message. Without a defaultValue, a missing value throws too.
+		uint32_t AsCheckedUInt(std::string_view what) const;
+		uint32_t AsCheckedUInt(std::string_view what, uint32_t defaultValue) const;
+		size_t AsCheckedSize(std::string_view what) const;
+		size_t AsCheckedSize(std::string_view what, size_t defaultValue) const;
+		// An index as above, or -1 if the value is missing.
+		int AsCheckedIndex(std::string_view what) const;
+		const std::string& AsString() const;
+
+		const Array& AsArray() const;
+		const Object& AsObject() const;
+	};
+}
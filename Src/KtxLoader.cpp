@@ -0,0 +1,210 @@
+﻿/*!
+\file		KtxLoader.cpp
+\date		19/10/2026
+
+\author		Adrian Tan
+\email		t.xingkhiangadrian\@digipen.edu
+
+\brief		Contains implementation for KtxTexture struct and KtxLoader class functions.
+
+\copyright	All content © 2023 DigiPen (SINGAPORE) Corporation, all rights reserved.
+			Reproduction or disclosure of this file or its contents without the
+			prior written consent of DigiPen Institute of Technology is prohibited.
+__________________________________________________________________________________*/
+
+#include "meowpch.h"
+
+#include "KtxLoader.h"
+
+#include <bit>
+
+namespace Nya
+{
+	//-- Helpers.
+	namespace
+	{
+		constexpr uint8_t s_KtxIdentifier[12] = { 0xAB, 'K', 'T', 'X', ' ', '2', '0', 0xBB, '\r', '\n', 0x1A, '\n' };
+		constexpr size_t s_HeaderSize = 80;		// Identifier, header and index.
+		constexpr size_t s_LevelIndexSize = 24;
+		constexpr uint8_t s_TransferSrgb = 2;	// KHR_DF_TRANSFER_SRGB.
+
+		uint32_t ReadU32(const uint8_t* data)
+		{
+			uint32_t value;
+			memcpy(&value, data, sizeof(value));
+			return value;
+		}
+
+		uint64_t ReadU64(const uint8_t* data)
+		{
+			uint64_t value;
+			memcpy(&value, data, sizeof(value));
+			return value;
+		}
+
+		bool InFile(const uint64_t offset, const uint64_t length, const size_t fileSize)
+		{
+			return offset <= fileSize && length <= fileSize - offset;
+		}
+	}
+
+
+	//-- KtxTexture Functions.
+	bool KtxTexture::IsBasisUniversal() const
+	{
+		return m_Format == VK_FORMAT_UNDEFINED && (m_ColorModel == KtxLoader::s_ColorModelEtc1s || m_ColorModel == KtxLoader::s_ColorModelUastc);
+	}
+
+	size_t KtxTexture::GetRgba8Size() const
+	{
+		size_t size = 0;
+		for (const KtxLevel& level : m_Levels)
+			size += static_cast<size_t>(level.m_Width) * level.m_Height * 4;
+
+		return size;
+	}
+
+
+	//-- KtxLoader Functions.
+	KtxTexture KtxLoader::Load(const std::string& filePath)
+	{
+		KtxTexture texture;
+		texture.m_File.Open(filePath);
+		const uint8_t* data = texture.m_File.GetData();
+		const size_t size = texture.m_File.GetSize();
+
+		//-- Header.
+		if (size < s_HeaderSize || memcmp(data, s_KtxIdentifier, sizeof(s_KtxIdentifier)) != 0)
+			throw std::runtime_error("File [" + filePath + "] is not a KTX2 file!");
+
+		texture.m_Format = static_cast<VkFormat>(ReadU32(data + 12));
+		texture.m_Width = ReadU32(data + 20);
+		texture.m_Height = ReadU32(data + 24);
+		const uint32_t depth = ReadU32(data + 28);
+		const uint32_t layerCount = ReadU32(data + 32);
+		const uint32_t faceCount = ReadU32(data + 36);
+		const uint32_t levelCount = std::max(ReadU32(data + 40), 1u);	// 0 asks the loader to generate mips, level 0 is still stored.
+		texture.m_Supercompression = static_cast<KtxSupercompression>(ReadU32(data + 44));
+
+		if (texture.m_Width == 0 || texture.m_Height == 0 || depth > 1 || layerCount > 1 || faceCount != 1)
+			throw std::runtime_error("KTX2 file [" + filePath + "] is not a single 2D texture!");
+		// A full chain ends at 1x1, i.e. floor(log2(max(width, height))) + 1 levels. Also keeps the level shifts below 32.
+		if (levelCount > static_cast<uint32_t>(std::bit_width(std::max(texture.m_Width, texture.m_Height))))
+			throw std::runtime_error("KTX2 file [" + filePath + "] has more mip levels than its size allows!");
+		if (texture.m_Supercompression == KtxSupercompression::Zstandard || texture.m_Supercompression == KtxSupercompression::Zlib)
+			throw std::runtime_error("KTX2 file [" + filePath + "] uses Zstandard or zlib supercompression, which is unsupported!");
+		if (texture.m_Supercompression != KtxSupercompression::None && texture.m_Supercompression != KtxSupercompression::BasisLZ)
+			throw std::runtime_error("KTX2 file [" + filePath + "] uses an unknown supercompression scheme!");
+
+		//-- Data format descriptor, only the basic block's colour model and transfer function are needed.
+		const uint32_t dfdOffset = ReadU32(data + 48);
+		const uint32_t dfdLength = ReadU32(data + 52);
+		if (dfdLength >= 16 && InFile(dfdOffset, dfdLength, size))
+		{
+			texture.m_ColorModel = data[dfdOffset + 12];
+			texture.m_Srgb = data[dfdOffset + 14] == s_TransferSrgb;
+		}
+
+		const uint64_t sgdOffset = ReadU64(data + 64);
+		const uint64_t sgdLength = ReadU64(data + 72);
+		if (sgdLength > 0)
+		{
+			if (!InFile(sgdOffset, sgdLength, size))
+				throw std::runtime_error("KTX2 file [" + filePath + "] has truncated supercompression data!");
+
+			texture.m_SupercompressionData = data + sgdOffset;
+			texture.m_SupercompressionDataSize = static_cast<size_t>(sgdLength);
+		}
+
+		const bool basisUniversal = texture.IsBasisUniversal();
+		if (!basisUniversal && (texture.m_Supercompression != KtxSupercompression::None || GetBlockInfo(texture.m_Format).m_Bytes == 0))
+			throw std::runtime_error("KTX2 file [" + filePath + "] has an unsupported format!");
+
+		//-- Level index.
+		if (size < s_HeaderSize + levelCount * s_LevelIndexSize)
+			throw std::runtime_error("KTX2 file [" + filePath + "] has a truncated level index!");
+
+		texture.m_Levels.resize(levelCount);
+		for (uint32_t level = 0; level < levelCount; ++level)
+		{
+			const uint8_t* entry = data + s_HeaderSize + level * s_LevelIndexSize;
+			const uint64_t byteOffset = ReadU64(entry);
+			const uint64_t byteLength = ReadU64(entry + 8);
+
+			if (!InFile(byteOffset, byteLength, size))
+				throw std::runtime_error("KTX2 file [" + filePath + "] has a truncated mip level!");
+
+			KtxLevel& mip = texture.m_Levels[level];
+			mip.m_Data = data + byteOffset;
+			mip.m_Size = static_cast<size_t>(byteLength);
+			mip.m_Width = std::max(texture.m_Width >> level, 1u);
+			mip.m_Height = std::max(texture.m_Height >> level, 1u);
+
+			if (!basisUniversal && mip.m_Size < GetLevelSize(texture.m_Format, mip.m_Width, mip.m_Height))
+				throw std::runtime_error("KTX2 file [" + filePath + "] has a mip level smaller than its format needs!");
+		}
+
+		return texture;
+	}
+
+	TextureBlockInfo KtxLoader::GetBlockInfo(const VkFormat format)
+	{
+		switch (format)
+		{
+		case VK_FORMAT_R8_UNORM:
+		case VK_FORMAT_R8_SRGB:
+			return { 1, 1, 1 };
+		case VK_FORMAT_R8G8_UNORM:
+		case VK_FORMAT_R8G8_SRGB:
+			return { 1, 1, 2 };
+		case VK_FORMAT_R8G8B8A8_UNORM:
+		case VK_FORMAT_R8G8B8A8_SRGB:
+		case VK_FORMAT_B8G8R8A8_UNORM:
+		case VK_FORMAT_B8G8R8A8_SRGB:
+		case VK_FORMAT_A2B10G10R10_UNORM_PACK32:
+		case VK_FORMAT_B10G11R11_UFLOAT_PACK32:
+		case VK_FORMAT_E5B9G9R9_UFLOAT_PACK32:
+			return { 1, 1, 4 };
+		case VK_FORMAT_R16G16B16A16_SFLOAT:
+			return { 1, 1, 8 };
+		case VK_FORMAT_BC1_RGB_UNORM_BLOCK:
+		case VK_FORMAT_BC1_RGB_SRGB_BLOCK:
+		case VK_FORMAT_BC1_RGBA_UNORM_BLOCK:
+		case VK_FORMAT_BC1_RGBA_SRGB_BLOCK:
+		case VK_FORMAT_BC4_UNORM_BLOCK:
+		case VK_FORMAT_BC4_SNORM_BLOCK:
+			return { 4, 4, 8 };
+		case VK_FORMAT_BC2_UNORM_BLOCK:
+		case VK_FORMAT_BC2_SRGB_BLOCK:
+		case VK_FORMAT_BC3_UNORM_BLOCK:
+		case VK_FORMAT_BC3_SRGB_BLOCK:
+		case VK_FORMAT_BC5_UNORM_BLOCK:
+		case VK_FORMAT_BC5_SNORM_BLOCK:
+		case VK_FORMAT_BC6H_UFLOAT_BLOCK:
+		case VK_FORMAT_BC6H_SFLOAT_BLOCK:
+		case VK_FORMAT_BC7_UNORM_BLOCK:
+		case VK_FORMAT_BC7_SRGB_BLOCK:
+		case VK_FORMAT_ETC2_R8G8B8A8_UNORM_BLOCK:
+		case VK_FORMAT_ETC2_R8G8B8A8_SRGB_BLOCK:
+		case VK_FORMAT_ASTC_4x4_UNORM_BLOCK:
+		case VK_FORMAT_ASTC_4x4_SRGB_BLOCK:
+			return { 4, 4, 16 };
+		case VK_FORMAT_ASTC_6x6_UNORM_BLOCK:
+		case VK_FORMAT_ASTC_6x6_SRGB_BLOCK:
+			return { 6, 6, 16 };
+		case VK_FORMAT_ASTC_8x8_UNORM_BLOCK:
+		case VK_FORMAT_ASTC_8x8_SRGB_BLOCK:
+			return { 8, 8, 16 };
+		default:
+			return {};
+		}
+	}
+
+	size_t KtxLoader::GetLevelSize(const VkFormat format, const uint32_t width, const uint32_t height)
+	{
+		const TextureBlockInfo block = GetBlockInfo(format);
+		const size_t blocksX = (width + block.m_Width - 1) / block.m_Width;
+		const size_t blocksY = (height + block.m_Height - 1) / block.m_Height;
+		return blocksX * blocksY * block.m_Bytes;
+	}
+}
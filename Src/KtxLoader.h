@@ -0,0 +1,89 @@
+﻿/*!
+\file		KtxLoader.h
+\date		19/10/2026
+
+\author		Adrian Tan
+\email		t.xingkhiangadrian\@digipen.edu
+
+\brief		Contains definition of KtxTexture struct and KtxLoader class.
+
+\copyright	All content © 2023 DigiPen (SINGAPORE) Corporation, all rights reserved.
+			Reproduction or disclosure of this file or its contents without the
+			prior written consent of DigiPen Institute of Technology is prohibited.
+__________________________________________________________________________________*/
+#pragma once
+
+#include "MappedFile.h"
+
+#include <vulkan/vulkan.h>
+
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace Nya
+{
+	// Texel block of a format, 1x1 for uncompressed formats.
+	struct TextureBlockInfo
+	{
+		uint32_t m_Width = 1;
+		uint32_t m_Height = 1;
+		uint32_t m_Bytes = 0;	// 0 for formats the loader does not know.
+	};
+
+	enum class KtxSupercompression : uint32_t
+	{
+		None = 0,
+		BasisLZ = 1,
+		Zstandard = 2,
+		Zlib = 3
+	};
+
+	// One mip level, pointing straight into the mapped file.
+	struct KtxLevel
+	{
+		const uint8_t* m_Data = nullptr;
+		size_t m_Size = 0;
+		uint32_t m_Width = 0;
+		uint32_t m_Height = 0;
+	};
+
+	struct KtxTexture
+	{
+		MappedFile m_File;
+
+		VkFormat m_Format = VK_FORMAT_UNDEFINED;	// VK_FORMAT_UNDEFINED for Basis Universal data, see IsBasisUniversal.
+		uint32_t m_Width = 0;
+		uint32_t m_Height = 0;
+		bool m_Srgb = false;						// From the data format descriptor's transfer function.
+		uint32_t m_ColorModel = 0;					// From the data format descriptor, tells ETC1S from UASTC.
+		KtxSupercompression m_Supercompression = KtxSupercompression::None;
+
+		std::vector<KtxLevel> m_Levels;				// Level 0 first.
+		const uint8_t* m_SupercompressionData = nullptr;	// BasisLZ global codebooks, needed to transcode.
+		size_t m_SupercompressionDataSize = 0;
+
+		// ETC1S (BasisLZ) or UASTC, both need transcoding to a GPU format before upload.
+		bool IsBasisUniversal() const;
+		// Bytes the levels would take as RGBA8.
+		size_t GetRgba8Size() const;
+	};
+
+	// Transcodes one level of a Basis Universal texture into targetFormat, e.g. by wrapping basisu's transcoder, which
+	// Nya does not ship. Returns the level's blocks, or nothing if targetFormat is not one it can produce.
+	using KtxTranscodeFn = std::function<std::vector<uint8_t>(const KtxTexture& texture, uint32_t level, VkFormat targetFormat)>;
+
+	class KtxLoader
+	{
+	public:
+		static constexpr uint32_t s_ColorModelEtc1s = 163;	// KHR_DF_MODEL_ETC1S.
+		static constexpr uint32_t s_ColorModelUastc = 166;	// KHR_DF_MODEL_UASTC.
+
+		// 2D textures only, no arrays, cube maps or depth. Zstandard and zlib supercompression are rejected.
+		// Throws std::runtime_error if the file is not a valid KTX2 file.
+		static KtxTexture Load(const std::string& filePath);
+
+		static TextureBlockInfo GetBlockInfo(VkFormat format);
+		static size_t GetLevelSize(VkFormat format, uint32_t width, uint32_t height);
+	};
+}
@@ -0,0 +1,59 @@
+﻿/*!
+\file		LodSelector.cpp
+\date		19/10/2026
+
+\author		Adrian Tan
+\email		t.xingkhiangadrian\@digipen.edu
+
+\brief		Contains implementation for LodSelector class functions.
+
+\copyright	All content © 2023 DigiPen (SINGAPORE) Corporation, all rights reserved.
+			Reproduction or disclosure of this file or its contents without the
+			prior written consent of DigiPen Institute of Technology is prohibited.
+__________________________________________________________________________________*/
+
+#include "meowpch.h"
+
+#include "LodSelector.h"
+
+namespace Nya
+{
+	void LodSelector::SetProjection(const float fovY, const float viewportHeight)
+	{
+		m_ProjectionScale = viewportHeight / (2.f * std::tan(fovY * 0.5f));
+	}
+
+	void LodSelector::SetThreshold(const float thresholdPixels, const float hysteresis)
+	{
+		m_ThresholdPixels = thresholdPixels;
+		m_Hysteresis = hysteresis;
+	}
+
+	float LodSelector::GetProjectedError(const float error, const float distance) const
+	{
+		// Objects around or in front of the near plane are treated as very close.
+		return error * m_ProjectionScale / std::max(distance, 1e-3f);
+	}
+
+	uint32_t LodSelector::Select(const MeshLod* lods, const uint32_t lodCount, const float distance, uint32_t currentLod) const
+	{
+		if (lodCount == 0)
+			return 0;
+
+		currentLod = std::min(currentLod, lodCount - 1);
+		const auto coarsestWithin = [&](const float threshold)
+		{
+			uint32_t lod = 0;
+			while (lod + 1 < lodCount && GetProjectedError(lods[lod + 1].m_Error, distance) <= threshold)
+				++lod;
+			return lod;
+		};
+
+		// Current LOD is too coarse even with the band: refine to what the threshold allows.
+		if (GetProjectedError(lods[currentLod].m_Error, distance) > m_ThresholdPixels * (1.f + m_Hysteresis))
+			return coarsestWithin(m_ThresholdPixels);
+
+		// Only coarsen once the coarser LOD is comfortably under the threshold.
+		return std::max(currentLod, coarsestWithin(m_ThresholdPixels * (1.f - m_Hysteresis)));
+	}
+}
@@ -0,0 +1,43 @@
+﻿/*!
+\file		LodSelector.h
+\date		19/10/2026
+
+\author		Adrian Tan
+\email		t.xingkhiangadrian\@digipen.edu
+
+\brief		Contains definition of LodSelector class.
+
+\copyright	All content © 2023 DigiPen (SINGAPORE) Corporation, all rights reserved.
+			Reproduction or disclosure of this file or its contents without the
+			prior written consent of DigiPen Institute of Technology is prohibited.
+__________________________________________________________________________________*/
+#pragma once
+
+#include "MeshSimplifier.h"
+
+#include <cstdint>
+
+namespace Nya
+{
+	// Picks the coarsest LOD whose simplification error stays under a pixel threshold on screen.
+	// A hysteresis band around the threshold keeps objects near a switching distance from popping back and forth.
+	class LodSelector
+	{
+		float m_ProjectionScale = 1.f;		// Pixels per object space unit at distance 1.
+		float m_ThresholdPixels = 1.f;
+		float m_Hysteresis = 0.25f;
+
+	public:
+		// fovY in radians, viewportHeight in pixels.
+		void SetProjection(float fovY, float viewportHeight);
+		// Allowed error in pixels, and the fraction around it an object's current LOD may drift before switching.
+		void SetThreshold(float thresholdPixels, float hysteresis = 0.25f);
+
+		// Error in pixels of an object space error seen from distance.
+		float GetProjectedError(float error, float distance) const;
+
+		// distance is from the camera to the object's bounds, already scaled into the mesh's object space.
+		// currentLod is the object's LOD last frame, or lodCount - 1 for a new object.
+		uint32_t Select(const MeshLod* lods, uint32_t lodCount, float distance, uint32_t currentLod) const;
+	};
+}
@@ -0,0 +1,419 @@
+﻿/*!
+\file		MeshOptimizer.cpp
+\date		19/10/2026
+
+\author		Adrian Tan
+\email		t.xingkhiangadrian\@digipen.edu
+
+\brief		Contains implementation for MeshOptimizer class functions.
+
+\copyright	All content © 2023 DigiPen (SINGAPORE) Corporation, all rights reserved.
+			Reproduction or disclosure of this file or its contents without the
+			prior written consent of DigiPen Institute of Technology is prohibited.
+__________________________________________________________________________________*/
+
+#include "meowpch.h"
+
+#include "MeshOptimizer.h"
+
+namespace Nya
+{
+	//-- Helpers.
+	namespace
+	{
+		constexpr uint32_t s_InvalidIndex = ~0u;
+
+		// Triangles using each vertex, as a CSR list.
+		struct VertexAdjacency
+		{
+			std::vector<uint32_t> m_Offsets;
+			std::vector<uint32_t> m_Triangles;
+			std::vector<uint32_t> m_LiveCounts;
+
+			VertexAdjacency(const std::vector<uint32_t>& indices, const uint32_t vertexCount)
+				: m_Offsets(vertexCount + 1, 0), m_Triangles(indices.size()), m_LiveCounts(vertexCount, 0)
+			{
+				for (const uint32_t index : indices)
+					++m_LiveCounts[index];
+
+				for (uint32_t v = 0; v < vertexCount; ++v)
+					m_Offsets[v + 1] = m_Offsets[v] + m_LiveCounts[v];
+
+				std::vector<uint32_t> cursor(m_Offsets.begin(), m_Offsets.end() - 1);
+				for (size_t i = 0; i < indices.size(); ++i)
+					m_Triangles[cursor[indices[i]]++] = static_cast<uint32_t>(i / 3);
+			}
+		};
+
+		// FIFO cache simulation, calls onTriangle(triangle, misses) for each triangle.
+		template <typename TCallback>
+		void SimulateFifoCache(const uint32_t* indices, const size_t indexCount, const uint32_t vertexCount, const uint32_t cacheSize, std::vector<uint32_t>& timestamps, TCallback&& onTriangle)
+		{
+			// A vertex is cached if it was inserted less than cacheSize insertions ago.
+			uint32_t time = cacheSize + 1;
+			std::fill(timestamps.begin(), timestamps.begin() + vertexCount, 0u);
+
+			for (size_t i = 0; i + 2 < indexCount; i += 3)
+			{
+				uint32_t misses = 0;
+				for (size_t k = 0; k < 3; ++k)
+				{
+					const uint32_t v = indices[i + k];
+					if (time - timestamps[v] > cacheSize)
+					{
+						timestamps[v] = time++;
+						++misses;
+					}
+				}
+				onTriangle(i / 3, misses);
+			}
+		}
+
+		// Skips to the most recent dead-end vertex with live triangles, or the next one in input order.
+		uint32_t SkipDeadEnd(const std::vector<uint32_t>& liveCounts, std::vector<uint32_t>& deadEndStack, uint32_t& inputCursor)
+		{
+			while (!deadEndStack.empty())
+			{
+				const uint32_t v = deadEndStack.back();
+				deadEndStack.pop_back();
+				if (liveCounts[v] > 0)
+					return v;
+			}
+
+			while (inputCursor < liveCounts.size())
+			{
+				if (liveCounts[inputCursor] > 0)
+					return inputCursor;
+				++inputCursor;
+			}
+
+			return s_InvalidIndex;
+		}
+	}
+
+
+	//-- MeshOptimizer Functions.
+	VertexCacheStats MeshOptimizer::AnalyzeVertexCache(const std::vector<uint32_t>& indices, const uint32_t vertexCount, const uint32_t cacheSize)
+	{
+		VertexCacheStats stats;
+		const size_t triangleCount = indices.size() / 3;
+		if (triangleCount == 0 || vertexCount == 0)
+			return stats;
+
+		std::vector<uint32_t> timestamps(vertexCount);
+		SimulateFifoCache(indices.data(), indices.size(), vertexCount, cacheSize, timestamps, [&stats](size_t, const uint32_t misses)
+		{
+			stats.m_Transformed += misses;
+		});
+
+		std::vector<bool> used(vertexCount, false);
+		uint32_t uniqueCount = 0;
+		for (const uint32_t index : indices)
+		{
+			if (!used[index])
+			{
+				used[index] = true;
+				++uniqueCount;
+			}
+		}
+
+		stats.m_Acmr = static_cast<float>(stats.m_Transformed) / static_cast<float>(triangleCount);
+		stats.m_Atvr = static_cast<float>(stats.m_Transformed) / static_cast<float>(uniqueCount);
+		return stats;
+	}
+
+	void MeshOptimizer::OptimizeVertexCache(std::vector<uint32_t>& indices, const uint32_t vertexCount, const uint32_t cacheSize)
+	{
+		const size_t triangleCount = indices.size() / 3;
+		if (triangleCount == 0)
+			return;
+
+		VertexAdjacency adjacency(indices, vertexCount);
+		std::vector<uint32_t>& liveCounts = adjacency.m_LiveCounts;
+
+		std::vector<uint32_t> timestamps(vertexCount, 0);
+		std::vector<bool> emitted(triangleCount, false);
+		std::vector<uint32_t> deadEndStack;
+		std::vector<uint32_t> candidates;
+		std::vector<uint32_t> output;
+		output.reserve(indices.size());
+
+		uint32_t time = cacheSize + 1;
+		uint32_t inputCursor = 0;
+		uint32_t fanningVertex = SkipDeadEnd(liveCounts, deadEndStack, inputCursor);
+
+		while (fanningVertex != s_InvalidIndex)
+		{
+			candidates.clear();
+
+			// Emit every remaining triangle around the fanning vertex.
+			for (uint32_t i = adjacency.m_Offsets[fanningVertex]; i < adjacency.m_Offsets[fanningVertex + 1]; ++i)
+			{
+				const uint32_t triangle = adjacency.m_Triangles[i];
+				if (emitted[triangle])
+					continue;
+				emitted[triangle] = true;
+
+				for (uint32_t k = 0; k < 3; ++k)
+				{
+					const uint32_t v = indices[triangle * 3 + k];
+					output.push_back(v);
+					deadEndStack.push_back(v);
+					candidates.push_back(v);
+					--liveCounts[v];
+
+					if (time - timestamps[v] > cacheSize)
+						timestamps[v] = time++;
+				}
+			}
+
+			// Next fanning vertex is the candidate that stays in cache longest after emitting its fan.
+			uint32_t best = s_InvalidIndex;
+			int bestPriority = -1;
+			for (const uint32_t v : candidates)
+			{
+				if (liveCounts[v] == 0)
+					continue;
+
+				int priority = 0;
+				if (time - timestamps[v] + 2 * liveCounts[v] <= cacheSize)
+					priority = static_cast<int>(time - timestamps[v]);
+
+				if (priority > bestPriority)
+				{
+					bestPriority = priority;
+					best = v;
+				}
+			}
+
+			fanningVertex = best != s_InvalidIndex ? best : SkipDeadEnd(liveCounts, deadEndStack, inputCursor);
+		}
+
+		indices = std::move(output);
+	}
+
+	void MeshOptimizer::OptimizeOverdraw(std::vector<uint32_t>& indices, const float* positions, const size_t positionStride, const uint32_t vertexCount, const float threshold)
+	{
+		const size_t triangleCount = indices.size() / 3;
+		if (triangleCount < 2)
+			return;
+
+		const auto position = [positions, positionStride](const uint32_t v)
+		{
+			const float* p = reinterpret_cast<const float*>(reinterpret_cast<const uint8_t*>(positions) + v * positionStride);
+			return std::array<float, 3>{ p[0], p[1], p[2] };
+		};
+
+		//-- Hard boundaries: triangles where the cache fully restarted (all three vertices missed).
+		std::vector<uint32_t> timestamps(vertexCount);
+		std::vector<size_t> hardClusters;
+		uint32_t totalMisses = 0;
+		SimulateFifoCache(indices.data(), indices.size(), vertexCount, s_CacheSize, timestamps, [&](const size_t triangle, const uint32_t misses)
+		{
+			if (triangle == 0 || misses == 3)
+				hardClusters.push_back(triangle);
+			totalMisses += misses;
+		});
+		hardClusters.push_back(triangleCount);
+
+		//-- Soft boundaries: split hard clusters further wherever the piece on its own stays within threshold of the mesh ACMR.
+		const float meshAcmr = static_cast<float>(totalMisses) / static_cast<float>(triangleCount);
+		std::vector<size_t> clusters;
+		std::fill(timestamps.begin(), timestamps.end(), 0u);
+		uint32_t time = s_CacheSize + 1;
+		for (size_t c = 0; c + 1 < hardClusters.size(); ++c)
+		{
+			const size_t end = hardClusters[c + 1];
+			size_t start = hardClusters[c];
+			uint32_t misses = 0;
+			clusters.push_back(start);
+
+			// Each piece is measured from a cold cache, so a split stays safe whatever ends up drawn before it.
+			time += s_CacheSize + 1;
+			for (size_t triangle = start; triangle < end; ++triangle)
+			{
+				for (size_t k = 0; k < 3; ++k)
+				{
+					const uint32_t v = indices[triangle * 3 + k];
+					if (time - timestamps[v] > s_CacheSize)
+					{
+						timestamps[v] = time++;
+						++misses;
+					}
+				}
+
+				const size_t pieceTriangles = triangle + 1 - start;
+				if (triangle + 1 < end && pieceTriangles >= s_CacheSize && static_cast<float>(misses) <= meshAcmr * threshold * static_cast<float>(pieceTriangles))
+				{
+					start = triangle + 1;
+					misses = 0;
+					clusters.push_back(start);
+					time += s_CacheSize + 1;
+				}
+			}
+		}
+		clusters.push_back(triangleCount);
+
+		//-- Mesh centroid.
+		std::array<float, 3> meshCentroid{ 0.f, 0.f, 0.f };
+		for (const uint32_t index : indices)
+		{
+			const auto p = position(index);
+			for (size_t k = 0; k < 3; ++k)
+				meshCentroid[k] += p[k];
+		}
+		for (float& value : meshCentroid)
+			value /= static_cast<float>(indices.size());
+
+		//-- Sort clusters so the ones facing away from the centre (most likely to occlude others) draw first.
+		const size_t clusterCount = clusters.size() - 1;
+		std::vector<float> sortKeys(clusterCount);
+		for (size_t c = 0; c < clusterCount; ++c)
+		{
+			std::array<float, 3> centroid{ 0.f, 0.f, 0.f };
+			std::array<float, 3> normal{ 0.f, 0.f, 0.f };
+			float totalArea = 0.f;
+
+			for (size_t t = clusters[c]; t < clusters[c + 1]; ++t)
+			{
+				const auto p0 = position(indices[t * 3 + 0]);
+				const auto p1 = position(indices[t * 3 + 1]);
+				const auto p2 = position(indices[t * 3 + 2]);
+
+				const float e1[3] = { p1[0] - p0[0], p1[1] - p0[1], p1[2] - p0[2] };
+				const float e2[3] = { p2[0] - p0[0], p2[1] - p0[1], p2[2] - p0[2] };
+				// Unnormalized face normal, its length is twice the triangle area.
+				const float n[3] = { e1[1] * e2[2] - e1[2] * e2[1], e1[2] * e2[0] - e1[0] * e2[2], e1[0] * e2[1] - e1[1] * e2[0] };
+				const float area = std::sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+
+				for (size_t k = 0; k < 3; ++k)
+				{
+					centroid[k] += (p0[k] + p1[k] + p2[k]) / 3.f * area;
+					normal[k] += n[k];
+				}
+				totalArea += area;
+			}
+
+			float key = 0.f;
+			if (totalArea > 0.f)
+			{
+				for (size_t k = 0; k < 3; ++k)
+					key += (centroid[k] / totalArea - meshCentroid[k]) * normal[k];
+			}
+			sortKeys[c] = key;
+		}
+
+		std::vector<uint32_t> order(clusterCount);
+		for (uint32_t c = 0; c < clusterCount; ++c)
+			order[c] = c;
+		std::stable_sort(order.begin(), order.end(), [&sortKeys](const uint32_t a, const uint32_t b) { return sortKeys[a] > sortKeys[b]; });
+
+		std::vector<uint32_t> output;
+		output.reserve(indices.size());
+		for (const uint32_t c : order)
+			output.insert(output.end(), indices.begin() + clusters[c] * 3, indices.begin() + clusters[c + 1] * 3);
+
+		indices = std::move(output);
+	}
+
+	std::vector<uint32_t> MeshOptimizer::OptimizeVertexFetch(std::vector<uint32_t>& indices, const uint32_t vertexCount)
+	{
+		std::vector<uint32_t> remap(vertexCount, s_InvalidIndex);
+		uint32_t next = 0;
+
+		for (uint32_t& index : indices)
+		{
+			if (remap[index] == s_InvalidIndex)
+				remap[index] = next++;
+			index = remap[index];
+		}
+
+		for (uint32_t& target : remap)
+		{
+			if (target == s_InvalidIndex)
+				target = next++;
+		}
+
+		return remap;
+	}
+
+	void MeshOptimizer::RemapVertices(const void* src, void* dst, const uint32_t vertexCount, const size_t vertexStride, const std::vector<uint32_t>& remap)
+	{
+		const uint8_t* srcBytes = static_cast<const uint8_t*>(src);
+		uint8_t* dstBytes = static_cast<uint8_t*>(dst);
+
+		for (uint32_t v = 0; v < vertexCount; ++v)
+			memcpy(dstBytes + remap[v] * vertexStride, srcBytes + v * vertexStride, vertexStride);
+	}
+
+	void MeshOptimizer::Benchmark(const uint32_t triangleCount)
+	{
+		// Each vertex carries its original index, so the triangles can be compared across the remap.
+		struct BenchmarkVertex
+		{
+			float m_Position[3];
+			uint32_t m_Id;
+		};
+
+		//-- UV sphere, two triangles per quad, with the triangles shuffled so the cache starts out cold.
+		const uint32_t segments = std::max(static_cast<uint32_t>(std::sqrt(static_cast<float>(triangleCount))), 4u);
+		const uint32_t rings = std::max(triangleCount / (2 * segments), 3u);
+		std::vector<BenchmarkVertex> vertices;
+		for (uint32_t ring = 0; ring <= rings; ++ring)
+		{
+			const float theta = 3.14159265f * static_cast<float>(ring) / static_cast<float>(rings);
+			for (uint32_t segment = 0; segment <= segments; ++segment)
+			{
+				const float phi = 6.28318531f * static_cast<float>(segment) / static_cast<float>(segments);
+				const uint32_t id = static_cast<uint32_t>(vertices.size());
+				vertices.push_back({ { std::sin(theta) * std::cos(phi), std::cos(theta), std::sin(theta) * std::sin(phi) }, id });
+			}
+		}
+
+		std::vector<std::array<uint32_t, 3>> triangles;
+		for (uint32_t ring = 0; ring < rings; ++ring)
+		{
+			for (uint32_t segment = 0; segment < segments; ++segment)
+			{
+				const uint32_t a = ring * (segments + 1) + segment;
+				const uint32_t b = a + segments + 1;
+				triangles.push_back({ a, b, b + 1 });
+				triangles.push_back({ a, b + 1, a + 1 });
+			}
+		}
+		std::shuffle(triangles.begin(), triangles.end(), std::mt19937(1337));
+
+		std::vector<uint32_t> indices;
+		for (const auto& triangle : triangles)
+			indices.insert(indices.end(), triangle.begin(), triangle.end());
+
+		// Triangles by original vertex ids, rotated to start at the smallest so winding is kept, then sorted.
+		const auto canonicalTriangles = [](const std::vector<uint32_t>& triangleIndices, const std::vector<BenchmarkVertex>& triangleVertices)
+		{
+			std::vector<std::array<uint32_t, 3>> result;
+			for (size_t i = 0; i < triangleIndices.size(); i += 3)
+			{
+				std::array<uint32_t, 3> triangle = { triangleVertices[triangleIndices[i]].m_Id, triangleVertices[triangleIndices[i + 1]].m_Id,
+					triangleVertices[triangleIndices[i + 2]].m_Id };
+				std::rotate(triangle.begin(), std::min_element(triangle.begin(), triangle.end()), triangle.end());
+				result.push_back(triangle);
+			}
+			std::sort(result.begin(), result.end());
+			return result;
+		};
+		const std::vector<std::array<uint32_t, 3>> before = canonicalTriangles(indices, vertices);
+
+		const auto startTime = std::chrono::high_resolution_clock::now();
+		const MeshOptimizeStats stats = Optimize(indices, vertices, offsetof(BenchmarkVertex, m_Position));
+		const auto endTime = std::chrono::high_resolution_clock::now();
+
+		if (!(stats.m_After.m_Acmr < stats.m_Before.m_Acmr))
+			throw std::runtime_error("Mesh optimizer didn't improve the ACMR!");
+		if (canonicalTriangles(indices, vertices) != before)
+			throw std::runtime_error("Mesh optimizer changed the triangles!");
+
+		std::cout << "\t" << "Mesh optimize of " << indices.size() / 3 << " triangles: ACMR " << stats.m_Before.m_Acmr << " -> " << stats.m_After.m_Acmr
+			<< ", ATVR " << stats.m_Before.m_Atvr << " -> " << stats.m_After.m_Atvr << " in "
+			<< std::chrono::duration<float, std::chrono::milliseconds::period>(endTime - startTime).count() << "ms" << std::endl;
+	}
+}
@@ -0,0 +1,92 @@
+﻿/*!
+\file		MeshOptimizer.h
+\date		19/10/2026
+
+\author		Adrian Tan
+\email		t.xingkhiangadrian\@digipen.edu
+
+\brief		Contains definition of MeshOptimizer class.
+			Offline (import time) index and vertex reordering for post-transform
+			vertex cache, overdraw and vertex fetch locality. Pure CPU, no Vulkan.
+
+\copyright	All content © 2023 DigiPen (SINGAPORE) Corporation, all rights reserved.
+			Reproduction or disclosure of this file or its contents without the
+			prior written consent of DigiPen Institute of Technology is prohibited.
+__________________________________________________________________________________*/
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace Nya
+{
+	struct VertexCacheStats
+	{
+		float m_Acmr = 0.f;				// Average cache miss ratio, transformed vertices per triangle (0.5 is ideal, 3 is worst).
+		float m_Atvr = 0.f;				// Average transformed to vertex ratio, transformed vertices per unique vertex (1 is ideal).
+		uint32_t m_Transformed = 0;		// Total vertex shader invocations.
+	};
+
+	struct MeshOptimizeStats
+	{
+		VertexCacheStats m_Before;
+		VertexCacheStats m_After;
+	};
+
+	class MeshOptimizer
+	{
+	public:
+		// Post-transform cache size used for both the optimizer and the analysis, a conservative fit for current GPUs.
+		static constexpr uint32_t s_CacheSize = 16;
+		// Overdraw ordering may make the vertex cache this much worse at most.
+		static constexpr float s_DefaultOverdrawThreshold = 1.05f;
+
+		// Simulates a FIFO post-transform cache over a triangle list.
+		static VertexCacheStats AnalyzeVertexCache(const std::vector<uint32_t>& indices, uint32_t vertexCount, uint32_t cacheSize = s_CacheSize);
+
+		// Reorders triangles for vertex cache locality (Tipsify, Sander et al. 2007).
+		static void OptimizeVertexCache(std::vector<uint32_t>& indices, uint32_t vertexCount, uint32_t cacheSize = s_CacheSize);
+
+		// Reorders clusters of an already cache-optimized triangle list so outward-facing clusters draw first.
+		// positions points to the first vertex's float3 position, positionStride is in bytes.
+		static void OptimizeOverdraw(std::vector<uint32_t>& indices, const float* positions, size_t positionStride, uint32_t vertexCount, float threshold = s_DefaultOverdrawThreshold);
+
+		// Builds an old -> new vertex remap in first-use order, and rewrites indices to match.
+		// Unreferenced vertices are moved to the end.
+		static std::vector<uint32_t> OptimizeVertexFetch(std::vector<uint32_t>& indices, uint32_t vertexCount);
+
+		// Reorders a raw vertex buffer with a remap from OptimizeVertexFetch. src and dst must not overlap.
+		static void RemapVertices(const void* src, void* dst, uint32_t vertexCount, size_t vertexStride, const std::vector<uint32_t>& remap);
+
+		// Runs all three passes on an owned mesh and reports cache stats before and after.
+		template <typename TVertex>
+		static MeshOptimizeStats Optimize(std::vector<uint32_t>& indices, std::vector<TVertex>& vertices, size_t positionOffset, float overdrawThreshold = s_DefaultOverdrawThreshold);
+
+		// Runs Optimize on a sphere of about triangleCount triangles in shuffled order, and prints the cache stats and time.
+		// Throws if the ACMR doesn't improve, or the mesh no longer has the same triangles with the same winding.
+		static void Benchmark(uint32_t triangleCount);
+	};
+
+	template <typename TVertex>
+	MeshOptimizeStats MeshOptimizer::Optimize(std::vector<uint32_t>& indices, std::vector<TVertex>& vertices, const size_t positionOffset, const float overdrawThreshold)
+	{
+		const uint32_t vertexCount = static_cast<uint32_t>(vertices.size());
+
+		MeshOptimizeStats stats;
+		stats.m_Before = AnalyzeVertexCache(indices, vertexCount);
+
+		OptimizeVertexCache(indices, vertexCount);
+		const float* positions = reinterpret_cast<const float*>(reinterpret_cast<const uint8_t*>(vertices.data()) + positionOffset);
+		OptimizeOverdraw(indices, positions, sizeof(TVertex), vertexCount, overdrawThreshold);
+
+		const std::vector<uint32_t> remap = OptimizeVertexFetch(indices, vertexCount);
+		std::vector<TVertex> remapped(vertices.size());
+		RemapVertices(vertices.data(), remapped.data(), vertexCount, sizeof(TVertex), remap);
+		vertices = std::move(remapped);
+
+		stats.m_After = AnalyzeVertexCache(indices, vertexCount);
+		return stats;
+	}
+}
@@ -0,0 +1,315 @@
+﻿/*!
+\file		MeshSimplifier.cpp
+\date		19/10/2026
+
+\author		Adrian Tan
+\email		t.xingkhiangadrian\@digipen.edu
+
+\brief		Contains implementation for MeshSimplifier class functions.
+
+\copyright	All content © 2023 DigiPen (SINGAPORE) Corporation, all rights reserved.
+			Reproduction or disclosure of this file or its contents without the
+			prior written consent of DigiPen Institute of Technology is prohibited.
+__________________________________________________________________________________*/
+
+#include "meowpch.h"
+
+#include "MeshSimplifier.h"
+#include "MeshOptimizer.h"
+
+#include <glm/glm.hpp>
+
+namespace Nya
+{
+	//-- Helpers.
+	namespace
+	{
+		// Area weighted sum of squared distances to triangle planes, as a symmetric 4x4 matrix.
+		struct Quadric
+		{
+			double m_A00 = 0.0, m_A01 = 0.0, m_A02 = 0.0, m_A03 = 0.0;
+			double m_A11 = 0.0, m_A12 = 0.0, m_A13 = 0.0;
+			double m_A22 = 0.0, m_A23 = 0.0;
+			double m_A33 = 0.0;
+			double m_Weight = 0.0;
+
+			static Quadric FromPlane(const glm::dvec3& normal, const double distance, const double weight)
+			{
+				const double a = normal.x, b = normal.y, c = normal.z, d = distance;
+				return { a * a * weight, a * b * weight, a * c * weight, a * d * weight,
+					b * b * weight, b * c * weight, b * d * weight,
+					c * c * weight, c * d * weight,
+					d * d * weight, weight };
+			}
+
+			void Add(const Quadric& other)
+			{
+				m_A00 += other.m_A00; m_A01 += other.m_A01; m_A02 += other.m_A02; m_A03 += other.m_A03;
+				m_A11 += other.m_A11; m_A12 += other.m_A12; m_A13 += other.m_A13;
+				m_A22 += other.m_A22; m_A23 += other.m_A23;
+				m_A33 += other.m_A33;
+				m_Weight += other.m_Weight;
+			}
+
+			// Weighted mean squared distance of p to the planes.
+			double Evaluate(const glm::dvec3& p) const
+			{
+				const double x = p.x, y = p.y, z = p.z;
+				const double value = m_A00 * x * x + 2.0 * m_A01 * x * y + 2.0 * m_A02 * x * z + 2.0 * m_A03 * x
+					+ m_A11 * y * y + 2.0 * m_A12 * y * z + 2.0 * m_A13 * y
+					+ m_A22 * z * z + 2.0 * m_A23 * z
+					+ m_A33;
+				return m_Weight > 0.0 ? std::max(value, 0.0) / m_Weight : 0.0;
+			}
+		};
+
+		// Triangles using each vertex, as a CSR list.
+		struct VertexAdjacency
+		{
+			std::vector<uint32_t> m_Offsets;
+			std::vector<uint32_t> m_Triangles;
+
+			VertexAdjacency(const std::vector<uint32_t>& indices, const uint32_t vertexCount)
+				: m_Offsets(vertexCount + 1, 0), m_Triangles(indices.size())
+			{
+				for (const uint32_t index : indices)
+					++m_Offsets[index + 1];
+
+				for (uint32_t v = 0; v < vertexCount; ++v)
+					m_Offsets[v + 1] += m_Offsets[v];
+
+				std::vector<uint32_t> cursor(m_Offsets.begin(), m_Offsets.end() - 1);
+				for (size_t i = 0; i < indices.size(); ++i)
+					m_Triangles[cursor[indices[i]]++] = static_cast<uint32_t>(i / 3);
+			}
+		};
+
+		struct Collapse
+		{
+			uint32_t m_From = 0;
+			uint32_t m_To = 0;
+			double m_Cost = 0.0;
+		};
+
+		glm::dvec3 ReadPosition(const float* positions, const size_t positionStride, const uint32_t vertex)
+		{
+			const float* p = reinterpret_cast<const float*>(reinterpret_cast<const uint8_t*>(positions) + positionStride * vertex);
+			return { p[0], p[1], p[2] };
+		}
+
+		uint64_t EdgeKey(const uint32_t a, const uint32_t b)
+		{
+			return a < b ? static_cast<uint64_t>(a) << 32 | b : static_cast<uint64_t>(b) << 32 | a;
+		}
+
+		// True if moving from to the position of to keeps every other triangle around from facing the same way.
+		bool CollapseKeepsOrientation(const std::vector<uint32_t>& indices, const std::vector<glm::dvec3>& points, const uint32_t* triangles,
+			const uint32_t triangleCount, const uint32_t from, const uint32_t to)
+		{
+			for (uint32_t i = 0; i < triangleCount; ++i)
+			{
+				const uint32_t* triangle = &indices[static_cast<size_t>(triangles[i]) * 3];
+				if (triangle[0] == to || triangle[1] == to || triangle[2] == to)
+					continue;
+
+				glm::dvec3 corners[3] = { points[triangle[0]], points[triangle[1]], points[triangle[2]] };
+				const glm::dvec3 before = glm::cross(corners[1] - corners[0], corners[2] - corners[0]);
+				for (uint32_t k = 0; k < 3; ++k)
+				{
+					if (triangle[k] == from)
+						corners[k] = points[to];
+				}
+				const glm::dvec3 after = glm::cross(corners[1] - corners[0], corners[2] - corners[0]);
+
+				// Reject flips and slivers turned more than about 75 degrees.
+				if (glm::dot(before, after) <= 0.25 * glm::length(before) * glm::length(after))
+					return false;
+			}
+
+			return true;
+		}
+	}
+
+
+	//-- MeshSimplifier Functions.
+	std::vector<uint32_t> MeshSimplifier::Simplify(const std::vector<uint32_t>& indices, const float* positions, const size_t positionStride, const uint32_t vertexCount,
+		const size_t targetIndexCount, const float maxError, float* resultError)
+	{
+		std::vector<uint32_t> result = indices;
+		std::vector<glm::dvec3> points(vertexCount);
+		for (uint32_t v = 0; v < vertexCount; ++v)
+			points[v] = ReadPosition(positions, positionStride, v);
+
+		//-- Plane quadrics, weighted by triangle area.
+		std::vector<Quadric> quadrics(vertexCount);
+		for (size_t i = 0; i + 2 < result.size(); i += 3)
+		{
+			const glm::dvec3& p0 = points[result[i]];
+			const glm::dvec3 normal = glm::cross(points[result[i + 1]] - p0, points[result[i + 2]] - p0);
+			const double length = glm::length(normal);
+			if (length <= 0.0)
+				continue;
+
+			const glm::dvec3 unitNormal = normal / length;
+			const Quadric quadric = Quadric::FromPlane(unitNormal, -glm::dot(unitNormal, p0), length * 0.5);
+			for (size_t k = 0; k < 3; ++k)
+				quadrics[result[i + k]].Add(quadric);
+		}
+
+		//-- Lock vertices on open or non-manifold edges. Attribute seams split vertices, so they show up as open edges too.
+		std::vector<uint8_t> locked(vertexCount, 0);
+		{
+			std::unordered_map<uint64_t, uint32_t> edgeUses;
+			edgeUses.reserve(result.size());
+			for (size_t i = 0; i + 2 < result.size(); i += 3)
+			{
+				for (size_t k = 0; k < 3; ++k)
+					++edgeUses[EdgeKey(result[i + k], result[i + (k + 1) % 3])];
+			}
+
+			for (const auto& [edge, uses] : edgeUses)
+			{
+				if (uses != 2)
+				{
+					locked[edge >> 32] = 1;
+					locked[edge & 0xFFFFFFFF] = 1;
+				}
+			}
+		}
+
+		const double maxCost = static_cast<double>(maxError) * maxError;
+		double reachedCost = 0.0;
+		std::vector<uint32_t> remap(vertexCount);
+		std::vector<uint8_t> touched(vertexCount);
+		std::vector<Collapse> collapses;
+
+		//-- Passes of independent collapses, cheapest first, until the target is met or nothing can collapse.
+		while (result.size() > targetIndexCount)
+		{
+			const VertexAdjacency adjacency(result, vertexCount);
+
+			// Cheapest collapse of each unlocked vertex along any of its edges.
+			collapses.clear();
+			for (uint32_t from = 0; from < vertexCount; ++from)
+			{
+				if (locked[from])
+					continue;
+
+				Collapse best{ from, from, std::numeric_limits<double>::max() };
+				for (uint32_t t = adjacency.m_Offsets[from]; t < adjacency.m_Offsets[from + 1]; ++t)
+				{
+					const uint32_t* triangle = &result[static_cast<size_t>(adjacency.m_Triangles[t]) * 3];
+					for (uint32_t k = 0; k < 3; ++k)
+					{
+						const uint32_t to = triangle[k];
+						if (to == from)
+							continue;
+
+						Quadric quadric = quadrics[from];
+						quadric.Add(quadrics[to]);
+						const double cost = quadric.Evaluate(points[to]);
+						if (cost < best.m_Cost)
+							best = { from, to, cost };
+					}
+				}
+
+				if (best.m_To != from && best.m_Cost <= maxCost)
+					collapses.push_back(best);
+			}
+
+			std::ranges::sort(collapses, {}, &Collapse::m_Cost);
+
+			// Each interior collapse removes two triangles.
+			const size_t trianglesToRemove = (result.size() - targetIndexCount + 2) / 3;
+			size_t removed = 0;
+			for (uint32_t v = 0; v < vertexCount; ++v)
+				remap[v] = v;
+			std::ranges::fill(touched, 0);
+
+			for (const Collapse& collapse : collapses)
+			{
+				if (removed >= trianglesToRemove)
+					break;
+				if (touched[collapse.m_From] || touched[collapse.m_To])
+					continue;
+
+				const uint32_t* triangles = adjacency.m_Triangles.data() + adjacency.m_Offsets[collapse.m_From];
+				const uint32_t triangleCount = adjacency.m_Offsets[collapse.m_From + 1] - adjacency.m_Offsets[collapse.m_From];
+				if (!CollapseKeepsOrientation(result, points, triangles, triangleCount, collapse.m_From, collapse.m_To))
+					continue;
+
+				remap[collapse.m_From] = collapse.m_To;
+				quadrics[collapse.m_To].Add(quadrics[collapse.m_From]);
+				reachedCost = std::max(reachedCost, collapse.m_Cost);
+				removed += 2;
+
+				// Keep the neighbourhood fixed for the rest of the pass, so collapses never interact.
+				for (uint32_t t = 0; t < triangleCount; ++t)
+				{
+					for (uint32_t k = 0; k < 3; ++k)
+						touched[result[static_cast<size_t>(triangles[t]) * 3 + k]] = 1;
+				}
+			}
+
+			if (removed == 0)
+				break;
+
+			//-- Apply the collapses and drop triangles that became degenerate.
+			size_t write = 0;
+			for (size_t i = 0; i + 2 < result.size(); i += 3)
+			{
+				const uint32_t a = remap[result[i]];
+				const uint32_t b = remap[result[i + 1]];
+				const uint32_t c = remap[result[i + 2]];
+				if (a == b || b == c || c == a)
+					continue;
+
+				result[write++] = a;
+				result[write++] = b;
+				result[write++] = c;
+			}
+			result.resize(write);
+		}
+
+		if (resultError)
+			*resultError = static_cast<float>(std::sqrt(reachedCost));
+
+		return result;
+	}
+
+	LodChain MeshSimplifier::BuildLodChain(const std::vector<uint32_t>& indices, const float* positions, const size_t positionStride, const uint32_t vertexCount,
+		const uint32_t maxLods)
+	{
+		LodChain chain;
+		chain.m_Indices = indices;
+		chain.m_Lods.push_back({ 0, static_cast<uint32_t>(indices.size()), 0.f });
+
+		//-- Simplify from the full mesh every time, so errors are measured against it and do not accumulate.
+		size_t targetIndexCount = indices.size();
+		while (chain.m_Lods.size() < maxLods)
+		{
+			const MeshLod& previous = chain.m_Lods.back();
+			if (previous.m_IndexCount / 3 <= s_MinLodTriangles)
+				break;
+
+			targetIndexCount = static_cast<size_t>(static_cast<float>(targetIndexCount / 3) * s_LodReduction) * 3;
+			float error = 0.f;
+			std::vector<uint32_t> lodIndices = Simplify(indices, positions, positionStride, vertexCount, targetIndexCount, 1e30f, &error);
+
+			// Stop once locked borders or seams keep the mesh from shrinking meaningfully.
+			if (lodIndices.empty() || lodIndices.size() > previous.m_IndexCount * 9 / 10)
+				break;
+
+			MeshOptimizer::OptimizeVertexCache(lodIndices, vertexCount);
+
+			MeshLod lod;
+			lod.m_FirstIndex = static_cast<uint32_t>(chain.m_Indices.size());
+			lod.m_IndexCount = static_cast<uint32_t>(lodIndices.size());
+			lod.m_Error = std::max(error, previous.m_Error);
+			chain.m_Indices.insert(chain.m_Indices.end(), lodIndices.begin(), lodIndices.end());
+			chain.m_Lods.push_back(lod);
+		}
+
+		return chain;
+	}
+}
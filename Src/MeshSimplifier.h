@@ -0,0 +1,56 @@
+﻿/*!
+\file		MeshSimplifier.h
+\date		19/10/2026
+
+\author		Adrian Tan
+\email		t.xingkhiangadrian\@digipen.edu
+
+\brief		Contains definition of MeshSimplifier class.
+			Offline (import time) quadric error metric simplification into a chain of
+			LOD index buffers that share the original vertices. Pure CPU, no Vulkan.
+
+\copyright	All content © 2023 DigiPen (SINGAPORE) Corporation, all rights reserved.
+			Reproduction or disclosure of this file or its contents without the
+			prior written consent of DigiPen Institute of Technology is prohibited.
+__________________________________________________________________________________*/
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace Nya
+{
+	// One level of detail, an index range in its LodChain's indices.
+	struct MeshLod
+	{
+		uint32_t m_FirstIndex = 0;
+		uint32_t m_IndexCount = 0;
+		float m_Error = 0.f;		// Object space deviation from the full mesh, 0 for LOD 0.
+	};
+
+	struct LodChain
+	{
+		std::vector<uint32_t> m_Indices;	// Every LOD's triangles, finest first.
+		std::vector<MeshLod> m_Lods;
+	};
+
+	class MeshSimplifier
+	{
+	public:
+		static constexpr uint32_t s_MaxLods = 8;
+		static constexpr float s_LodReduction = 0.5f;		// Triangle ratio between consecutive LODs.
+		static constexpr uint32_t s_MinLodTriangles = 32;	// No LOD is generated from one this small.
+
+		// Collapses edges onto existing vertices in order of quadric error (Garland and Heckbert 1997) until at most
+		// targetIndexCount indices remain or the next collapse would exceed maxError. Border and seam vertices are locked,
+		// so attribute seams stay intact. positions points to the first vertex's float3 position, positionStride is in bytes.
+		// Returns the simplified indices, and the object space error reached in resultError if given.
+		static std::vector<uint32_t> Simplify(const std::vector<uint32_t>& indices, const float* positions, size_t positionStride, uint32_t vertexCount,
+			size_t targetIndexCount, float maxError = 1e30f, float* resultError = nullptr);
+
+		// LOD 0 is indices as given, each further LOD has about s_LodReduction times the triangles of the previous one.
+		// Stops early once a mesh cannot be simplified any further. LODs after the first are vertex cache optimized.
+		static LodChain BuildLodChain(const std::vector<uint32_t>& indices, const float* positions, size_t positionStride, uint32_t vertexCount,
+			uint32_t maxLods = s_MaxLods);
+	};
+}
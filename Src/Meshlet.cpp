@@ -0,0 +1,411 @@
+﻿/*!
+\file		Meshlet.cpp
+\date		19/10/2026
+
+\author		Adrian Tan
+\email		t.xingkhiangadrian\@digipen.edu
+
+\brief		Contains implementation for MeshletBuilder and MeshletCuller class functions.
+
+\copyright	All content © 2023 DigiPen (SINGAPORE) Corporation, all rights reserved.
+			Reproduction or disclosure of this file or its contents without the
+			prior written consent of DigiPen Institute of Technology is prohibited.
+__________________________________________________________________________________*/
+
+#include "meowpch.h"
+
+#include "Meshlet.h"
+#include "MeshOptimizer.h"
+#include "ShaderData.h"
+
+#include <glm/gtc/constants.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+
+namespace Nya
+{
+	//-- Helpers.
+	namespace
+	{
+		glm::vec3 GetPosition(const float* positions, const size_t stride, const uint32_t index)
+		{
+			const float* p = reinterpret_cast<const float*>(reinterpret_cast<const uint8_t*>(positions) + stride * index);
+			return { p[0], p[1], p[2] };
+		}
+	}
+
+
+	//-- MeshletBuilder Functions.
+	MeshletMesh MeshletBuilder::Build(const std::vector<uint32_t>& indices, const float* positions, const size_t positionStride, const uint32_t vertexCount,
+		const uint32_t maxVertices, const uint32_t maxTriangles)
+	{
+		const uint32_t triangleCount = static_cast<uint32_t>(indices.size() / 3);
+
+		MeshletMesh mesh;
+		mesh.m_Indices.reserve(triangleCount * 3);
+
+		// Vertex -> triangles adjacency, and how many unclustered triangles still use each vertex.
+		std::vector<uint32_t> liveCount(vertexCount, 0);
+		for (const uint32_t index : indices)
+			++liveCount[index];
+
+		std::vector<uint32_t> adjacencyOffsets(vertexCount + 1, 0);
+		for (uint32_t v = 0; v < vertexCount; ++v)
+			adjacencyOffsets[v + 1] = adjacencyOffsets[v] + liveCount[v];
+
+		std::vector<uint32_t> adjacency(indices.size());
+		std::vector<uint32_t> fill(adjacencyOffsets.begin(), adjacencyOffsets.end() - 1);
+		for (uint32_t t = 0; t < triangleCount; ++t)
+		{
+			for (uint32_t k = 0; k < 3; ++k)
+				adjacency[fill[indices[t * 3 + k]]++] = t;
+		}
+
+		std::vector<bool> emitted(triangleCount, false);
+		std::vector<uint32_t> vertexStamp(vertexCount, 0);	// Meshlet number + 1 the vertex was last added to.
+		std::vector<uint32_t> meshletVertices;
+		meshletVertices.reserve(maxVertices);
+
+		Meshlet current;
+		uint32_t stamp = 1;
+		uint32_t seedCursor = 0;
+
+		const auto finishMeshlet = [&]()
+		{
+			if (current.m_IndexCount == 0)
+				return;
+
+			current.m_VertexCount = static_cast<uint32_t>(meshletVertices.size());
+			ComputeBounds(current, mesh.m_Indices.data() + current.m_IndexOffset, positions, positionStride);
+			mesh.m_Meshlets.push_back(current);
+
+			current = {};
+			current.m_IndexOffset = static_cast<uint32_t>(mesh.m_Indices.size());
+			meshletVertices.clear();
+			++stamp;
+		};
+
+		const auto newVertexCount = [&](const uint32_t t)
+		{
+			uint32_t count = 0;
+			for (uint32_t k = 0; k < 3; ++k)
+				count += vertexStamp[indices[t * 3 + k]] != stamp;
+			return count;
+		};
+
+		for (uint32_t emittedCount = 0; emittedCount < triangleCount; ++emittedCount)
+		{
+			// Best unclustered neighbour of the current meshlet, the one adding the fewest new vertices.
+			uint32_t best = UINT32_MAX;
+			uint32_t bestScore = UINT32_MAX;
+			for (const uint32_t v : meshletVertices)
+			{
+				if (liveCount[v] == 0)
+					continue;
+
+				for (uint32_t i = adjacencyOffsets[v]; i < adjacencyOffsets[v + 1] && bestScore > 0; ++i)
+				{
+					const uint32_t t = adjacency[i];
+					if (emitted[t])
+						continue;
+
+					const uint32_t score = newVertexCount(t);
+					if (score < bestScore || (score == bestScore && t < best))
+					{
+						best = t;
+						bestScore = score;
+					}
+				}
+			}
+
+			// No neighbours left, continue from the next triangle in input order.
+			if (best == UINT32_MAX)
+			{
+				while (emitted[seedCursor])
+					++seedCursor;
+				best = seedCursor;
+				bestScore = newVertexCount(best);
+			}
+
+			if (meshletVertices.size() + bestScore > maxVertices || current.m_IndexCount / 3 + 1 > maxTriangles)
+			{
+				finishMeshlet();
+				bestScore = 3;
+			}
+
+			for (uint32_t k = 0; k < 3; ++k)
+			{
+				const uint32_t v = indices[best * 3 + k];
+				if (vertexStamp[v] != stamp)
+				{
+					vertexStamp[v] = stamp;
+					meshletVertices.push_back(v);
+				}
+				--liveCount[v];
+				mesh.m_Indices.push_back(v);
+			}
+
+			emitted[best] = true;
+			current.m_IndexCount += 3;
+		}
+
+		finishMeshlet();
+		return mesh;
+	}
+
+	void MeshletBuilder::ComputeBounds(Meshlet& meshlet, const uint32_t* indices, const float* positions, const size_t positionStride)
+	{
+		//-- Bounding sphere (Ritter): start from the two far apart points, grow to fit the rest.
+		const glm::vec3 first = GetPosition(positions, positionStride, indices[0]);
+		glm::vec3 a = first;
+		float maxDistance = -1.f;
+		for (uint32_t i = 0; i < meshlet.m_IndexCount; ++i)
+		{
+			const glm::vec3 p = GetPosition(positions, positionStride, indices[i]);
+			const float d = glm::dot(p - first, p - first);
+			if (d > maxDistance)
+			{
+				maxDistance = d;
+				a = p;
+			}
+		}
+
+		glm::vec3 b = a;
+		maxDistance = -1.f;
+		for (uint32_t i = 0; i < meshlet.m_IndexCount; ++i)
+		{
+			const glm::vec3 p = GetPosition(positions, positionStride, indices[i]);
+			const float d = glm::dot(p - a, p - a);
+			if (d > maxDistance)
+			{
+				maxDistance = d;
+				b = p;
+			}
+		}
+
+		glm::vec3 center = (a + b) * 0.5f;
+		float radius = glm::length(b - a) * 0.5f;
+		for (uint32_t i = 0; i < meshlet.m_IndexCount; ++i)
+		{
+			const glm::vec3 p = GetPosition(positions, positionStride, indices[i]);
+			const float d = glm::length(p - center);
+			if (d > radius)
+			{
+				// Move the sphere towards p just enough to contain it.
+				const float newRadius = (radius + d) * 0.5f;
+				center += (p - center) * ((newRadius - radius) / d);
+				radius = newRadius;
+			}
+		}
+
+		meshlet.m_Center = center;
+		meshlet.m_Radius = radius;
+
+		//-- Normal cone.
+		std::vector<glm::vec3> normals;
+		normals.reserve(meshlet.m_IndexCount / 3);
+		glm::vec3 axis(0.f);
+		for (uint32_t i = 0; i < meshlet.m_IndexCount; i += 3)
+		{
+			const glm::vec3 p0 = GetPosition(positions, positionStride, indices[i]);
+			const glm::vec3 p1 = GetPosition(positions, positionStride, indices[i + 1]);
+			const glm::vec3 p2 = GetPosition(positions, positionStride, indices[i + 2]);
+
+			const glm::vec3 normal = glm::cross(p1 - p0, p2 - p0);
+			const float length = glm::length(normal);
+			if (length <= 0.f)
+				continue;	// Degenerate triangles can face any way, and never rasterize.
+
+			normals.push_back(normal / length);
+			axis += normals.back();
+		}
+
+		meshlet.m_ConeAxis = glm::vec3(0.f);
+		meshlet.m_ConeCutoff = 1.f;
+
+		const float axisLength = glm::length(axis);
+		if (axisLength <= 0.f)
+			return;
+		axis /= axisLength;
+
+		float minDot = 1.f;
+		for (const glm::vec3& normal : normals)
+			minDot = std::min(minDot, glm::dot(normal, axis));
+
+		meshlet.m_ConeAxis = axis;
+		// Cones wider than ~85 degrees are almost never back-facing as a whole, don't bother testing.
+		if (minDot > 0.1f)
+			meshlet.m_ConeCutoff = std::sqrt(1.f - minDot * minDot);
+	}
+
+
+	//-- MeshletCuller Functions.
+	bool MeshletCuller::IsVisible(const Meshlet& meshlet, const Frustum& frustum, const glm::vec3& cameraPosition)
+	{
+		if (!frustum.IntersectsSphere(meshlet.m_Center, meshlet.m_Radius))
+			return false;
+
+		// Back-facing if every point in the sphere sees every normal in the cone from behind.
+		const glm::vec3 view = meshlet.m_Center - cameraPosition;
+		return glm::dot(view, meshlet.m_ConeAxis) < meshlet.m_ConeCutoff * glm::length(view) + meshlet.m_Radius;
+	}
+
+	uint32_t MeshletCuller::Cull(const Meshlet* meshlets, const uint32_t meshletCount, const Frustum& frustum, const glm::vec3& cameraPosition,
+		std::vector<MeshletDrawRange>& ranges)
+	{
+		uint32_t visibleCount = 0;
+		for (uint32_t i = 0; i < meshletCount; ++i)
+		{
+			const Meshlet& meshlet = meshlets[i];
+			if (!IsVisible(meshlet, frustum, cameraPosition))
+				continue;
+
+			++visibleCount;
+			if (!ranges.empty() && ranges.back().m_FirstIndex + ranges.back().m_IndexCount == meshlet.m_IndexOffset)
+				ranges.back().m_IndexCount += meshlet.m_IndexCount;
+			else
+				ranges.push_back({ meshlet.m_IndexOffset, meshlet.m_IndexCount });
+		}
+
+		return visibleCount;
+	}
+
+	MeshletCullConstants MeshletCuller::MakeGpuConstants(const Frustum& frustum, const glm::vec3& cameraPosition, const uint32_t meshletCount, const uint32_t meshletOffset,
+		const uint32_t drawOffset)
+	{
+		MeshletCullConstants constants{};
+		std::copy(frustum.m_Planes.begin(), frustum.m_Planes.end(), constants.m_FrustumPlanes);
+		constants.m_CameraPosition = cameraPosition;
+		constants.m_MeshletCount = meshletCount;
+		constants.m_MeshletOffset = meshletOffset;
+		constants.m_DrawOffset = drawOffset;
+		return constants;
+	}
+
+	bool MeshletCuller::IsVisibleGpu(const Meshlet& meshlet, const MeshletCullConstants& constants)
+	{
+		for (const glm::vec4& plane : constants.m_FrustumPlanes)
+		{
+			if (glm::dot(glm::vec3(plane), meshlet.m_Center) + plane.w < -meshlet.m_Radius)
+				return false;
+		}
+
+		const glm::vec3 view = meshlet.m_Center - constants.m_CameraPosition;
+		return glm::dot(view, meshlet.m_ConeAxis) < meshlet.m_ConeCutoff * glm::length(view) + meshlet.m_Radius;
+	}
+
+	void MeshletCuller::Benchmark(const uint32_t triangleCount, const uint32_t cameraCount)
+	{
+		//-- UV sphere with bumps, so meshlets have cones of every width, cache optimized as Build expects.
+		const uint32_t segments = std::max(static_cast<uint32_t>(std::sqrt(static_cast<float>(triangleCount))), 4u);
+		const uint32_t rings = std::max(triangleCount / (2 * segments), 3u);
+		std::vector<glm::vec3> positions;
+		for (uint32_t ring = 0; ring <= rings; ++ring)
+		{
+			const float theta = glm::pi<float>() * static_cast<float>(ring) / static_cast<float>(rings);
+			for (uint32_t segment = 0; segment <= segments; ++segment)
+			{
+				const float phi = glm::two_pi<float>() * static_cast<float>(segment) / static_cast<float>(segments);
+				const float radius = 1.f + 0.05f * std::sin(theta * 12.f) * std::sin(phi * 12.f);
+				positions.emplace_back(std::sin(theta) * std::cos(phi) * radius, std::cos(theta) * radius, std::sin(theta) * std::sin(phi) * radius);
+			}
+		}
+
+		// Counter-clockwise seen from outside.
+		std::vector<uint32_t> indices;
+		for (uint32_t ring = 0; ring < rings; ++ring)
+		{
+			for (uint32_t segment = 0; segment < segments; ++segment)
+			{
+				const uint32_t a = ring * (segments + 1) + segment;
+				const uint32_t b = a + segments + 1;
+				indices.insert(indices.end(), { a, b + 1, b, a, a + 1, b + 1 });
+			}
+		}
+		const uint32_t vertexCount = static_cast<uint32_t>(positions.size());
+		MeshOptimizer::OptimizeVertexCache(indices, vertexCount);
+
+		auto startTime = std::chrono::high_resolution_clock::now();
+		const MeshletMesh mesh = MeshletBuilder::Build(indices, &positions[0].x, sizeof(glm::vec3), vertexCount);
+		auto endTime = std::chrono::high_resolution_clock::now();
+		const float buildMs = std::chrono::duration<float, std::chrono::milliseconds::period>(endTime - startTime).count();
+
+		//-- Limits and bounding spheres.
+		uint32_t coveredIndices = 0;
+		std::vector<uint32_t> lastUse(vertexCount, UINT32_MAX);
+		for (uint32_t m = 0; m < mesh.m_Meshlets.size(); ++m)
+		{
+			const Meshlet& meshlet = mesh.m_Meshlets[m];
+			if (meshlet.m_IndexCount / 3 > MeshletBuilder::s_MaxTriangles || meshlet.m_VertexCount > MeshletBuilder::s_MaxVertices)
+				throw std::runtime_error("Meshlet " + std::to_string(m) + " is over the vertex or triangle limit!");
+
+			uint32_t uniqueVertices = 0;
+			for (uint32_t i = meshlet.m_IndexOffset; i < meshlet.m_IndexOffset + meshlet.m_IndexCount; ++i)
+			{
+				const uint32_t vertex = mesh.m_Indices[i];
+				if (lastUse[vertex] != m)
+				{
+					lastUse[vertex] = m;
+					++uniqueVertices;
+				}
+				if (glm::length(positions[vertex] - meshlet.m_Center) > meshlet.m_Radius * (1.f + 1e-4f))
+					throw std::runtime_error("Meshlet " + std::to_string(m) + " has a vertex outside its bounding sphere!");
+			}
+			if (uniqueVertices != meshlet.m_VertexCount)
+				throw std::runtime_error("Meshlet " + std::to_string(m) + " miscounts its vertices!");
+			coveredIndices += meshlet.m_IndexCount;
+		}
+		if (coveredIndices != mesh.m_Indices.size() || mesh.m_Indices.size() != indices.size())
+			throw std::runtime_error("Meshlets don't cover every triangle exactly once!");
+
+		//-- Cameras around the sphere, looking somewhere near its center.
+		std::mt19937 random(1337);
+		std::uniform_real_distribution<float> unit(-1.f, 1.f);
+		std::uniform_real_distribution<float> distances(1.5f, 6.f);
+		const glm::mat4 proj = glm::perspective(glm::radians(60.f), 16.f / 9.f, 0.1f, 100.f);
+
+		uint32_t visibleCount = 0;
+		uint32_t coneCulledCount = 0;
+		float cullMs = 0.f;
+		std::vector<MeshletDrawRange> ranges;
+		for (uint32_t camera = 0; camera < cameraCount; ++camera)
+		{
+			const glm::vec3 direction = glm::normalize(glm::vec3(unit(random), unit(random), unit(random)) + glm::vec3(0.f, 0.f, 1e-3f));
+			const glm::vec3 cameraPosition = direction * distances(random);
+			const glm::vec3 target(unit(random) * 0.5f, unit(random) * 0.5f, unit(random) * 0.5f);
+			const glm::vec3 up = std::abs(direction.y) > 0.9f ? glm::vec3(1.f, 0.f, 0.f) : glm::vec3(0.f, 1.f, 0.f);
+			const Frustum frustum = Frustum::FromMatrix(proj * glm::lookAt(cameraPosition, target, up));
+
+			ranges.clear();
+			startTime = std::chrono::high_resolution_clock::now();
+			visibleCount += Cull(mesh.m_Meshlets.data(), static_cast<uint32_t>(mesh.m_Meshlets.size()), frustum, cameraPosition, ranges);
+			endTime = std::chrono::high_resolution_clock::now();
+			cullMs += std::chrono::duration<float, std::chrono::milliseconds::period>(endTime - startTime).count();
+
+			const MeshletCullConstants constants = MakeGpuConstants(frustum, cameraPosition, static_cast<uint32_t>(mesh.m_Meshlets.size()), 0, 0);
+			for (uint32_t m = 0; m < mesh.m_Meshlets.size(); ++m)
+			{
+				const Meshlet& meshlet = mesh.m_Meshlets[m];
+				const bool visible = IsVisible(meshlet, frustum, cameraPosition);
+				if (visible != IsVisibleGpu(meshlet, constants))
+					throw std::runtime_error("CPU and GPU meshlet culling disagree on meshlet " + std::to_string(m) + "!");
+				if (visible || !frustum.IntersectsSphere(meshlet.m_Center, meshlet.m_Radius))
+					continue;
+
+				// Rejected by the cone alone, so every triangle has to face away from the camera.
+				++coneCulledCount;
+				for (uint32_t i = meshlet.m_IndexOffset; i < meshlet.m_IndexOffset + meshlet.m_IndexCount; i += 3)
+				{
+					const glm::vec3& p0 = positions[mesh.m_Indices[i]];
+					const glm::vec3 normal = glm::cross(positions[mesh.m_Indices[i + 1]] - p0, positions[mesh.m_Indices[i + 2]] - p0);
+					if (glm::dot(normal, p0 - cameraPosition) < -1e-6f)
+						throw std::runtime_error("Meshlet " + std::to_string(m) + "'s cone culled a triangle facing the camera!");
+				}
+			}
+		}
+
+		const float meshletCount = static_cast<float>(mesh.m_Meshlets.size());
+		std::cout << "\t" << "Meshlets of " << indices.size() / 3 << " triangles: " << mesh.m_Meshlets.size() << " meshlets built in " << buildMs << "ms, "
+			<< visibleCount / (meshletCount * cameraCount) * 100.f << "% visible and " << coneCulledCount / (meshletCount * cameraCount) * 100.f
+			<< "% cone culled per camera, culled in " << cullMs / cameraCount << "ms" << std::endl;
+	}
+}
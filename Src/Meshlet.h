@@ -0,0 +1,89 @@
+﻿/*!
+\file		Meshlet.h
+\date		19/10/2026
+
+\author		Adrian Tan
+\email		t.xingkhiangadrian\@digipen.edu
+
+\brief		Contains definition of MeshletBuilder and MeshletCuller classes.
+
+\copyright	All content © 2023 DigiPen (SINGAPORE) Corporation, all rights reserved.
+			Reproduction or disclosure of this file or its contents without the
+			prior written consent of DigiPen Institute of Technology is prohibited.
+__________________________________________________________________________________*/
+#pragma once
+
+#include "Frustum.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace Nya
+{
+	struct MeshletCullConstants;
+
+	// A cluster of up to s_MaxVertices vertices and s_MaxTriangles triangles, drawn as one contiguous index range.
+	// Laid out for std430, must match Meshlet in Shaders/meshlet_cull.comp.
+	struct Meshlet
+	{
+		glm::vec3 m_Center{};			// Bounding sphere, object space.
+		float m_Radius = 0.f;
+		glm::vec3 m_ConeAxis{};			// Average triangle normal.
+		float m_ConeCutoff = 1.f;		// Sine of the normal cone's half angle, 1 if the cone can never be back-facing.
+		uint32_t m_IndexOffset = 0;		// First index, relative to the mesh's index range.
+		uint32_t m_IndexCount = 0;
+		uint32_t m_VertexCount = 0;		// Unique vertices referenced.
+		uint32_t m_Padding = 0;
+	};
+	static_assert(sizeof(Meshlet) == 48, "Meshlet must match its std430 layout!");
+
+	struct MeshletMesh
+	{
+		std::vector<Meshlet> m_Meshlets;
+		std::vector<uint32_t> m_Indices;	// Triangles reordered so each meshlet is contiguous.
+	};
+
+	// Index range of one or more adjacent visible meshlets.
+	struct MeshletDrawRange
+	{
+		uint32_t m_FirstIndex = 0;
+		uint32_t m_IndexCount = 0;
+	};
+
+	class MeshletBuilder
+	{
+	public:
+		static constexpr uint32_t s_MaxVertices = 64;
+		static constexpr uint32_t s_MaxTriangles = 124;
+
+		// Greedily grows clusters from triangles sharing the most vertices with the current one, in input order,
+		// so run it on a cache-optimized index list. positionStride is in bytes between float3 positions.
+		static MeshletMesh Build(const std::vector<uint32_t>& indices, const float* positions, size_t positionStride, uint32_t vertexCount,
+			uint32_t maxVertices = s_MaxVertices, uint32_t maxTriangles = s_MaxTriangles);
+
+		// Fills the bounding sphere and normal cone of a meshlet from its triangles in indices.
+		static void ComputeBounds(Meshlet& meshlet, const uint32_t* indices, const float* positions, size_t positionStride);
+	};
+
+	class MeshletCuller
+	{
+	public:
+		// frustum and cameraPosition must be in the mesh's object space (see Frustum::FromMatrix), with uniform scale.
+		static bool IsVisible(const Meshlet& meshlet, const Frustum& frustum, const glm::vec3& cameraPosition);
+
+		// Appends the index ranges of visible meshlets, merging neighbours. Returns the number of visible meshlets.
+		static uint32_t Cull(const Meshlet* meshlets, uint32_t meshletCount, const Frustum& frustum, const glm::vec3& cameraPosition,
+			std::vector<MeshletDrawRange>& ranges);
+
+		// Constants of one Shaders/meshlet_cull.comp dispatch, see VulkanMeshletCuller::Cull.
+		static MeshletCullConstants MakeGpuConstants(const Frustum& frustum, const glm::vec3& cameraPosition, uint32_t meshletCount, uint32_t meshletOffset,
+			uint32_t drawOffset);
+		// The test Shaders/meshlet_cull.comp runs, written the same way on the same constants.
+		static bool IsVisibleGpu(const Meshlet& meshlet, const MeshletCullConstants& constants);
+
+		// Builds meshlets of a bumpy sphere of about triangleCount triangles, then culls them from cameraCount random cameras,
+		// and prints the timings. Throws if a meshlet breaks the vertex or triangle limits, a vertex is outside its bounding
+		// sphere, a cone culls a triangle facing the camera, or IsVisible and IsVisibleGpu ever disagree. Needs no GPU.
+		static void Benchmark(uint32_t triangleCount, uint32_t cameraCount = 1000);
+	};
+}
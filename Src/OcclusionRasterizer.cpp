@@ -0,0 +1,522 @@
+﻿/*!
+\file		OcclusionRasterizer.cpp
+\date		19/10/2026
+
+\author		Adrian Tan
+\email		t.xingkhiangadrian\@digipen.edu
+
+\brief		Contains implementation for OcclusionRasterizer class functions.
+
+\copyright	All content © 2023 DigiPen (SINGAPORE) Corporation, all rights reserved.
+			Reproduction or disclosure of this file or its contents without the
+			prior written consent of DigiPen Institute of Technology is prohibited.
+__________________________________________________________________________________*/
+
+#include "meowpch.h"
+
+#include "OcclusionRasterizer.h"
+#include "Simd.h"
+#include "ThreadPool.h"
+
+#include <glm/gtc/matrix_transform.hpp>
+
+#include <cfloat>
+#include <numeric>
+
+namespace Nya
+{
+	//-- Kernels.
+	namespace
+	{
+		// Clip space w below this is treated as behind the camera.
+		constexpr float s_MinW = 1e-6f;
+
+		// Writes the nearer of the stored and the triangle's depth for pixels [minX, maxX] of a row.
+		// Every path evaluates the edge and depth planes at each pixel center directly, never incrementally.
+		void RasterizeRowScalar(float* row, const OcclusionTriangle& triangle, const int32_t y, const int32_t minX, const int32_t maxX)
+		{
+			// Row terms first, summed in the same order as the SIMD paths so every path rounds alike.
+			const float py = static_cast<float>(y) + 0.5f;
+			float edgeRow[3];
+			for (uint32_t e = 0; e < 3; ++e)
+				edgeRow[e] = triangle.m_EdgeB[e] * py + triangle.m_EdgeC[e];
+			const float depthRow = triangle.m_DepthB * py + triangle.m_DepthC;
+
+			for (int32_t x = minX; x <= maxX; ++x)
+			{
+				const float px = static_cast<float>(x) + 0.5f;
+				const float e0 = triangle.m_EdgeA[0] * px + edgeRow[0];
+				const float e1 = triangle.m_EdgeA[1] * px + edgeRow[1];
+				const float e2 = triangle.m_EdgeA[2] * px + edgeRow[2];
+				if (e0 >= 0.f && e1 >= 0.f && e2 >= 0.f)
+				{
+					const float depth = triangle.m_DepthA * px + depthRow;
+					row[x] = std::min(row[x], depth);
+				}
+			}
+		}
+
+#ifdef NYA_SIMD_SSE2
+		// 4 pixels per iteration from minX rounded down. Lanes outside [minX, maxX] are masked, the row must
+		// be padded to a multiple of 4 past maxX.
+		void RasterizeRowSse(float* row, const OcclusionTriangle& triangle, const int32_t y, const int32_t minX, const int32_t maxX)
+		{
+			const __m128 py = _mm_set1_ps(static_cast<float>(y) + 0.5f);
+			const __m128 zero = _mm_setzero_ps();
+			const __m128i laneOffsets = _mm_setr_epi32(0, 1, 2, 3);
+			const __m128i first = _mm_set1_epi32(minX - 1);
+			const __m128i last = _mm_set1_epi32(maxX + 1);
+
+			__m128 edgeA[3], edgeRow[3];
+			for (uint32_t e = 0; e < 3; ++e)
+			{
+				edgeA[e] = _mm_set1_ps(triangle.m_EdgeA[e]);
+				edgeRow[e] = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(triangle.m_EdgeB[e]), py), _mm_set1_ps(triangle.m_EdgeC[e]));
+			}
+			const __m128 depthA = _mm_set1_ps(triangle.m_DepthA);
+			const __m128 depthRow = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(triangle.m_DepthB), py), _mm_set1_ps(triangle.m_DepthC));
+
+			for (int32_t x = minX & ~3; x <= maxX; x += 4)
+			{
+				const __m128i lanes = _mm_add_epi32(_mm_set1_epi32(x), laneOffsets);
+				const __m128 px = _mm_add_ps(_mm_cvtepi32_ps(lanes), _mm_set1_ps(0.5f));
+
+				__m128 inside = _mm_castsi128_ps(_mm_and_si128(_mm_cmpgt_epi32(lanes, first), _mm_cmplt_epi32(lanes, last)));
+				for (uint32_t e = 0; e < 3; ++e)
+					inside = _mm_and_ps(inside, _mm_cmpge_ps(_mm_add_ps(_mm_mul_ps(edgeA[e], px), edgeRow[e]), zero));
+
+				const __m128 stored = _mm_loadu_ps(row + x);
+				const __m128 nearer = _mm_min_ps(stored, _mm_add_ps(_mm_mul_ps(depthA, px), depthRow));
+				_mm_storeu_ps(row + x, _mm_or_ps(_mm_and_ps(inside, nearer), _mm_andnot_ps(inside, stored)));
+			}
+		}
+#endif
+
+#ifdef NYA_SIMD_AVX2
+NYA_SIMD_BEGIN_AVX2
+		void RasterizeRowAvx2(float* row, const OcclusionTriangle& triangle, const int32_t y, const int32_t minX, const int32_t maxX)
+		{
+			const __m256 py = _mm256_set1_ps(static_cast<float>(y) + 0.5f);
+			const __m256 zero = _mm256_setzero_ps();
+			const __m256i laneOffsets = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+			const __m256i first = _mm256_set1_epi32(minX - 1);
+			const __m256i last = _mm256_set1_epi32(maxX + 1);
+
+			__m256 edgeA[3], edgeRow[3];
+			for (uint32_t e = 0; e < 3; ++e)
+			{
+				edgeA[e] = _mm256_set1_ps(triangle.m_EdgeA[e]);
+				edgeRow[e] = _mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(triangle.m_EdgeB[e]), py), _mm256_set1_ps(triangle.m_EdgeC[e]));
+			}
+			const __m256 depthA = _mm256_set1_ps(triangle.m_DepthA);
+			const __m256 depthRow = _mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(triangle.m_DepthB), py), _mm256_set1_ps(triangle.m_DepthC));
+
+			for (int32_t x = minX & ~7; x <= maxX; x += 8)
+			{
+				const __m256i lanes = _mm256_add_epi32(_mm256_set1_epi32(x), laneOffsets);
+				const __m256 px = _mm256_add_ps(_mm256_cvtepi32_ps(lanes), _mm256_set1_ps(0.5f));
+
+				__m256 inside = _mm256_castsi256_ps(_mm256_and_si256(_mm256_cmpgt_epi32(lanes, first), _mm256_cmpgt_epi32(last, lanes)));
+				for (uint32_t e = 0; e < 3; ++e)
+					inside = _mm256_and_ps(inside, _mm256_cmp_ps(_mm256_add_ps(_mm256_mul_ps(edgeA[e], px), edgeRow[e]), zero, _CMP_GE_OQ));
+
+				const __m256 stored = _mm256_loadu_ps(row + x);
+				const __m256 nearer = _mm256_min_ps(stored, _mm256_add_ps(_mm256_mul_ps(depthA, px), depthRow));
+				_mm256_storeu_ps(row + x, _mm256_blendv_ps(stored, nearer, inside));
+			}
+		}
+NYA_SIMD_END
+#endif
+	}
+
+
+	//-- OcclusionRasterizer Functions.
+	void OcclusionRasterizer::Init(const uint32_t width, const uint32_t height)
+	{
+		if (width == 0 || height == 0 || width % s_TileSize != 0 || height % s_TileSize != 0)
+			throw std::runtime_error("Occlusion buffer size must be a non-zero multiple of the tile size!");
+
+		m_Width = width;
+		m_Height = height;
+		m_TilesX = width / s_TileSize;
+		m_TilesY = height / s_TileSize;
+
+		m_Depth.assign(static_cast<size_t>(width) * height, 1.f);
+		m_TileMaxDepth.assign(static_cast<size_t>(m_TilesX) * m_TilesY, 1.f);
+	}
+
+	void OcclusionRasterizer::Begin(const glm::mat4& viewProj)
+	{
+		m_ViewProj = viewProj;
+		m_Occluders.clear();
+		m_OccluderFirstTriangles.clear();
+		m_TriangleCount = 0;
+	}
+
+	void OcclusionRasterizer::AddOccluder(const float* positions, const size_t positionStride, const uint32_t* indices, const uint32_t indexCount, const glm::mat4& model)
+	{
+		if (indexCount < 3)
+			return;
+
+		Occluder& occluder = m_Occluders.emplace_back();
+		occluder.m_Positions = positions;
+		occluder.m_PositionStride = positionStride;
+		occluder.m_Indices = indices;
+		occluder.m_TriangleCount = indexCount / 3;
+		occluder.m_ModelViewProj = m_ViewProj * model;
+
+		m_OccluderFirstTriangles.push_back(m_TriangleCount);
+		m_TriangleCount += occluder.m_TriangleCount;
+	}
+
+	bool OcclusionRasterizer::SetupTriangle(const Occluder& occluder, const uint32_t triangle, OcclusionTriangle& setup) const
+	{
+		//-- Project.
+		glm::vec3 screen[3];
+		for (uint32_t corner = 0; corner < 3; ++corner)
+		{
+			const uint32_t index = occluder.m_Indices[triangle * 3 + corner];
+			const float* position = reinterpret_cast<const float*>(reinterpret_cast<const uint8_t*>(occluder.m_Positions) + index * occluder.m_PositionStride);
+			const glm::vec4 clip = occluder.m_ModelViewProj * glm::vec4(position[0], position[1], position[2], 1.f);
+
+			// Clipping against the near plane would only add occlusion, dropping the triangle is always safe.
+			if (clip.w < s_MinW || clip.z < 0.f)
+				return false;
+
+			const float invW = 1.f / clip.w;
+			screen[corner] = glm::vec3((clip.x * invW * 0.5f + 0.5f) * static_cast<float>(m_Width), (clip.y * invW * 0.5f + 0.5f) * static_cast<float>(m_Height), clip.z * invW);
+		}
+
+		//-- Pixel bounds, covering the pixel centers inside the triangle's box.
+		const float minX = std::min({ screen[0].x, screen[1].x, screen[2].x });
+		const float minY = std::min({ screen[0].y, screen[1].y, screen[2].y });
+		const float maxX = std::max({ screen[0].x, screen[1].x, screen[2].x });
+		const float maxY = std::max({ screen[0].y, screen[1].y, screen[2].y });
+
+		setup.m_MinX = std::max(static_cast<int32_t>(std::ceil(minX - 0.5f)), 0);
+		setup.m_MinY = std::max(static_cast<int32_t>(std::ceil(minY - 0.5f)), 0);
+		setup.m_MaxX = std::min(static_cast<int32_t>(std::floor(std::min(maxX, static_cast<float>(m_Width)) - 0.5f)), static_cast<int32_t>(m_Width) - 1);
+		setup.m_MaxY = std::min(static_cast<int32_t>(std::floor(std::min(maxY, static_cast<float>(m_Height)) - 0.5f)), static_cast<int32_t>(m_Height) - 1);
+		if (setup.m_MinX > setup.m_MaxX || setup.m_MinY > setup.m_MaxY)
+			return false;
+
+		//-- Edges, wound so inside is positive whichever way the triangle faces. Occluders are drawn double sided.
+		float area = (screen[1].x - screen[0].x) * (screen[2].y - screen[0].y) - (screen[1].y - screen[0].y) * (screen[2].x - screen[0].x);
+		if (std::abs(area) < 1e-6f)
+			return false;
+		if (area < 0.f)
+		{
+			std::swap(screen[1], screen[2]);
+			area = -area;
+		}
+
+		for (uint32_t edge = 0; edge < 3; ++edge)
+		{
+			const glm::vec3& a = screen[edge];
+			const glm::vec3& b = screen[(edge + 1) % 3];
+			setup.m_EdgeA[edge] = a.y - b.y;
+			setup.m_EdgeB[edge] = b.x - a.x;
+			setup.m_EdgeC[edge] = -(setup.m_EdgeA[edge] * a.x + setup.m_EdgeB[edge] * a.y);
+		}
+
+		//-- Depth plane from barycentrics. Edge 1 -> 2 weighs corner 0, 2 -> 0 corner 1 and 0 -> 1 corner 2.
+		const float invArea = 1.f / area;
+		const float dz1 = (screen[1].z - screen[0].z) * invArea;
+		const float dz2 = (screen[2].z - screen[0].z) * invArea;
+		setup.m_DepthA = dz1 * setup.m_EdgeA[2] + dz2 * setup.m_EdgeA[0];
+		setup.m_DepthB = dz1 * setup.m_EdgeB[2] + dz2 * setup.m_EdgeB[0];
+		setup.m_DepthC = screen[0].z + dz1 * setup.m_EdgeC[2] + dz2 * setup.m_EdgeC[0];
+
+		return true;
+	}
+
+	void OcclusionRasterizer::SetupChunk(const uint32_t chunk)
+	{
+		const uint32_t tileCount = m_TilesX * m_TilesY;
+		std::vector<uint32_t>* bins = m_Bins.data() + static_cast<size_t>(chunk) * tileCount;
+
+		const uint32_t begin = chunk * s_SetupChunkSize;
+		const uint32_t end = std::min(begin + s_SetupChunkSize, m_TriangleCount);
+
+		uint32_t occluder = static_cast<uint32_t>(std::upper_bound(m_OccluderFirstTriangles.begin(), m_OccluderFirstTriangles.end(), begin) - m_OccluderFirstTriangles.begin()) - 1;
+		for (uint32_t triangle = begin; triangle < end; ++triangle)
+		{
+			while (triangle >= m_OccluderFirstTriangles[occluder] + m_Occluders[occluder].m_TriangleCount)
+				++occluder;
+
+			OcclusionTriangle& setup = m_Triangles[triangle];
+			if (!SetupTriangle(m_Occluders[occluder], triangle - m_OccluderFirstTriangles[occluder], setup))
+				continue;
+
+			//-- Bin into every tile the bounds touch.
+			const uint32_t firstTileX = static_cast<uint32_t>(setup.m_MinX) / s_TileSize;
+			const uint32_t firstTileY = static_cast<uint32_t>(setup.m_MinY) / s_TileSize;
+			const uint32_t lastTileX = static_cast<uint32_t>(setup.m_MaxX) / s_TileSize;
+			const uint32_t lastTileY = static_cast<uint32_t>(setup.m_MaxY) / s_TileSize;
+			for (uint32_t tileY = firstTileY; tileY <= lastTileY; ++tileY)
+			{
+				for (uint32_t tileX = firstTileX; tileX <= lastTileX; ++tileX)
+					bins[tileY * m_TilesX + tileX].push_back(triangle);
+			}
+		}
+	}
+
+	void OcclusionRasterizer::RasterizeTile(const uint32_t tile, const uint32_t chunkCount, const SimdPath path)
+	{
+		const uint32_t tileCount = m_TilesX * m_TilesY;
+		const int32_t tileMinX = static_cast<int32_t>((tile % m_TilesX) * s_TileSize);
+		const int32_t tileMinY = static_cast<int32_t>((tile / m_TilesX) * s_TileSize);
+		const int32_t tileMaxX = tileMinX + static_cast<int32_t>(s_TileSize) - 1;
+		const int32_t tileMaxY = tileMinY + static_cast<int32_t>(s_TileSize) - 1;
+
+		for (int32_t y = tileMinY; y <= tileMaxY; ++y)
+			std::fill_n(m_Depth.data() + static_cast<size_t>(y) * m_Width + tileMinX, s_TileSize, 1.f);
+
+		//-- Chunks in order, so a tile always sees its triangles in submission order.
+		for (uint32_t chunk = 0; chunk < chunkCount; ++chunk)
+		{
+			for (const uint32_t triangleIndex : m_Bins[static_cast<size_t>(chunk) * tileCount + tile])
+			{
+				const OcclusionTriangle& triangle = m_Triangles[triangleIndex];
+				const int32_t minX = std::max(triangle.m_MinX, tileMinX);
+				const int32_t maxX = std::min(triangle.m_MaxX, tileMaxX);
+				const int32_t minY = std::max(triangle.m_MinY, tileMinY);
+				const int32_t maxY = std::min(triangle.m_MaxY, tileMaxY);
+
+				for (int32_t y = minY; y <= maxY; ++y)
+				{
+					float* row = m_Depth.data() + static_cast<size_t>(y) * m_Width;
+					switch (path)
+					{
+#ifdef NYA_SIMD_AVX2
+					case SimdPath::Avx2:
+						RasterizeRowAvx2(row, triangle, y, minX, maxX);
+						break;
+#endif
+#ifdef NYA_SIMD_SSE2
+					case SimdPath::Sse:
+						RasterizeRowSse(row, triangle, y, minX, maxX);
+						break;
+#endif
+					default:
+						RasterizeRowScalar(row, triangle, y, minX, maxX);
+						break;
+					}
+				}
+			}
+		}
+
+		float maxDepth = 0.f;
+		for (int32_t y = tileMinY; y <= tileMaxY; ++y)
+		{
+			const float* row = m_Depth.data() + static_cast<size_t>(y) * m_Width + tileMinX;
+			maxDepth = std::max(maxDepth, *std::max_element(row, row + s_TileSize));
+		}
+		m_TileMaxDepth[tile] = maxDepth;
+	}
+
+	void OcclusionRasterizer::Rasterize(const SimdPath path)
+	{
+		const uint32_t tileCount = m_TilesX * m_TilesY;
+		const uint32_t chunkCount = (m_TriangleCount + s_SetupChunkSize - 1) / s_SetupChunkSize;
+
+		//-- Setup and bin. Bins keep their capacity between frames.
+		m_Triangles.resize(m_TriangleCount);
+		if (m_Bins.size() < static_cast<size_t>(chunkCount) * tileCount)
+			m_Bins.resize(static_cast<size_t>(chunkCount) * tileCount);
+		for (size_t bin = 0; bin < static_cast<size_t>(chunkCount) * tileCount; ++bin)
+			m_Bins[bin].clear();
+
+		ThreadPool::Get().ParallelFor(chunkCount, 1, [this](const uint32_t begin, const uint32_t end)
+		{
+			for (uint32_t chunk = begin; chunk < end; ++chunk)
+				SetupChunk(chunk);
+		});
+
+		//-- Rasterize, one tile per task. Tiles own disjoint pixels.
+		const SimdPath supportedPath = ClampSimdPath(path);
+		ThreadPool::Get().ParallelFor(tileCount, 1, [this, chunkCount, supportedPath](const uint32_t begin, const uint32_t end)
+		{
+			for (uint32_t tile = begin; tile < end; ++tile)
+				RasterizeTile(tile, chunkCount, supportedPath);
+		});
+	}
+
+	bool OcclusionRasterizer::IsVisible(const glm::vec3& min, const glm::vec3& max) const
+	{
+		//-- Screen rectangle and nearest depth of the box.
+		float minX = FLT_MAX, minY = FLT_MAX, maxX = -FLT_MAX, maxY = -FLT_MAX;
+		float nearestDepth = FLT_MAX;
+		for (uint32_t corner = 0; corner < 8; ++corner)
+		{
+			const glm::vec3 position((corner & 1) ? max.x : min.x, (corner & 2) ? max.y : min.y, (corner & 4) ? max.z : min.z);
+			const glm::vec4 clip = m_ViewProj * glm::vec4(position, 1.f);
+			if (clip.w < s_MinW || clip.z < 0.f)
+				return true;
+
+			const float invW = 1.f / clip.w;
+			const float x = (clip.x * invW * 0.5f + 0.5f) * static_cast<float>(m_Width);
+			const float y = (clip.y * invW * 0.5f + 0.5f) * static_cast<float>(m_Height);
+			minX = std::min(minX, x);
+			minY = std::min(minY, y);
+			maxX = std::max(maxX, x);
+			maxY = std::max(maxY, y);
+			nearestDepth = std::min(nearestDepth, clip.z * invW);
+		}
+
+		if (maxX < 0.f || maxY < 0.f || minX >= static_cast<float>(m_Width) || minY >= static_cast<float>(m_Height))
+			return false;
+
+		// Every pixel the rectangle touches, not just the centers it covers.
+		const int32_t pixelMinX = std::max(static_cast<int32_t>(std::floor(minX)), 0);
+		const int32_t pixelMinY = std::max(static_cast<int32_t>(std::floor(minY)), 0);
+		const int32_t pixelMaxX = std::min(static_cast<int32_t>(std::floor(maxX)), static_cast<int32_t>(m_Width) - 1);
+		const int32_t pixelMaxY = std::min(static_cast<int32_t>(std::floor(maxY)), static_cast<int32_t>(m_Height) - 1);
+
+		//-- Most occluded boxes are rejected by the tile maxima alone.
+		bool anyTileBehind = false;
+		for (int32_t tileY = pixelMinY / static_cast<int32_t>(s_TileSize); tileY <= pixelMaxY / static_cast<int32_t>(s_TileSize); ++tileY)
+		{
+			for (int32_t tileX = pixelMinX / static_cast<int32_t>(s_TileSize); tileX <= pixelMaxX / static_cast<int32_t>(s_TileSize); ++tileX)
+				anyTileBehind |= nearestDepth <= m_TileMaxDepth[tileY * m_TilesX + tileX];
+		}
+		if (!anyTileBehind)
+			return false;
+
+		//-- Then pixel by pixel, visible as soon as one stored depth is at or behind the box.
+		for (int32_t y = pixelMinY; y <= pixelMaxY; ++y)
+		{
+			const float* row = m_Depth.data() + static_cast<size_t>(y) * m_Width;
+			int32_t x = pixelMinX;
+#ifdef NYA_SIMD_SSE2
+			const __m128 nearest = _mm_set1_ps(nearestDepth);
+			for (; x + 4 <= pixelMaxX + 1; x += 4)
+			{
+				if (_mm_movemask_ps(_mm_cmpge_ps(_mm_loadu_ps(row + x), nearest)) != 0)
+					return true;
+			}
+#endif
+			for (; x <= pixelMaxX; ++x)
+			{
+				if (row[x] >= nearestDepth)
+					return true;
+			}
+		}
+
+		return false;
+	}
+
+	uint32_t OcclusionRasterizer::CullAabbs(const AabbBoundsSoA& bounds, const uint32_t* candidates, const uint32_t count, uint32_t* visible) const
+	{
+		uint32_t written = 0;
+		for (uint32_t i = 0; i < count; ++i)
+		{
+			const uint32_t object = candidates[i];
+			const glm::vec3 center(bounds.m_CenterX[object], bounds.m_CenterY[object], bounds.m_CenterZ[object]);
+			const glm::vec3 extent(bounds.m_ExtentX[object], bounds.m_ExtentY[object], bounds.m_ExtentZ[object]);
+			if (IsVisible(center - extent, center + extent))
+				visible[written++] = object;
+		}
+
+		return written;
+	}
+
+	const std::vector<float>& OcclusionRasterizer::GetDepth() const
+	{
+		return m_Depth;
+	}
+
+	uint32_t OcclusionRasterizer::GetWidth() const
+	{
+		return m_Width;
+	}
+
+	uint32_t OcclusionRasterizer::GetHeight() const
+	{
+		return m_Height;
+	}
+
+	uint32_t OcclusionRasterizer::GetTriangleCount() const
+	{
+		return m_TriangleCount;
+	}
+
+	void OcclusionRasterizer::Benchmark(const uint32_t triangleCount, const uint32_t objectCount, const uint32_t iterations)
+	{
+		//-- Random occluder quads and objects in front of a camera at the origin looking down -z.
+		std::mt19937 random(1337);
+		std::uniform_real_distribution<float> spread(-20.f, 20.f), depths(-60.f, -5.f), sizes(0.25f, 2.f);
+
+		std::vector<glm::vec3> positions;
+		std::vector<uint32_t> indices;
+		for (uint32_t quad = 0; quad < (triangleCount + 1) / 2; ++quad)
+		{
+			const glm::vec3 center(spread(random), spread(random) * 0.5f, depths(random));
+			const float halfWidth = sizes(random);
+			const float halfHeight = sizes(random);
+			const uint32_t first = static_cast<uint32_t>(positions.size());
+			positions.emplace_back(center.x - halfWidth, center.y - halfHeight, center.z);
+			positions.emplace_back(center.x + halfWidth, center.y - halfHeight, center.z);
+			positions.emplace_back(center.x + halfWidth, center.y + halfHeight, center.z);
+			positions.emplace_back(center.x - halfWidth, center.y + halfHeight, center.z);
+			indices.insert(indices.end(), { first, first + 1, first + 2, first, first + 2, first + 3 });
+		}
+
+		AabbBoundsSoA objects;
+		objects.Reserve(objectCount);
+		for (uint32_t i = 0; i < objectCount; ++i)
+		{
+			const glm::vec3 center(spread(random), spread(random) * 0.5f, depths(random));
+			const glm::vec3 extent(sizes(random) * 0.25f);
+			objects.Add(center - extent, center + extent);
+		}
+
+		const glm::mat4 proj = glm::perspective(glm::radians(60.f), 2.f, 0.1f, 100.f);
+		const glm::mat4 view = glm::lookAt(glm::vec3(0.f), glm::vec3(0.f, 0.f, -1.f), glm::vec3(0.f, 1.f, 0.f));
+
+		OcclusionRasterizer rasterizer;
+		rasterizer.Init();
+
+		std::vector<uint32_t> candidates(objectCount);
+		std::vector<uint32_t> visible(objectCount);
+		for (uint32_t i = 0; i < objectCount; ++i)
+			candidates[i] = i;
+
+		std::vector<float> reference;
+		constexpr std::array paths = { SimdPath::Scalar, SimdPath::Sse, SimdPath::Avx2 };
+		constexpr std::array pathNames = { "scalar", "sse", "avx2" };
+		for (uint32_t p = 0; p <= static_cast<uint32_t>(GetBestSimdPath()); ++p)
+		{
+			float rasterMs = 0.f;
+			float testMs = 0.f;
+			uint32_t visibleCount = 0;
+			for (uint32_t iteration = 0; iteration < iterations; ++iteration)
+			{
+				auto startTime = std::chrono::high_resolution_clock::now();
+				rasterizer.Begin(proj * view);
+				rasterizer.AddOccluder(&positions[0].x, sizeof(glm::vec3), indices.data(), static_cast<uint32_t>(indices.size()), glm::mat4(1.f));
+				rasterizer.Rasterize(paths[p]);
+				auto endTime = std::chrono::high_resolution_clock::now();
+				rasterMs += std::chrono::duration<float, std::chrono::milliseconds::period>(endTime - startTime).count();
+
+				startTime = std::chrono::high_resolution_clock::now();
+				visibleCount = rasterizer.CullAabbs(objects, candidates.data(), objectCount, visible.data());
+				endTime = std::chrono::high_resolution_clock::now();
+				testMs += std::chrono::duration<float, std::chrono::milliseconds::period>(endTime - startTime).count();
+			}
+
+			// Every path must write the same depth. Fusing multiply-adds breaks that, so builds must not contract
+			// floating point expressions: MSVC's /fp:precise does not, GCC and Clang need -ffp-contract=off.
+			if (p == 0)
+				reference = rasterizer.GetDepth();
+			else if (rasterizer.GetDepth() != reference)
+				throw std::runtime_error(std::string("Occlusion raster (") + pathNames[p] + ") depth differs from the scalar path!");
+
+			rasterMs /= static_cast<float>(iterations);
+			testMs /= static_cast<float>(iterations);
+			std::cout << "\t" << "Occlusion raster of " << rasterizer.GetTriangleCount() << " triangles (" << pathNames[p] << "): " << rasterMs << "ms, "
+				<< static_cast<float>(rasterizer.GetTriangleCount()) / rasterMs << " triangles/ms. "
+				<< objectCount << " box tests " << testMs << "ms, " << visibleCount << " visible" << std::endl;
+		}
+	}
+}
@@ -0,0 +1,107 @@
+﻿/*!
+\file		OcclusionRasterizer.h
+\date		19/10/2026
+
+\author		Adrian Tan
+\email		t.xingkhiangadrian\@digipen.edu
+
+\brief		Contains definition of OcclusionRasterizer class.
+			Software depth rasterizer for occluder-based visibility culling on the CPU,
+			needs no GPU and no compute support.
+
+\copyright	All content © 2023 DigiPen (SINGAPORE) Corporation, all rights reserved.
+			Reproduction or disclosure of this file or its contents without the
+			prior written consent of DigiPen Institute of Technology is prohibited.
+__________________________________________________________________________________*/
+#pragma once
+
+#include "FrustumCuller.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace Nya
+{
+	// Screen space triangle ready to rasterize, 64 bytes. Edge functions are A * x + B * y + C, positive inside,
+	// and depth is the plane A * x + B * y + C too. Bounds are inclusive pixels.
+	struct OcclusionTriangle
+	{
+		float m_EdgeA[3];
+		float m_EdgeB[3];
+		float m_EdgeC[3];
+		float m_DepthA;
+		float m_DepthB;
+		float m_DepthC;
+		int32_t m_MinX;
+		int32_t m_MinY;
+		int32_t m_MaxX;
+		int32_t m_MaxY;
+	};
+
+	// Rasterizes a few large occluder meshes into a small depth buffer on the CPU, then tests object bounds
+	// against it before anything is recorded. Depth runs 0 near to 1 far, like the GPU's.
+	// Screen is split into tiles; triangle setup and tile rasterization both run on the ThreadPool, and every
+	// pixel's depth is computed the same way regardless of tiling or thread count, so results are deterministic.
+	class OcclusionRasterizer
+	{
+		struct Occluder
+		{
+			const float* m_Positions = nullptr;
+			size_t m_PositionStride = 0;
+			const uint32_t* m_Indices = nullptr;
+			uint32_t m_TriangleCount = 0;
+			glm::mat4 m_ModelViewProj{ 1.f };
+		};
+
+		uint32_t m_Width = 0;
+		uint32_t m_Height = 0;
+		uint32_t m_TilesX = 0;
+		uint32_t m_TilesY = 0;
+
+		glm::mat4 m_ViewProj{ 1.f };
+		std::vector<Occluder> m_Occluders;
+		std::vector<uint32_t> m_OccluderFirstTriangles;
+		uint32_t m_TriangleCount = 0;
+
+		std::vector<OcclusionTriangle> m_Triangles;				// One slot per submitted triangle, rejected ones are never binned.
+		std::vector<std::vector<uint32_t>> m_Bins;		// Per setup chunk, then per tile, so setup threads never share a bin.
+		std::vector<float> m_Depth;						// Row major.
+		std::vector<float> m_TileMaxDepth;				// Farthest depth in each tile, lets most occluded tests skip the pixels.
+
+		bool SetupTriangle(const Occluder& occluder, uint32_t triangle, OcclusionTriangle& setup) const;
+		void SetupChunk(uint32_t chunk);
+		void RasterizeTile(uint32_t tile, uint32_t chunkCount, SimdPath path);
+
+	public:
+		static constexpr uint32_t s_DefaultWidth = 256;
+		static constexpr uint32_t s_DefaultHeight = 128;
+		static constexpr uint32_t s_TileSize = 32;			// Width and height must be multiples of it.
+		static constexpr uint32_t s_SetupChunkSize = 1024;	// Triangles per setup task.
+
+		void Init(uint32_t width = s_DefaultWidth, uint32_t height = s_DefaultHeight);
+
+		// Starts a frame: forgets every occluder. Depth is cleared by Rasterize.
+		void Begin(const glm::mat4& viewProj);
+		// Adds an indexed triangle list. positions points to the first vertex's float3 position, positionStride is in bytes.
+		// The data is read by Rasterize, and must stay alive until then.
+		void AddOccluder(const float* positions, size_t positionStride, const uint32_t* indices, uint32_t indexCount, const glm::mat4& model);
+		// Rasterizes every occluder added since Begin. Triangles crossing the near plane are dropped, which only loses occlusion.
+		void Rasterize(SimdPath path = GetBestSimdPath());
+
+		// True if any part of a world space box may be in front of the occluders. Boxes crossing the near plane are always visible.
+		bool IsVisible(const glm::vec3& min, const glm::vec3& max) const;
+		// Keeps the candidates whose box passes IsVisible and writes them to visible, in order. Returns the number written.
+		// visible may be candidates itself, and disjoint ranges can be tested on separate threads.
+		uint32_t CullAabbs(const AabbBoundsSoA& bounds, const uint32_t* candidates, uint32_t count, uint32_t* visible) const;
+
+		const std::vector<float>& GetDepth() const;
+		uint32_t GetWidth() const;
+		uint32_t GetHeight() const;
+		uint32_t GetTriangleCount() const;
+
+		// Times rasterization of triangleCount random occluder triangles on every path the CPU runs, and the tests of
+		// objectCount boxes against the result, and prints triangles per millisecond. Throws if a path's depth differs
+		// from scalar. Needs no GPU.
+		static void Benchmark(uint32_t triangleCount, uint32_t objectCount = 100000, uint32_t iterations = 16);
+	};
+}
@@ -0,0 +1,656 @@
+﻿/*!
+\file		PixelConverter.cpp
+\date		19/10/2026
+
+\author		Adrian Tan
+\email		t.xingkhiangadrian\@digipen.edu
+
+\brief		Contains implementation of PixelConverter class.
+
+\copyright	All content © 2023 DigiPen (SINGAPORE) Corporation, all rights reserved.
+			Reproduction or disclosure of this file or its contents without the
+			prior written consent of DigiPen Institute of Technology is prohibited.
+__________________________________________________________________________________*/
+
+#include "meowpch.h"
+
+#include "PixelConverter.h"
+#include "Simd.h"
+
+#include <cfloat>
+
+namespace Nya
+{
+	//-- Tables.
+	namespace
+	{
+
+		struct SrgbTables
+		{
+			float m_ToLinear[512];		// Colour bytes, then alpha bytes from 256.
+			float m_Thresholds[257];	// m_Thresholds[k] is the smallest linear value that encodes to sRGB k or above, with sentinels at 0 and 256.
+		};
+
+		double DecodeSrgb(const double value)
+		{
+			return value <= 0.04045 ? value / 12.92 : std::pow((value + 0.055) / 1.055, 2.4);
+		}
+
+		const SrgbTables& GetSrgbTables()
+		{
+			static const SrgbTables s_Tables = []
+			{
+				SrgbTables tables{};
+				for (uint32_t i = 0; i < 256; ++i)
+				{
+					tables.m_ToLinear[i] = static_cast<float>(DecodeSrgb(i / 255.0));
+					tables.m_ToLinear[256 + i] = static_cast<float>(i) / 255.f;
+				}
+
+				tables.m_Thresholds[0] = -FLT_MAX;
+				for (uint32_t k = 1; k < 256; ++k)
+					tables.m_Thresholds[k] = static_cast<float>(DecodeSrgb((k - 0.5) / 255.0));
+				tables.m_Thresholds[256] = FLT_MAX;
+				return tables;
+			}();
+			return s_Tables;
+		}
+	}
+
+
+	//-- Scalar kernels, each converts pixels [begin, end).
+	namespace
+	{
+		void ExpandRgbToRgbaScalar(const uint8_t* rgb, uint8_t* rgba, const size_t begin, const size_t end)
+		{
+			for (size_t i = begin; i < end; ++i)
+			{
+				rgba[i * 4 + 0] = rgb[i * 3 + 0];
+				rgba[i * 4 + 1] = rgb[i * 3 + 1];
+				rgba[i * 4 + 2] = rgb[i * 3 + 2];
+				rgba[i * 4 + 3] = 255;
+			}
+		}
+
+		void SwapRedBlueScalar(const uint8_t* source, uint8_t* destination, const size_t begin, const size_t end)
+		{
+			for (size_t i = begin; i < end; ++i)
+			{
+				const uint8_t red = source[i * 4 + 0];
+				const uint8_t blue = source[i * 4 + 2];
+				destination[i * 4 + 0] = blue;
+				destination[i * 4 + 1] = source[i * 4 + 1];
+				destination[i * 4 + 2] = red;
+				destination[i * 4 + 3] = source[i * 4 + 3];
+			}
+		}
+
+		// x * a / 255 rounded to nearest, exact for every byte pair.
+		uint32_t MultiplyBytes(const uint32_t x, const uint32_t a)
+		{
+			const uint32_t t = x * a + 128;
+			return (t + (t >> 8)) >> 8;
+		}
+
+		void PremultiplyAlphaScalar(const uint8_t* source, uint8_t* destination, const size_t begin, const size_t end)
+		{
+			for (size_t i = begin; i < end; ++i)
+			{
+				const uint32_t alpha = source[i * 4 + 3];
+				for (uint32_t c = 0; c < 3; ++c)
+					destination[i * 4 + c] = static_cast<uint8_t>(MultiplyBytes(source[i * 4 + c], alpha));
+				destination[i * 4 + 3] = static_cast<uint8_t>(alpha);
+			}
+		}
+
+		void RenormalizeNormalsScalar(const uint8_t* source, uint8_t* destination, const size_t begin, const size_t end)
+		{
+			for (size_t i = begin; i < end; ++i)
+			{
+				// Byte b decodes to (2b - 255) / 255, the scale cancels out of the normalization. The odd integers and
+				// their squared length are exact in float, and no multiply feeds an add, so fused multiply-adds
+				// cannot change the result. No byte maps to 0, so the length never is.
+				float normal[3];
+				for (uint32_t c = 0; c < 3; ++c)
+					normal[c] = static_cast<float>(source[i * 4 + c] * 2 - 255);
+
+				const float length = std::sqrt(normal[0] * normal[0] + normal[1] * normal[1] + normal[2] * normal[2]);
+				for (uint32_t c = 0; c < 3; ++c)
+					destination[i * 4 + c] = static_cast<uint8_t>(static_cast<int32_t>(normal[c] * 127.5f / length + 128.f));
+				destination[i * 4 + 3] = source[i * 4 + 3];
+			}
+		}
+
+		void SrgbToLinearScalar(const uint8_t* source, float* destination, const size_t begin, const size_t end)
+		{
+			const float* toLinear = GetSrgbTables().m_ToLinear;
+			for (size_t i = begin; i < end; ++i)
+			{
+				for (uint32_t c = 0; c < 3; ++c)
+					destination[i * 4 + c] = toLinear[source[i * 4 + c]];
+				destination[i * 4 + 3] = toLinear[256 + source[i * 4 + 3]];
+			}
+		}
+
+		// A polynomial in square roots (Lagarde) lands within one sRGB step,
+		// then comparing against the neighbouring thresholds gives the exact step.
+		uint8_t EncodeSrgb(const float linear, const float* thresholds)
+		{
+			const float value = std::clamp(linear, 0.f, 1.f);
+
+			const float root2 = std::sqrt(value);
+			const float root4 = std::sqrt(root2);
+			const float root8 = std::sqrt(root4);
+			const float approximate = value <= 0.0031308f ? value * 12.92f : 0.585122381f * root2 + 0.783140355f * root4 - 0.368262736f * root8;
+
+			int32_t guess = static_cast<int32_t>(std::clamp(approximate, 0.f, 1.f) * 255.f + 0.5f);
+			guess += value >= thresholds[guess + 1] ? 1 : 0;
+			guess -= value < thresholds[guess] ? 1 : 0;
+			return static_cast<uint8_t>(guess);
+		}
+
+		void LinearToSrgbScalar(const float* source, uint8_t* destination, const size_t begin, const size_t end)
+		{
+			const float* thresholds = GetSrgbTables().m_Thresholds;
+			for (size_t i = begin; i < end; ++i)
+			{
+				for (uint32_t c = 0; c < 3; ++c)
+					destination[i * 4 + c] = EncodeSrgb(source[i * 4 + c], thresholds);
+				destination[i * 4 + 3] = static_cast<uint8_t>(std::clamp(source[i * 4 + 3], 0.f, 1.f) * 255.f + 0.5f);
+			}
+		}
+	}
+
+
+	//-- SIMD kernels, each converts as many leading pixels as it can and returns how many.
+	namespace
+	{
+#ifdef NYA_SIMD_SSE2
+		// One byte per 32 bit lane of packed RGBA8 pixels.
+		__m128i ExtractChannel(const __m128i pixels, const int32_t channel)
+		{
+			return _mm_and_si128(_mm_srl_epi32(pixels, _mm_cvtsi32_si128(channel * 8)), _mm_set1_epi32(0xFF));
+		}
+
+		__m128i PackChannels(const __m128i red, const __m128i green, const __m128i blue, const __m128i alpha)
+		{
+			return _mm_or_si128(_mm_or_si128(red, _mm_slli_epi32(green, 8)), _mm_or_si128(_mm_slli_epi32(blue, 16), _mm_slli_epi32(alpha, 24)));
+		}
+
+		size_t SwapRedBlueSse(const uint8_t* source, uint8_t* destination, const size_t pixelCount)
+		{
+			const __m128i greenAlpha = _mm_set1_epi32(static_cast<int32_t>(0xFF00FF00u));
+			size_t i = 0;
+			for (; i + 4 <= pixelCount; i += 4)
+			{
+				const __m128i pixels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i * 4));
+				const __m128i swapped = _mm_or_si128(_mm_slli_epi32(ExtractChannel(pixels, 0), 16), ExtractChannel(pixels, 2));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(destination + i * 4), _mm_or_si128(_mm_and_si128(pixels, greenAlpha), swapped));
+			}
+			return i;
+		}
+
+		__m128i MultiplyBytesSse(const __m128i x, const __m128i a)
+		{
+			// Both factors fit 16 bits, so the low half product is the whole product.
+			const __m128i t = _mm_add_epi32(_mm_mullo_epi16(x, a), _mm_set1_epi32(128));
+			return _mm_srli_epi32(_mm_add_epi32(t, _mm_srli_epi32(t, 8)), 8);
+		}
+
+		size_t PremultiplyAlphaSse(const uint8_t* source, uint8_t* destination, const size_t pixelCount)
+		{
+			size_t i = 0;
+			for (; i + 4 <= pixelCount; i += 4)
+			{
+				const __m128i pixels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i * 4));
+				const __m128i alpha = _mm_srli_epi32(pixels, 24);
+				const __m128i result = PackChannels(MultiplyBytesSse(ExtractChannel(pixels, 0), alpha), MultiplyBytesSse(ExtractChannel(pixels, 1), alpha),
+					MultiplyBytesSse(ExtractChannel(pixels, 2), alpha), alpha);
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(destination + i * 4), result);
+			}
+			return i;
+		}
+
+		size_t RenormalizeNormalsSse(const uint8_t* source, uint8_t* destination, const size_t pixelCount)
+		{
+			const __m128i bias = _mm_set1_epi32(255);
+			const __m128 encodeScale = _mm_set1_ps(127.5f);
+			const __m128 encodeBias = _mm_set1_ps(128.f);
+
+			size_t i = 0;
+			for (; i + 4 <= pixelCount; i += 4)
+			{
+				const __m128i pixels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i * 4));
+
+				__m128 normal[3];
+				for (int32_t c = 0; c < 3; ++c)
+					normal[c] = _mm_cvtepi32_ps(_mm_sub_epi32(_mm_slli_epi32(ExtractChannel(pixels, c), 1), bias));
+
+				const __m128 length = _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(normal[0], normal[0]), _mm_mul_ps(normal[1], normal[1])), _mm_mul_ps(normal[2], normal[2])));
+
+				__m128i encoded[3];
+				for (uint32_t c = 0; c < 3; ++c)
+					encoded[c] = _mm_cvttps_epi32(_mm_add_ps(_mm_div_ps(_mm_mul_ps(normal[c], encodeScale), length), encodeBias));
+
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(destination + i * 4), PackChannels(encoded[0], encoded[1], encoded[2], _mm_srli_epi32(pixels, 24)));
+			}
+			return i;
+		}
+
+		size_t SrgbToLinearSse(const uint8_t* source, float* destination, const size_t pixelCount)
+		{
+			// No gather before AVX2, the loads stay scalar.
+			const float* toLinear = GetSrgbTables().m_ToLinear;
+			for (size_t i = 0; i < pixelCount; ++i)
+			{
+				const uint8_t* texel = source + i * 4;
+				_mm_storeu_ps(destination + i * 4, _mm_setr_ps(toLinear[texel[0]], toLinear[texel[1]], toLinear[texel[2]], toLinear[256 + texel[3]]));
+			}
+			return pixelCount;
+		}
+
+		// One pixel, RGBA in lanes 0 to 3, see EncodeSrgb.
+		__m128i EncodeSrgbSse(const __m128 linear, const float* thresholds)
+		{
+			const __m128 value = _mm_min_ps(_mm_max_ps(linear, _mm_setzero_ps()), _mm_set1_ps(1.f));
+
+			const __m128 root2 = _mm_sqrt_ps(value);
+			const __m128 root4 = _mm_sqrt_ps(root2);
+			const __m128 root8 = _mm_sqrt_ps(root4);
+			const __m128 curve = _mm_sub_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(0.585122381f), root2), _mm_mul_ps(_mm_set1_ps(0.783140355f), root4)),
+				_mm_mul_ps(_mm_set1_ps(0.368262736f), root8));
+			const __m128 isLinear = _mm_cmple_ps(value, _mm_set1_ps(0.0031308f));
+			const __m128 approximate = _mm_or_ps(_mm_and_ps(isLinear, _mm_mul_ps(value, _mm_set1_ps(12.92f))), _mm_andnot_ps(isLinear, curve));
+
+			const __m128 clamped = _mm_min_ps(_mm_max_ps(approximate, _mm_setzero_ps()), _mm_set1_ps(1.f));
+			const __m128i guess = _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(clamped, _mm_set1_ps(255.f)), _mm_set1_ps(0.5f)));
+
+			alignas(16) int32_t guesses[4];
+			_mm_store_si128(reinterpret_cast<__m128i*>(guesses), guess);
+			const __m128 lower = _mm_setr_ps(thresholds[guesses[0]], thresholds[guesses[1]], thresholds[guesses[2]], 0.f);
+			const __m128 upper = _mm_setr_ps(thresholds[guesses[0] + 1], thresholds[guesses[1] + 1], thresholds[guesses[2] + 1], 0.f);
+
+			// Compare masks are -1, so subtracting one that passed adds a step.
+			const __m128i color = _mm_add_epi32(_mm_sub_epi32(guess, _mm_castps_si128(_mm_cmpge_ps(value, upper))), _mm_castps_si128(_mm_cmplt_ps(value, lower)));
+			const __m128i alpha = _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(value, _mm_set1_ps(255.f)), _mm_set1_ps(0.5f)));
+
+			const __m128i alphaLane = _mm_setr_epi32(0, 0, 0, -1);
+			return _mm_or_si128(_mm_and_si128(alphaLane, alpha), _mm_andnot_si128(alphaLane, color));
+		}
+
+		size_t LinearToSrgbSse(const float* source, uint8_t* destination, const size_t pixelCount)
+		{
+			const float* thresholds = GetSrgbTables().m_Thresholds;
+			size_t i = 0;
+			for (; i + 4 <= pixelCount; i += 4)
+			{
+				__m128i encoded[4];
+				for (uint32_t pixel = 0; pixel < 4; ++pixel)
+					encoded[pixel] = EncodeSrgbSse(_mm_loadu_ps(source + (i + pixel) * 4), thresholds);
+
+				const __m128i packed = _mm_packus_epi16(_mm_packs_epi32(encoded[0], encoded[1]), _mm_packs_epi32(encoded[2], encoded[3]));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(destination + i * 4), packed);
+			}
+			return i;
+		}
+#endif
+
+#ifdef NYA_SIMD_SSE41
+NYA_SIMD_BEGIN_SSE41
+		// Reads 16 bytes for every 12 it converts, so it stops where that would run past the source.
+		size_t ExpandRgbToRgbaSse(const uint8_t* rgb, uint8_t* rgba, const size_t pixelCount)
+		{
+			const __m128i shuffle = _mm_setr_epi8(0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1);
+			const __m128i opaque = _mm_set1_epi32(static_cast<int32_t>(0xFF000000u));
+
+			size_t i = 0;
+			for (; (i + 4) * 3 + 4 <= pixelCount * 3; i += 4)
+			{
+				const __m128i pixels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(rgb + i * 3));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(rgba + i * 4), _mm_or_si128(_mm_shuffle_epi8(pixels, shuffle), opaque));
+			}
+			return i;
+		}
+NYA_SIMD_END
+#endif
+
+#ifdef NYA_SIMD_AVX2
+NYA_SIMD_BEGIN_AVX2
+		__m256i ExtractChannel(const __m256i pixels, const int32_t channel)
+		{
+			return _mm256_and_si256(_mm256_srl_epi32(pixels, _mm_cvtsi32_si128(channel * 8)), _mm256_set1_epi32(0xFF));
+		}
+
+		__m256i PackChannels(const __m256i red, const __m256i green, const __m256i blue, const __m256i alpha)
+		{
+			return _mm256_or_si256(_mm256_or_si256(red, _mm256_slli_epi32(green, 8)), _mm256_or_si256(_mm256_slli_epi32(blue, 16), _mm256_slli_epi32(alpha, 24)));
+		}
+
+		size_t ExpandRgbToRgbaAvx2(const uint8_t* rgb, uint8_t* rgba, const size_t pixelCount)
+		{
+			// The shuffle stays within 128 bit lanes, so each lane loads its own 4 pixels.
+			const __m256i shuffle = _mm256_setr_epi8(0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1, 0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1);
+			const __m256i opaque = _mm256_set1_epi32(static_cast<int32_t>(0xFF000000u));
+
+			size_t i = 0;
+			for (; (i + 8) * 3 + 4 <= pixelCount * 3; i += 8)
+			{
+				const __m128i low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(rgb + i * 3));
+				const __m128i high = _mm_loadu_si128(reinterpret_cast<const __m128i*>(rgb + i * 3 + 12));
+				const __m256i pixels = _mm256_inserti128_si256(_mm256_castsi128_si256(low), high, 1);
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(rgba + i * 4), _mm256_or_si256(_mm256_shuffle_epi8(pixels, shuffle), opaque));
+			}
+			return i;
+		}
+
+		size_t SwapRedBlueAvx2(const uint8_t* source, uint8_t* destination, const size_t pixelCount)
+		{
+			const __m256i greenAlpha = _mm256_set1_epi32(static_cast<int32_t>(0xFF00FF00u));
+			size_t i = 0;
+			for (; i + 8 <= pixelCount; i += 8)
+			{
+				const __m256i pixels = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(source + i * 4));
+				const __m256i swapped = _mm256_or_si256(_mm256_slli_epi32(ExtractChannel(pixels, 0), 16), ExtractChannel(pixels, 2));
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(destination + i * 4), _mm256_or_si256(_mm256_and_si256(pixels, greenAlpha), swapped));
+			}
+			return i;
+		}
+
+		__m256i MultiplyBytesAvx2(const __m256i x, const __m256i a)
+		{
+			const __m256i t = _mm256_add_epi32(_mm256_mullo_epi16(x, a), _mm256_set1_epi32(128));
+			return _mm256_srli_epi32(_mm256_add_epi32(t, _mm256_srli_epi32(t, 8)), 8);
+		}
+
+		size_t PremultiplyAlphaAvx2(const uint8_t* source, uint8_t* destination, const size_t pixelCount)
+		{
+			size_t i = 0;
+			for (; i + 8 <= pixelCount; i += 8)
+			{
+				const __m256i pixels = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(source + i * 4));
+				const __m256i alpha = _mm256_srli_epi32(pixels, 24);
+				const __m256i result = PackChannels(MultiplyBytesAvx2(ExtractChannel(pixels, 0), alpha), MultiplyBytesAvx2(ExtractChannel(pixels, 1), alpha),
+					MultiplyBytesAvx2(ExtractChannel(pixels, 2), alpha), alpha);
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(destination + i * 4), result);
+			}
+			return i;
+		}
+
+		size_t RenormalizeNormalsAvx2(const uint8_t* source, uint8_t* destination, const size_t pixelCount)
+		{
+			const __m256i bias = _mm256_set1_epi32(255);
+			const __m256 encodeScale = _mm256_set1_ps(127.5f);
+			const __m256 encodeBias = _mm256_set1_ps(128.f);
+
+			size_t i = 0;
+			for (; i + 8 <= pixelCount; i += 8)
+			{
+				const __m256i pixels = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(source + i * 4));
+
+				__m256 normal[3];
+				for (int32_t c = 0; c < 3; ++c)
+					normal[c] = _mm256_cvtepi32_ps(_mm256_sub_epi32(_mm256_slli_epi32(ExtractChannel(pixels, c), 1), bias));
+
+				const __m256 length = _mm256_sqrt_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(normal[0], normal[0]), _mm256_mul_ps(normal[1], normal[1])),
+					_mm256_mul_ps(normal[2], normal[2])));
+
+				__m256i encoded[3];
+				for (uint32_t c = 0; c < 3; ++c)
+					encoded[c] = _mm256_cvttps_epi32(_mm256_add_ps(_mm256_div_ps(_mm256_mul_ps(normal[c], encodeScale), length), encodeBias));
+
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(destination + i * 4), PackChannels(encoded[0], encoded[1], encoded[2], _mm256_srli_epi32(pixels, 24)));
+			}
+			return i;
+		}
+
+		size_t SrgbToLinearAvx2(const uint8_t* source, float* destination, const size_t pixelCount)
+		{
+			// Two pixels per gather, alpha lanes index the linear half of the table.
+			const float* toLinear = GetSrgbTables().m_ToLinear;
+			const __m256i alphaOffset = _mm256_setr_epi32(0, 0, 0, 256, 0, 0, 0, 256);
+
+			size_t i = 0;
+			for (; i + 2 <= pixelCount; i += 2)
+			{
+				const __m256i indices = _mm256_add_epi32(_mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(source + i * 4))), alphaOffset);
+				_mm256_storeu_ps(destination + i * 4, _mm256_i32gather_ps(toLinear, indices, 4));
+			}
+			return i;
+		}
+
+		// Two pixels, see EncodeSrgb.
+		__m256i EncodeSrgbAvx2(const __m256 linear, const float* thresholds)
+		{
+			const __m256 value = _mm256_min_ps(_mm256_max_ps(linear, _mm256_setzero_ps()), _mm256_set1_ps(1.f));
+
+			const __m256 root2 = _mm256_sqrt_ps(value);
+			const __m256 root4 = _mm256_sqrt_ps(root2);
+			const __m256 root8 = _mm256_sqrt_ps(root4);
+			const __m256 curve = _mm256_sub_ps(_mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(0.585122381f), root2), _mm256_mul_ps(_mm256_set1_ps(0.783140355f), root4)),
+				_mm256_mul_ps(_mm256_set1_ps(0.368262736f), root8));
+			const __m256 approximate = _mm256_blendv_ps(curve, _mm256_mul_ps(value, _mm256_set1_ps(12.92f)), _mm256_cmp_ps(value, _mm256_set1_ps(0.0031308f), _CMP_LE_OQ));
+
+			const __m256 clamped = _mm256_min_ps(_mm256_max_ps(approximate, _mm256_setzero_ps()), _mm256_set1_ps(1.f));
+			const __m256i guess = _mm256_cvttps_epi32(_mm256_add_ps(_mm256_mul_ps(clamped, _mm256_set1_ps(255.f)), _mm256_set1_ps(0.5f)));
+
+			const __m256 lower = _mm256_i32gather_ps(thresholds, guess, 4);
+			const __m256 upper = _mm256_i32gather_ps(thresholds + 1, guess, 4);
+			const __m256i color = _mm256_add_epi32(_mm256_sub_epi32(guess, _mm256_castps_si256(_mm256_cmp_ps(value, upper, _CMP_GE_OQ))),
+				_mm256_castps_si256(_mm256_cmp_ps(value, lower, _CMP_LT_OQ)));
+			const __m256i alpha = _mm256_cvttps_epi32(_mm256_add_ps(_mm256_mul_ps(value, _mm256_set1_ps(255.f)), _mm256_set1_ps(0.5f)));
+
+			return _mm256_blend_epi32(color, alpha, 0x88);
+		}
+
+		size_t LinearToSrgbAvx2(const float* source, uint8_t* destination, const size_t pixelCount)
+		{
+			const float* thresholds = GetSrgbTables().m_Thresholds;
+			size_t i = 0;
+			for (; i + 8 <= pixelCount; i += 8)
+			{
+				__m256i encoded[4];
+				for (uint32_t pair = 0; pair < 4; ++pair)
+					encoded[pair] = EncodeSrgbAvx2(_mm256_loadu_ps(source + (i + pair * 2) * 4), thresholds);
+
+				// Packs interleave the 128 bit lanes, the permute puts the pixels back in order.
+				const __m256i packed = _mm256_packus_epi16(_mm256_packs_epi32(encoded[0], encoded[1]), _mm256_packs_epi32(encoded[2], encoded[3]));
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(destination + i * 4), _mm256_permutevar8x32_epi32(packed, _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7)));
+			}
+			return i;
+		}
+NYA_SIMD_END
+#endif
+	}
+
+
+	//-- PixelConverter Functions.
+	void PixelConverter::ExpandRgbToRgba(const uint8_t* rgb, uint8_t* rgba, const size_t pixelCount, const SimdPath path)
+	{
+		size_t done = 0;
+		switch (ClampSimdPath(path))
+		{
+#ifdef NYA_SIMD_AVX2
+		case SimdPath::Avx2:
+			done = ExpandRgbToRgbaAvx2(rgb, rgba, pixelCount);
+			break;
+#endif
+#ifdef NYA_SIMD_SSE41
+		case SimdPath::Sse:
+			if (GetSimdFeatures().m_Sse41)
+				done = ExpandRgbToRgbaSse(rgb, rgba, pixelCount);
+			break;
+#endif
+		default:
+			break;
+		}
+		ExpandRgbToRgbaScalar(rgb, rgba, done, pixelCount);
+	}
+
+	void PixelConverter::SwapRedBlue(const uint8_t* source, uint8_t* destination, const size_t pixelCount, const SimdPath path)
+	{
+		size_t done = 0;
+		switch (ClampSimdPath(path))
+		{
+#ifdef NYA_SIMD_AVX2
+		case SimdPath::Avx2:
+			done = SwapRedBlueAvx2(source, destination, pixelCount);
+			break;
+#endif
+#ifdef NYA_SIMD_SSE2
+		case SimdPath::Sse:
+			done = SwapRedBlueSse(source, destination, pixelCount);
+			break;
+#endif
+		default:
+			break;
+		}
+		SwapRedBlueScalar(source, destination, done, pixelCount);
+	}
+
+	void PixelConverter::PremultiplyAlpha(const uint8_t* source, uint8_t* destination, const size_t pixelCount, const SimdPath path)
+	{
+		size_t done = 0;
+		switch (ClampSimdPath(path))
+		{
+#ifdef NYA_SIMD_AVX2
+		case SimdPath::Avx2:
+			done = PremultiplyAlphaAvx2(source, destination, pixelCount);
+			break;
+#endif
+#ifdef NYA_SIMD_SSE2
+		case SimdPath::Sse:
+			done = PremultiplyAlphaSse(source, destination, pixelCount);
+			break;
+#endif
+		default:
+			break;
+		}
+		PremultiplyAlphaScalar(source, destination, done, pixelCount);
+	}
+
+	void PixelConverter::RenormalizeNormals(const uint8_t* source, uint8_t* destination, const size_t pixelCount, const SimdPath path)
+	{
+		size_t done = 0;
+		switch (ClampSimdPath(path))
+		{
+#ifdef NYA_SIMD_AVX2
+		case SimdPath::Avx2:
+			done = RenormalizeNormalsAvx2(source, destination, pixelCount);
+			break;
+#endif
+#ifdef NYA_SIMD_SSE2
+		case SimdPath::Sse:
+			done = RenormalizeNormalsSse(source, destination, pixelCount);
+			break;
+#endif
+		default:
+			break;
+		}
+		RenormalizeNormalsScalar(source, destination, done, pixelCount);
+	}
+
+	void PixelConverter::SrgbToLinear(const uint8_t* source, float* destination, const size_t pixelCount, const SimdPath path)
+	{
+		size_t done = 0;
+		switch (ClampSimdPath(path))
+		{
+#ifdef NYA_SIMD_AVX2
+		case SimdPath::Avx2:
+			done = SrgbToLinearAvx2(source, destination, pixelCount);
+			break;
+#endif
+#ifdef NYA_SIMD_SSE2
+		case SimdPath::Sse:
+			done = SrgbToLinearSse(source, destination, pixelCount);
+			break;
+#endif
+		default:
+			break;
+		}
+		SrgbToLinearScalar(source, destination, done, pixelCount);
+	}
+
+	void PixelConverter::LinearToSrgb(const float* source, uint8_t* destination, const size_t pixelCount, const SimdPath path)
+	{
+		size_t done = 0;
+		switch (ClampSimdPath(path))
+		{
+#ifdef NYA_SIMD_AVX2
+		case SimdPath::Avx2:
+			done = LinearToSrgbAvx2(source, destination, pixelCount);
+			break;
+#endif
+#ifdef NYA_SIMD_SSE2
+		case SimdPath::Sse:
+			done = LinearToSrgbSse(source, destination, pixelCount);
+			break;
+#endif
+		default:
+			break;
+		}
+		LinearToSrgbScalar(source, destination, done, pixelCount);
+	}
+
+	void PixelConverter::Benchmark(const uint32_t pixelCount)
+	{
+		//-- Random texels, plus linear floats slightly past [0, 1] to exercise the clamps.
+		std::mt19937 random(1337);
+		std::vector<uint8_t> texels(static_cast<size_t>(pixelCount) * 4);
+		for (uint8_t& texel : texels)
+			texel = static_cast<uint8_t>(random());
+
+		std::uniform_real_distribution<float> linearValues(-0.05f, 1.05f);
+		std::vector<float> linear(static_cast<size_t>(pixelCount) * 4);
+		for (float& value : linear)
+			value = linearValues(random);
+
+		std::vector<uint8_t> bytes(static_cast<size_t>(pixelCount) * 4);
+		std::vector<float> floats(static_cast<size_t>(pixelCount) * 4);
+
+		struct Kernel
+		{
+			const char* m_Name;
+			size_t m_BytesPerPixel;		// Read plus written.
+			std::function<void(SimdPath)> m_Run;
+			bool m_FloatOutput;
+		};
+		const std::array kernels =
+		{
+			Kernel{ "RGB to RGBA", 7, [&](const SimdPath path) { ExpandRgbToRgba(texels.data(), bytes.data(), pixelCount, path); }, false },
+			Kernel{ "RGBA to BGRA", 8, [&](const SimdPath path) { SwapRedBlue(texels.data(), bytes.data(), pixelCount, path); }, false },
+			Kernel{ "Premultiply alpha", 8, [&](const SimdPath path) { PremultiplyAlpha(texels.data(), bytes.data(), pixelCount, path); }, false },
+			Kernel{ "Renormalize normals", 8, [&](const SimdPath path) { RenormalizeNormals(texels.data(), bytes.data(), pixelCount, path); }, false },
+			Kernel{ "sRGB to linear", 20, [&](const SimdPath path) { SrgbToLinear(texels.data(), floats.data(), pixelCount, path); }, true },
+			Kernel{ "Linear to sRGB", 20, [&](const SimdPath path) { LinearToSrgb(linear.data(), bytes.data(), pixelCount, path); }, false }
+		};
+
+		constexpr uint32_t iterations = 10;
+		constexpr std::array paths = { SimdPath::Scalar, SimdPath::Sse, SimdPath::Avx2 };
+		constexpr std::array pathNames = { "scalar", "sse", "avx2" };
+		for (const Kernel& kernel : kernels)
+		{
+			std::vector<uint8_t> referenceBytes;
+			std::vector<float> referenceFloats;
+			for (uint32_t p = 0; p <= static_cast<uint32_t>(GetBestSimdPath()); ++p)
+			{
+				const auto startTime = std::chrono::high_resolution_clock::now();
+				for (uint32_t iteration = 0; iteration < iterations; ++iteration)
+					kernel.m_Run(paths[p]);
+				const auto endTime = std::chrono::high_resolution_clock::now();
+				const float ms = std::chrono::duration<float, std::chrono::milliseconds::period>(endTime - startTime).count() / static_cast<float>(iterations);
+
+				if (p == 0)
+				{
+					referenceBytes = bytes;
+					referenceFloats = floats;
+				}
+				else if (kernel.m_FloatOutput ? floats != referenceFloats : bytes != referenceBytes)
+					throw std::runtime_error(std::string("Pixel convert ") + kernel.m_Name + " (" + pathNames[p] + ") differs from the scalar path!");
+
+				const float gigabytes = static_cast<float>(kernel.m_BytesPerPixel) * static_cast<float>(pixelCount) / 1e9f;
+				std::cout << "\t" << "Pixel convert " << kernel.m_Name << " of " << pixelCount << " pixels (" << pathNames[p] << "): " << ms << "ms, "
+					<< gigabytes / (ms / 1000.f) << " GB/s" << std::endl;
+			}
+		}
+	}
+}
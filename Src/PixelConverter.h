@@ -0,0 +1,47 @@
+﻿/*!
+\file		PixelConverter.h
+\date		19/10/2026
+
+\author		Adrian Tan
+\email		t.xingkhiangadrian\@digipen.edu
+
+\brief		Contains definition of PixelConverter class.
+			Scalar, SSE and AVX2 texel conversion kernels for texture data on its
+			way into staging memory.
+
+\copyright	All content © 2023 DigiPen (SINGAPORE) Corporation, all rights reserved.
+			Reproduction or disclosure of this file or its contents without the
+			prior written consent of DigiPen Institute of Technology is prohibited.
+__________________________________________________________________________________*/
+#pragma once
+
+#include "Simd.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Nya
+{
+	// Texel conversions run while a decoded image is written to staging memory. Every kernel has a scalar, SSE and
+	// AVX2 path that give the same bytes. Source and destination may be the same buffer when their texels are the same size.
+	class PixelConverter
+	{
+	public:
+		// RGB8 to RGBA8 with opaque alpha. The SSE path needs SSSE3, so it runs scalar on CPUs without SSE4.1.
+		static void ExpandRgbToRgba(const uint8_t* rgb, uint8_t* rgba, size_t pixelCount, SimdPath path = GetBestSimdPath());
+		// RGBA8 to BGRA8, or back.
+		static void SwapRedBlue(const uint8_t* source, uint8_t* destination, size_t pixelCount, SimdPath path = GetBestSimdPath());
+		// RGBA8 colour scaled by alpha, rounded to nearest.
+		static void PremultiplyAlpha(const uint8_t* source, uint8_t* destination, size_t pixelCount, SimdPath path = GetBestSimdPath());
+		// RGBA8 normals stored as xyz * 0.5 + 0.5, rescaled to unit length. Alpha is kept.
+		static void RenormalizeNormals(const uint8_t* source, uint8_t* destination, size_t pixelCount, SimdPath path = GetBestSimdPath());
+
+		// RGBA8 with sRGB colour to linear float RGBA, alpha to [0, 1].
+		static void SrgbToLinear(const uint8_t* source, float* destination, size_t pixelCount, SimdPath path = GetBestSimdPath());
+		// Linear float RGBA to RGBA8 with sRGB colour, rounded to the nearest sRGB step and clamped.
+		static void LinearToSrgb(const float* source, uint8_t* destination, size_t pixelCount, SimdPath path = GetBestSimdPath());
+
+		// Runs every kernel over pixelCount random texels on each path and prints GB/s. Throws if a path's output differs from scalar.
+		static void Benchmark(uint32_t pixelCount);
+	};
+}
@@ -0,0 +1,220 @@
+﻿/*!
+\file		RenderComponents.cpp
+\date		19/10/2026
+
+\author		Adrian Tan
+\email		t.xingkhiangadrian\@digipen.edu
+
+\brief		Contains implementation for RenderSystems class functions.
+
+\copyright	All content © 2023 DigiPen (SINGAPORE) Corporation, all rights reserved.
+			Reproduction or disclosure of this file or its contents without the
+			prior written consent of DigiPen Institute of Technology is prohibited.
+__________________________________________________________________________________*/
+
+#include "meowpch.h"
+
+#include "RenderComponents.h"
+#include "FrustumCuller.h"
+#include "OcclusionRasterizer.h"
+#include "VulkanGpuScene.h"
+#include "VulkanInstanceRenderer.h"
+
+namespace Nya
+{
+	void RenderSystems::SyncTransforms(EntityWorld& world, const TransformHierarchy& hierarchy)
+	{
+		world.ParallelForEachChunk<const TransformNode, Transform>([&hierarchy](const Entity*, const uint32_t count, const TransformNode* nodes, Transform* transforms)
+		{
+			for (uint32_t i = 0; i < count; ++i)
+			{
+				transforms[i].m_Moved = hierarchy.WasUpdated(nodes[i].m_Node);
+				if (transforms[i].m_Moved)
+					transforms[i].m_World = hierarchy.GetWorldMatrix(nodes[i].m_Node);
+			}
+		});
+
+		// The box around the transformed box: each world axis gets the extents projected onto it.
+		world.ParallelForEachChunk<const Transform, const LocalBounds, Bounds>([](const Entity*, const uint32_t count, const Transform* transforms, const LocalBounds* localBounds, Bounds* bounds)
+		{
+			for (uint32_t i = 0; i < count; ++i)
+			{
+				const glm::mat4& model = transforms[i].m_World;
+				const glm::vec3& extent = localBounds[i].m_Extent;
+				bounds[i].m_Center = glm::vec3(model * glm::vec4(localBounds[i].m_Center, 1.f));
+				bounds[i].m_Extent = glm::abs(glm::vec3(model[0])) * extent.x + glm::abs(glm::vec3(model[1])) * extent.y + glm::abs(glm::vec3(model[2])) * extent.z;
+			}
+		});
+	}
+
+	void RenderSystems::Cull(EntityWorld& world, const Frustum& frustum)
+	{
+		world.ParallelForEachChunk<const Bounds, Visibility>([&frustum](const Entity*, const uint32_t count, const Bounds* bounds, Visibility* visibility)
+		{
+			// Per worker, the chunk's boxes are transposed into arrays the culler loads several at a time.
+			thread_local AabbBoundsSoA chunkBounds;
+			thread_local std::vector<uint32_t> visible;
+
+			chunkBounds.Clear();
+			chunkBounds.Reserve(count);
+			for (uint32_t i = 0; i < count; ++i)
+			{
+				chunkBounds.m_CenterX.push_back(bounds[i].m_Center.x);
+				chunkBounds.m_CenterY.push_back(bounds[i].m_Center.y);
+				chunkBounds.m_CenterZ.push_back(bounds[i].m_Center.z);
+				chunkBounds.m_ExtentX.push_back(bounds[i].m_Extent.x);
+				chunkBounds.m_ExtentY.push_back(bounds[i].m_Extent.y);
+				chunkBounds.m_ExtentZ.push_back(bounds[i].m_Extent.z);
+			}
+
+			visible.resize(count);
+			const uint32_t visibleCount = FrustumCuller::CullAabbs(chunkBounds, 0, count, frustum, visible.data());
+
+			for (uint32_t i = 0; i < count; ++i)
+				visibility[i].m_Visible = 0;
+			for (uint32_t i = 0; i < visibleCount; ++i)
+				visibility[visible[i]].m_Visible = 1;
+		});
+	}
+
+	void RenderSystems::AddOccluders(EntityWorld& world, OcclusionRasterizer& rasterizer, const std::vector<OccluderMesh>& meshes)
+	{
+		world.ForEachChunk<const Occluder, const Transform, const Visibility>([&rasterizer, &meshes](const Entity*, const uint32_t count, const Occluder* occluders,
+			const Transform* transforms, const Visibility* visibility)
+		{
+			for (uint32_t i = 0; i < count; ++i)
+			{
+				// Outside the frustum, nothing drawn can be behind it.
+				if (!visibility[i].m_Visible)
+					continue;
+
+				const OccluderMesh& mesh = meshes[occluders[i].m_Mesh];
+				rasterizer.AddOccluder(&mesh.m_Positions[0].x, sizeof(glm::vec3), mesh.m_Indices.data(), static_cast<uint32_t>(mesh.m_Indices.size()), transforms[i].m_World);
+			}
+		});
+	}
+
+	void RenderSystems::CullOccluded(EntityWorld& world, const OcclusionRasterizer& rasterizer)
+	{
+		world.ParallelForEachChunk<const Occludee, const Bounds, Visibility>([&rasterizer](const Entity*, const uint32_t count, const Occludee*, const Bounds* bounds,
+			Visibility* visibility)
+		{
+			// Same layout as Cull, only the rows the frustum kept are tested.
+			thread_local AabbBoundsSoA chunkBounds;
+			thread_local std::vector<uint32_t> candidates;
+
+			chunkBounds.Clear();
+			chunkBounds.Reserve(count);
+			candidates.clear();
+			for (uint32_t i = 0; i < count; ++i)
+			{
+				chunkBounds.m_CenterX.push_back(bounds[i].m_Center.x);
+				chunkBounds.m_CenterY.push_back(bounds[i].m_Center.y);
+				chunkBounds.m_CenterZ.push_back(bounds[i].m_Center.z);
+				chunkBounds.m_ExtentX.push_back(bounds[i].m_Extent.x);
+				chunkBounds.m_ExtentY.push_back(bounds[i].m_Extent.y);
+				chunkBounds.m_ExtentZ.push_back(bounds[i].m_Extent.z);
+
+				if (visibility[i].m_Visible)
+				{
+					candidates.push_back(i);
+					visibility[i].m_Visible = 0;
+				}
+			}
+
+			const uint32_t visibleCount = rasterizer.CullAabbs(chunkBounds, candidates.data(), static_cast<uint32_t>(candidates.size()), candidates.data());
+			for (uint32_t i = 0; i < visibleCount; ++i)
+				visibility[candidates[i]].m_Visible = 1;
+		});
+	}
+
+	void RenderSystems::BuildDrawList(EntityWorld& world, const std::vector<LodMesh>& meshes, DrawList& drawList, const glm::mat4& viewProj, const uint32_t pass)
+	{
+		world.ForEachChunk<const Visibility, const MeshRef, const MaterialRef, const Transform>(
+			[&meshes, &drawList, &viewProj, pass](const Entity* entities, const uint32_t count, const Visibility* visibility, const MeshRef* meshRefs, const MaterialRef* materials,
+				const Transform* transforms)
+		{
+			for (uint32_t i = 0; i < count; ++i)
+			{
+				if (!visibility[i].m_Visible || materials[i].m_Pipeline == MaterialRef::s_Instanced)
+					continue;
+
+				// Depth of the object's origin, only used to order draws.
+				const glm::vec4 clip = viewProj * transforms[i].m_World[3];
+				const float depth = clip.w > 0.f ? glm::clamp(clip.z / clip.w, 0.f, 1.f) : 0.f;
+
+				DrawPushConstants drawData;
+				drawData.m_Model = transforms[i].m_World;
+				drawData.m_ObjectID = entities[i].m_Index;
+				drawData.m_MaterialIndex = materials[i].m_Material;
+
+				DrawPacket packet = meshes[meshRefs[i].m_Mesh].m_Draws[meshRefs[i].m_Lod];
+				packet.m_Key = DrawKey::MakeOpaque(pass, materials[i].m_Pipeline, materials[i].m_Material, depth, meshRefs[i].m_Mesh);
+				packet.m_Pipeline = materials[i].m_Pipeline;
+				packet.m_Material = DrawPacket::s_None;
+				packet.m_DrawData = drawList.AddDrawData(drawData);
+				drawList.Add(packet);
+			}
+		});
+	}
+
+	void RenderSystems::SelectLods(EntityWorld& world, const std::vector<LodMesh>& meshes, const LodSelector& selector, const glm::vec3& cameraPosition)
+	{
+		world.ParallelForEachChunk<const Transform, const Bounds, MeshRef>([&meshes, &selector, &cameraPosition](const Entity*, const uint32_t count, const Transform* transforms,
+			const Bounds* bounds, MeshRef* meshRefs)
+		{
+			for (uint32_t i = 0; i < count; ++i)
+			{
+				// Distance to the box, zero from inside it.
+				const glm::vec3 offset = glm::max(glm::abs(cameraPosition - bounds[i].m_Center) - bounds[i].m_Extent, glm::vec3(0.f));
+
+				// LOD errors are in object space, so the distance is scaled into it too.
+				const glm::mat4& model = transforms[i].m_World;
+				const float scale = std::max({ glm::length(glm::vec3(model[0])), glm::length(glm::vec3(model[1])), glm::length(glm::vec3(model[2])) });
+				const float distance = glm::length(offset) / std::max(scale, 1e-6f);
+
+				const std::vector<MeshLod>& lods = meshes[meshRefs[i].m_Mesh].m_Lods;
+				meshRefs[i].m_Lod = selector.Select(lods.data(), static_cast<uint32_t>(lods.size()), distance, meshRefs[i].m_Lod);
+			}
+		});
+	}
+
+	void RenderSystems::SubmitInstances(EntityWorld& world, VulkanInstanceRenderer& instanceRenderer, const std::vector<LodMesh>& meshes)
+	{
+		world.ForEachChunk<const Visibility, const MeshRef, const MaterialRef, const Transform>(
+			[&instanceRenderer, &meshes](const Entity*, const uint32_t count, const Visibility* visibility, const MeshRef* meshRefs, const MaterialRef* materials, const Transform* transforms)
+		{
+			for (uint32_t i = 0; i < count; ++i)
+			{
+				if (visibility[i].m_Visible && materials[i].m_Pipeline == MaterialRef::s_Instanced)
+					instanceRenderer.Submit(meshes[meshRefs[i].m_Mesh].m_Meshes[meshRefs[i].m_Lod], materials[i].m_Material, transforms[i].m_World);
+			}
+		});
+	}
+
+	void RenderSystems::SyncGpuScene(EntityWorld& world, VulkanGpuScene& scene, const std::vector<LodMesh>& meshes)
+	{
+		// Only the entity's own arrays are compared, the scene's records are never read back.
+		world.ForEachChunk<GpuInstanceRef, const MeshRef, const MaterialRef, const Transform>(
+			[&scene, &meshes](const Entity*, const uint32_t count, GpuInstanceRef* instances, const MeshRef* meshRefs, const MaterialRef* materials, const Transform* transforms)
+		{
+			for (uint32_t i = 0; i < count; ++i)
+			{
+				GpuInstanceRef& instance = instances[i];
+				const uint32_t mesh = meshes[meshRefs[i].m_Mesh].m_GpuMeshes[meshRefs[i].m_Lod];
+				if (instance.m_Mesh != mesh)
+				{
+					scene.SetMesh(instance.m_Instance, mesh);
+					instance.m_Mesh = mesh;
+				}
+				if (transforms[i].m_Moved)
+					scene.SetTransform(instance.m_Instance, transforms[i].m_World);
+				if (instance.m_Material != materials[i].m_Material)
+				{
+					scene.SetMaterial(instance.m_Instance, materials[i].m_Material);
+					instance.m_Material = materials[i].m_Material;
+				}
+			}
+		});
+	}
+}
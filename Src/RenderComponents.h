@@ -0,0 +1,144 @@
+﻿/*!
+\file		RenderComponents.h
+\date		19/10/2026
+
+\author		Adrian Tan
+\email		t.xingkhiangadrian\@digipen.edu
+
+\brief		Contains definitions of renderable entity components and RenderSystems class.
+
+\copyright	All content © 2023 DigiPen (SINGAPORE) Corporation, all rights reserved.
+			Reproduction or disclosure of this file or its contents without the
+			prior written consent of DigiPen Institute of Technology is prohibited.
+__________________________________________________________________________________*/
+#pragma once
+
+#include "DrawList.h"
+#include "EntityWorld.h"
+#include "Frustum.h"
+#include "LodSelector.h"
+#include "TransformHierarchy.h"
+
+namespace Nya
+{
+	class OcclusionRasterizer;
+	class VulkanGpuScene;
+	class VulkanInstanceRenderer;
+
+	//-- Components. Plain data, see EntityWorld.
+	// m_Moved is set by RenderSystems::SyncTransforms on the frames m_World changed.
+	struct Transform
+	{
+		glm::mat4 m_World{ 1.f };
+		uint32_t m_Moved = 0;
+	};
+
+	// Ties an entity to a TransformHierarchy node, RenderSystems::SyncTransforms copies its world matrix into Transform.
+	struct TransformNode
+	{
+		uint32_t m_Node = 0;
+	};
+
+	// Points into a LodMesh table, m_Lod is written by RenderSystems::SelectLods.
+	struct MeshRef
+	{
+		uint32_t m_Mesh = 0;
+		uint32_t m_Lod = 0;
+	};
+
+	// m_Material is a bindless heap slot. m_Pipeline indexes the VulkanDrawList tables, or is s_Instanced to batch
+	// the entity through a VulkanInstanceRenderer instead. Without a GPU scene only, a VulkanGpuScene draws everything.
+	struct MaterialRef
+	{
+		static constexpr uint32_t s_Instanced = UINT32_MAX;
+
+		uint32_t m_Material = 0;
+		uint32_t m_Pipeline = s_Instanced;
+	};
+
+	// Object space box as center and half extents, RenderSystems::SyncTransforms turns it into Bounds.
+	struct LocalBounds
+	{
+		glm::vec3 m_Center{ 0.f };
+		glm::vec3 m_Extent{ 0.f };
+	};
+
+	// World space box as center and half extents.
+	struct Bounds
+	{
+		glm::vec3 m_Center{ 0.f };
+		glm::vec3 m_Extent{ 0.f };
+	};
+
+	struct Visibility
+	{
+		uint32_t m_Visible = 1;
+	};
+
+	// Rasterized into the CPU occlusion buffer by RenderSystems::AddOccluders. m_Mesh indexes an OccluderMesh table.
+	struct Occluder
+	{
+		uint32_t m_Mesh = 0;
+	};
+
+	// Tested against the CPU occlusion buffer by RenderSystems::CullOccluded. Occluders go without it, so they never hide themselves.
+	struct Occludee
+	{
+	};
+
+	// The entity's record in a VulkanGpuScene, with the mesh and material RenderSystems::SyncGpuScene last sent to it.
+	struct GpuInstanceRef
+	{
+		static constexpr uint32_t s_Unsent = UINT32_MAX;
+
+		uint32_t m_Instance = 0;
+		uint32_t m_Mesh = s_Unsent;
+		uint32_t m_Material = s_Unsent;
+	};
+
+	// Levels of detail of one mesh, finest first. Each level is a mesh of its own in the renderers:
+	// m_Meshes in a VulkanInstanceRenderer, m_Draws for a DrawList and, with a GPU scene, m_GpuMeshes in a VulkanGpuScene.
+	struct LodMesh
+	{
+		std::vector<MeshLod> m_Lods;		// Only the errors are read, by LodSelector.
+		std::vector<uint32_t> m_Meshes;
+		std::vector<DrawPacket> m_Draws;	// Only the geometry: m_Mesh, m_FirstIndex, m_IndexCount and m_VertexOffset.
+		std::vector<uint32_t> m_GpuMeshes;
+	};
+
+	// Object space stand-in for an occluder's mesh, a few large triangles inside its visible surface.
+	struct OccluderMesh
+	{
+		std::vector<glm::vec3> m_Positions;
+		std::vector<uint32_t> m_Indices;
+	};
+
+	// Per-frame passes over renderable entities. Each one only touches the component arrays it needs.
+	class RenderSystems
+	{
+	public:
+		// TransformNode -> Transform for the nodes the hierarchy's last Update recomputed, flagging them m_Moved,
+		// then Transform and LocalBounds -> Bounds. The hierarchy must be updated first.
+		static void SyncTransforms(EntityWorld& world, const TransformHierarchy& hierarchy);
+		// Bounds -> Visibility, chunks in parallel, each one through the SIMD FrustumCuller.
+		static void Cull(EntityWorld& world, const Frustum& frustum);
+		// Occluder, Transform and Visibility -> the mesh of every occluder in the frustum added to rasterizer, which
+		// must have been begun with this frame's view projection. Run after Cull.
+		static void AddOccluders(EntityWorld& world, OcclusionRasterizer& rasterizer, const std::vector<OccluderMesh>& meshes);
+		// Bounds -> Visibility of Occludee entities still visible after Cull, chunks in parallel, against a rasterized rasterizer.
+		static void CullOccluded(EntityWorld& world, const OcclusionRasterizer& rasterizer);
+		// Visibility, MeshRef, MaterialRef and Transform -> one opaque packet per visible entity that isn't instanced,
+		// drawing the selected LOD's m_Draws geometry. The material slot goes in the packet's push constants, so the
+		// bindless heap stays bound, and the pipeline id must index the VulkanDrawList tables the list is recorded with.
+		static void BuildDrawList(EntityWorld& world, const std::vector<LodMesh>& meshes, DrawList& drawList, const glm::mat4& viewProj, uint32_t pass = 0);
+		// Transform, Bounds and the camera -> MeshRef::m_Lod, chunks in parallel. MeshRef::m_Mesh indexes meshes.
+		// Each entity starts from last frame's LOD, so the selector's hysteresis applies. Run after SyncTransforms.
+		static void SelectLods(EntityWorld& world, const std::vector<LodMesh>& meshes, const LodSelector& selector, const glm::vec3& cameraPosition);
+		// Visibility, MeshRef, MaterialRef and Transform -> instances of the selected LOD queued on instanceRenderer,
+		// for the visible entities whose pipeline is MaterialRef::s_Instanced.
+		static void SubmitInstances(EntityWorld& world, VulkanInstanceRenderer& instanceRenderer, const std::vector<LodMesh>& meshes);
+		// Moved Transforms, and MaterialRef and the selected LOD where they differ from what GpuInstanceRef last sent -> its record,
+		// so the next UploadChanges sends just those entities. The GPU scene culls on its own, Visibility is ignored.
+		static void SyncGpuScene(EntityWorld& world, VulkanGpuScene& scene, const std::vector<LodMesh>& meshes);
+	};
+}
@@ -0,0 +1,134 @@
+﻿/*!
+\file		ShaderData.h
+\date		19/10/2026
+
+\author		Adrian Tan
+\email		t.xingkhiangadrian\@digipen.edu
+
+\brief		Contains CPU-side layouts of data shared with shaders.
+
+\copyright	All content © 2023 DigiPen (SINGAPORE) Corporation, all rights reserved.
+			Reproduction or disclosure of this file or its contents without the
+			prior written consent of DigiPen Institute of Technology is prohibited.
+__________________________________________________________________________________*/
+#pragma once
+
+#define GLM_FORCE_RADIANS
+#define GLM_FORCE_DEPTH_ZERO_TO_ONE
+#include <glm/mat4x4.hpp>
+#include <glm/glm.hpp>
+
+#include <cstdint>
+
+namespace Nya
+{
+	// Shared by every draw in a frame, lives in a uniform buffer.
+	// Must match FrameUniforms in Shaders/frame_uniforms.glsl.
+	struct FrameUniforms
+	{
+		alignas(16) glm::mat4 m_View;
+		alignas(16) glm::mat4 m_Proj;
+	};
+
+	// Small per-draw data, pushed straight into the command buffer.
+	// Must match DrawPushConstants in Shaders/push_constants.glsl.
+	struct DrawPushConstants
+	{
+		glm::mat4 m_Model;
+		uint32_t m_ObjectID = 0;
+		uint32_t m_MaterialIndex = 0;
+	};
+
+	// Per-dispatch input of Shaders/meshlet_cull.comp, must match MeshletCullConstants there.
+	// Planes and camera are in the mesh's object space.
+	struct MeshletCullConstants
+	{
+		glm::vec4 m_FrustumPlanes[6];
+		glm::vec3 m_CameraPosition;
+		uint32_t m_MeshletCount = 0;
+		uint32_t m_MeshletOffset = 0;	// First meshlet in the meshlet buffer.
+		uint32_t m_FirstIndex = 0;		// Added to every meshlet's index offset.
+		int32_t m_VertexOffset = 0;
+		uint32_t m_DrawOffset = 0;		// First command written in the draw buffer.
+	};
+
+	// One object of a VulkanGpuScene, must match Instance in Shaders/gpu_scene.glsl.
+	struct GpuInstance
+	{
+		glm::mat4 m_Model;
+		uint32_t m_Mesh = 0;
+		uint32_t m_Batch = 0;			// Draws of a batch share one pipeline and one indirect draw call.
+		uint32_t m_MaterialIndex = 0;
+		uint32_t m_ObjectID = 0;
+	};
+
+	// One changed instance record, scattered into the instance buffer by Shaders/gpu_scene_scatter.comp.
+	// Must match InstanceUpdate in Shaders/gpu_scene.glsl.
+	struct GpuInstanceUpdate
+	{
+		GpuInstance m_Instance;
+		uint32_t m_Index = 0;			// Destination instance.
+		uint32_t m_Padding[3]{};
+	};
+
+	// Index range and object space bounding sphere of a mesh, must match Mesh in Shaders/gpu_scene.glsl.
+	struct GpuMesh
+	{
+		glm::vec3 m_Center;
+		float m_Radius = 0.f;
+		uint32_t m_IndexCount = 0;
+		uint32_t m_FirstIndex = 0;
+		int32_t m_VertexOffset = 0;
+		uint32_t m_Padding = 0;
+	};
+
+	// Per-dispatch input of Shaders/gpu_cull.comp and Shaders/gpu_cull_occlusion.comp, must match GpuCullConstants there.
+	struct GpuCullConstants
+	{
+		glm::vec4 m_FrustumPlanes[6];	// World space.
+		uint32_t m_InstanceCount = 0;
+		uint32_t m_Phase = 0;			// Occlusion culling only, 0 for the early phase and 1 for the late one.
+	};
+
+	// Per-frame input of Shaders/gpu_cull_occlusion.comp, lives in a storage buffer. Must match OcclusionConstants there.
+	struct GpuOcclusionConstants
+	{
+		glm::mat4 m_PreviousViewProj;	// Early phase, the pyramid holds last frame's depth.
+		glm::mat4 m_ViewProj;			// Late phase, the pyramid holds this frame's early depth.
+		uint32_t m_PyramidValid = 0;	// Zero until a pyramid exists, the early phase then draws everything in the frustum.
+		uint32_t m_LateDrawOffset = 0;	// Late draws and counts follow the early ones in their buffers.
+		uint32_t m_LateCountOffset = 0;
+		uint32_t m_Padding = 0;
+	};
+
+	// Per-dispatch input of Shaders/gpu_scene_scatter.comp, must match ScatterConstants there.
+	struct GpuScatterConstants
+	{
+		uint32_t m_UpdateCount = 0;
+	};
+
+	// Per-dispatch input of Shaders/hiz_downsample.comp, must match HiZDownsampleConstants there.
+	struct HiZDownsampleConstants
+	{
+		glm::uvec2 m_SourceSize;
+		glm::uvec2 m_DestinationSize;
+	};
+
+	// Per-dispatch input of Shaders/mip_downsample.comp, must match MipDownsampleConstants there.
+	struct MipDownsampleConstants
+	{
+		glm::uvec2 m_BaseSize;
+		uint32_t m_LevelCount = 0;		// Levels written below the base level.
+		uint32_t m_GroupCount = 0;
+		uint32_t m_Srgb = 0;
+	};
+
+	// Vulkan only guarantees 128 bytes of push constants.
+	constexpr uint32_t g_MaxPushConstantSize = 128;
+	static_assert(sizeof(DrawPushConstants) <= g_MaxPushConstantSize, "DrawPushConstants is too big for push constants!");
+	static_assert(sizeof(MeshletCullConstants) <= g_MaxPushConstantSize, "MeshletCullConstants is too big for push constants!");
+	static_assert(sizeof(GpuCullConstants) <= g_MaxPushConstantSize, "GpuCullConstants is too big for push constants!");
+	static_assert(sizeof(GpuScatterConstants) <= g_MaxPushConstantSize, "GpuScatterConstants is too big for push constants!");
+	static_assert(sizeof(HiZDownsampleConstants) <= g_MaxPushConstantSize, "HiZDownsampleConstants is too big for push constants!");
+	static_assert(sizeof(MipDownsampleConstants) <= g_MaxPushConstantSize, "MipDownsampleConstants is too big for push constants!");
+}
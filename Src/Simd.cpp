@@ -0,0 +1,104 @@
+﻿/*!
+\file		Simd.cpp
+\date		19/10/2026
+
+\author		Adrian Tan
+\email		t.xingkhiangadrian\@digipen.edu
+
+\brief		Contains implementation of runtime SIMD feature detection.
+
+\copyright	All content © 2023 DigiPen (SINGAPORE) Corporation, all rights reserved.
+			Reproduction or disclosure of this file or its contents without the
+			prior written consent of DigiPen Institute of Technology is prohibited.
+__________________________________________________________________________________*/
+
+#include "meowpch.h"
+
+#include "Simd.h"
+
+#if defined(NYA_SIMD_SSE2) && defined(_MSC_VER)
+#include <intrin.h>
+#elif defined(NYA_SIMD_SSE2)
+#include <cpuid.h>
+#endif
+
+namespace Nya
+{
+	//-- Helpers.
+	namespace
+	{
+#ifdef NYA_SIMD_SSE2
+		void Cpuid(const uint32_t leaf, uint32_t registers[4])
+		{
+#ifdef _MSC_VER
+			int values[4];
+			__cpuidex(values, static_cast<int>(leaf), 0);
+			for (uint32_t i = 0; i < 4; ++i)
+				registers[i] = static_cast<uint32_t>(values[i]);
+#else
+			__cpuid_count(leaf, 0, registers[0], registers[1], registers[2], registers[3]);
+#endif
+		}
+
+		// XCR0, the register state the OS saves on context switches.
+		uint64_t ReadXcr0()
+		{
+#ifdef _MSC_VER
+			return _xgetbv(0);
+#else
+			uint32_t low, high;
+			__asm__("xgetbv" : "=a"(low), "=d"(high) : "c"(0));
+			return (static_cast<uint64_t>(high) << 32) | low;
+#endif
+		}
+
+		SimdFeatures DetectFeatures()
+		{
+			SimdFeatures features;
+
+			uint32_t registers[4];
+			Cpuid(0, registers);
+			const uint32_t maxLeaf = registers[0];
+
+			Cpuid(1, registers);
+			const uint32_t ecx = registers[2];
+			features.m_Sse41 = (ecx >> 19) & 1;
+
+			// AVX registers are only usable if the OS saves the YMM state, reported through OSXSAVE and XCR0.
+			const bool osSavesYmm = ((ecx >> 27) & 1) && ((ecx >> 28) & 1) && (ReadXcr0() & 0x6) == 0x6;
+			features.m_F16c = osSavesYmm && ((ecx >> 29) & 1);
+
+			if (maxLeaf >= 7)
+			{
+				Cpuid(7, registers);
+				features.m_Avx2 = osSavesYmm && ((registers[1] >> 5) & 1);
+			}
+
+			return features;
+		}
+#else
+		SimdFeatures DetectFeatures()
+		{
+			return {};
+		}
+#endif
+	}
+
+
+	//-- Simd Functions.
+	const SimdFeatures& GetSimdFeatures()
+	{
+		static const SimdFeatures s_Features = DetectFeatures();
+		return s_Features;
+	}
+
+	SimdPath GetBestSimdPath()
+	{
+#ifdef NYA_SIMD_SSE2
+		static const SimdPath s_Best = GetSimdFeatures().m_Avx2 ? SimdPath::Avx2 : SimdPath::Sse;
+		return s_Best;
+#else
+		return SimdPath::Scalar;
+#endif
+	}
+}
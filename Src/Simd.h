@@ -0,0 +1,79 @@
+﻿/*!
+\file		Simd.h
+\date		19/10/2026
+
+\author		Adrian Tan
+\email		t.xingkhiangadrian\@digipen.edu
+
+\brief		Contains SIMD kernel compilation macros, intrinsic includes, the SimdPath enum
+			and runtime CPU feature detection. Every SIMD path in the renderer is guarded
+			by these macros, picked at runtime and has a scalar fallback, so one binary runs
+			on any x64 CPU and the same code builds for any target architecture.
+
+\copyright	All content © 2023 DigiPen (SINGAPORE) Corporation, all rights reserved.
+			Reproduction or disclosure of this file or its contents without the
+			prior written consent of DigiPen Institute of Technology is prohibited.
+__________________________________________________________________________________*/
+#pragma once
+
+#include <cstdint>
+
+// Kernels for every instruction set are compiled on x86 and picked at runtime (see GetBestSimdPath), so the
+// build needs no /arch or -m flags. SSE2 is baseline on x64, MSVC only reports it through _M_X64 / _M_IX86_FP.
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define NYA_SIMD_SSE2 1
+#define NYA_SIMD_SSE41 1
+#define NYA_SIMD_AVX2 1
+#define NYA_SIMD_F16C 1
+#include <immintrin.h>
+#endif
+
+// Code past SSE2 must sit between a BEGIN/END pair. MSVC emits any intrinsic without /arch, GCC and Clang
+// only inside functions that target the instruction set. Only call it after checking GetSimdFeatures.
+#if defined(NYA_SIMD_SSE2) && defined(__clang__)
+#define NYA_SIMD_BEGIN_SSE41 _Pragma("clang attribute push(__attribute__((target(\"sse4.1\"))), apply_to = function)")
+#define NYA_SIMD_BEGIN_AVX2 _Pragma("clang attribute push(__attribute__((target(\"avx2\"))), apply_to = function)")
+#define NYA_SIMD_BEGIN_F16C _Pragma("clang attribute push(__attribute__((target(\"f16c\"))), apply_to = function)")
+#define NYA_SIMD_END _Pragma("clang attribute pop")
+#elif defined(NYA_SIMD_SSE2) && defined(__GNUC__)
+#define NYA_SIMD_BEGIN_SSE41 _Pragma("GCC push_options") _Pragma("GCC target(\"sse4.1\")")
+#define NYA_SIMD_BEGIN_AVX2 _Pragma("GCC push_options") _Pragma("GCC target(\"avx2\")")
+#define NYA_SIMD_BEGIN_F16C _Pragma("GCC push_options") _Pragma("GCC target(\"f16c\")")
+#define NYA_SIMD_END _Pragma("GCC pop_options")
+#else
+#define NYA_SIMD_BEGIN_SSE41
+#define NYA_SIMD_BEGIN_AVX2
+#define NYA_SIMD_BEGIN_F16C
+#define NYA_SIMD_END
+#endif
+
+namespace Nya
+{
+	// Kernel set a SIMD function runs with. Paths the CPU lacks fall back to the widest one it has,
+	// so any path can be requested, e.g. to compare every path against scalar.
+	enum class SimdPath : uint32_t
+	{
+		Scalar,
+		Sse,		// SSE2, 4 lanes. A few kernels also use SSE4.1 when the CPU has it.
+		Avx2		// 8 lanes.
+	};
+
+	// Instruction sets both compiled in and usable on this CPU and OS, detected once.
+	struct SimdFeatures
+	{
+		bool m_Sse41 = false;
+		bool m_Avx2 = false;
+		bool m_F16c = false;
+	};
+
+	const SimdFeatures& GetSimdFeatures();
+
+	// Widest path this CPU runs.
+	SimdPath GetBestSimdPath();
+
+	inline SimdPath ClampSimdPath(const SimdPath path)
+	{
+		const SimdPath best = GetBestSimdPath();
+		return path < best ? path : best;
+	}
+}
@@ -0,0 +1,176 @@
+﻿/*!
+\file		ThreadPool.cpp
+\date		19/10/2026
+
+\author		Adrian Tan
+\email		t.xingkhiangadrian\@digipen.edu
+
+\brief		Contains implementation for ThreadPool class functions.
+
+\copyright	All content © 2023 DigiPen (SINGAPORE) Corporation, all rights reserved.
+			Reproduction or disclosure of this file or its contents without the
+			prior written consent of DigiPen Institute of Technology is prohibited.
+__________________________________________________________________________________*/
+
+#include "meowpch.h"
+
+#include "ThreadPool.h"
+
+namespace Nya
+{
+	ThreadPool* ThreadPool::s_Instance = nullptr;
+
+	ThreadPool& ThreadPool::Get()
+	{
+		if (!s_Instance)
+			s_Instance = new ThreadPool();
+
+		return *s_Instance;
+	}
+
+	void ThreadPool::Init(uint32_t workerCount)
+	{
+		if (!m_Workers.empty())
+			throw std::runtime_error("Thread pool is already initialized!");
+
+		if (workerCount == 0)
+			workerCount = std::max(std::thread::hardware_concurrency(), 1u) - 1;
+
+		m_Stopping = false;
+		for (uint32_t i = 0; i < workerCount; ++i)
+			m_Workers.emplace_back(&ThreadPool::WorkerLoop, this);
+	}
+
+	void ThreadPool::Cleanup()
+	{
+		{
+			std::lock_guard lock(m_Mutex);
+			m_Stopping = true;
+		}
+		m_TaskAvailable.notify_all();
+
+		for (std::thread& worker : m_Workers)
+			worker.join();
+		m_Workers.clear();
+	}
+
+	void ThreadPool::WorkerLoop()
+	{
+		while (true)
+		{
+			std::function<void()> task;
+			{
+				std::unique_lock lock(m_Mutex);
+				m_TaskAvailable.wait(lock, [this] { return m_Stopping || !m_Tasks.empty(); });
+				if (m_Tasks.empty())
+					return;
+
+				task = std::move(m_Tasks.front());
+				m_Tasks.pop();
+			}
+
+			task();
+		}
+	}
+
+	std::future<void> ThreadPool::Submit(std::function<void()> task)
+	{
+		auto packagedTask = std::make_shared<std::packaged_task<void()>>(std::move(task));
+		std::future<void> future = packagedTask->get_future();
+
+		if (m_Workers.empty())
+		{
+			(*packagedTask)();
+			return future;
+		}
+
+		{
+			std::lock_guard lock(m_Mutex);
+			m_Tasks.emplace([packagedTask] { (*packagedTask)(); });
+		}
+		m_TaskAvailable.notify_one();
+
+		return future;
+	}
+
+	void ThreadPool::ParallelFor(const uint32_t count, uint32_t grainSize, const std::function<void(uint32_t begin, uint32_t end)>& function)
+	{
+		grainSize = std::max(grainSize, 1u);
+		const uint32_t chunkCount = (count + grainSize - 1) / grainSize;
+		if (chunkCount == 0)
+			return;
+
+		if (chunkCount == 1 || m_Workers.empty())
+		{
+			function(0, count);
+			return;
+		}
+
+		// Shared with helper tasks that may only start after this call has returned.
+		struct Job
+		{
+			std::function<void(uint32_t, uint32_t)> m_Function;
+			uint32_t m_Count = 0;
+			uint32_t m_GrainSize = 0;
+			uint32_t m_ChunkCount = 0;
+			std::atomic<uint32_t> m_NextChunk = 0;
+			std::atomic<uint32_t> m_DoneChunks = 0;
+			std::exception_ptr m_Exception;
+			std::mutex m_Mutex;
+			std::condition_variable m_Done;
+
+			void Run()
+			{
+				for (uint32_t chunk = m_NextChunk++; chunk < m_ChunkCount; chunk = m_NextChunk++)
+				{
+					const uint32_t begin = chunk * m_GrainSize;
+					try
+					{
+						m_Function(begin, std::min(begin + m_GrainSize, m_Count));
+					}
+					catch (...)
+					{
+						std::lock_guard lock(m_Mutex);
+						if (!m_Exception)
+							m_Exception = std::current_exception();
+					}
+
+					if (++m_DoneChunks == m_ChunkCount)
+					{
+						std::lock_guard lock(m_Mutex);
+						m_Done.notify_all();
+					}
+				}
+			}
+		};
+
+		const auto job = std::make_shared<Job>();
+		job->m_Function = function;
+		job->m_Count = count;
+		job->m_GrainSize = grainSize;
+		job->m_ChunkCount = chunkCount;
+
+		const uint32_t helperCount = std::min(static_cast<uint32_t>(m_Workers.size()), chunkCount - 1);
+		{
+			std::lock_guard lock(m_Mutex);
+			for (uint32_t i = 0; i < helperCount; ++i)
+				m_Tasks.emplace([job] { job->Run(); });
+		}
+		m_TaskAvailable.notify_all();
+
+		//-- Take chunks on this thread too, then wait only for chunks already running elsewhere.
+		job->Run();
+		{
+			std::unique_lock lock(job->m_Mutex);
+			job->m_Done.wait(lock, [&job] { return job->m_DoneChunks == job->m_ChunkCount; });
+		}
+
+		if (job->m_Exception)
+			std::rethrow_exception(job->m_Exception);
+	}
+
+	uint32_t ThreadPool::GetConcurrency() const
+	{
+		return static_cast<uint32_t>(m_Workers.size()) + 1;
+	}
+}
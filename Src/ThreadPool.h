@@ -0,0 +1,61 @@
+﻿/*!
+\file		ThreadPool.h
+\date		19/10/2026
+
+\author		Adrian Tan
+\email		t.xingkhiangadrian\@digipen.edu
+
+\brief		Contains definition of ThreadPool class.
+
+\copyright	All content © 2023 DigiPen (SINGAPORE) Corporation, all rights reserved.
+			Reproduction or disclosure of this file or its contents without the
+			prior written consent of DigiPen Institute of Technology is prohibited.
+__________________________________________________________________________________*/
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+namespace Nya
+{
+	// Fixed set of worker threads shared by CPU-heavy systems (BVH builds, software rasterization, ...).
+	// Until Init is called, or with zero workers, everything runs inline on the calling thread.
+	class ThreadPool
+	{
+		static ThreadPool* s_Instance;
+
+		std::vector<std::thread> m_Workers;
+		std::queue<std::function<void()>> m_Tasks;
+		std::mutex m_Mutex;
+		std::condition_variable m_TaskAvailable;
+		bool m_Stopping = false;
+
+		void WorkerLoop();
+
+	public:
+		static ThreadPool& Get();
+
+		// 0 uses one worker per hardware thread, minus the calling thread.
+		void Init(uint32_t workerCount = 0);
+		// Finishes queued tasks, then joins the workers.
+		void Cleanup();
+
+		// Runs a task on a worker. Do not wait on the future from inside another task.
+		std::future<void> Submit(std::function<void()> task);
+
+		// Calls function(begin, end) over [0, count) in chunks of grainSize, on the workers and the calling
+		// thread, and returns once every chunk is done. Safe to call from inside a task: the caller keeps
+		// taking chunks itself, so it never waits on work that has not started.
+		void ParallelFor(uint32_t count, uint32_t grainSize, const std::function<void(uint32_t begin, uint32_t end)>& function);
+
+		// Workers plus the calling thread, the most chunks ParallelFor runs at once.
+		uint32_t GetConcurrency() const;
+	};
+}
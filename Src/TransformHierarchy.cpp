@@ -0,0 +1,451 @@
+﻿/*!
+\file		TransformHierarchy.cpp
+\date		19/10/2026
+
+\author		Adrian Tan
+\email		t.xingkhiangadrian\@digipen.edu
+
+\brief		Contains implementation for TransformHierarchy class functions.
+
+\copyright	All content © 2023 DigiPen (SINGAPORE) Corporation, all rights reserved.
+			Reproduction or disclosure of this file or its contents without the
+			prior written consent of DigiPen Institute of Technology is prohibited.
+__________________________________________________________________________________*/
+
+#include "meowpch.h"
+
+#include "TransformHierarchy.h"
+#include "ThreadPool.h"
+
+namespace Nya
+{
+	namespace
+	{
+		// Scale, then rotate, then translate.
+		glm::mat4 ComposeTransform(const glm::vec3& position, const glm::quat& rotation, const glm::vec3& scale)
+		{
+			const glm::mat3 basis = glm::mat3_cast(rotation);
+			return glm::mat4(glm::vec4(basis[0] * scale.x, 0.f), glm::vec4(basis[1] * scale.y, 0.f), glm::vec4(basis[2] * scale.z, 0.f), glm::vec4(position, 1.f));
+		}
+	}
+
+	uint32_t TransformHierarchy::AddNode(const uint32_t parent, const glm::vec3& position, const glm::quat& rotation, const glm::vec3& scale)
+	{
+		const uint32_t index = static_cast<uint32_t>(m_Handles.size());
+		const uint32_t handle = static_cast<uint32_t>(m_Indices.size());
+
+		m_LocalPositions.push_back(position);
+		m_LocalRotations.push_back(rotation);
+		m_LocalScales.push_back(scale);
+		m_WorldMatrices.emplace_back(1.f);
+		m_Parents.push_back(parent == s_None ? s_None : m_Indices.at(parent));
+		m_FirstChildren.push_back(0);
+		m_ChildCounts.push_back(0);
+		m_Dirty.push_back(0);
+		m_UpdateStamps.push_back(0);
+		m_Handles.push_back(handle);
+		m_Indices.push_back(index);
+
+		// Sorting puts it on its level, and recomputes every node.
+		m_OrderDirty = true;
+		return handle;
+	}
+
+	void TransformHierarchy::SetParent(const uint32_t node, const uint32_t parent)
+	{
+		const uint32_t index = m_Indices.at(node);
+		const uint32_t parentIndex = parent == s_None ? s_None : m_Indices.at(parent);
+
+		for (uint32_t ancestor = parentIndex; ancestor != s_None; ancestor = m_Parents[ancestor])
+		{
+			if (ancestor == index)
+				throw std::runtime_error("Transform parent would create a cycle!");
+		}
+
+		m_Parents[index] = parentIndex;
+		m_OrderDirty = true;
+	}
+
+	void TransformHierarchy::Reserve(const size_t count)
+	{
+		m_LocalPositions.reserve(count);
+		m_LocalRotations.reserve(count);
+		m_LocalScales.reserve(count);
+		m_WorldMatrices.reserve(count);
+		m_Parents.reserve(count);
+		m_FirstChildren.reserve(count);
+		m_ChildCounts.reserve(count);
+		m_Dirty.reserve(count);
+		m_UpdateStamps.reserve(count);
+		m_Handles.reserve(count);
+		m_Indices.reserve(count);
+	}
+
+	void TransformHierarchy::Clear()
+	{
+		m_LocalPositions.clear();
+		m_LocalRotations.clear();
+		m_LocalScales.clear();
+		m_WorldMatrices.clear();
+		m_Parents.clear();
+		m_FirstChildren.clear();
+		m_ChildCounts.clear();
+		m_Dirty.clear();
+		m_UpdateStamps.clear();
+		m_Handles.clear();
+		m_LevelStarts.clear();
+		m_Indices.clear();
+		m_DirtyIndices.clear();
+		m_OrderDirty = false;
+		m_LastUpdatedCount = 0;
+	}
+
+	void TransformHierarchy::SortByLevel()
+	{
+		const uint32_t nodeCount = GetNodeCount();
+
+		//-- Children of each node, in current storage order.
+		std::vector<uint32_t> childStarts(nodeCount + 1, 0);
+		for (const uint32_t parent : m_Parents)
+		{
+			if (parent != s_None)
+				++childStarts[parent + 1];
+		}
+		for (uint32_t index = 0; index < nodeCount; ++index)
+			childStarts[index + 1] += childStarts[index];
+
+		std::vector<uint32_t> children(childStarts.back());
+		std::vector<uint32_t> cursors(childStarts.begin(), childStarts.end() - 1);
+		for (uint32_t index = 0; index < nodeCount; ++index)
+		{
+			if (m_Parents[index] != s_None)
+				children[cursors[m_Parents[index]]++] = index;
+		}
+
+		//-- Breadth first from the roots: levels in order, each node's children next to each other.
+		std::vector<uint32_t> order;
+		order.reserve(nodeCount);
+		for (uint32_t index = 0; index < nodeCount; ++index)
+		{
+			if (m_Parents[index] == s_None)
+				order.push_back(index);
+		}
+
+		m_LevelStarts.assign(1, 0);
+		size_t levelEnd = order.size();
+		for (size_t head = 0; head < order.size(); ++head)
+		{
+			if (head == levelEnd)
+			{
+				m_LevelStarts.push_back(static_cast<uint32_t>(head));
+				levelEnd = order.size();
+			}
+
+			const uint32_t index = order[head];
+			order.insert(order.end(), children.begin() + childStarts[index], children.begin() + childStarts[index + 1]);
+		}
+		if (nodeCount > 0)
+			m_LevelStarts.push_back(nodeCount);
+
+		//-- Permute every array into the new order.
+		std::vector<uint32_t> newIndices(nodeCount);
+		for (uint32_t index = 0; index < nodeCount; ++index)
+			newIndices[order[index]] = index;
+
+		const auto permute = [&order](auto& values)
+		{
+			auto permuted = values;
+			for (size_t index = 0; index < order.size(); ++index)
+				permuted[index] = values[order[index]];
+			values.swap(permuted);
+		};
+
+		permute(m_LocalPositions);
+		permute(m_LocalRotations);
+		permute(m_LocalScales);
+		permute(m_WorldMatrices);
+		permute(m_UpdateStamps);
+		permute(m_Handles);
+		permute(m_Parents);
+
+		uint32_t nextChild = m_LevelStarts.size() > 1 ? m_LevelStarts[1] : nodeCount;
+		for (uint32_t index = 0; index < nodeCount; ++index)
+		{
+			if (m_Parents[index] != s_None)
+				m_Parents[index] = newIndices[m_Parents[index]];
+
+			const uint32_t oldIndex = order[index];
+			m_ChildCounts[index] = childStarts[oldIndex + 1] - childStarts[oldIndex];
+			m_FirstChildren[index] = nextChild;
+			nextChild += m_ChildCounts[index];
+
+			m_Indices[m_Handles[index]] = index;
+		}
+
+		std::fill(m_Dirty.begin(), m_Dirty.end(), static_cast<uint8_t>(0));
+		m_DirtyIndices.clear();
+	}
+
+	void TransformHierarchy::MarkDirty(const uint32_t index)
+	{
+		if (m_Dirty[index])
+			return;
+
+		m_Dirty[index] = 1;
+		m_DirtyIndices.push_back(index);
+	}
+
+	void TransformHierarchy::MarkAllDirty()
+	{
+		// Sorting already recomputes everything.
+		if (m_OrderDirty || m_LevelStarts.size() < 2)
+			return;
+
+		for (uint32_t index = m_LevelStarts[0]; index < m_LevelStarts[1]; ++index)
+			MarkDirty(index);
+	}
+
+	void TransformHierarchy::SetLocalPosition(const uint32_t node, const glm::vec3& position)
+	{
+		const uint32_t index = m_Indices.at(node);
+		m_LocalPositions[index] = position;
+		MarkDirty(index);
+	}
+
+	void TransformHierarchy::SetLocalRotation(const uint32_t node, const glm::quat& rotation)
+	{
+		const uint32_t index = m_Indices.at(node);
+		m_LocalRotations[index] = rotation;
+		MarkDirty(index);
+	}
+
+	void TransformHierarchy::SetLocalScale(const uint32_t node, const glm::vec3& scale)
+	{
+		const uint32_t index = m_Indices.at(node);
+		m_LocalScales[index] = scale;
+		MarkDirty(index);
+	}
+
+	void TransformHierarchy::SetLocalTransform(const uint32_t node, const glm::vec3& position, const glm::quat& rotation, const glm::vec3& scale)
+	{
+		const uint32_t index = m_Indices.at(node);
+		m_LocalPositions[index] = position;
+		m_LocalRotations[index] = rotation;
+		m_LocalScales[index] = scale;
+		MarkDirty(index);
+	}
+
+	void TransformHierarchy::UpdateRanges(const std::vector<Range>& ranges)
+	{
+		const auto updateNode = [this](const uint32_t index)
+		{
+			const glm::mat4 local = ComposeTransform(m_LocalPositions[index], m_LocalRotations[index], m_LocalScales[index]);
+			const uint32_t parent = m_Parents[index];
+			m_WorldMatrices[index] = parent == s_None ? local : m_WorldMatrices[parent] * local;
+			m_UpdateStamps[index] = m_UpdateCount;
+		};
+
+		m_RangeEnds.clear();
+		uint32_t nodeCount = 0;
+		for (const Range& range : ranges)
+		{
+			nodeCount += range.m_End - range.m_Begin;
+			m_RangeEnds.push_back(nodeCount);
+		}
+		m_LastUpdatedCount += nodeCount;
+
+		if (nodeCount < s_ParallelThreshold)
+		{
+			for (const Range& range : ranges)
+			{
+				for (uint32_t index = range.m_Begin; index < range.m_End; ++index)
+					updateNode(index);
+			}
+			return;
+		}
+
+		//-- Nodes on one level only read the level above, so any split of the level works.
+		ThreadPool::Get().ParallelFor(nodeCount, 1024, [this, &ranges, &updateNode](const uint32_t begin, const uint32_t end)
+		{
+			size_t range = std::upper_bound(m_RangeEnds.begin(), m_RangeEnds.end(), begin) - m_RangeEnds.begin();
+			for (uint32_t node = begin; node < end; ++node)
+			{
+				while (node >= m_RangeEnds[range])
+					++range;
+
+				updateNode(ranges[range].m_End - (m_RangeEnds[range] - node));
+			}
+		});
+	}
+
+	void TransformHierarchy::Update()
+	{
+		m_LastUpdatedCount = 0;
+		++m_UpdateCount;
+
+		if (m_OrderDirty)
+		{
+			SortByLevel();
+			m_OrderDirty = false;
+			MarkAllDirty();
+		}
+
+		if (m_DirtyIndices.empty())
+			return;
+
+		//-- Bucket the changed nodes by level.
+		const uint32_t levelCount = GetLevelCount();
+		m_LevelRanges.resize(levelCount);
+		for (std::vector<Range>& ranges : m_LevelRanges)
+			ranges.clear();
+
+		uint32_t firstLevel = levelCount;
+		for (const uint32_t index : m_DirtyIndices)
+		{
+			const uint32_t level = GetLevel(index);
+			m_LevelRanges[level].push_back({ index, index + 1 });
+			firstLevel = std::min(firstLevel, level);
+			m_Dirty[index] = 0;
+		}
+		m_DirtyIndices.clear();
+
+		//-- Walk down. Merging drops nodes already covered by a changed ancestor, then each run's children are one run below.
+		for (uint32_t level = firstLevel; level < levelCount; ++level)
+		{
+			std::vector<Range>& ranges = m_LevelRanges[level];
+			if (ranges.empty())
+				continue;
+
+			std::sort(ranges.begin(), ranges.end(), [](const Range& a, const Range& b) { return a.m_Begin < b.m_Begin; });
+
+			size_t merged = 0;
+			for (size_t range = 1; range < ranges.size(); ++range)
+			{
+				if (ranges[range].m_Begin <= ranges[merged].m_End)
+					ranges[merged].m_End = std::max(ranges[merged].m_End, ranges[range].m_End);
+				else
+					ranges[++merged] = ranges[range];
+			}
+			ranges.resize(merged + 1);
+
+			UpdateRanges(ranges);
+
+			if (level + 1 == levelCount)
+				break;
+
+			for (const Range& range : ranges)
+			{
+				const Range children{ m_FirstChildren[range.m_Begin], m_FirstChildren[range.m_End - 1] + m_ChildCounts[range.m_End - 1] };
+				if (children.m_Begin < children.m_End)
+					m_LevelRanges[level + 1].push_back(children);
+			}
+		}
+	}
+
+	uint32_t TransformHierarchy::GetLevel(const uint32_t index) const
+	{
+		return static_cast<uint32_t>(std::upper_bound(m_LevelStarts.begin(), m_LevelStarts.end(), index) - m_LevelStarts.begin()) - 1;
+	}
+
+	const glm::vec3& TransformHierarchy::GetLocalPosition(const uint32_t node) const
+	{
+		return m_LocalPositions[m_Indices.at(node)];
+	}
+
+	const glm::quat& TransformHierarchy::GetLocalRotation(const uint32_t node) const
+	{
+		return m_LocalRotations[m_Indices.at(node)];
+	}
+
+	const glm::vec3& TransformHierarchy::GetLocalScale(const uint32_t node) const
+	{
+		return m_LocalScales[m_Indices.at(node)];
+	}
+
+	uint32_t TransformHierarchy::GetParent(const uint32_t node) const
+	{
+		const uint32_t parent = m_Parents[m_Indices.at(node)];
+		return parent == s_None ? s_None : m_Handles[parent];
+	}
+
+	const glm::mat4& TransformHierarchy::GetWorldMatrix(const uint32_t node) const
+	{
+		return m_WorldMatrices[m_Indices.at(node)];
+	}
+
+	bool TransformHierarchy::WasUpdated(const uint32_t node) const
+	{
+		return m_UpdateStamps[m_Indices.at(node)] == m_UpdateCount;
+	}
+
+	const std::vector<glm::mat4>& TransformHierarchy::GetWorldMatrices() const
+	{
+		return m_WorldMatrices;
+	}
+
+	uint32_t TransformHierarchy::GetStorageIndex(const uint32_t node) const
+	{
+		return m_Indices.at(node);
+	}
+
+	uint32_t TransformHierarchy::GetNodeCount() const
+	{
+		return static_cast<uint32_t>(m_Handles.size());
+	}
+
+	uint32_t TransformHierarchy::GetLevelCount() const
+	{
+		return m_LevelStarts.empty() ? 0 : static_cast<uint32_t>(m_LevelStarts.size() - 1);
+	}
+
+	uint32_t TransformHierarchy::GetLastUpdatedCount() const
+	{
+		return m_LastUpdatedCount;
+	}
+
+	void TransformHierarchy::Benchmark(const uint32_t nodeCount, const uint32_t movedCount, const uint32_t iterations)
+	{
+		//-- Random forest, every node hangs off a random earlier one.
+		std::mt19937 random(1337);
+		std::uniform_real_distribution<float> offsets(-1.f, 1.f);
+
+		TransformHierarchy hierarchy;
+		hierarchy.Reserve(nodeCount);
+		const uint32_t rootCount = std::max(nodeCount / 1000, 1u);
+		for (uint32_t node = 0; node < nodeCount; ++node)
+		{
+			const uint32_t parent = node < rootCount ? s_None : std::uniform_int_distribution<uint32_t>(0, node - 1)(random);
+			hierarchy.AddNode(parent, glm::vec3(offsets(random), offsets(random), offsets(random)), glm::angleAxis(offsets(random), glm::vec3(0.f, 1.f, 0.f)));
+		}
+
+		auto startTime = std::chrono::high_resolution_clock::now();
+		hierarchy.Update();
+		auto endTime = std::chrono::high_resolution_clock::now();
+		const float sortMs = std::chrono::duration<float, std::chrono::milliseconds::period>(endTime - startTime).count();
+
+		float fullMs = 0.f;
+		float partialUs = 0.f;
+		uint32_t updatedCount = 0;
+		std::uniform_int_distribution<uint32_t> nodes(0, nodeCount - 1);
+		for (uint32_t iteration = 0; iteration < iterations; ++iteration)
+		{
+			hierarchy.MarkAllDirty();
+			startTime = std::chrono::high_resolution_clock::now();
+			hierarchy.Update();
+			endTime = std::chrono::high_resolution_clock::now();
+			fullMs += std::chrono::duration<float, std::chrono::milliseconds::period>(endTime - startTime).count();
+
+			for (uint32_t moved = 0; moved < movedCount; ++moved)
+				hierarchy.SetLocalPosition(nodes(random), glm::vec3(offsets(random), offsets(random), offsets(random)));
+
+			startTime = std::chrono::high_resolution_clock::now();
+			hierarchy.Update();
+			endTime = std::chrono::high_resolution_clock::now();
+			partialUs += std::chrono::duration<float, std::chrono::microseconds::period>(endTime - startTime).count();
+			updatedCount += hierarchy.GetLastUpdatedCount();
+		}
+
+		std::cout << "\t" << "Transform hierarchy of " << nodeCount << " nodes, " << hierarchy.GetLevelCount() << " levels: sort " << sortMs << "ms, full update "
+			<< fullMs / iterations << "ms, " << movedCount << " moved " << partialUs / iterations << "us (" << updatedCount / iterations << " world matrices)" << std::endl;
+	}
+}
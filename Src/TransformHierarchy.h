@@ -0,0 +1,111 @@
+﻿/*!
+\file		TransformHierarchy.h
+\date		19/10/2026
+
+\author		Adrian Tan
+\email		t.xingkhiangadrian\@digipen.edu
+
+\brief		Contains definition of TransformHierarchy class.
+			Scene graph transforms as structure of arrays, with incremental world matrix
+			updates of dirty subtrees only.
+
+\copyright	All content © 2023 DigiPen (SINGAPORE) Corporation, all rights reserved.
+			Reproduction or disclosure of this file or its contents without the
+			prior written consent of DigiPen Institute of Technology is prohibited.
+__________________________________________________________________________________*/
+#pragma once
+
+#define GLM_FORCE_RADIANS
+#define GLM_FORCE_DEPTH_ZERO_TO_ONE
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+
+#include <cstdint>
+#include <vector>
+
+namespace Nya
+{
+	// Local translation, rotation and scale per node, and the world matrices they propagate to.
+	// Nodes are stored by depth, parents always before children and siblings next to each other, so a run of
+	// nodes on one level has its children in one run on the next level. Updates walk down level by level from
+	// the nodes changed since the last Update, touching only their subtrees, and split big levels across the ThreadPool.
+	// Nodes are referred to by handles, which stay valid when the storage order changes.
+	class TransformHierarchy
+	{
+		// Half-open range of storage indices, all on one level.
+		struct Range
+		{
+			uint32_t m_Begin = 0;
+			uint32_t m_End = 0;
+		};
+
+		//-- Storage order.
+		std::vector<glm::vec3> m_LocalPositions;
+		std::vector<glm::quat> m_LocalRotations;
+		std::vector<glm::vec3> m_LocalScales;
+		std::vector<glm::mat4> m_WorldMatrices;
+		std::vector<uint32_t> m_Parents;		// Storage index, or s_None.
+		std::vector<uint32_t> m_FirstChildren;	// Where a node's children start, or would start if it had any.
+		std::vector<uint32_t> m_ChildCounts;
+		std::vector<uint8_t> m_Dirty;			// Local data changed since the last Update.
+		std::vector<uint32_t> m_UpdateStamps;	// m_UpdateCount of the Update that last recomputed the world matrix.
+		std::vector<uint32_t> m_Handles;		// Storage index -> handle.
+		std::vector<uint32_t> m_LevelStarts;	// First storage index of each level, plus the end.
+
+		std::vector<uint32_t> m_Indices;		// Handle -> storage index.
+		std::vector<uint32_t> m_DirtyIndices;
+		bool m_OrderDirty = false;				// Nodes were added or reparented, storage must be sorted again.
+
+		std::vector<std::vector<Range>> m_LevelRanges;	// Update scratch, kept for its capacity.
+		std::vector<uint32_t> m_RangeEnds;
+		uint32_t m_LastUpdatedCount = 0;
+		uint32_t m_UpdateCount = 0;
+
+		void SortByLevel();
+		void MarkDirty(uint32_t index);
+		void UpdateRanges(const std::vector<Range>& ranges);
+		uint32_t GetLevel(uint32_t index) const;
+
+	public:
+		static constexpr uint32_t s_None = UINT32_MAX;
+		static constexpr uint32_t s_ParallelThreshold = 4096;	// Nodes on one level before the level is split across threads.
+
+		uint32_t AddNode(uint32_t parent = s_None, const glm::vec3& position = glm::vec3(0.f), const glm::quat& rotation = glm::quat(1.f, 0.f, 0.f, 0.f), const glm::vec3& scale = glm::vec3(1.f));
+		// parent may be s_None. Throws if it would make a cycle.
+		void SetParent(uint32_t node, uint32_t parent);
+		void Reserve(size_t count);
+		void Clear();
+
+		void SetLocalPosition(uint32_t node, const glm::vec3& position);
+		void SetLocalRotation(uint32_t node, const glm::quat& rotation);
+		void SetLocalScale(uint32_t node, const glm::vec3& scale);
+		void SetLocalTransform(uint32_t node, const glm::vec3& position, const glm::quat& rotation, const glm::vec3& scale);
+
+		// Recomputes the world matrices of every changed node and its descendants.
+		void Update();
+		// Makes the next Update recompute every node.
+		void MarkAllDirty();
+
+		const glm::vec3& GetLocalPosition(uint32_t node) const;
+		const glm::quat& GetLocalRotation(uint32_t node) const;
+		const glm::vec3& GetLocalScale(uint32_t node) const;
+		uint32_t GetParent(uint32_t node) const;
+		// As of the last Update.
+		const glm::mat4& GetWorldMatrix(uint32_t node) const;
+		// The last Update recomputed the node's world matrix, it or an ancestor changed.
+		bool WasUpdated(uint32_t node) const;
+
+		// Storage order, for bulk uploads. Valid until the next Update after nodes are added or reparented.
+		const std::vector<glm::mat4>& GetWorldMatrices() const;
+		uint32_t GetStorageIndex(uint32_t node) const;
+
+		uint32_t GetNodeCount() const;
+		uint32_t GetLevelCount() const;
+		// World matrices the last Update recomputed.
+		uint32_t GetLastUpdatedCount() const;
+
+		// Builds a random forest of nodeCount nodes and times Update with movedCount nodes changed per frame,
+		// against a full update, and prints the result.
+		static void Benchmark(uint32_t nodeCount, uint32_t movedCount, uint32_t iterations = 64);
+	};
+}
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "VertexLayout.h"
+
 #include <vulkan/vulkan.h>
 
 #define GLFW_INCLUDE_VULKAN
@@ -13,36 +15,74 @@
 
 namespace Nya
 {
+	// CPU-side vertex, packed into Vertex::Layout when uploaded.
 	struct Vertex
 	{
 		glm::vec2 pos;
 		glm::vec3 color;
 
+		// GPU layout: half float position and 8-bit colour, 8 bytes instead of 20.
+		using Layout = VertexLayout<
+			VertexAttribute<0, VertexEncoding::Half2>,		// Vertex position.
+			VertexAttribute<1, VertexEncoding::Unorm8x3>>;	// Vertex colour.
+
+		// Split layout: positions on their own binding so depth-only passes fetch nothing else.
+		using PositionLayout = VertexLayout<VertexAttribute<0, VertexEncoding::Half2>>;
+		using AttributeLayout = VertexLayout<VertexAttribute<1, VertexEncoding::Unorm8x3>>;
+
 		static VkVertexInputBindingDescription GetBindingDescription()
 		{
-			VkVertexInputBindingDescription description{};
-			description.binding = 0;
-			description.stride = sizeof(Vertex);
-			description.inputRate = VK_VERTEX_INPUT_RATE_VERTEX;
+			return Layout::GetBindingDescription();
+		}
+
+		static std::array<VkVertexInputAttributeDescription, Layout::s_AttributeCount> GetAttributeDescription()
+		{
+			return Layout::GetAttributeDescriptions();
+		}
+
+		static void Pack(const std::vector<Vertex>& vertices, void* dst)
+		{
+			Layout::Pack(dst, vertices.size(), MakeStridedSource(vertices, &Vertex::pos), MakeStridedSource(vertices, &Vertex::color));
+		}
 
-			return description;
+		static void PackPositions(const std::vector<Vertex>& vertices, void* dst)
+		{
+			PositionLayout::Pack(dst, vertices.size(), MakeStridedSource(vertices, &Vertex::pos));
+		}
+
+		static void PackAttributes(const std::vector<Vertex>& vertices, void* dst)
+		{
+			AttributeLayout::Pack(dst, vertices.size(), MakeStridedSource(vertices, &Vertex::color));
 		}
+	};
+
+	// CPU-side per-instance data, packed into InstanceData::Layout for a VK_VERTEX_INPUT_RATE_INSTANCE binding.
+	struct InstanceData
+	{
+		glm::mat4 m_Transform{ 1.f };
+		glm::vec4 m_Colour{ 1.f };
+		uint32_t m_MaterialIndex = 0;
+
+		// GPU layout: affine transform as three rows, 8-bit colour and material index, 56 bytes instead of 84.
+		using Layout = VertexLayout<
+			VertexAttribute<2, VertexEncoding::Float4>,		// Transform row 0.
+			VertexAttribute<3, VertexEncoding::Float4>,		// Transform row 1.
+			VertexAttribute<4, VertexEncoding::Float4>,		// Transform row 2.
+			VertexAttribute<5, VertexEncoding::Unorm8x4>,	// Instance colour.
+			VertexAttribute<6, VertexEncoding::Uint1>>;		// Material index.
 
-		static std::array<VkVertexInputAttributeDescription, 2> GetAttributeDescription()
+		static void Pack(const InstanceData* instances, const size_t count, void* dst)
 		{
-			std::array<VkVertexInputAttributeDescription, 2> attributes{};
-			// Vertex position.
-			attributes[0].binding = 0;
-			attributes[0].location = 0;
-			attributes[0].format = VK_FORMAT_R32G32_SFLOAT;
-			attributes[0].offset = offsetof(Vertex, pos);
-			// Vertex colour;
-			attributes[1].binding = 0;
-			attributes[1].location = 1;
-			attributes[1].format = VK_FORMAT_R32G32B32_SFLOAT;
-			attributes[1].offset = offsetof(Vertex, color);
-
-			return attributes;
+			uint8_t* out = static_cast<uint8_t*>(dst);
+			for (size_t i = 0; i < count; ++i, out += Layout::s_Stride)
+			{
+				const glm::mat4 rows = glm::transpose(instances[i].m_Transform);
+				VertexEncoding::Float4::Pack(rows[0], out + Layout::s_Offsets[0]);
+				VertexEncoding::Float4::Pack(rows[1], out + Layout::s_Offsets[1]);
+				VertexEncoding::Float4::Pack(rows[2], out + Layout::s_Offsets[2]);
+				VertexEncoding::Unorm8x4::Pack(instances[i].m_Colour, out + Layout::s_Offsets[3]);
+				VertexEncoding::Uint1::Pack(instances[i].m_MaterialIndex, out + Layout::s_Offsets[4]);
+			}
 		}
 	};
 }
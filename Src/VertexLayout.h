@@ -0,0 +1,368 @@
+﻿/*!
+\file		VertexLayout.h
+\date		19/10/2026
+
+\author		Adrian Tan
+\email		t.xingkhiangadrian\@digipen.edu
+
+\brief		Contains definition of VertexLayout class template and vertex encodings.
+			A layout is declared as a list of attributes with their storage encoding,
+			the Vulkan vertex input descriptions and packing code are generated from it.
+
+\copyright	All content © 2023 DigiPen (SINGAPORE) Corporation, all rights reserved.
+			Reproduction or disclosure of this file or its contents without the
+			prior written consent of DigiPen Institute of Technology is prohibited.
+__________________________________________________________________________________*/
+#pragma once
+
+#include "Simd.h"
+
+#include <vulkan/vulkan.h>
+
+#define GLM_FORCE_RADIANS
+#define GLM_FORCE_DEPTH_ZERO_TO_ONE
+#include <glm/glm.hpp>
+
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+namespace Nya
+{
+	//-- Packing kernels, SIMD with scalar fallbacks.
+	inline uint16_t FloatToHalf(const float value)
+	{
+		uint32_t bits;
+		memcpy(&bits, &value, sizeof(bits));
+
+		const uint32_t sign = (bits >> 16) & 0x8000;
+		const uint32_t magnitude = bits & 0x7FFFFFFF;
+
+		// Rounds to nearest even and keeps denormals, bit-exact with _mm_cvtps_ph(_MM_FROUND_TO_NEAREST_INT).
+		uint32_t half;
+		if (magnitude > (255u << 23))
+			half = 0x7E00 | ((magnitude >> 13) & 0x3FF);	// NaN: quieted, payload truncated.
+		else if (magnitude >= (143u << 23))
+			half = 0x7C00;									// Overflow or infinity.
+		else if (magnitude < (113u << 23))
+		{
+			// Denormal or zero. Adding 0.5 aligns the half denormal bits to the bottom of the mantissa,
+			// and the float add itself rounds to nearest even.
+			const float magic = 0.5f;
+			float sum;
+			memcpy(&sum, &magnitude, sizeof(sum));
+			sum += magic;
+			uint32_t sumBits, magicBits;
+			memcpy(&sumBits, &sum, sizeof(sumBits));
+			memcpy(&magicBits, &magic, sizeof(magicBits));
+			half = sumBits - magicBits;
+		}
+		else
+		{
+			// Rebias exponent, then round to nearest even. A mantissa carry correctly bumps the exponent, up to infinity.
+			const uint32_t odd = (magnitude >> 13) & 1;
+			half = (magnitude - (112u << 23) + 0xFFF + odd) >> 13;
+		}
+
+		return static_cast<uint16_t>(sign | half);
+	}
+
+#ifdef NYA_SIMD_F16C
+NYA_SIMD_BEGIN_F16C
+	inline void PackHalf4F16c(const glm::vec4& value, uint8_t* dst)
+	{
+		_mm_storel_epi64(reinterpret_cast<__m128i*>(dst), _mm_cvtps_ph(_mm_loadu_ps(&value.x), _MM_FROUND_TO_NEAREST_INT));
+	}
+NYA_SIMD_END
+#endif
+
+	inline void PackHalf4(const glm::vec4& value, uint8_t* dst)
+	{
+#ifdef NYA_SIMD_F16C
+		if (GetSimdFeatures().m_F16c)
+		{
+			PackHalf4F16c(value, dst);
+			return;
+		}
+#endif
+		const uint16_t halves[4] = { FloatToHalf(value.x), FloatToHalf(value.y), FloatToHalf(value.z), FloatToHalf(value.w) };
+		memcpy(dst, halves, sizeof(halves));
+	}
+
+	inline void PackSnorm16x4(const glm::vec4& value, uint8_t* dst)
+	{
+#ifdef NYA_SIMD_SSE2
+		const __m128 clamped = _mm_min_ps(_mm_max_ps(_mm_loadu_ps(&value.x), _mm_set1_ps(-1.f)), _mm_set1_ps(1.f));
+		const __m128i integers = _mm_cvtps_epi32(_mm_mul_ps(clamped, _mm_set1_ps(32767.f)));
+		_mm_storel_epi64(reinterpret_cast<__m128i*>(dst), _mm_packs_epi32(integers, integers));
+#else
+		// nearbyint rounds to nearest even in the default rounding mode, like _mm_cvtps_epi32 does.
+		int16_t values[4];
+		for (int i = 0; i < 4; ++i)
+			values[i] = static_cast<int16_t>(std::nearbyint(glm::clamp(value[i], -1.f, 1.f) * 32767.f));
+		memcpy(dst, values, sizeof(values));
+#endif
+	}
+
+	inline void PackUnorm8x4(const glm::vec4& value, uint8_t* dst)
+	{
+#ifdef NYA_SIMD_SSE2
+		const __m128 clamped = _mm_min_ps(_mm_max_ps(_mm_loadu_ps(&value.x), _mm_setzero_ps()), _mm_set1_ps(1.f));
+		const __m128i integers = _mm_cvtps_epi32(_mm_mul_ps(clamped, _mm_set1_ps(255.f)));
+		const __m128i shorts = _mm_packs_epi32(integers, integers);
+		const int packed = _mm_cvtsi128_si32(_mm_packus_epi16(shorts, shorts));
+		memcpy(dst, &packed, sizeof(packed));
+#else
+		uint8_t values[4];
+		for (int i = 0; i < 4; ++i)
+			values[i] = static_cast<uint8_t>(std::nearbyint(glm::clamp(value[i], 0.f, 1.f) * 255.f));
+		memcpy(dst, values, sizeof(values));
+#endif
+	}
+
+	inline void PackSnorm8x4(const glm::vec4& value, uint8_t* dst)
+	{
+#ifdef NYA_SIMD_SSE2
+		const __m128 clamped = _mm_min_ps(_mm_max_ps(_mm_loadu_ps(&value.x), _mm_set1_ps(-1.f)), _mm_set1_ps(1.f));
+		const __m128i integers = _mm_cvtps_epi32(_mm_mul_ps(clamped, _mm_set1_ps(127.f)));
+		const __m128i shorts = _mm_packs_epi32(integers, integers);
+		const int packed = _mm_cvtsi128_si32(_mm_packs_epi16(shorts, shorts));
+		memcpy(dst, &packed, sizeof(packed));
+#else
+		int8_t values[4];
+		for (int i = 0; i < 4; ++i)
+			values[i] = static_cast<int8_t>(std::nearbyint(glm::clamp(value[i], -1.f, 1.f) * 127.f));
+		memcpy(dst, values, sizeof(values));
+#endif
+	}
+
+	// Octahedral encoding of a unit vector into [-1, 1]^2, decoded by OctDecode in Shaders/vertex_packing.glsl.
+	inline glm::vec2 OctEncode(const glm::vec3& normal)
+	{
+		const glm::vec3 n = normal / (glm::abs(normal.x) + glm::abs(normal.y) + glm::abs(normal.z));
+		if (n.z >= 0.f)
+			return { n.x, n.y };
+
+		return { (1.f - glm::abs(n.y)) * (n.x >= 0.f ? 1.f : -1.f), (1.f - glm::abs(n.x)) * (n.y >= 0.f ? 1.f : -1.f) };
+	}
+
+
+	//-- Encodings. Each maps a CPU source type to a Vulkan format and packs one value.
+	// 3 component 8/16-bit formats are padded to 4, as they are not guaranteed vertex formats.
+	namespace VertexEncoding
+	{
+		struct Float2
+		{
+			using Source = glm::vec2;
+			static constexpr VkFormat s_Format = VK_FORMAT_R32G32_SFLOAT;
+			static constexpr uint32_t s_Size = 8;
+			static void Pack(const Source& value, uint8_t* dst) { memcpy(dst, &value, s_Size); }
+		};
+
+		struct Float3
+		{
+			using Source = glm::vec3;
+			static constexpr VkFormat s_Format = VK_FORMAT_R32G32B32_SFLOAT;
+			static constexpr uint32_t s_Size = 12;
+			static void Pack(const Source& value, uint8_t* dst) { memcpy(dst, &value, s_Size); }
+		};
+
+		struct Float4
+		{
+			using Source = glm::vec4;
+			static constexpr VkFormat s_Format = VK_FORMAT_R32G32B32A32_SFLOAT;
+			static constexpr uint32_t s_Size = 16;
+			static void Pack(const Source& value, uint8_t* dst) { memcpy(dst, &value, s_Size); }
+		};
+
+		struct Half2
+		{
+			using Source = glm::vec2;
+			static constexpr VkFormat s_Format = VK_FORMAT_R16G16_SFLOAT;
+			static constexpr uint32_t s_Size = 4;
+			static void Pack(const Source& value, uint8_t* dst)
+			{
+				uint8_t packed[8];
+				PackHalf4(glm::vec4(value, 0.f, 0.f), packed);
+				memcpy(dst, packed, s_Size);
+			}
+		};
+
+		struct Half3
+		{
+			using Source = glm::vec3;
+			static constexpr VkFormat s_Format = VK_FORMAT_R16G16B16A16_SFLOAT;
+			static constexpr uint32_t s_Size = 8;
+			static void Pack(const Source& value, uint8_t* dst) { PackHalf4(glm::vec4(value, 1.f), dst); }
+		};
+
+		struct Half4
+		{
+			using Source = glm::vec4;
+			static constexpr VkFormat s_Format = VK_FORMAT_R16G16B16A16_SFLOAT;
+			static constexpr uint32_t s_Size = 8;
+			static void Pack(const Source& value, uint8_t* dst) { PackHalf4(value, dst); }
+		};
+
+		struct Snorm16x2
+		{
+			using Source = glm::vec2;
+			static constexpr VkFormat s_Format = VK_FORMAT_R16G16_SNORM;
+			static constexpr uint32_t s_Size = 4;
+			static void Pack(const Source& value, uint8_t* dst)
+			{
+				uint8_t packed[8];
+				PackSnorm16x4(glm::vec4(value, 0.f, 0.f), packed);
+				memcpy(dst, packed, s_Size);
+			}
+		};
+
+		struct Snorm16x4
+		{
+			using Source = glm::vec4;
+			static constexpr VkFormat s_Format = VK_FORMAT_R16G16B16A16_SNORM;
+			static constexpr uint32_t s_Size = 8;
+			static void Pack(const Source& value, uint8_t* dst) { PackSnorm16x4(value, dst); }
+		};
+
+		struct Unorm8x3
+		{
+			using Source = glm::vec3;
+			static constexpr VkFormat s_Format = VK_FORMAT_R8G8B8A8_UNORM;
+			static constexpr uint32_t s_Size = 4;
+			static void Pack(const Source& value, uint8_t* dst) { PackUnorm8x4(glm::vec4(value, 1.f), dst); }
+		};
+
+		struct Unorm8x4
+		{
+			using Source = glm::vec4;
+			static constexpr VkFormat s_Format = VK_FORMAT_R8G8B8A8_UNORM;
+			static constexpr uint32_t s_Size = 4;
+			static void Pack(const Source& value, uint8_t* dst) { PackUnorm8x4(value, dst); }
+		};
+
+		struct Snorm8x4
+		{
+			using Source = glm::vec4;
+			static constexpr VkFormat s_Format = VK_FORMAT_R8G8B8A8_SNORM;
+			static constexpr uint32_t s_Size = 4;
+			static void Pack(const Source& value, uint8_t* dst) { PackSnorm8x4(value, dst); }
+		};
+
+		// Integer attribute, read as uint in the shader (indices, IDs).
+		struct Uint1
+		{
+			using Source = uint32_t;
+			static constexpr VkFormat s_Format = VK_FORMAT_R32_UINT;
+			static constexpr uint32_t s_Size = 4;
+			static void Pack(const Source& value, uint8_t* dst) { memcpy(dst, &value, s_Size); }
+		};
+
+		// Unit vector in 4 bytes, about 0.005 degrees of error.
+		struct OctNormal16
+		{
+			using Source = glm::vec3;
+			static constexpr VkFormat s_Format = VK_FORMAT_R16G16_SNORM;
+			static constexpr uint32_t s_Size = 4;
+			static void Pack(const Source& value, uint8_t* dst) { Snorm16x2::Pack(OctEncode(value), dst); }
+		};
+
+		// Unit vector in 2 bytes, about 1 degree of error. Good enough for tangents and low-detail normals.
+		struct OctNormal8
+		{
+			using Source = glm::vec3;
+			static constexpr VkFormat s_Format = VK_FORMAT_R8G8_SNORM;
+			static constexpr uint32_t s_Size = 2;
+			static void Pack(const Source& value, uint8_t* dst)
+			{
+				uint8_t packed[4];
+				PackSnorm8x4(glm::vec4(OctEncode(value), 0.f, 0.f), packed);
+				memcpy(dst, packed, s_Size);
+			}
+		};
+	}
+
+
+	//-- Layout.
+	template <uint32_t Location, typename TEncoding>
+	struct VertexAttribute
+	{
+		static constexpr uint32_t s_Location = Location;
+		using Encoding = TEncoding;
+		using Source = typename TEncoding::Source;
+	};
+
+	// Reads T values at a byte stride, so both SoA arrays and members of AoS structs can feed a layout.
+	template <typename T>
+	struct StridedSource
+	{
+		const uint8_t* m_Data = nullptr;
+		size_t m_Stride = sizeof(T);
+
+		StridedSource(const T* data, const size_t stride = sizeof(T)) : m_Data(reinterpret_cast<const uint8_t*>(data)), m_Stride(stride) {}
+
+		const T& operator[](const size_t index) const { return *reinterpret_cast<const T*>(m_Data + index * m_Stride); }
+	};
+
+	template <typename TVertex, typename T>
+	StridedSource<T> MakeStridedSource(const std::vector<TVertex>& vertices, T TVertex::* member)
+	{
+		return { vertices.empty() ? nullptr : &(vertices.data()->*member), sizeof(TVertex) };
+	}
+
+	template <typename... TAttributes>
+	class VertexLayout
+	{
+		static_assert(sizeof...(TAttributes) > 0, "Vertex layout needs at least one attribute!");
+
+		// Every attribute starts 4-byte aligned.
+		static constexpr uint32_t AlignAttribute(const uint32_t size) { return (size + 3u) & ~3u; }
+
+		static constexpr std::array<uint32_t, sizeof...(TAttributes)> ComputeOffsets()
+		{
+			std::array<uint32_t, sizeof...(TAttributes)> offsets{};
+			uint32_t offset = 0;
+			size_t i = 0;
+			((offsets[i++] = offset, offset += AlignAttribute(TAttributes::Encoding::s_Size)), ...);
+			return offsets;
+		}
+
+		template <size_t... I>
+		static void PackVertex(uint8_t* dst, const size_t index, std::index_sequence<I...>, const StridedSource<typename TAttributes::Source>&... sources)
+		{
+			(TAttributes::Encoding::Pack(sources[index], dst + s_Offsets[I]), ...);
+		}
+
+	public:
+		static constexpr uint32_t s_AttributeCount = sizeof...(TAttributes);
+		static constexpr std::array<uint32_t, sizeof...(TAttributes)> s_Offsets = ComputeOffsets();
+		static constexpr uint32_t s_Stride = (AlignAttribute(TAttributes::Encoding::s_Size) + ...);
+		static constexpr bool s_HasPadding = s_Stride != (TAttributes::Encoding::s_Size + ...);
+
+		static constexpr VkVertexInputBindingDescription GetBindingDescription(const uint32_t binding = 0, const VkVertexInputRate inputRate = VK_VERTEX_INPUT_RATE_VERTEX)
+		{
+			return { binding, s_Stride, inputRate };
+		}
+
+		static constexpr std::array<VkVertexInputAttributeDescription, sizeof...(TAttributes)> GetAttributeDescriptions(const uint32_t binding = 0)
+		{
+			std::array<VkVertexInputAttributeDescription, sizeof...(TAttributes)> attributes{};
+			size_t i = 0;
+			((attributes[i] = { TAttributes::s_Location, binding, TAttributes::Encoding::s_Format, s_Offsets[i] }, ++i), ...);
+			return attributes;
+		}
+
+		// Packs vertexCount vertices into dst, s_Stride bytes each. One source per attribute, in declaration order.
+		static void Pack(void* dst, const size_t vertexCount, const StridedSource<typename TAttributes::Source>&... sources)
+		{
+			uint8_t* out = static_cast<uint8_t*>(dst);
+			if constexpr (s_HasPadding)
+				memset(out, 0, vertexCount * s_Stride);
+
+			for (size_t v = 0; v < vertexCount; ++v, out += s_Stride)
+				PackVertex(out, v, std::index_sequence_for<TAttributes...>{}, sources...);
+		}
+	};
+}
@@ -0,0 +1,260 @@
+﻿/*!
+\file		VulkanBindlessHeap.cpp
+\date		19/10/2026
+
+\author		Adrian Tan
+\email		t.xingkhiangadrian\@digipen.edu
+
+\brief		Contains implementation for VulkanBindlessHeap class functions.
+
+\copyright	All content © 2023 DigiPen (SINGAPORE) Corporation, all rights reserved.
+			Reproduction or disclosure of this file or its contents without the
+			prior written consent of DigiPen Institute of Technology is prohibited.
+__________________________________________________________________________________*/
+
+#include "meowpch.h"
+
+#include "VulkanBindlessHeap.h"
+#include "VulkanLogicalDevice.h"
+#include "VulkanPhysicalDevice.h"
+
+namespace Nya
+{
+	//-- BindlessSlotAllocator Functions.
+	void BindlessSlotAllocator::Init(const uint32_t capacity)
+	{
+		m_FreeSlots.clear();
+		m_States.clear();
+		m_NextSlot = 0;
+		m_Capacity = capacity;
+	}
+
+	uint32_t BindlessSlotAllocator::Allocate()
+	{
+		// Reuse released slots first, keeps the live range of the array compact.
+		if (!m_FreeSlots.empty())
+		{
+			const uint32_t slot = m_FreeSlots.back();
+			m_FreeSlots.pop_back();
+			m_States[slot] = SlotState::Live;
+			return slot;
+		}
+
+		if (m_NextSlot >= m_Capacity)
+			throw std::runtime_error("Bindless descriptor array is full!");
+
+		m_States.push_back(SlotState::Live);
+		return m_NextSlot++;
+	}
+
+	void BindlessSlotAllocator::Retire(const uint32_t slot)
+	{
+		if (slot >= m_NextSlot)
+			throw std::runtime_error("Releasing a bindless slot that was never allocated!");
+		if (m_States[slot] != SlotState::Live)
+			throw std::runtime_error("Releasing a bindless slot that was already released!");
+
+		m_States[slot] = SlotState::Retired;
+	}
+
+	void BindlessSlotAllocator::Free(const uint32_t slot)
+	{
+		if (slot >= m_NextSlot)
+			throw std::runtime_error("Freeing a bindless slot that was never allocated!");
+		// A second free would hand the slot out twice.
+		if (m_States[slot] == SlotState::Free)
+			throw std::runtime_error("Freeing a bindless slot that is already free!");
+
+		m_States[slot] = SlotState::Free;
+		m_FreeSlots.push_back(slot);
+	}
+
+	uint32_t BindlessSlotAllocator::GetCapacity() const
+	{
+		return m_Capacity;
+	}
+
+	uint32_t BindlessSlotAllocator::GetLiveCount() const
+	{
+		return m_NextSlot - static_cast<uint32_t>(m_FreeSlots.size());
+	}
+
+
+	//-- VulkanBindlessHeap Functions.
+	bool VulkanBindlessHeap::IsSupported()
+	{
+		return VulkanLogicalDevice::Get().IsBindlessEnabled();
+	}
+
+	void VulkanBindlessHeap::Init(uint32_t maxImages, uint32_t maxBuffers)
+	{
+		if (!IsSupported())
+			throw std::runtime_error("Bindless heap requested, but descriptor indexing is not enabled!");
+
+		// Clamp array sizes to what the GPU can put in a single update-after-bind set.
+		const auto& limits = VulkanPhysicalDevice::Get().GetDescriptorIndexingProperties();
+		maxImages = std::min({ maxImages, limits.maxDescriptorSetUpdateAfterBindSampledImages, limits.maxPerStageDescriptorUpdateAfterBindSampledImages, limits.maxPerStageDescriptorUpdateAfterBindSamplers });
+		maxBuffers = std::min({ maxBuffers, limits.maxDescriptorSetUpdateAfterBindStorageBuffers, limits.maxPerStageDescriptorUpdateAfterBindStorageBuffers });
+
+		m_ImageSlots.Init(maxImages);
+		m_BufferSlots.Init(maxBuffers);
+
+		//-- Set layout.
+		std::array<VkDescriptorSetLayoutBinding, 2> bindings{};
+		bindings[0].binding = s_ImageBinding;
+		bindings[0].descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+		bindings[0].descriptorCount = maxImages;
+		bindings[0].stageFlags = VK_SHADER_STAGE_ALL;
+		bindings[1].binding = s_BufferBinding;
+		bindings[1].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+		bindings[1].descriptorCount = maxBuffers;
+		bindings[1].stageFlags = VK_SHADER_STAGE_ALL;
+
+		// Slots can be written while the set is bound, even by frames in flight as long as those don't read them,
+		// and unwritten slots are legal as long as they aren't read.
+		constexpr VkDescriptorBindingFlagsEXT bindingFlag = VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT_EXT | VK_DESCRIPTOR_BINDING_UPDATE_UNUSED_WHILE_PENDING_BIT_EXT |
+			VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT_EXT;
+		const std::array<VkDescriptorBindingFlagsEXT, 2> bindingFlags = { bindingFlag, bindingFlag };
+
+		VkDescriptorSetLayoutBindingFlagsCreateInfoEXT bindingFlagsInfo{};
+		bindingFlagsInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_BINDING_FLAGS_CREATE_INFO_EXT;
+		bindingFlagsInfo.bindingCount = static_cast<uint32_t>(bindingFlags.size());
+		bindingFlagsInfo.pBindingFlags = bindingFlags.data();
+
+		VkDescriptorSetLayoutCreateInfo layoutInfo{};
+		layoutInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+		layoutInfo.flags = VK_DESCRIPTOR_SET_LAYOUT_CREATE_UPDATE_AFTER_BIND_POOL_BIT_EXT;
+		layoutInfo.bindingCount = static_cast<uint32_t>(bindings.size());
+		layoutInfo.pBindings = bindings.data();
+		layoutInfo.pNext = &bindingFlagsInfo;
+
+		if (vkCreateDescriptorSetLayout(VulkanLogicalDevice::Get().GetLogicalDevice(), &layoutInfo, nullptr, &m_SetLayout) != VK_SUCCESS)
+			throw std::runtime_error("Failed to create bindless descriptor set layout!");
+
+		//-- Pool.
+		std::array<VkDescriptorPoolSize, 2> poolSizes{};
+		poolSizes[0].type = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+		poolSizes[0].descriptorCount = maxImages;
+		poolSizes[1].type = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+		poolSizes[1].descriptorCount = maxBuffers;
+
+		VkDescriptorPoolCreateInfo poolInfo{};
+		poolInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+		poolInfo.flags = VK_DESCRIPTOR_POOL_CREATE_UPDATE_AFTER_BIND_BIT_EXT;
+		poolInfo.poolSizeCount = static_cast<uint32_t>(poolSizes.size());
+		poolInfo.pPoolSizes = poolSizes.data();
+		poolInfo.maxSets = 1;
+
+		if (vkCreateDescriptorPool(VulkanLogicalDevice::Get().GetLogicalDevice(), &poolInfo, nullptr, &m_DescriptorPool) != VK_SUCCESS)
+			throw std::runtime_error("Failed to create bindless descriptor pool!");
+
+		//-- The one and only set.
+		VkDescriptorSetAllocateInfo allocInfo{};
+		allocInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+		allocInfo.descriptorPool = m_DescriptorPool;
+		allocInfo.descriptorSetCount = 1;
+		allocInfo.pSetLayouts = &m_SetLayout;
+
+		if (vkAllocateDescriptorSets(VulkanLogicalDevice::Get().GetLogicalDevice(), &allocInfo, &m_DescriptorSet) != VK_SUCCESS)
+			throw std::runtime_error("Failed to allocate bindless descriptor set!");
+	}
+
+	void VulkanBindlessHeap::Cleanup() const
+	{
+		vkDestroyDescriptorPool(VulkanLogicalDevice::Get().GetLogicalDevice(), m_DescriptorPool, nullptr);
+		vkDestroyDescriptorSetLayout(VulkanLogicalDevice::Get().GetLogicalDevice(), m_SetLayout, nullptr);
+	}
+
+	void VulkanBindlessHeap::BeginFrame(const uint32_t currentFrame)
+	{
+		// This frame's fence has been waited on, so slots it released are no longer read by the GPU.
+		m_CurrentFrame = currentFrame;
+
+		for (const uint32_t slot : m_PendingImageFrees[m_CurrentFrame])
+			m_ImageSlots.Free(slot);
+		for (const uint32_t slot : m_PendingBufferFrees[m_CurrentFrame])
+			m_BufferSlots.Free(slot);
+
+		m_PendingImageFrees[m_CurrentFrame].clear();
+		m_PendingBufferFrees[m_CurrentFrame].clear();
+	}
+
+	uint32_t VulkanBindlessHeap::RegisterImage(const VkImageView imageView, const VkSampler sampler, const VkImageLayout imageLayout)
+	{
+		const uint32_t slot = m_ImageSlots.Allocate();
+		UpdateImage(slot, imageView, sampler, imageLayout);
+		return slot;
+	}
+
+	uint32_t VulkanBindlessHeap::RegisterBuffer(const VkBuffer buffer, const VkDeviceSize offset, const VkDeviceSize range)
+	{
+		const uint32_t slot = m_BufferSlots.Allocate();
+		UpdateBuffer(slot, buffer, offset, range);
+		return slot;
+	}
+
+	void VulkanBindlessHeap::UpdateImage(const uint32_t slot, const VkImageView imageView, const VkSampler sampler, const VkImageLayout imageLayout) const
+	{
+		VkDescriptorImageInfo imageInfo{};
+		imageInfo.imageView = imageView;
+		imageInfo.sampler = sampler;
+		imageInfo.imageLayout = imageLayout;
+
+		VkWriteDescriptorSet descriptorWrite{};
+		descriptorWrite.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+		descriptorWrite.dstSet = m_DescriptorSet;
+		descriptorWrite.dstBinding = s_ImageBinding;
+		descriptorWrite.dstArrayElement = slot;
+		descriptorWrite.descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+		descriptorWrite.descriptorCount = 1;
+		descriptorWrite.pImageInfo = &imageInfo;
+
+		vkUpdateDescriptorSets(VulkanLogicalDevice::Get().GetLogicalDevice(), 1, &descriptorWrite, 0, nullptr);
+	}
+
+	void VulkanBindlessHeap::UpdateBuffer(const uint32_t slot, const VkBuffer buffer, const VkDeviceSize offset, const VkDeviceSize range) const
+	{
+		VkDescriptorBufferInfo bufferInfo{};
+		bufferInfo.buffer = buffer;
+		bufferInfo.offset = offset;
+		bufferInfo.range = range;
+
+		VkWriteDescriptorSet descriptorWrite{};
+		descriptorWrite.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+		descriptorWrite.dstSet = m_DescriptorSet;
+		descriptorWrite.dstBinding = s_BufferBinding;
+		descriptorWrite.dstArrayElement = slot;
+		descriptorWrite.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+		descriptorWrite.descriptorCount = 1;
+		descriptorWrite.pBufferInfo = &bufferInfo;
+
+		vkUpdateDescriptorSets(VulkanLogicalDevice::Get().GetLogicalDevice(), 1, &descriptorWrite, 0, nullptr);
+	}
+
+	void VulkanBindlessHeap::ReleaseImage(const uint32_t slot)
+	{
+		m_ImageSlots.Retire(slot);
+		m_PendingImageFrees[m_CurrentFrame].push_back(slot);
+	}
+
+	void VulkanBindlessHeap::ReleaseBuffer(const uint32_t slot)
+	{
+		m_BufferSlots.Retire(slot);
+		m_PendingBufferFrees[m_CurrentFrame].push_back(slot);
+	}
+
+	void VulkanBindlessHeap::Bind(const VkCommandBuffer commandBuffer, const VkPipelineLayout pipelineLayout, const uint32_t setIndex, const VkPipelineBindPoint bindPoint) const
+	{
+		vkCmdBindDescriptorSets(commandBuffer, bindPoint, pipelineLayout, setIndex, 1, &m_DescriptorSet, 0, nullptr);
+	}
+
+	VkDescriptorSetLayout VulkanBindlessHeap::GetLayout() const
+	{
+		return m_SetLayout;
+	}
+
+	VkDescriptorSet VulkanBindlessHeap::GetDescriptorSet() const
+	{
+		return m_DescriptorSet;
+	}
+}
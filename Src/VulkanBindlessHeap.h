@@ -0,0 +1,88 @@
+﻿/*!
+\file		VulkanBindlessHeap.h
+\date		19/10/2026
+
+\author		Adrian Tan
+\email		t.xingkhiangadrian\@digipen.edu
+
+\brief		Contains definition of VulkanBindlessHeap class.
+
+\copyright	All content © 2023 DigiPen (SINGAPORE) Corporation, all rights reserved.
+			Reproduction or disclosure of this file or its contents without the
+			prior written consent of DigiPen Institute of Technology is prohibited.
+__________________________________________________________________________________*/
+#pragma once
+
+#include "VulkanDefines.h"
+
+namespace Nya
+{
+	// Hands out slots in a fixed-size descriptor array.
+	// A slot keeps its index for as long as it is alive, so shaders can store it.
+	class BindlessSlotAllocator
+	{
+		enum class SlotState : uint8_t
+		{
+			Free,
+			Live,
+			Retired		// Released, but possibly still read by frames in flight.
+		};
+
+		std::vector<uint32_t> m_FreeSlots;
+		std::vector<SlotState> m_States;	// Per allocated slot.
+		uint32_t m_NextSlot = 0;
+		uint32_t m_Capacity = 0;
+
+	public:
+		void Init(uint32_t capacity);
+
+		uint32_t Allocate();
+		// Marks a live slot released without reusing it yet. Throws if it is not live.
+		void Retire(uint32_t slot);
+		// Makes a live or retired slot reusable. Throws if it is already free.
+		void Free(uint32_t slot);
+
+		uint32_t GetCapacity() const;
+		uint32_t GetLiveCount() const;
+	};
+
+	// One update-after-bind descriptor set holding every sampled image and storage buffer.
+	// Bound once per command buffer, shaders index into it by texture/material ID.
+	class VulkanBindlessHeap
+	{
+		VkDescriptorSetLayout m_SetLayout{};
+		VkDescriptorPool m_DescriptorPool{};
+		VkDescriptorSet m_DescriptorSet{};
+
+		BindlessSlotAllocator m_ImageSlots;
+		BindlessSlotAllocator m_BufferSlots;
+
+		// Slots released this frame, recycled once the frame is no longer in flight.
+		std::array<std::vector<uint32_t>, g_MaxFramesInFlight> m_PendingImageFrees;
+		std::array<std::vector<uint32_t>, g_MaxFramesInFlight> m_PendingBufferFrees;
+		uint32_t m_CurrentFrame = 0;
+
+	public:
+		static constexpr uint32_t s_ImageBinding = 0;
+		static constexpr uint32_t s_BufferBinding = 1;
+
+		static bool IsSupported();
+
+		void Init(uint32_t maxImages = g_MaxBindlessImages, uint32_t maxBuffers = g_MaxBindlessBuffers);
+		void Cleanup() const;
+
+		void BeginFrame(uint32_t currentFrame);
+
+		uint32_t RegisterImage(VkImageView imageView, VkSampler sampler, VkImageLayout imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+		uint32_t RegisterBuffer(VkBuffer buffer, VkDeviceSize offset = 0, VkDeviceSize range = VK_WHOLE_SIZE);
+		void UpdateImage(uint32_t slot, VkImageView imageView, VkSampler sampler, VkImageLayout imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL) const;
+		void UpdateBuffer(uint32_t slot, VkBuffer buffer, VkDeviceSize offset = 0, VkDeviceSize range = VK_WHOLE_SIZE) const;
+		void ReleaseImage(uint32_t slot);
+		void ReleaseBuffer(uint32_t slot);
+
+		void Bind(VkCommandBuffer commandBuffer, VkPipelineLayout pipelineLayout, uint32_t setIndex, VkPipelineBindPoint bindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS) const;
+
+		VkDescriptorSetLayout GetLayout() const;
+		VkDescriptorSet GetDescriptorSet() const;
+	};
+}
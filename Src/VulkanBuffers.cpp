@@ -86,6 +86,32 @@ namespace Nya
 		vkFreeCommandBuffers(VulkanLogicalDevice::Get().GetLogicalDevice(), commandPool, 1, &commandBuffer);
 	}
 
+	void VulkanBuffer::CreateDeviceLocalBuffer(const VkDeviceSize size, const VkBufferUsageFlags usage, const VkCommandPool commandPool, const StagingWriteFn& writeStaging)
+	{
+		constexpr VkMemoryPropertyFlags memProperties = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+		m_Size = size;
+
+		// Staging buffer.
+		VkBuffer stagingBuffer;
+		VkDeviceMemory stagingBufferMemory;
+		CreateBuffer(size, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, memProperties, stagingBuffer, stagingBufferMemory);
+
+		// Map memory to CPU, and let the caller write into it directly.
+		void* data;
+		vkMapMemory(VulkanLogicalDevice::Get().GetLogicalDevice(), stagingBufferMemory, 0, size, 0, &data);
+		writeStaging(data);
+		vkUnmapMemory(VulkanLogicalDevice::Get().GetLogicalDevice(), stagingBufferMemory);
+
+		// Actual buffer, created in high-performance memory in GPU.
+		CreateBuffer(size, VK_BUFFER_USAGE_TRANSFER_DST_BIT | usage, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, m_Buffer, m_BufferMemory);
+		// Copy from staging buffer to actual buffer.
+		CopyBuffer(stagingBuffer, m_Buffer, size, commandPool);
+
+		// Cleanup staging buffer.
+		vkDestroyBuffer(VulkanLogicalDevice::Get().GetLogicalDevice(), stagingBuffer, nullptr);
+		vkFreeMemory(VulkanLogicalDevice::Get().GetLogicalDevice(), stagingBufferMemory, nullptr);
+	}
+
 	void VulkanBuffer::Cleanup() const
 	{
 		vkDestroyBuffer(VulkanLogicalDevice::Get().GetLogicalDevice(), m_Buffer, nullptr);
@@ -101,4 +127,9 @@ namespace Nya
 	{
 		return m_BufferMemory;
 	}
+
+	VkDeviceSize VulkanBuffer::GetSize() const
+	{
+		return m_Size;
+	}
 }
@@ -15,21 +15,31 @@ ________________________________________________________________________________
 
 #include <vulkan/vulkan.h>
 
+#include <functional>
+
 namespace Nya
 {
+	// Writes the initial contents of a buffer straight into mapped staging memory.
+	using StagingWriteFn = std::function<void(void* stagingMemory)>;
+
 	class VulkanBuffer
 	{
 	protected:
 		VkBuffer m_Buffer{};
 		VkDeviceMemory m_BufferMemory{};
+		VkDeviceSize m_Size = 0;
 
 		void CreateBuffer(VkDeviceSize size, VkBufferUsageFlags usage, VkMemoryPropertyFlags properties, VkBuffer& buffer, VkDeviceMemory& bufferMemory);
 		void CopyBuffer(VkBuffer srcBuffer, VkBuffer dstBuffer, VkDeviceSize size, VkCommandPool commandPool);
 
+		// Creates m_Buffer in device local memory, filled through a temporary staging buffer.
+		void CreateDeviceLocalBuffer(VkDeviceSize size, VkBufferUsageFlags usage, VkCommandPool commandPool, const StagingWriteFn& writeStaging);
+
 	public:
 		void Cleanup() const;
 
 		VkBuffer GetBuffer() const;
 		VkDeviceMemory GetBufferMemory() const;
+		VkDeviceSize GetSize() const;
 	};
 }
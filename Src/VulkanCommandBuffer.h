@@ -15,6 +15,8 @@ ________________________________________________________________________________
 
 #include <vulkan/vulkan.h>
 
+#include <type_traits>
+
 namespace Nya
 {
 	class VulkanCommandBuffer
@@ -24,6 +26,22 @@ namespace Nya
 	public:
 		void Init(VkCommandPool commandPool);
 
+		// Typed vkCmdPushConstants, size is taken from T.
+		template <typename T>
+		static void PushConstants(VkCommandBuffer commandBuffer, VkPipelineLayout pipelineLayout, VkShaderStageFlags stageFlags, const T& data, uint32_t offset = 0)
+		{
+			static_assert(std::is_trivially_copyable_v<T>, "Push constant data must be trivially copyable!");
+			static_assert(sizeof(T) % 4 == 0, "Push constant size must be a multiple of 4!");
+
+			vkCmdPushConstants(commandBuffer, pipelineLayout, stageFlags, offset, static_cast<uint32_t>(sizeof(T)), &data);
+		}
+
+		template <typename T>
+		void PushConstants(VkPipelineLayout pipelineLayout, VkShaderStageFlags stageFlags, const T& data, uint32_t offset = 0) const
+		{
+			PushConstants(m_CommandBuffer, pipelineLayout, stageFlags, data, offset);
+		}
+
 		VkCommandBuffer GetCommandBuffer() const;
 	};
 }
@@ -0,0 +1,92 @@
+﻿/*!
+\file		VulkanComputePipeline.cpp
+\date		19/10/2026
+
+\author		Adrian Tan
+\email		t.xingkhiangadrian\@digipen.edu
+
+\brief		Contains implementation for VulkanComputePipeline class functions.
+
+\copyright	All content © 2023 DigiPen (SINGAPORE) Corporation, all rights reserved.
+			Reproduction or disclosure of this file or its contents without the
+			prior written consent of DigiPen Institute of Technology is prohibited.
+__________________________________________________________________________________*/
+
+#include "meowpch.h"
+
+#include "VulkanComputePipeline.h"
+#include "VulkanLogicalDevice.h"
+
+namespace Nya
+{
+	void VulkanComputePipeline::Init(const VulkanComputePipelineConfig& config)
+	{
+		//-- Shader.
+		const auto shaderCode = ReadShaderFile(config.m_ShaderPath);
+		VkShaderModule shaderModule = CreateShaderModule(shaderCode);
+
+		VkPipelineShaderStageCreateInfo shaderStageInfo{};
+		shaderStageInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+		shaderStageInfo.stage = VK_SHADER_STAGE_COMPUTE_BIT;
+		shaderStageInfo.module = shaderModule;
+		shaderStageInfo.pName = "main";
+
+		//-- Create pipeline layout.
+		VkPipelineLayoutCreateInfo pipelineLayout{};
+		pipelineLayout.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+		pipelineLayout.setLayoutCount = static_cast<uint32_t>(config.m_SetLayouts.size());
+		pipelineLayout.pSetLayouts = config.m_SetLayouts.data();
+		pipelineLayout.pushConstantRangeCount = static_cast<uint32_t>(config.m_PushConstantRanges.size());
+		pipelineLayout.pPushConstantRanges = config.m_PushConstantRanges.data();
+
+		if (vkCreatePipelineLayout(VulkanLogicalDevice::Get().GetLogicalDevice(), &pipelineLayout, nullptr, &m_PipelineLayout) != VK_SUCCESS)
+			throw std::runtime_error("Failed to create compute pipeline layout!");
+
+		//-- Create pipeline.
+		VkComputePipelineCreateInfo pipelineInfo{};
+		pipelineInfo.sType = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO;
+		pipelineInfo.stage = shaderStageInfo;
+		pipelineInfo.layout = m_PipelineLayout;
+		pipelineInfo.basePipelineHandle = VK_NULL_HANDLE;
+
+		if (vkCreateComputePipelines(VulkanLogicalDevice::Get().GetLogicalDevice(), VK_NULL_HANDLE, 1, &pipelineInfo, nullptr, &m_Pipeline) != VK_SUCCESS)
+			throw std::runtime_error("Failed to create compute pipeline [" + config.m_ShaderPath + "]!");
+
+		//-- Cleanup.
+		vkDestroyShaderModule(VulkanLogicalDevice::Get().GetLogicalDevice(), shaderModule, nullptr);
+	}
+
+	void VulkanComputePipeline::Cleanup() const
+	{
+		vkDestroyPipeline(VulkanLogicalDevice::Get().GetLogicalDevice(), m_Pipeline, nullptr);
+		vkDestroyPipelineLayout(VulkanLogicalDevice::Get().GetLogicalDevice(), m_PipelineLayout, nullptr);
+	}
+
+	void VulkanComputePipeline::Bind(VkCommandBuffer commandBuffer) const
+	{
+		vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, m_Pipeline);
+	}
+
+	void VulkanComputePipeline::BindDescriptorSet(VkCommandBuffer commandBuffer, VkDescriptorSet descriptorSet, const uint32_t setIndex) const
+	{
+		vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, m_PipelineLayout, setIndex, 1, &descriptorSet, 0, nullptr);
+	}
+
+	void VulkanComputePipeline::Dispatch(VkCommandBuffer commandBuffer, const uint32_t invocationCount, const uint32_t groupSize)
+	{
+		if (invocationCount == 0)
+			return;
+
+		vkCmdDispatch(commandBuffer, (invocationCount + groupSize - 1) / groupSize, 1, 1);
+	}
+
+	VkPipeline VulkanComputePipeline::GetPipeline() const
+	{
+		return m_Pipeline;
+	}
+
+	VkPipelineLayout VulkanComputePipeline::GetLayout() const
+	{
+		return m_PipelineLayout;
+	}
+}
@@ -0,0 +1,60 @@
+﻿/*!
+\file		VulkanComputePipeline.h
+\date		19/10/2026
+
+\author		Adrian Tan
+\email		t.xingkhiangadrian\@digipen.edu
+
+\brief		Contains definition of VulkanComputePipeline class.
+
+\copyright	All content © 2023 DigiPen (SINGAPORE) Corporation, all rights reserved.
+			Reproduction or disclosure of this file or its contents without the
+			prior written consent of DigiPen Institute of Technology is prohibited.
+__________________________________________________________________________________*/
+#pragma once
+
+#include "VulkanPipeline.h"
+
+namespace Nya
+{
+	struct VulkanComputePipelineConfig
+	{
+		std::string m_ShaderPath;
+
+		std::vector<VkDescriptorSetLayout> m_SetLayouts;
+		std::vector<VkPushConstantRange> m_PushConstantRanges;
+
+		template <typename T>
+		VulkanComputePipelineConfig& AddPushConstant(const uint32_t offset = 0)
+		{
+			m_PushConstantRanges.push_back(MakePushConstantRange<T>(VK_SHADER_STAGE_COMPUTE_BIT, offset));
+			return *this;
+		}
+	};
+
+	class VulkanComputePipeline
+	{
+		VkPipelineLayout m_PipelineLayout{};
+		VkPipeline m_Pipeline{};
+
+	public:
+		void Init(const VulkanComputePipelineConfig& config);
+		void Cleanup() const;
+
+		void Bind(VkCommandBuffer commandBuffer) const;
+		void BindDescriptorSet(VkCommandBuffer commandBuffer, VkDescriptorSet descriptorSet, uint32_t setIndex = 0) const;
+
+		template <typename T>
+		void PushConstants(VkCommandBuffer commandBuffer, const T& data, const uint32_t offset = 0) const
+		{
+			static_assert(std::is_trivially_copyable_v<T>, "Push constant data must be trivially copyable!");
+			vkCmdPushConstants(commandBuffer, m_PipelineLayout, VK_SHADER_STAGE_COMPUTE_BIT, offset, static_cast<uint32_t>(sizeof(T)), &data);
+		}
+
+		// Dispatches enough groups of groupSize invocations to cover invocationCount.
+		static void Dispatch(VkCommandBuffer commandBuffer, uint32_t invocationCount, uint32_t groupSize);
+
+		VkPipeline GetPipeline() const;
+		VkPipelineLayout GetLayout() const;
+	};
+}
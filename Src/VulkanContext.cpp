@@ -50,7 +50,7 @@ namespace Nya
 		appInfo.applicationVersion = VK_MAKE_VERSION(1, 0, 0);
 		appInfo.pEngineName = "MEOW";
 		appInfo.engineVersion = VK_MAKE_VERSION(1, 0, 0);
-		appInfo.apiVersion = VK_API_VERSION_1_0;
+		appInfo.apiVersion = VK_API_VERSION_1_1; // 1.1 for vkGetPhysicalDeviceFeatures2.
 
 		// Create info for vulkan instance.
 		VkInstanceCreateInfo createInfo{};
@@ -38,7 +38,18 @@ namespace Nya
 		VK_KHR_SWAPCHAIN_EXTENSION_NAME
 	};
 
+	// Optional Device Extensions, only enabled if the selected GPU supports them.
+	const std::vector<const char*> g_OptionalDeviceExtensions =
+	{
+		VK_EXT_DESCRIPTOR_INDEXING_EXTENSION_NAME,
+		VK_KHR_DRAW_INDIRECT_COUNT_EXTENSION_NAME
+	};
+
 	// Max pre-rendered frames.
 	constexpr int g_MaxFramesInFlight = 2;
 
+	// Bindless descriptor array sizes (clamped to device limits at runtime).
+	constexpr uint32_t g_MaxBindlessImages = 16384;
+	constexpr uint32_t g_MaxBindlessBuffers = 4096;
+
 }
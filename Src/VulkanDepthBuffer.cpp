@@ -0,0 +1,123 @@
+﻿/*!
+\file		VulkanDepthBuffer.cpp
+\date		19/10/2026
+
+\author		Adrian Tan
+\email		t.xingkhiangadrian\@digipen.edu
+
+\brief		Contains implementation for VulkanDepthBuffer class functions.
+
+\copyright	All content © 2023 DigiPen (SINGAPORE) Corporation, all rights reserved.
+			Reproduction or disclosure of this file or its contents without the
+			prior written consent of DigiPen Institute of Technology is prohibited.
+__________________________________________________________________________________*/
+
+#include "meowpch.h"
+
+#include "VulkanDepthBuffer.h"
+#include "VulkanLogicalDevice.h"
+#include "VulkanPhysicalDevice.h"
+#include "VulkanQuery.h"
+
+namespace Nya
+{
+	void VulkanDepthBuffer::Init(const uint32_t width, const uint32_t height)
+	{
+		m_Format = FindFormat();
+		m_Width = width;
+		m_Height = height;
+		CreateImage();
+	}
+
+	void VulkanDepthBuffer::Cleanup() const
+	{
+		const VkDevice device = VulkanLogicalDevice::Get().GetLogicalDevice();
+
+		vkDestroyImageView(device, m_View, nullptr);
+		vkDestroyImage(device, m_Image, nullptr);
+		vkFreeMemory(device, m_ImageMemory, nullptr);
+	}
+
+	void VulkanDepthBuffer::Resize(const uint32_t width, const uint32_t height)
+	{
+		Cleanup();
+
+		m_Width = width;
+		m_Height = height;
+		CreateImage();
+	}
+
+	void VulkanDepthBuffer::CreateImage()
+	{
+		const VkDevice device = VulkanLogicalDevice::Get().GetLogicalDevice();
+
+		//-- Image.
+		VkImageCreateInfo imageInfo{};
+		imageInfo.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+		imageInfo.imageType = VK_IMAGE_TYPE_2D;
+		imageInfo.format = m_Format;
+		imageInfo.extent = { m_Width, m_Height, 1 };
+		imageInfo.mipLevels = 1;
+		imageInfo.arrayLayers = 1;
+		imageInfo.samples = VK_SAMPLE_COUNT_1_BIT;
+		imageInfo.tiling = VK_IMAGE_TILING_OPTIMAL;
+		imageInfo.usage = VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT | VK_IMAGE_USAGE_SAMPLED_BIT;	// Sampled by the Hi-Z build.
+		imageInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+		imageInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+
+		if (vkCreateImage(device, &imageInfo, nullptr, &m_Image) != VK_SUCCESS)
+			throw std::runtime_error("Failed to create depth image!");
+
+		VkMemoryRequirements memRequirements;
+		vkGetImageMemoryRequirements(device, m_Image, &memRequirements);
+
+		VkMemoryAllocateInfo allocInfo{};
+		allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+		allocInfo.allocationSize = memRequirements.size;
+		allocInfo.memoryTypeIndex = VulkanQuery::FindMemoryType(VulkanPhysicalDevice::Get().GetPhysicalDevice(), memRequirements.memoryTypeBits, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+
+		if (vkAllocateMemory(device, &allocInfo, nullptr, &m_ImageMemory) != VK_SUCCESS)
+			throw std::runtime_error("Failed to allocate memory for depth image!");
+		vkBindImageMemory(device, m_Image, m_ImageMemory, 0);
+
+		//-- View.
+		VkImageViewCreateInfo viewInfo{};
+		viewInfo.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
+		viewInfo.image = m_Image;
+		viewInfo.viewType = VK_IMAGE_VIEW_TYPE_2D;
+		viewInfo.format = m_Format;
+		viewInfo.subresourceRange = { VK_IMAGE_ASPECT_DEPTH_BIT, 0, 1, 0, 1 };
+
+		if (vkCreateImageView(device, &viewInfo, nullptr, &m_View) != VK_SUCCESS)
+			throw std::runtime_error("Failed to create depth image view!");
+	}
+
+	VkFormat VulkanDepthBuffer::FindFormat()
+	{
+		for (const VkFormat format : { VK_FORMAT_D32_SFLOAT, VK_FORMAT_D16_UNORM })
+		{
+			VkFormatProperties properties;
+			vkGetPhysicalDeviceFormatProperties(VulkanPhysicalDevice::Get().GetPhysicalDevice(), format, &properties);
+			constexpr VkFormatFeatureFlags required = VK_FORMAT_FEATURE_DEPTH_STENCIL_ATTACHMENT_BIT | VK_FORMAT_FEATURE_SAMPLED_IMAGE_BIT;
+			if ((properties.optimalTilingFeatures & required) == required)
+				return format;
+		}
+
+		throw std::runtime_error("GPU has no usable depth format!");
+	}
+
+	VkImage VulkanDepthBuffer::GetImage() const
+	{
+		return m_Image;
+	}
+
+	VkImageView VulkanDepthBuffer::GetView() const
+	{
+		return m_View;
+	}
+
+	VkFormat VulkanDepthBuffer::GetFormat() const
+	{
+		return m_Format;
+	}
+}
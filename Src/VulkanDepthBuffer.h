@@ -0,0 +1,47 @@
+﻿/*!
+\file		VulkanDepthBuffer.h
+\date		19/10/2026
+
+\author		Adrian Tan
+\email		t.xingkhiangadrian\@digipen.edu
+
+\brief		Contains definition of VulkanDepthBuffer class.
+
+\copyright	All content © 2023 DigiPen (SINGAPORE) Corporation, all rights reserved.
+			Reproduction or disclosure of this file or its contents without the
+			prior written consent of DigiPen Institute of Technology is prohibited.
+__________________________________________________________________________________*/
+#pragma once
+
+#include "VulkanDefines.h"
+
+namespace Nya
+{
+	// Depth attachment sized to the swapchain. Render passes clear or load it, so it never needs an explicit transition.
+	class VulkanDepthBuffer
+	{
+		VkImage m_Image{};
+		VkDeviceMemory m_ImageMemory{};
+		VkImageView m_View{};
+
+		VkFormat m_Format = VK_FORMAT_UNDEFINED;
+		uint32_t m_Width = 0;
+		uint32_t m_Height = 0;
+
+		void CreateImage();
+
+	public:
+		void Init(uint32_t width, uint32_t height);
+		void Cleanup() const;
+
+		// Recreates the image for a new size, e.g. after a swapchain resize. Only call while it is not in flight.
+		void Resize(uint32_t width, uint32_t height);
+
+		// D32_SFLOAT, or D16_UNORM where that is not usable as a sampled optimal tiling depth attachment.
+		static VkFormat FindFormat();
+
+		VkImage GetImage() const;
+		VkImageView GetView() const;
+		VkFormat GetFormat() const;
+	};
+}
@@ -0,0 +1,211 @@
+﻿/*!
+\file		VulkanDescriptorCache.cpp
+\date		19/10/2026
+
+\author		Adrian Tan
+\email		t.xingkhiangadrian\@digipen.edu
+
+\brief		Contains implementation for VulkanDescriptorCache class functions.
+
+\copyright	All content © 2023 DigiPen (SINGAPORE) Corporation, all rights reserved.
+			Reproduction or disclosure of this file or its contents without the
+			prior written consent of DigiPen Institute of Technology is prohibited.
+__________________________________________________________________________________*/
+
+#include "meowpch.h"
+
+#include "VulkanDescriptorCache.h"
+#include "VulkanLogicalDevice.h"
+
+namespace Nya
+{
+	//-- DescriptorResource Functions.
+	DescriptorResource DescriptorResource::Image(const VkSampler sampler, const VkImageView imageView, const VkImageLayout imageLayout)
+	{
+		DescriptorResource resource;
+		resource.m_Image.sampler = sampler;
+		resource.m_Image.imageView = imageView;
+		resource.m_Image.imageLayout = imageLayout;
+		return resource;
+	}
+
+	DescriptorResource DescriptorResource::Buffer(const VkBuffer buffer, const VkDeviceSize offset, const VkDeviceSize range)
+	{
+		DescriptorResource resource;
+		resource.m_Buffer.buffer = buffer;
+		resource.m_Buffer.offset = offset;
+		resource.m_Buffer.range = range;
+		return resource;
+	}
+
+	DescriptorResource DescriptorResource::TexelBuffer(const VkBufferView bufferView)
+	{
+		DescriptorResource resource;
+		resource.m_TexelBufferView = bufferView;
+		return resource;
+	}
+
+
+	//-- VulkanDescriptorCache Functions.
+	size_t VulkanDescriptorCache::ResourceHash::operator()(const std::vector<DescriptorResource>& resources) const
+	{
+		// FNV-1a over the raw handles, resources are zero-padded so this is stable.
+		const auto* bytes = reinterpret_cast<const uint8_t*>(resources.data());
+		const size_t byteCount = resources.size() * sizeof(DescriptorResource);
+
+		uint64_t hash = 14695981039346656037ull;
+		for (size_t i = 0; i < byteCount; ++i)
+		{
+			hash ^= bytes[i];
+			hash *= 1099511628211ull;
+		}
+
+		return static_cast<size_t>(hash);
+	}
+
+	void VulkanDescriptorCache::CreatePool()
+	{
+		// Enough descriptors of each type for m_SetsPerPool sets.
+		std::map<VkDescriptorType, uint32_t> typeCounts;
+		for (const auto& binding : m_Bindings)
+			typeCounts[binding.descriptorType] += binding.descriptorCount * m_SetsPerPool;
+
+		std::vector<VkDescriptorPoolSize> poolSizes;
+		for (const auto& [type, count] : typeCounts)
+			poolSizes.push_back({ type, count });
+
+		VkDescriptorPoolCreateInfo poolInfo{};
+		poolInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+		poolInfo.poolSizeCount = static_cast<uint32_t>(poolSizes.size());
+		poolInfo.pPoolSizes = poolSizes.data();
+		poolInfo.maxSets = m_SetsPerPool;
+
+		VkDescriptorPool pool;
+		if (vkCreateDescriptorPool(VulkanLogicalDevice::Get().GetLogicalDevice(), &poolInfo, nullptr, &pool) != VK_SUCCESS)
+			throw std::runtime_error("Failed to create descriptor pool for descriptor cache!");
+
+		m_Pools.push_back(pool);
+		m_SetsInCurrentPool = 0;
+	}
+
+	VkDescriptorSet VulkanDescriptorCache::AllocateSet()
+	{
+		if (m_Pools.empty() || m_SetsInCurrentPool >= m_SetsPerPool)
+			CreatePool();
+
+		VkDescriptorSetAllocateInfo allocInfo{};
+		allocInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+		allocInfo.descriptorPool = m_Pools.back();
+		allocInfo.descriptorSetCount = 1;
+		allocInfo.pSetLayouts = &m_SetLayout;
+
+		VkDescriptorSet descriptorSet;
+		if (vkAllocateDescriptorSets(VulkanLogicalDevice::Get().GetLogicalDevice(), &allocInfo, &descriptorSet) != VK_SUCCESS)
+			throw std::runtime_error("Failed to allocate descriptor set for descriptor cache!");
+
+		++m_SetsInCurrentPool;
+		return descriptorSet;
+	}
+
+	void VulkanDescriptorCache::Init(const std::vector<VkDescriptorSetLayoutBinding>& bindings, const uint32_t setsPerPool)
+	{
+		m_Bindings = bindings;
+		m_SetsPerPool = setsPerPool;
+
+		//-- Set layout.
+		VkDescriptorSetLayoutCreateInfo layoutInfo{};
+		layoutInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+		layoutInfo.bindingCount = static_cast<uint32_t>(m_Bindings.size());
+		layoutInfo.pBindings = m_Bindings.data();
+
+		if (vkCreateDescriptorSetLayout(VulkanLogicalDevice::Get().GetLogicalDevice(), &layoutInfo, nullptr, &m_SetLayout) != VK_SUCCESS)
+			throw std::runtime_error("Failed to create descriptor set layout for descriptor cache!");
+
+		//-- Update template, one entry per binding, reading a tightly packed DescriptorResource array.
+		std::vector<VkDescriptorUpdateTemplateEntry> entries;
+		m_DescriptorCount = 0;
+		for (const auto& binding : m_Bindings)
+		{
+			VkDescriptorUpdateTemplateEntry entry{};
+			entry.dstBinding = binding.binding;
+			entry.dstArrayElement = 0;
+			entry.descriptorCount = binding.descriptorCount;
+			entry.descriptorType = binding.descriptorType;
+			entry.offset = m_DescriptorCount * sizeof(DescriptorResource);
+			entry.stride = sizeof(DescriptorResource);
+			entries.push_back(entry);
+
+			m_DescriptorCount += binding.descriptorCount;
+		}
+
+		VkDescriptorUpdateTemplateCreateInfo templateInfo{};
+		templateInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_UPDATE_TEMPLATE_CREATE_INFO;
+		templateInfo.descriptorUpdateEntryCount = static_cast<uint32_t>(entries.size());
+		templateInfo.pDescriptorUpdateEntries = entries.data();
+		templateInfo.templateType = VK_DESCRIPTOR_UPDATE_TEMPLATE_TYPE_DESCRIPTOR_SET;
+		templateInfo.descriptorSetLayout = m_SetLayout;
+
+		if (vkCreateDescriptorUpdateTemplate(VulkanLogicalDevice::Get().GetLogicalDevice(), &templateInfo, nullptr, &m_UpdateTemplate) != VK_SUCCESS)
+			throw std::runtime_error("Failed to create descriptor update template!");
+	}
+
+	void VulkanDescriptorCache::Cleanup() const
+	{
+		for (const auto pool : m_Pools)
+			vkDestroyDescriptorPool(VulkanLogicalDevice::Get().GetLogicalDevice(), pool, nullptr);
+
+		vkDestroyDescriptorUpdateTemplate(VulkanLogicalDevice::Get().GetLogicalDevice(), m_UpdateTemplate, nullptr);
+		vkDestroyDescriptorSetLayout(VulkanLogicalDevice::Get().GetLogicalDevice(), m_SetLayout, nullptr);
+	}
+
+	VkDescriptorSet VulkanDescriptorCache::Request(const std::vector<DescriptorResource>& resources)
+	{
+		if (resources.size() != m_DescriptorCount)
+			throw std::runtime_error("Descriptor cache request doesn't match the set layout!");
+
+		// Same resources as before, reuse the set that already points at them.
+		if (const auto it = m_Sets.find(resources); it != m_Sets.end())
+			return it->second;
+
+		const VkDescriptorSet descriptorSet = AllocateSet();
+		vkUpdateDescriptorSetWithTemplate(VulkanLogicalDevice::Get().GetLogicalDevice(), descriptorSet, m_UpdateTemplate, resources.data());
+
+		m_Sets.emplace(resources, descriptorSet);
+		return descriptorSet;
+	}
+
+	void VulkanDescriptorCache::Reset()
+	{
+		for (const auto pool : m_Pools)
+			vkResetDescriptorPool(VulkanLogicalDevice::Get().GetLogicalDevice(), pool, 0);
+
+		// Keep the first pool around, the rest get recreated on demand.
+		for (size_t i = 1; i < m_Pools.size(); ++i)
+			vkDestroyDescriptorPool(VulkanLogicalDevice::Get().GetLogicalDevice(), m_Pools[i], nullptr);
+		if (m_Pools.size() > 1)
+			m_Pools.resize(1);
+
+		m_SetsInCurrentPool = 0;
+		m_Sets.clear();
+	}
+
+	VkDescriptorSetLayout VulkanDescriptorCache::GetLayout() const
+	{
+		return m_SetLayout;
+	}
+
+	VkDescriptorUpdateTemplate VulkanDescriptorCache::GetUpdateTemplate() const
+	{
+		return m_UpdateTemplate;
+	}
+
+	uint32_t VulkanDescriptorCache::GetDescriptorCount() const
+	{
+		return m_DescriptorCount;
+	}
+
+	size_t VulkanDescriptorCache::GetCachedSetCount() const
+	{
+		return m_Sets.size();
+	}
+}
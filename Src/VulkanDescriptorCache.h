@@ -0,0 +1,84 @@
+﻿/*!
+\file		VulkanDescriptorCache.h
+\date		19/10/2026
+
+\author		Adrian Tan
+\email		t.xingkhiangadrian\@digipen.edu
+
+\brief		Contains definition of VulkanDescriptorCache class.
+
+\copyright	All content © 2023 DigiPen (SINGAPORE) Corporation, all rights reserved.
+			Reproduction or disclosure of this file or its contents without the
+			prior written consent of DigiPen Institute of Technology is prohibited.
+__________________________________________________________________________________*/
+#pragma once
+
+#include "VulkanDefines.h"
+
+#include <cstring>
+
+namespace Nya
+{
+	// One descriptor's worth of resource data, in the layout the update template reads.
+	// Always zero-filled, so two resources can be compared and hashed bytewise.
+	struct DescriptorResource
+	{
+		// m_Buffer has no padding and spans the whole union, so value-initializing it zeroes every byte.
+		union
+		{
+			VkDescriptorBufferInfo m_Buffer{};
+			VkDescriptorImageInfo m_Image;
+			VkBufferView m_TexelBufferView;
+		};
+
+		static DescriptorResource Image(VkSampler sampler, VkImageView imageView, VkImageLayout imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+		static DescriptorResource Buffer(VkBuffer buffer, VkDeviceSize offset = 0, VkDeviceSize range = VK_WHOLE_SIZE);
+		static DescriptorResource TexelBuffer(VkBufferView bufferView);
+
+		bool operator==(const DescriptorResource& other) const
+		{
+			return std::memcmp(this, &other, sizeof(DescriptorResource)) == 0;
+		}
+	};
+	static_assert(sizeof(DescriptorResource) == sizeof(VkDescriptorBufferInfo), "DescriptorResource must be exactly as big as the member it zeroes!");
+
+	// Builds a descriptor update template from a set layout, and hands back an
+	// existing set whenever the same resources are requested again.
+	class VulkanDescriptorCache
+	{
+		struct ResourceHash
+		{
+			size_t operator()(const std::vector<DescriptorResource>& resources) const;
+		};
+
+		VkDescriptorSetLayout m_SetLayout{};
+		VkDescriptorUpdateTemplate m_UpdateTemplate{};
+
+		std::vector<VkDescriptorSetLayoutBinding> m_Bindings;
+		uint32_t m_DescriptorCount = 0;	// Total descriptors across all bindings, i.e. resources per set.
+
+		std::vector<VkDescriptorPool> m_Pools;
+		uint32_t m_SetsPerPool = 0;
+		uint32_t m_SetsInCurrentPool = 0;
+
+		std::unordered_map<std::vector<DescriptorResource>, VkDescriptorSet, ResourceHash> m_Sets;
+
+		void CreatePool();
+		VkDescriptorSet AllocateSet();
+
+	public:
+		void Init(const std::vector<VkDescriptorSetLayoutBinding>& bindings, uint32_t setsPerPool = 64);
+		void Cleanup() const;
+
+		// Resources are ordered by binding, then by array element within a binding.
+		VkDescriptorSet Request(const std::vector<DescriptorResource>& resources);
+
+		// Drops every cached set. Only safe once none of them are in flight.
+		void Reset();
+
+		VkDescriptorSetLayout GetLayout() const;
+		VkDescriptorUpdateTemplate GetUpdateTemplate() const;
+		uint32_t GetDescriptorCount() const;
+		size_t GetCachedSetCount() const;
+	};
+}
@@ -0,0 +1,123 @@
+﻿/*!
+\file		VulkanDrawList.cpp
+\date		19/10/2026
+
+\author		Adrian Tan
+\email		t.xingkhiangadrian\@digipen.edu
+
+\brief		Contains implementation for VulkanDrawList class functions.
+
+\copyright	All content © 2023 DigiPen (SINGAPORE) Corporation, all rights reserved.
+			Reproduction or disclosure of this file or its contents without the
+			prior written consent of DigiPen Institute of Technology is prohibited.
+__________________________________________________________________________________*/
+
+#include "meowpch.h"
+
+#include "VulkanDrawList.h"
+#include "VulkanIndexBuffer.h"
+#include "VulkanMeshBuffer.h"
+#include "VulkanPipeline.h"
+
+namespace Nya
+{
+	uint32_t VulkanDrawList::AddPipeline(const VulkanPipeline& pipeline)
+	{
+		m_Pipelines.push_back(&pipeline);
+		return static_cast<uint32_t>(m_Pipelines.size() - 1);
+	}
+
+	uint32_t VulkanDrawList::AddMaterial(const VkDescriptorSet descriptorSet, const uint32_t setIndex)
+	{
+		m_Materials.push_back({ descriptorSet, setIndex });
+		return static_cast<uint32_t>(m_Materials.size() - 1);
+	}
+
+	uint32_t VulkanDrawList::AddMesh(const VulkanMeshBuffer& meshBuffer, const VulkanIndexBuffer& indexBuffer)
+	{
+		m_Meshes.push_back({ &meshBuffer, &indexBuffer });
+		return static_cast<uint32_t>(m_Meshes.size() - 1);
+	}
+
+	void VulkanDrawList::Clear()
+	{
+		m_Pipelines.clear();
+		m_Materials.clear();
+		m_Meshes.clear();
+	}
+
+	DrawListStats VulkanDrawList::Record(const VkCommandBuffer commandBuffer, const DrawList& drawList, const uint32_t pass) const
+	{
+		DrawListStats stats;
+
+		const VulkanPipeline* boundPipeline = nullptr;
+		VkPipelineLayout boundLayout = VK_NULL_HANDLE;
+		uint32_t boundMaterial = DrawPacket::s_None;
+		uint32_t boundMesh = DrawPacket::s_None;
+		uint32_t boundDrawData = DrawPacket::s_None;
+
+		const auto [first, last] = drawList.GetPassRange(pass);
+		for (uint32_t position = first; position < last; ++position)
+		{
+			const DrawPacket& packet = drawList.GetSortedPacket(position);
+
+			//-- Pipeline. Sets and push constants survive a pipeline change only if the layout matches.
+			const VulkanPipeline* pipeline = m_Pipelines[packet.m_Pipeline];
+			if (pipeline != boundPipeline)
+			{
+				vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline->GetPipeline());
+				boundPipeline = pipeline;
+				++stats.m_PipelineBinds;
+
+				if (pipeline->GetLayout() != boundLayout)
+				{
+					boundLayout = pipeline->GetLayout();
+					boundMaterial = DrawPacket::s_None;
+					boundDrawData = DrawPacket::s_None;
+				}
+			}
+			else
+				++stats.m_SkippedBinds;
+
+			//-- Material descriptor set.
+			if (packet.m_Material != DrawPacket::s_None)
+			{
+				if (packet.m_Material != boundMaterial)
+				{
+					const Material& material = m_Materials[packet.m_Material];
+					vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, boundLayout, material.m_SetIndex, 1, &material.m_DescriptorSet, 0, nullptr);
+					boundMaterial = packet.m_Material;
+					++stats.m_MaterialBinds;
+				}
+				else
+					++stats.m_SkippedBinds;
+			}
+
+			//-- Vertex and index buffers.
+			const Mesh& mesh = m_Meshes[packet.m_Mesh];
+			if (packet.m_Mesh != boundMesh)
+			{
+				mesh.m_MeshBuffer->Bind(commandBuffer, VertexStreams::All);
+				vkCmdBindIndexBuffer(commandBuffer, mesh.m_IndexBuffer->GetBuffer(), 0, mesh.m_IndexBuffer->GetIndexType());
+				boundMesh = packet.m_Mesh;
+				++stats.m_MeshBinds;
+			}
+			else
+				++stats.m_SkippedBinds;
+
+			//-- Per-draw data.
+			if (packet.m_DrawData != DrawPacket::s_None && packet.m_DrawData != boundDrawData)
+			{
+				pipeline->PushConstants(commandBuffer, drawList.GetDrawData(packet.m_DrawData));
+				boundDrawData = packet.m_DrawData;
+				++stats.m_PushConstants;
+			}
+
+			const uint32_t indexCount = packet.m_IndexCount ? packet.m_IndexCount : mesh.m_IndexBuffer->GetIndexCount();
+			vkCmdDrawIndexed(commandBuffer, indexCount, packet.m_InstanceCount, packet.m_FirstIndex, packet.m_VertexOffset, packet.m_FirstInstance);
+			++stats.m_Draws;
+		}
+
+		return stats;
+	}
+}
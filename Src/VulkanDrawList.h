@@ -0,0 +1,68 @@
+﻿/*!
+\file		VulkanDrawList.h
+\date		19/10/2026
+
+\author		Adrian Tan
+\email		t.xingkhiangadrian\@digipen.edu
+
+\brief		Contains definition of VulkanDrawList class.
+
+\copyright	All content © 2023 DigiPen (SINGAPORE) Corporation, all rights reserved.
+			Reproduction or disclosure of this file or its contents without the
+			prior written consent of DigiPen Institute of Technology is prohibited.
+__________________________________________________________________________________*/
+#pragma once
+
+#include "DrawList.h"
+
+#include <vulkan/vulkan_core.h>
+
+namespace Nya
+{
+	class VulkanIndexBuffer;
+	class VulkanMeshBuffer;
+	class VulkanPipeline;
+
+	// Commands recorded for one pass of a draw list, and the binds that were skipped as redundant.
+	struct DrawListStats
+	{
+		uint32_t m_Draws = 0;
+		uint32_t m_PipelineBinds = 0;
+		uint32_t m_MaterialBinds = 0;
+		uint32_t m_MeshBinds = 0;
+		uint32_t m_PushConstants = 0;
+		uint32_t m_SkippedBinds = 0;
+	};
+
+	// Translates sorted DrawList packets into Vulkan commands, resolving packet ids through its resource
+	// tables and only binding state that differs from the previous packet.
+	class VulkanDrawList
+	{
+		struct Material
+		{
+			VkDescriptorSet m_DescriptorSet = VK_NULL_HANDLE;
+			uint32_t m_SetIndex = 0;
+		};
+
+		struct Mesh
+		{
+			const VulkanMeshBuffer* m_MeshBuffer = nullptr;
+			const VulkanIndexBuffer* m_IndexBuffer = nullptr;
+		};
+
+		std::vector<const VulkanPipeline*> m_Pipelines;
+		std::vector<Material> m_Materials;
+		std::vector<Mesh> m_Meshes;
+
+	public:
+		// Resources must outlive the draw list. Returned ids go in DrawPacket and DrawKey.
+		uint32_t AddPipeline(const VulkanPipeline& pipeline);
+		uint32_t AddMaterial(VkDescriptorSet descriptorSet, uint32_t setIndex = 1);
+		uint32_t AddMesh(const VulkanMeshBuffer& meshBuffer, const VulkanIndexBuffer& indexBuffer);
+
+		void Clear();
+
+		// Records a sorted draw list's packets of one pass, inside the caller's render pass.
+		DrawListStats Record(VkCommandBuffer commandBuffer, const DrawList& drawList, uint32_t pass = 0) const;
+	};
+}
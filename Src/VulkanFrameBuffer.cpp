@@ -20,11 +20,12 @@ ________________________________________________________________________________
 
 namespace Nya
 {
-	void VulkanFramebuffer::Init(size_t index, VkImageView attachments[], VkRenderPass renderPass)
+	void VulkanFramebuffer::Init(size_t index, VkImageView attachments[], VkRenderPass renderPass, const uint32_t attachmentCount)
 	{
 		VkFramebufferCreateInfo framebufferInfo{};
 		framebufferInfo.sType = VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO;
 		framebufferInfo.renderPass = renderPass;
+		framebufferInfo.attachmentCount = attachmentCount;
 		framebufferInfo.pAttachments = attachments;
 		framebufferInfo.width = VulkanSwapchain::Get().GetSwapChainImageExtents().width;
 		framebufferInfo.height = VulkanSwapchain::Get().GetSwapChainImageExtents().height;
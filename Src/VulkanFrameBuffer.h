@@ -26,7 +26,7 @@ namespace Nya
 		VkFramebuffer m_Framebuffer{};
 
 	public:
-		void Init(size_t index, VkImageView attachments[], VkRenderPass renderPass);
+		void Init(size_t index, VkImageView attachments[], VkRenderPass renderPass, uint32_t attachmentCount = 1);
 		void Cleanup() const;
 
 		VkFramebuffer GetFramebuffer() const;
@@ -0,0 +1,26 @@
+﻿/*!
+\file		VulkanGeometryBuffer.cpp
+\date		19/10/2026
+
+\author		Adrian Tan
+\email		t.xingkhiangadrian\@digipen.edu
+
+\brief		Contains implementation for VulkanGeometryBuffer class functions.
+
+\copyright	All content © 2023 DigiPen (SINGAPORE) Corporation, all rights reserved.
+			Reproduction or disclosure of this file or its contents without the
+			prior written consent of DigiPen Institute of Technology is prohibited.
+__________________________________________________________________________________*/
+
+#include "meowpch.h"
+
+#include "VulkanGeometryBuffer.h"
+
+namespace Nya
+{
+	void VulkanGeometryBuffer::Init(const VkDeviceSize size, VkCommandPool commandPool, const StagingWriteFn& writeStaging)
+	{
+		constexpr VkBufferUsageFlags usage = VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_INDEX_BUFFER_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
+		CreateDeviceLocalBuffer(size, usage, commandPool, writeStaging);
+	}
+}
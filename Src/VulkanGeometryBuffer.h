@@ -0,0 +1,27 @@
+﻿/*!
+\file		VulkanGeometryBuffer.h
+\date		19/10/2026
+
+\author		Adrian Tan
+\email		t.xingkhiangadrian\@digipen.edu
+
+\brief		Contains definition of VulkanGeometryBuffer class.
+
+\copyright	All content © 2023 DigiPen (SINGAPORE) Corporation, all rights reserved.
+			Reproduction or disclosure of this file or its contents without the
+			prior written consent of DigiPen Institute of Technology is prohibited.
+__________________________________________________________________________________*/
+#pragma once
+
+#include "VulkanBuffers.h"
+
+namespace Nya
+{
+	// Device local buffer usable as vertex, index and storage buffer at the same time,
+	// so a whole model's streams can share one allocation and be bound by offset.
+	class VulkanGeometryBuffer : public VulkanBuffer
+	{
+	public:
+		void Init(VkDeviceSize size, VkCommandPool commandPool, const StagingWriteFn& writeStaging);
+	};
+}
@@ -0,0 +1,398 @@
+﻿/*!
+\file		VulkanGltfScene.cpp
+\date		19/10/2026
+
+\author		Adrian Tan
+\email		t.xingkhiangadrian\@digipen.edu
+
+\brief		Contains implementation for VulkanGltfScene class functions.
+
+\copyright	All content © 2023 DigiPen (SINGAPORE) Corporation, all rights reserved.
+			Reproduction or disclosure of this file or its contents without the
+			prior written consent of DigiPen Institute of Technology is prohibited.
+__________________________________________________________________________________*/
+
+#include "meowpch.h"
+
+#include "VulkanGltfScene.h"
+#include "VulkanMeshletCuller.h"
+#include "MeshOptimizer.h"
+
+namespace Nya
+{
+	//-- Helpers.
+	namespace
+	{
+		// Keeps every stream aligned for any vertex format and index type.
+		constexpr VkDeviceSize s_StreamAlignment = 16;
+		// Largest minStorageBufferOffsetAlignment Vulkan allows, for data bound as a storage buffer.
+		constexpr VkDeviceSize s_StorageAlignment = 256;
+
+		VkDeviceSize AlignUp(const VkDeviceSize value, const VkDeviceSize alignment)
+		{
+			return (value + alignment - 1) & ~(alignment - 1);
+		}
+
+		// A block of the geometry buffer copied as-is from the mapped file.
+		struct UploadRegion
+		{
+			VkDeviceSize m_DstOffset = 0;
+			const uint8_t* m_Src = nullptr;
+			size_t m_Size = 0;
+		};
+
+		// Indices rewritten on import (optimized, or widened since Vulkan 1.0 has no 8-bit indices).
+		struct IndexRegion
+		{
+			VkDeviceSize m_DstOffset = 0;
+			std::vector<uint32_t> m_Indices;
+			VkIndexType m_IndexType = VK_INDEX_TYPE_UINT32;
+		};
+
+		std::vector<uint32_t> ReadIndices(const GltfAccessorView& view, const GltfComponentType componentType)
+		{
+			std::vector<uint32_t> indices(view.m_Count);
+			for (uint32_t i = 0; i < view.m_Count; ++i)
+			{
+				switch (componentType)
+				{
+				case GltfComponentType::UnsignedByte:
+					indices[i] = *view[i];
+					break;
+				case GltfComponentType::UnsignedShort:
+					indices[i] = *reinterpret_cast<const uint16_t*>(view[i]);
+					break;
+				default:
+					indices[i] = *reinterpret_cast<const uint32_t*>(view[i]);
+					break;
+				}
+			}
+
+			return indices;
+		}
+	}
+
+
+	//-- VulkanGltfPrimitive Functions.
+	const VulkanVertexStream* VulkanGltfPrimitive::FindStream(const std::string_view semantic) const
+	{
+		for (const auto& [name, stream] : m_Streams)
+		{
+			if (name == semantic)
+				return &stream;
+		}
+
+		return nullptr;
+	}
+
+
+	//-- VulkanGltfScene Functions.
+	void VulkanGltfScene::Init(const std::string& filePath, VkCommandPool commandPool, const bool optimizeIndices, const bool generateLods)
+	{
+		m_Scene = GltfLoader::LoadGlb(filePath);
+		m_Meshes.clear();
+		m_Meshlets.clear();
+
+		std::vector<UploadRegion> regions;
+		std::vector<IndexRegion> indexRegions;
+		std::vector<VkDeviceSize> viewOffsets(m_Scene.m_BufferViews.size(), VK_WHOLE_SIZE);
+		VkDeviceSize totalSize = 0;
+		MeshOptimizeStats optimizeStats;
+		uint32_t optimizedTriangles = 0;
+		uint32_t coarsestLodTriangles = 0;
+
+		const auto reserveRegion = [&](const uint8_t* src, const size_t size)
+		{
+			totalSize = AlignUp(totalSize, s_StreamAlignment);
+			regions.push_back({ totalSize, src, size });
+			totalSize += size;
+			return regions.back().m_DstOffset;
+		};
+
+		const auto reserveIndices = [&](std::vector<uint32_t> indices, const VkIndexType indexType)
+		{
+			totalSize = AlignUp(totalSize, s_StreamAlignment);
+			const VkDeviceSize offset = totalSize;
+			totalSize += indices.size() * (indexType == VK_INDEX_TYPE_UINT16 ? sizeof(uint16_t) : sizeof(uint32_t));
+			indexRegions.push_back({ offset, std::move(indices), indexType });
+			return offset;
+		};
+
+		// Vertex data is copied a whole buffer view at a time, so interleaved views are uploaded once and keep their stride.
+		const auto reserveView = [&](const int viewIndex)
+		{
+			if (viewOffsets[viewIndex] == VK_WHOLE_SIZE)
+			{
+				const GltfBufferView& view = m_Scene.m_BufferViews[viewIndex];
+				viewOffsets[viewIndex] = reserveRegion(m_Scene.m_Buffers[view.m_Buffer].m_Data + view.m_ByteOffset, view.m_ByteLength);
+			}
+			return viewOffsets[viewIndex];
+		};
+
+		//-- Lay out the geometry buffer.
+		for (const GltfMesh& gltfMesh : m_Scene.m_Meshes)
+		{
+			VulkanGltfMesh& mesh = m_Meshes.emplace_back();
+			mesh.m_Name = gltfMesh.m_Name;
+
+			for (const GltfPrimitive& gltfPrimitive : gltfMesh.m_Primitives)
+			{
+				if (gltfPrimitive.m_Mode != g_GltfModeTriangles)
+					throw std::runtime_error("Only triangle list glTF primitives are supported, in [" + filePath + "]!");
+
+				VulkanGltfPrimitive& primitive = mesh.m_Primitives.emplace_back();
+				primitive.m_Material = gltfPrimitive.m_Material;
+
+				for (const auto& [semantic, accessorIndex] : gltfPrimitive.m_Attributes)
+				{
+					const GltfAccessor& accessor = m_Scene.m_Accessors.at(accessorIndex);
+					const GltfAccessorView accessorView = m_Scene.GetAccessorView(accessorIndex);
+
+					VulkanVertexStream stream;
+					stream.m_Offset = reserveView(accessor.m_BufferView) + accessor.m_ByteOffset;
+					stream.m_Stride = accessorView.m_Stride;
+					stream.m_Format = GetVertexFormat(accessor);
+					primitive.m_Streams.emplace_back(semantic, stream);
+
+					if (semantic == "POSITION")
+						primitive.m_VertexCount = accessor.m_Count;
+				}
+
+				if (gltfPrimitive.m_Indices >= 0)
+				{
+					const GltfAccessor& accessor = m_Scene.m_Accessors.at(gltfPrimitive.m_Indices);
+					const GltfAccessorView accessorView = m_Scene.GetAccessorView(gltfPrimitive.m_Indices);
+					if (!accessorView.IsTightlyPacked())
+						throw std::runtime_error("Strided glTF index buffers are not supported, in [" + filePath + "]!");
+
+					if (accessor.m_ComponentType != GltfComponentType::UnsignedByte && accessor.m_ComponentType != GltfComponentType::UnsignedShort && accessor.m_ComponentType != GltfComponentType::UnsignedInt)
+						throw std::runtime_error("Invalid glTF index component type, in [" + filePath + "]!");
+
+					primitive.m_IndexCount = accessor.m_Count;
+					primitive.m_IndexType = accessor.m_ComponentType == GltfComponentType::UnsignedInt ? VK_INDEX_TYPE_UINT32 : VK_INDEX_TYPE_UINT16;
+
+					// Cache and overdraw optimization needs float3 positions, everything else is uploaded as authored.
+					const int positionAccessor = gltfPrimitive.FindAttribute("POSITION");
+					const bool optimize = optimizeIndices && positionAccessor >= 0 && m_Scene.m_Accessors[positionAccessor].m_ComponentType == GltfComponentType::Float
+						&& m_Scene.m_Accessors[positionAccessor].m_ComponentCount == 3;
+
+					if (optimize || accessor.m_ComponentType == GltfComponentType::UnsignedByte)
+					{
+						std::vector<uint32_t> indices = ReadIndices(accessorView, accessor.m_ComponentType);
+						if (optimize)
+						{
+							const GltfAccessorView positions = m_Scene.GetAccessorView(positionAccessor);
+							const VertexCacheStats before = MeshOptimizer::AnalyzeVertexCache(indices, positions.m_Count);
+
+							MeshOptimizer::OptimizeVertexCache(indices, positions.m_Count);
+							MeshOptimizer::OptimizeOverdraw(indices, reinterpret_cast<const float*>(positions.m_Data), positions.m_Stride, positions.m_Count);
+
+							const VertexCacheStats after = MeshOptimizer::AnalyzeVertexCache(indices, positions.m_Count);
+							optimizeStats.m_Before.m_Transformed += before.m_Transformed;
+							optimizeStats.m_After.m_Transformed += after.m_Transformed;
+							optimizedTriangles += static_cast<uint32_t>(indices.size() / 3);
+
+							// Meshlets keep the optimized order within and between clusters.
+							MeshletMesh meshletMesh = MeshletBuilder::Build(indices, reinterpret_cast<const float*>(positions.m_Data), positions.m_Stride, positions.m_Count);
+							primitive.m_MeshletOffset = static_cast<uint32_t>(m_Meshlets.size());
+							primitive.m_MeshletCount = static_cast<uint32_t>(meshletMesh.m_Meshlets.size());
+							m_Meshlets.insert(m_Meshlets.end(), meshletMesh.m_Meshlets.begin(), meshletMesh.m_Meshlets.end());
+							indices = std::move(meshletMesh.m_Indices);
+
+							// Coarser LODs follow LOD 0 in the same index region and reuse its vertices.
+							if (generateLods)
+							{
+								LodChain lodChain = MeshSimplifier::BuildLodChain(indices, reinterpret_cast<const float*>(positions.m_Data), positions.m_Stride, positions.m_Count);
+								primitive.m_Lods = std::move(lodChain.m_Lods);
+								indices = std::move(lodChain.m_Indices);
+								coarsestLodTriangles += primitive.m_Lods.back().m_IndexCount / 3;
+							}
+						}
+						primitive.m_IndexOffset = reserveIndices(std::move(indices), primitive.m_IndexType);
+					}
+					else
+					{
+						primitive.m_IndexOffset = reserveView(accessor.m_BufferView) + accessor.m_ByteOffset;
+					}
+				}
+			}
+		}
+
+#ifdef _DEBUG
+		if (optimizedTriangles > 0)
+		{
+			std::cout << "\t" << "Optimized " << optimizedTriangles << " triangles, ACMR " << static_cast<float>(optimizeStats.m_Before.m_Transformed) / optimizedTriangles
+				<< " -> " << static_cast<float>(optimizeStats.m_After.m_Transformed) / optimizedTriangles << ", " << m_Meshlets.size() << " meshlets" << std::endl;
+		}
+		if (coarsestLodTriangles > 0)
+			std::cout << "\t" << "Generated LOD chains, " << optimizedTriangles << " triangles at LOD 0 -> " << coarsestLodTriangles << " at the coarsest LODs" << std::endl;
+#endif
+
+		// Meshlets go last, bound as a storage buffer by the GPU culling pass.
+		if (!m_Meshlets.empty())
+		{
+			totalSize = AlignUp(totalSize, s_StorageAlignment);
+			m_MeshletBufferOffset = totalSize;
+			regions.push_back({ m_MeshletBufferOffset, reinterpret_cast<const uint8_t*>(m_Meshlets.data()), m_Meshlets.size() * sizeof(Meshlet) });
+			totalSize += regions.back().m_Size;
+		}
+
+		if (totalSize == 0)
+			return;
+
+		//-- Upload, straight from the mapped file into staging memory.
+		m_GeometryBuffer.Init(totalSize, commandPool, [&regions, &indexRegions](void* staging)
+		{
+			uint8_t* dst = static_cast<uint8_t*>(staging);
+			for (const UploadRegion& region : regions)
+				memcpy(dst + region.m_DstOffset, region.m_Src, region.m_Size);
+
+			for (const IndexRegion& region : indexRegions)
+			{
+				if (region.m_IndexType == VK_INDEX_TYPE_UINT32)
+				{
+					memcpy(dst + region.m_DstOffset, region.m_Indices.data(), region.m_Indices.size() * sizeof(uint32_t));
+					continue;
+				}
+
+				uint16_t* indices = reinterpret_cast<uint16_t*>(dst + region.m_DstOffset);
+				for (size_t i = 0; i < region.m_Indices.size(); ++i)
+					indices[i] = static_cast<uint16_t>(region.m_Indices[i]);
+			}
+		});
+	}
+
+	void VulkanGltfScene::Cleanup() const
+	{
+		if (m_GeometryBuffer.GetSize() > 0)
+			m_GeometryBuffer.Cleanup();
+	}
+
+	void VulkanGltfScene::BindPrimitive(VkCommandBuffer commandBuffer, const VulkanGltfPrimitive& primitive, const std::vector<std::string_view>& semantics) const
+	{
+		std::vector<VkBuffer> buffers(semantics.size(), m_GeometryBuffer.GetBuffer());
+		std::vector<VkDeviceSize> offsets;
+		offsets.reserve(semantics.size());
+
+		for (const std::string_view semantic : semantics)
+		{
+			const VulkanVertexStream* stream = primitive.FindStream(semantic);
+			if (stream == nullptr)
+				throw std::runtime_error("glTF primitive has no [" + std::string(semantic) + "] attribute!");
+			offsets.push_back(stream->m_Offset);
+		}
+
+		vkCmdBindVertexBuffers(commandBuffer, 0, static_cast<uint32_t>(buffers.size()), buffers.data(), offsets.data());
+		if (primitive.m_IndexCount > 0)
+			vkCmdBindIndexBuffer(commandBuffer, m_GeometryBuffer.GetBuffer(), primitive.m_IndexOffset, primitive.m_IndexType);
+	}
+
+	void VulkanGltfScene::DrawPrimitive(VkCommandBuffer commandBuffer, const VulkanGltfPrimitive& primitive, const uint32_t instanceCount, const uint32_t lod) const
+	{
+		if (lod > 0 && lod < primitive.m_Lods.size())
+			vkCmdDrawIndexed(commandBuffer, primitive.m_Lods[lod].m_IndexCount, instanceCount, primitive.m_Lods[lod].m_FirstIndex, 0, 0);
+		else if (primitive.m_IndexCount > 0)
+			vkCmdDrawIndexed(commandBuffer, primitive.m_IndexCount, instanceCount, 0, 0, 0);
+		else
+			vkCmdDraw(commandBuffer, primitive.m_VertexCount, instanceCount, 0, 0);
+	}
+
+	uint32_t VulkanGltfScene::DrawPrimitiveCulled(VkCommandBuffer commandBuffer, const VulkanGltfPrimitive& primitive, const Frustum& frustum, const glm::vec3& cameraPosition) const
+	{
+		if (primitive.m_MeshletCount == 0)
+		{
+			DrawPrimitive(commandBuffer, primitive);
+			return 0;
+		}
+
+		std::vector<MeshletDrawRange> ranges;
+		const uint32_t visibleCount = MeshletCuller::Cull(m_Meshlets.data() + primitive.m_MeshletOffset, primitive.m_MeshletCount, frustum, cameraPosition, ranges);
+
+		for (const MeshletDrawRange& range : ranges)
+			vkCmdDrawIndexed(commandBuffer, range.m_IndexCount, 1, range.m_FirstIndex, 0, 0);
+
+		return visibleCount;
+	}
+
+	void VulkanGltfScene::CullPrimitive(VkCommandBuffer commandBuffer, VulkanMeshletCuller& culler, const VulkanGltfPrimitive& primitive, const Frustum& frustum,
+		const glm::vec3& cameraPosition, VkBuffer drawBuffer, const uint32_t drawOffset) const
+	{
+		if (primitive.m_MeshletCount == 0)
+			return;
+
+		const MeshletCullConstants constants = MeshletCuller::MakeGpuConstants(frustum, cameraPosition, primitive.m_MeshletCount, primitive.m_MeshletOffset, drawOffset);
+		culler.Cull(commandBuffer, m_GeometryBuffer.GetBuffer(), m_MeshletBufferOffset, drawBuffer, constants);
+	}
+
+	VkFormat VulkanGltfScene::GetVertexFormat(const GltfAccessor& accessor)
+	{
+		if (accessor.m_ComponentCount < 1 || accessor.m_ComponentCount > 4)
+			return VK_FORMAT_UNDEFINED;
+
+		const uint32_t index = accessor.m_ComponentCount - 1;
+		switch (accessor.m_ComponentType)
+		{
+		case GltfComponentType::Float:
+		{
+			constexpr VkFormat formats[] = { VK_FORMAT_R32_SFLOAT, VK_FORMAT_R32G32_SFLOAT, VK_FORMAT_R32G32B32_SFLOAT, VK_FORMAT_R32G32B32A32_SFLOAT };
+			return formats[index];
+		}
+		case GltfComponentType::UnsignedInt:
+		{
+			constexpr VkFormat formats[] = { VK_FORMAT_R32_UINT, VK_FORMAT_R32G32_UINT, VK_FORMAT_R32G32B32_UINT, VK_FORMAT_R32G32B32A32_UINT };
+			return formats[index];
+		}
+		case GltfComponentType::UnsignedShort:
+		{
+			constexpr VkFormat unorm[] = { VK_FORMAT_R16_UNORM, VK_FORMAT_R16G16_UNORM, VK_FORMAT_R16G16B16_UNORM, VK_FORMAT_R16G16B16A16_UNORM };
+			constexpr VkFormat uint[] = { VK_FORMAT_R16_UINT, VK_FORMAT_R16G16_UINT, VK_FORMAT_R16G16B16_UINT, VK_FORMAT_R16G16B16A16_UINT };
+			return accessor.m_Normalized ? unorm[index] : uint[index];
+		}
+		case GltfComponentType::Short:
+		{
+			constexpr VkFormat snorm[] = { VK_FORMAT_R16_SNORM, VK_FORMAT_R16G16_SNORM, VK_FORMAT_R16G16B16_SNORM, VK_FORMAT_R16G16B16A16_SNORM };
+			constexpr VkFormat sint[] = { VK_FORMAT_R16_SINT, VK_FORMAT_R16G16_SINT, VK_FORMAT_R16G16B16_SINT, VK_FORMAT_R16G16B16A16_SINT };
+			return accessor.m_Normalized ? snorm[index] : sint[index];
+		}
+		case GltfComponentType::UnsignedByte:
+		{
+			constexpr VkFormat unorm[] = { VK_FORMAT_R8_UNORM, VK_FORMAT_R8G8_UNORM, VK_FORMAT_R8G8B8_UNORM, VK_FORMAT_R8G8B8A8_UNORM };
+			constexpr VkFormat uint[] = { VK_FORMAT_R8_UINT, VK_FORMAT_R8G8_UINT, VK_FORMAT_R8G8B8_UINT, VK_FORMAT_R8G8B8A8_UINT };
+			return accessor.m_Normalized ? unorm[index] : uint[index];
+		}
+		case GltfComponentType::Byte:
+		{
+			constexpr VkFormat snorm[] = { VK_FORMAT_R8_SNORM, VK_FORMAT_R8G8_SNORM, VK_FORMAT_R8G8B8_SNORM, VK_FORMAT_R8G8B8A8_SNORM };
+			constexpr VkFormat sint[] = { VK_FORMAT_R8_SINT, VK_FORMAT_R8G8_SINT, VK_FORMAT_R8G8B8_SINT, VK_FORMAT_R8G8B8A8_SINT };
+			return accessor.m_Normalized ? snorm[index] : sint[index];
+		}
+		}
+
+		return VK_FORMAT_UNDEFINED;
+	}
+
+	const GltfScene& VulkanGltfScene::GetScene() const
+	{
+		return m_Scene;
+	}
+
+	const std::vector<VulkanGltfMesh>& VulkanGltfScene::GetMeshes() const
+	{
+		return m_Meshes;
+	}
+
+	const VulkanGeometryBuffer& VulkanGltfScene::GetGeometryBuffer() const
+	{
+		return m_GeometryBuffer;
+	}
+
+	const std::vector<Meshlet>& VulkanGltfScene::GetMeshlets() const
+	{
+		return m_Meshlets;
+	}
+
+	VkDeviceSize VulkanGltfScene::GetMeshletBufferOffset() const
+	{
+		return m_MeshletBufferOffset;
+	}
+}
@@ -0,0 +1,102 @@
+﻿/*!
+\file		VulkanGltfScene.h
+\date		19/10/2026
+
+\author		Adrian Tan
+\email		t.xingkhiangadrian\@digipen.edu
+
+\brief		Contains definition of VulkanGltfScene class.
+			Uploads a loaded glTF scene into a single geometry buffer, copying each
+			buffer view once from the mapped file into staging memory.
+
+\copyright	All content © 2023 DigiPen (SINGAPORE) Corporation, all rights reserved.
+			Reproduction or disclosure of this file or its contents without the
+			prior written consent of DigiPen Institute of Technology is prohibited.
+__________________________________________________________________________________*/
+#pragma once
+
+#include "GltfLoader.h"
+#include "MeshSimplifier.h"
+#include "Meshlet.h"
+#include "VulkanGeometryBuffer.h"
+
+#include <vulkan/vulkan.h>
+
+namespace Nya
+{
+	// One vertex attribute stream inside the geometry buffer, in the file's own layout.
+	struct VulkanVertexStream
+	{
+		VkDeviceSize m_Offset = 0;
+		uint32_t m_Stride = 0;
+		VkFormat m_Format = VK_FORMAT_UNDEFINED;
+	};
+
+	struct VulkanGltfPrimitive
+	{
+		std::vector<std::pair<std::string, VulkanVertexStream>> m_Streams;	// Attribute semantic -> stream.
+		uint32_t m_VertexCount = 0;
+
+		VkDeviceSize m_IndexOffset = 0;
+		VkIndexType m_IndexType = VK_INDEX_TYPE_UINT32;
+		uint32_t m_IndexCount = 0;	// 0 means the primitive is drawn non-indexed.
+
+		int m_Material = -1;
+
+		uint32_t m_MeshletOffset = 0;	// Into the scene's meshlets.
+		uint32_t m_MeshletCount = 0;	// 0 if the primitive was not split into meshlets.
+
+		// Index ranges relative to m_IndexOffset, LOD 0 first. Empty if no LOD chain was generated.
+		// Every LOD indexes the same vertices, and LOD 0 is the m_IndexCount indices the meshlets cover.
+		std::vector<MeshLod> m_Lods;
+
+		const VulkanVertexStream* FindStream(std::string_view semantic) const;
+	};
+
+	struct VulkanGltfMesh
+	{
+		std::string m_Name;
+		std::vector<VulkanGltfPrimitive> m_Primitives;
+	};
+
+	class VulkanMeshletCuller;
+
+	class VulkanGltfScene
+	{
+		GltfScene m_Scene;
+		VulkanGeometryBuffer m_GeometryBuffer;
+		std::vector<VulkanGltfMesh> m_Meshes;
+
+		std::vector<Meshlet> m_Meshlets;			// Every primitive's meshlets, also uploaded to the geometry buffer.
+		VkDeviceSize m_MeshletBufferOffset = 0;
+
+	public:
+		// optimizeIndices reorders each primitive's triangles for vertex cache and overdraw before upload,
+		// then splits them into meshlets for cluster culling. generateLods also builds a LOD chain for those primitives.
+		void Init(const std::string& filePath, VkCommandPool commandPool, bool optimizeIndices = true, bool generateLods = true);
+		void Cleanup() const;
+
+		// Binds the requested attribute semantics to vertex bindings 0..N-1, plus the index buffer if the primitive has one.
+		void BindPrimitive(VkCommandBuffer commandBuffer, const VulkanGltfPrimitive& primitive, const std::vector<std::string_view>& semantics) const;
+		// lod indexes primitive.m_Lods (see LodSelector), and is ignored for primitives without LODs.
+		void DrawPrimitive(VkCommandBuffer commandBuffer, const VulkanGltfPrimitive& primitive, uint32_t instanceCount = 1, uint32_t lod = 0) const;
+
+		// Culls meshlets on the CPU and draws the visible index ranges. Returns the number of visible meshlets.
+		// frustum and cameraPosition are in the primitive's object space. Primitives without meshlets are drawn whole.
+		uint32_t DrawPrimitiveCulled(VkCommandBuffer commandBuffer, const VulkanGltfPrimitive& primitive, const Frustum& frustum, const glm::vec3& cameraPosition) const;
+
+		// Records the GPU cull of a primitive's meshlets into drawBuffer at drawOffset, outside a render pass.
+		// Draw them later with VulkanMeshletCuller::Draw(commandBuffer, drawBuffer, drawOffset, primitive.m_MeshletCount).
+		void CullPrimitive(VkCommandBuffer commandBuffer, VulkanMeshletCuller& culler, const VulkanGltfPrimitive& primitive, const Frustum& frustum,
+			const glm::vec3& cameraPosition, VkBuffer drawBuffer, uint32_t drawOffset) const;
+
+		// Vertex input format for an accessor, VK_FORMAT_UNDEFINED if Vulkan has no matching format.
+		static VkFormat GetVertexFormat(const GltfAccessor& accessor);
+
+		const GltfScene& GetScene() const;
+		const std::vector<VulkanGltfMesh>& GetMeshes() const;
+		const VulkanGeometryBuffer& GetGeometryBuffer() const;
+		const std::vector<Meshlet>& GetMeshlets() const;
+		VkDeviceSize GetMeshletBufferOffset() const;
+	};
+}
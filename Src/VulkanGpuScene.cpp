@@ -0,0 +1,461 @@
+﻿/*!
+\file		VulkanGpuScene.cpp
+\date		19/10/2026
+
+\author		Adrian Tan
+\email		t.xingkhiangadrian\@digipen.edu
+
+\brief		Contains implementation for VulkanGpuScene class functions.
+
+\copyright	All content © 2023 DigiPen (SINGAPORE) Corporation, all rights reserved.
+			Reproduction or disclosure of this file or its contents without the
+			prior written consent of DigiPen Institute of Technology is prohibited.
+__________________________________________________________________________________*/
+
+#include "meowpch.h"
+
+#include "VulkanGpuScene.h"
+#include "VulkanLogicalDevice.h"
+
+namespace Nya
+{
+	void VulkanGpuScene::Init()
+	{
+		// Draws find their instance through firstInstance, which must be non-zero in indirect commands.
+		if (!VulkanLogicalDevice::Get().IsDrawIndirectFirstInstanceEnabled())
+			throw std::runtime_error("GPU-driven rendering needs the drawIndirectFirstInstance feature!");
+
+		m_DescriptorCache.Init(
+		{
+			{ 0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr },	// Instances.
+			{ 1, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr },	// Meshes.
+			{ 2, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr },	// Batch draw offsets.
+			{ 3, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr },	// Draw commands.
+			{ 4, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr }	// Draw counts.
+		});
+
+		VulkanComputePipelineConfig config;
+		config.m_ShaderPath = "Shaders/output/gpu_cull_comp.spv";
+		config.m_SetLayouts.push_back(m_DescriptorCache.GetLayout());
+		config.AddPushConstant<GpuCullConstants>();
+
+		m_CullPipeline.Init(config);
+
+		//-- Occlusion culling shares set 0, and adds the pyramid and its per-frame state as set 1.
+		m_OcclusionDescriptorCache.Init(
+		{
+			{ 0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr },			// Occlusion constants.
+			{ 1, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr },			// Late candidates.
+			{ 2, VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, 1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr }	// Hi-Z pyramid.
+		});
+
+		config.m_ShaderPath = "Shaders/output/gpu_cull_occlusion_comp.spv";
+		config.m_SetLayouts.push_back(m_OcclusionDescriptorCache.GetLayout());
+
+		m_OcclusionCullPipeline.Init(config);
+
+		//-- Delta uploads, changed records are scattered from a per-frame list into the instance buffer.
+		m_ScatterDescriptorCache.Init(
+		{
+			{ 0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr },	// Instance updates.
+			{ 1, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr }	// Instances.
+		});
+
+		VulkanComputePipelineConfig scatterConfig;
+		scatterConfig.m_ShaderPath = "Shaders/output/gpu_scene_scatter_comp.spv";
+		scatterConfig.m_SetLayouts.push_back(m_ScatterDescriptorCache.GetLayout());
+		scatterConfig.AddPushConstant<GpuScatterConstants>();
+
+		m_ScatterPipeline.Init(scatterConfig);
+	}
+
+	void VulkanGpuScene::Cleanup()
+	{
+		CleanupBuffers();
+		m_CullPipeline.Cleanup();
+		m_OcclusionCullPipeline.Cleanup();
+		m_ScatterPipeline.Cleanup();
+		m_DescriptorCache.Cleanup();
+		m_OcclusionDescriptorCache.Cleanup();
+		m_ScatterDescriptorCache.Cleanup();
+	}
+
+	void VulkanGpuScene::CleanupBuffers()
+	{
+		if (!m_Uploaded)
+			return;
+
+		m_InstanceBuffer.Cleanup();
+		m_MeshBuffer.Cleanup();
+		m_BatchBuffer.Cleanup();
+		m_DrawBuffer.Cleanup();
+		m_CountBuffer.Cleanup();
+		m_OcclusionBuffer.Cleanup();
+		m_CandidateBuffer.Cleanup();
+		for (auto& buffer : m_UpdateBuffers)
+			buffer.Cleanup();
+	}
+
+	void VulkanGpuScene::MarkDirty(const uint32_t instance)
+	{
+		if (m_DirtyFlags[instance])
+			return;
+
+		m_DirtyFlags[instance] = 1;
+		m_DirtyInstances.push_back(instance);
+	}
+
+	void VulkanGpuScene::ThrowIfUploaded() const
+	{
+		// The instance, batch and draw buffers, and the per-frame upload lists, are sized by Upload.
+		if (m_Uploaded)
+			throw std::runtime_error("GPU scene meshes, batches and instances can't be added once it is uploaded!");
+	}
+
+	uint32_t VulkanGpuScene::AddMesh(const uint32_t indexCount, const uint32_t firstIndex, const int32_t vertexOffset, const glm::vec3& center, const float radius)
+	{
+		ThrowIfUploaded();
+
+		GpuMesh& mesh = m_Meshes.emplace_back();
+		mesh.m_Center = center;
+		mesh.m_Radius = radius;
+		mesh.m_IndexCount = indexCount;
+		mesh.m_FirstIndex = firstIndex;
+		mesh.m_VertexOffset = vertexOffset;
+
+		return static_cast<uint32_t>(m_Meshes.size() - 1);
+	}
+
+	uint32_t VulkanGpuScene::AddBatch()
+	{
+		ThrowIfUploaded();
+		m_BatchSizes.push_back(0);
+		return static_cast<uint32_t>(m_BatchSizes.size() - 1);
+	}
+
+	uint32_t VulkanGpuScene::AddInstance(const uint32_t mesh, const uint32_t batch, const glm::mat4& model, const uint32_t materialIndex)
+	{
+		ThrowIfUploaded();
+		if (mesh >= m_Meshes.size() || batch >= m_BatchSizes.size())
+			throw std::runtime_error("GPU scene instance refers to a missing mesh or batch!");
+
+		GpuInstance& instance = m_Instances.emplace_back();
+		instance.m_Model = model;
+		instance.m_Mesh = mesh;
+		instance.m_Batch = batch;
+		instance.m_MaterialIndex = materialIndex;
+		instance.m_ObjectID = static_cast<uint32_t>(m_Instances.size() - 1);
+		++m_BatchSizes[batch];
+		m_DirtyFlags.push_back(0);
+
+		return instance.m_ObjectID;
+	}
+
+	void VulkanGpuScene::SetTransform(const uint32_t instance, const glm::mat4& model)
+	{
+		m_Instances.at(instance).m_Model = model;
+		MarkDirty(instance);
+	}
+
+	void VulkanGpuScene::SetMaterial(const uint32_t instance, const uint32_t materialIndex)
+	{
+		m_Instances.at(instance).m_MaterialIndex = materialIndex;
+		MarkDirty(instance);
+	}
+
+	void VulkanGpuScene::SetMesh(const uint32_t instance, const uint32_t mesh)
+	{
+		if (mesh >= m_Meshes.size())
+			throw std::runtime_error("GPU scene instance refers to a missing mesh!");
+
+		m_Instances.at(instance).m_Mesh = mesh;
+		MarkDirty(instance);
+	}
+
+	void VulkanGpuScene::Upload(VkCommandPool commandPool)
+	{
+		CleanupBuffers();
+		m_DescriptorCache.Reset();
+		m_OcclusionDescriptorCache.Reset();
+		m_ScatterDescriptorCache.Reset();
+		m_Uploaded = false;
+
+		// Everything goes up below, pending edits included.
+		for (const uint32_t instance : m_DirtyInstances)
+			m_DirtyFlags[instance] = 0;
+		m_DirtyInstances.clear();
+
+		if (m_Instances.empty())
+			return;
+
+		// Each batch gets room for all of its instances, so the cull pass can never overflow a batch.
+		m_BatchDrawOffsets.resize(m_BatchSizes.size());
+		m_DrawCount = 0;
+		for (size_t batch = 0; batch < m_BatchSizes.size(); ++batch)
+		{
+			m_BatchDrawOffsets[batch] = m_DrawCount;
+			m_DrawCount += m_BatchSizes[batch];
+		}
+
+		const auto upload = [commandPool](VulkanStorageBuffer& buffer, const void* data, const size_t size)
+		{
+			buffer.Init(size, commandPool, [data, size](void* staging) { memcpy(staging, data, size); });
+		};
+
+		upload(m_InstanceBuffer, m_Instances.data(), m_Instances.size() * sizeof(GpuInstance));
+		upload(m_MeshBuffer, m_Meshes.data(), m_Meshes.size() * sizeof(GpuMesh));
+		upload(m_BatchBuffer, m_BatchDrawOffsets.data(), m_BatchDrawOffsets.size() * sizeof(uint32_t));
+		// Room for the late phase of occlusion culling too, which appends after the early draws and counts.
+		m_DrawBuffer.Init(2 * m_DrawCount * sizeof(VkDrawIndexedIndirectCommand), VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT);
+		m_CountBuffer.Init(2 * m_BatchSizes.size() * sizeof(uint32_t), VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT);
+		m_OcclusionBuffer.Init(sizeof(GpuOcclusionConstants));
+		m_CandidateBuffer.Init(m_Instances.size() * sizeof(uint32_t));
+
+		// Each instance is listed at most once per upload, so sizing for all of them means the lists never grow.
+		for (auto& buffer : m_UpdateBuffers)
+			buffer.Init(m_Instances.size() * sizeof(GpuInstanceUpdate), VK_BUFFER_USAGE_STORAGE_BUFFER_BIT);
+
+		m_Uploaded = true;
+	}
+
+	uint32_t VulkanGpuScene::UploadChanges(VkCommandBuffer commandBuffer, const uint32_t frameIndex)
+	{
+		if (!m_Uploaded || m_DirtyInstances.empty())
+			return 0;
+
+		//-- Fill this frame's upload list, safe since its last use has completed.
+		const VulkanHostBuffer& updateBuffer = m_UpdateBuffers[frameIndex];
+		GpuInstanceUpdate* updates = static_cast<GpuInstanceUpdate*>(updateBuffer.GetMappedData());
+		for (const uint32_t instance : m_DirtyInstances)
+		{
+			updates->m_Instance = m_Instances[instance];
+			updates->m_Index = instance;
+			++updates;
+			m_DirtyFlags[instance] = 0;
+		}
+
+		GpuScatterConstants constants{};
+		constants.m_UpdateCount = static_cast<uint32_t>(m_DirtyInstances.size());
+		m_DirtyInstances.clear();
+
+		// The previous frame may still be culling or drawing with the records about to be overwritten.
+		vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_VERTEX_SHADER_BIT | VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0, 0, nullptr, 0, nullptr, 0, nullptr);
+
+		//-- Scatter.
+		m_ScatterPipeline.Bind(commandBuffer);
+		m_ScatterPipeline.BindDescriptorSet(commandBuffer, m_ScatterDescriptorCache.Request(
+		{
+			DescriptorResource::Buffer(updateBuffer.GetBuffer()),
+			DescriptorResource::Buffer(m_InstanceBuffer.GetBuffer())
+		}));
+		m_ScatterPipeline.PushConstants(commandBuffer, constants);
+		VulkanComputePipeline::Dispatch(commandBuffer, constants.m_UpdateCount, s_GroupSize);
+
+		//-- Culling and vertex shaders read the new records.
+		VkMemoryBarrier scatterBarrier{};
+		scatterBarrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+		scatterBarrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+		scatterBarrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+		vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT | VK_PIPELINE_STAGE_VERTEX_SHADER_BIT, 0, 1, &scatterBarrier, 0, nullptr, 0, nullptr);
+
+		return constants.m_UpdateCount;
+	}
+
+	VkDescriptorSet VulkanGpuScene::RequestSceneSet()
+	{
+		return m_DescriptorCache.Request(
+		{
+			DescriptorResource::Buffer(m_InstanceBuffer.GetBuffer()),
+			DescriptorResource::Buffer(m_MeshBuffer.GetBuffer()),
+			DescriptorResource::Buffer(m_BatchBuffer.GetBuffer()),
+			DescriptorResource::Buffer(m_DrawBuffer.GetBuffer()),
+			DescriptorResource::Buffer(m_CountBuffer.GetBuffer())
+		});
+	}
+
+	void VulkanGpuScene::ResetDraws(VkCommandBuffer commandBuffer) const
+	{
+		// The previous frame may still be drawing from these buffers, or culling into them.
+		vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT | VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 0, nullptr, 0, nullptr);
+
+		//-- Reset counts. Without the count extension every command slot is drawn, so unused ones must stay empty too.
+		vkCmdFillBuffer(commandBuffer, m_CountBuffer.GetBuffer(), 0, VK_WHOLE_SIZE, 0);
+		if (VulkanLogicalDevice::Get().GetCmdDrawIndexedIndirectCount() == nullptr)
+			vkCmdFillBuffer(commandBuffer, m_DrawBuffer.GetBuffer(), 0, VK_WHOLE_SIZE, 0);
+	}
+
+	void VulkanGpuScene::DispatchCull(VkCommandBuffer commandBuffer, const VulkanComputePipeline& pipeline, const GpuCullConstants& constants) const
+	{
+		pipeline.PushConstants(commandBuffer, constants);
+		VulkanComputePipeline::Dispatch(commandBuffer, constants.m_InstanceCount, s_GroupSize);
+
+		//-- Draw commands and counts are read by the indirect draw stage.
+		VkMemoryBarrier cullBarrier{};
+		cullBarrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+		cullBarrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+		cullBarrier.dstAccessMask = VK_ACCESS_INDIRECT_COMMAND_READ_BIT;
+		vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT, 0, 1, &cullBarrier, 0, nullptr, 0, nullptr);
+	}
+
+	void VulkanGpuScene::Cull(VkCommandBuffer commandBuffer, const Frustum& frustum)
+	{
+		if (!m_Uploaded)
+			return;
+
+		ResetDraws(commandBuffer);
+
+		VkMemoryBarrier clearBarrier{};
+		clearBarrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+		clearBarrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+		clearBarrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT;
+		vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0, 1, &clearBarrier, 0, nullptr, 0, nullptr);
+
+		//-- Cull.
+		GpuCullConstants constants{};
+		std::copy(frustum.m_Planes.begin(), frustum.m_Planes.end(), constants.m_FrustumPlanes);
+		constants.m_InstanceCount = static_cast<uint32_t>(m_Instances.size());
+
+		m_CullPipeline.Bind(commandBuffer);
+		m_CullPipeline.BindDescriptorSet(commandBuffer, RequestSceneSet());
+		DispatchCull(commandBuffer, m_CullPipeline, constants);
+	}
+
+	void VulkanGpuScene::CullEarly(VkCommandBuffer commandBuffer, const Frustum& frustum, const glm::mat4& viewProj, const VulkanHiZPyramid& pyramid)
+	{
+		if (!m_Uploaded)
+			return;
+
+		ResetDraws(commandBuffer);
+
+		//-- Both phases' constants go up at once, the late phase reads them too.
+		GpuOcclusionConstants occlusion{};
+		occlusion.m_PreviousViewProj = m_PreviousViewProj;
+		occlusion.m_ViewProj = viewProj;
+		occlusion.m_PyramidValid = pyramid.IsValid() && m_HasPreviousViewProj ? 1 : 0;
+		occlusion.m_LateDrawOffset = m_DrawCount;
+		occlusion.m_LateCountOffset = static_cast<uint32_t>(m_BatchSizes.size());
+		vkCmdUpdateBuffer(commandBuffer, m_OcclusionBuffer.GetBuffer(), 0, sizeof(GpuOcclusionConstants), &occlusion);
+
+		VkMemoryBarrier clearBarrier{};
+		clearBarrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+		clearBarrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+		clearBarrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT;
+		vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0, 1, &clearBarrier, 0, nullptr, 0, nullptr);
+
+		//-- Cull against last frame's pyramid.
+		const VkDescriptorSet occlusionSet = m_OcclusionDescriptorCache.Request(
+		{
+			DescriptorResource::Buffer(m_OcclusionBuffer.GetBuffer()),
+			DescriptorResource::Buffer(m_CandidateBuffer.GetBuffer()),
+			pyramid.GetDescriptor()
+		});
+
+		GpuCullConstants constants{};
+		std::copy(frustum.m_Planes.begin(), frustum.m_Planes.end(), constants.m_FrustumPlanes);
+		constants.m_InstanceCount = static_cast<uint32_t>(m_Instances.size());
+		constants.m_Phase = 0;
+
+		m_OcclusionCullPipeline.Bind(commandBuffer);
+		m_OcclusionCullPipeline.BindDescriptorSet(commandBuffer, RequestSceneSet());
+		m_OcclusionCullPipeline.BindDescriptorSet(commandBuffer, occlusionSet, 1);
+		DispatchCull(commandBuffer, m_OcclusionCullPipeline, constants);
+
+		m_PreviousViewProj = viewProj;
+		m_HasPreviousViewProj = true;
+	}
+
+	void VulkanGpuScene::CullLate(VkCommandBuffer commandBuffer, const VulkanHiZPyramid& pyramid)
+	{
+		if (!m_Uploaded)
+			return;
+
+		//-- Late candidates and early counts come from the early phase.
+		VkMemoryBarrier earlyBarrier{};
+		earlyBarrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+		earlyBarrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+		earlyBarrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT;
+		vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0, 1, &earlyBarrier, 0, nullptr, 0, nullptr);
+
+		//-- Retest the early rejects against this frame's pyramid.
+		const VkDescriptorSet occlusionSet = m_OcclusionDescriptorCache.Request(
+		{
+			DescriptorResource::Buffer(m_OcclusionBuffer.GetBuffer()),
+			DescriptorResource::Buffer(m_CandidateBuffer.GetBuffer()),
+			pyramid.GetDescriptor()
+		});
+
+		GpuCullConstants constants{};
+		constants.m_InstanceCount = static_cast<uint32_t>(m_Instances.size());
+		constants.m_Phase = 1;
+
+		m_OcclusionCullPipeline.Bind(commandBuffer);
+		m_OcclusionCullPipeline.BindDescriptorSet(commandBuffer, RequestSceneSet());
+		m_OcclusionCullPipeline.BindDescriptorSet(commandBuffer, occlusionSet, 1);
+		DispatchCull(commandBuffer, m_OcclusionCullPipeline, constants);
+	}
+
+	void VulkanGpuScene::Draw(VkCommandBuffer commandBuffer, const uint32_t batch) const
+	{
+		DrawRange(commandBuffer, batch, 0, 0);
+	}
+
+	void VulkanGpuScene::DrawLate(VkCommandBuffer commandBuffer, const uint32_t batch) const
+	{
+		DrawRange(commandBuffer, batch, m_DrawCount, static_cast<uint32_t>(m_BatchSizes.size()));
+	}
+
+	void VulkanGpuScene::ResetPyramidSets()
+	{
+		// The cache keys on view handles, which a new pyramid may reuse.
+		m_OcclusionDescriptorCache.Reset();
+	}
+
+	void VulkanGpuScene::DrawRange(VkCommandBuffer commandBuffer, const uint32_t batch, const uint32_t drawOffset, const uint32_t countOffset) const
+	{
+		if (batch >= m_BatchSizes.size())
+			throw std::runtime_error("GPU scene batch " + std::to_string(batch) + " doesn't exist!");
+		if (!m_Uploaded || m_BatchSizes[batch] == 0)
+			return;
+
+		constexpr uint32_t stride = sizeof(VkDrawIndexedIndirectCommand);
+		const VkDeviceSize offset = static_cast<VkDeviceSize>(drawOffset + m_BatchDrawOffsets[batch]) * stride;
+		const uint32_t maxDrawCount = m_BatchSizes[batch];
+
+		if (const auto drawIndexedIndirectCount = VulkanLogicalDevice::Get().GetCmdDrawIndexedIndirectCount())
+		{
+			drawIndexedIndirectCount(commandBuffer, m_DrawBuffer.GetBuffer(), offset, m_CountBuffer.GetBuffer(), (countOffset + batch) * sizeof(uint32_t), maxDrawCount, stride);
+			return;
+		}
+
+		// Fallback: every slot of the batch is drawn, the ones the cull pass left empty have no instances.
+		if (VulkanLogicalDevice::Get().IsMultiDrawIndirectEnabled())
+		{
+			vkCmdDrawIndexedIndirect(commandBuffer, m_DrawBuffer.GetBuffer(), offset, maxDrawCount, stride);
+			return;
+		}
+
+		// Last resort, one call per slot, which does scale with the instance count on the CPU.
+		for (uint32_t i = 0; i < maxDrawCount; ++i)
+			vkCmdDrawIndexedIndirect(commandBuffer, m_DrawBuffer.GetBuffer(), offset + static_cast<VkDeviceSize>(i) * stride, 1, stride);
+	}
+
+	VkBuffer VulkanGpuScene::GetInstanceBuffer() const
+	{
+		return m_InstanceBuffer.GetBuffer();
+	}
+
+	const GpuInstance& VulkanGpuScene::GetInstance(const uint32_t instance) const
+	{
+		return m_Instances.at(instance);
+	}
+
+	uint32_t VulkanGpuScene::GetInstanceCount() const
+	{
+		return static_cast<uint32_t>(m_Instances.size());
+	}
+
+	uint32_t VulkanGpuScene::GetBatchCount() const
+	{
+		return static_cast<uint32_t>(m_BatchSizes.size());
+	}
+}
@@ -0,0 +1,122 @@
+﻿/*!
+\file		VulkanGpuScene.h
+\date		19/10/2026
+
+\author		Adrian Tan
+\email		t.xingkhiangadrian\@digipen.edu
+
+\brief		Contains definition of VulkanGpuScene class.
+
+\copyright	All content © 2023 DigiPen (SINGAPORE) Corporation, all rights reserved.
+			Reproduction or disclosure of this file or its contents without the
+			prior written consent of DigiPen Institute of Technology is prohibited.
+__________________________________________________________________________________*/
+#pragma once
+
+#include "Frustum.h"
+#include "ShaderData.h"
+#include "VulkanComputePipeline.h"
+#include "VulkanDescriptorCache.h"
+#include "VulkanDefines.h"
+#include "VulkanHiZPyramid.h"
+#include "VulkanHostBuffer.h"
+#include "VulkanStorageBuffer.h"
+
+#include <array>
+
+namespace Nya
+{
+	// GPU-driven rendering: every object lives in a GPU instance buffer, a compute pass frustum culls them
+	// and writes compacted indexed indirect draws plus a count per batch, and each batch (one pipeline)
+	// is drawn with a single indirect draw call. CPU cost per frame depends on the batch count only.
+	// Optionally, the cull pass also occlusion culls against a Hi-Z pyramid in two phases (see CullEarly).
+	// The instance buffer persists across frames, per-frame edits only upload the changed records (see UploadChanges).
+	class VulkanGpuScene
+	{
+		std::vector<GpuInstance> m_Instances;
+		std::vector<GpuMesh> m_Meshes;
+		std::vector<uint32_t> m_BatchDrawOffsets;	// First draw command of each batch.
+		std::vector<uint32_t> m_BatchSizes;			// Instances, i.e. most draws, of each batch.
+
+		VulkanStorageBuffer m_InstanceBuffer;
+		VulkanStorageBuffer m_MeshBuffer;
+		VulkanStorageBuffer m_BatchBuffer;
+		VulkanStorageBuffer m_DrawBuffer;			// VkDrawIndexedIndirectCommand per instance, grouped by batch. Early draws, then late ones.
+		VulkanStorageBuffer m_CountBuffer;			// Draw count per batch. Early counts, then late ones.
+		VulkanStorageBuffer m_OcclusionBuffer;		// GpuOcclusionConstants.
+		VulkanStorageBuffer m_CandidateBuffer;		// Per instance, set when the early phase rejected it by occlusion.
+		uint32_t m_DrawCount = 0;
+		bool m_Uploaded = false;
+
+		// Instances edited since the last upload, each listed once.
+		std::vector<uint32_t> m_DirtyInstances;
+		std::vector<uint8_t> m_DirtyFlags;
+		std::array<VulkanHostBuffer, g_MaxFramesInFlight> m_UpdateBuffers;	// GpuInstanceUpdate list per frame.
+
+		glm::mat4 m_PreviousViewProj{ 1.f };
+		bool m_HasPreviousViewProj = false;
+
+		VulkanComputePipeline m_CullPipeline;
+		VulkanComputePipeline m_OcclusionCullPipeline;
+		VulkanComputePipeline m_ScatterPipeline;
+		VulkanDescriptorCache m_DescriptorCache;
+		VulkanDescriptorCache m_OcclusionDescriptorCache;
+		VulkanDescriptorCache m_ScatterDescriptorCache;
+
+		void CleanupBuffers();
+		void ThrowIfUploaded() const;
+		void MarkDirty(uint32_t instance);
+		VkDescriptorSet RequestSceneSet();
+		void ResetDraws(VkCommandBuffer commandBuffer) const;
+		void DispatchCull(VkCommandBuffer commandBuffer, const VulkanComputePipeline& pipeline, const GpuCullConstants& constants) const;
+		void DrawRange(VkCommandBuffer commandBuffer, uint32_t batch, uint32_t drawOffset, uint32_t countOffset) const;
+
+	public:
+		static constexpr uint32_t s_GroupSize = 64;	// Must match local_size_x in gpu_cull.comp, gpu_cull_occlusion.comp and gpu_scene_scatter.comp.
+
+		void Init();
+		void Cleanup();
+
+		// Geometry is an index range in whichever vertex and index buffers the batches bind.
+		// Meshes, batches and instances are added before Upload, adding any afterwards throws.
+		uint32_t AddMesh(uint32_t indexCount, uint32_t firstIndex, int32_t vertexOffset, const glm::vec3& center, float radius);
+		uint32_t AddBatch();
+		uint32_t AddInstance(uint32_t mesh, uint32_t batch, const glm::mat4& model, uint32_t materialIndex = 0);
+		// Edits after Upload reach the GPU with the next UploadChanges.
+		void SetTransform(uint32_t instance, const glm::mat4& model);
+		void SetMaterial(uint32_t instance, uint32_t materialIndex);
+		// Swaps the geometry, e.g. for another LOD. The instance keeps its batch.
+		void SetMesh(uint32_t instance, uint32_t mesh);
+
+		// Uploads the scene, recreating its buffers. Only call while none of them are in flight.
+		void Upload(VkCommandPool commandPool);
+		// Writes the instances edited since the last upload into this frame's upload list and records a compute
+		// scatter of them into the instance buffer, so the cost follows the edit count rather than the scene size.
+		// Record outside a render pass, before culling, once the frame's in-flight fence was waited on.
+		// Returns the number of records uploaded.
+		uint32_t UploadChanges(VkCommandBuffer commandBuffer, uint32_t frameIndex);
+
+		// Records the cull pass and the barriers for the indirect draws. Must be recorded outside a render pass.
+		void Cull(VkCommandBuffer commandBuffer, const Frustum& frustum);
+		// Draws a batch's visible instances with the currently bound pipeline and geometry.
+		void Draw(VkCommandBuffer commandBuffer, uint32_t batch) const;
+
+		// Two-phase occlusion culling, used instead of Cull. Each frame records, outside render passes:
+		//   CullEarly -> Draw every batch -> pyramid.Build from that depth -> CullLate -> DrawLate every batch.
+		// The early phase tests against the pyramid built last frame, with last frame's viewProj. Instances it
+		// rejects are retested in the late phase against the fresh pyramid, so disoccluded objects never pop in late.
+		void CullEarly(VkCommandBuffer commandBuffer, const Frustum& frustum, const glm::mat4& viewProj, const VulkanHiZPyramid& pyramid);
+		void CullLate(VkCommandBuffer commandBuffer, const VulkanHiZPyramid& pyramid);
+		// Draws the instances the late phase found visible, on top of the early depth.
+		void DrawLate(VkCommandBuffer commandBuffer, uint32_t batch) const;
+		// Frees the occlusion sets, which hold the pyramid's views. Call after resizing the pyramid, while none are in flight.
+		void ResetPyramidSets();
+
+		// Bound by vertex shaders as set 0, binding 1 (see Shaders/gpu_driven.vert).
+		VkBuffer GetInstanceBuffer() const;
+		// CPU copy, including edits not uploaded yet.
+		const GpuInstance& GetInstance(uint32_t instance) const;
+		uint32_t GetInstanceCount() const;
+		uint32_t GetBatchCount() const;
+	};
+}
@@ -0,0 +1,259 @@
+﻿/*!
+\file		VulkanHiZPyramid.cpp
+\date		19/10/2026
+
+\author		Adrian Tan
+\email		t.xingkhiangadrian\@digipen.edu
+
+\brief		Contains implementation for VulkanHiZPyramid class functions.
+
+\copyright	All content © 2023 DigiPen (SINGAPORE) Corporation, all rights reserved.
+			Reproduction or disclosure of this file or its contents without the
+			prior written consent of DigiPen Institute of Technology is prohibited.
+__________________________________________________________________________________*/
+
+#include "meowpch.h"
+
+#include "VulkanHiZPyramid.h"
+#include "ShaderData.h"
+#include "VulkanLogicalDevice.h"
+#include "VulkanPhysicalDevice.h"
+#include "VulkanQuery.h"
+
+namespace Nya
+{
+	void VulkanHiZPyramid::Init(const uint32_t width, const uint32_t height, VkCommandPool commandPool)
+	{
+		m_DescriptorCache.Init(
+		{
+			{ 0, VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, 1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr },	// Source, depth or the previous level.
+			{ 1, VK_DESCRIPTOR_TYPE_STORAGE_IMAGE, 1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr }				// Destination level.
+		});
+
+		VulkanComputePipelineConfig config;
+		config.m_ShaderPath = "Shaders/output/hiz_downsample_comp.spv";
+		config.m_SetLayouts.push_back(m_DescriptorCache.GetLayout());
+		config.AddPushConstant<HiZDownsampleConstants>();
+
+		m_DownsamplePipeline.Init(config);
+
+		//-- Point sampling only, the downsample and the cull passes fetch texels and reduce them themselves.
+		VkSamplerCreateInfo samplerInfo{};
+		samplerInfo.sType = VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO;
+		samplerInfo.magFilter = VK_FILTER_NEAREST;
+		samplerInfo.minFilter = VK_FILTER_NEAREST;
+		samplerInfo.mipmapMode = VK_SAMPLER_MIPMAP_MODE_NEAREST;
+		samplerInfo.addressModeU = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+		samplerInfo.addressModeV = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+		samplerInfo.addressModeW = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+		samplerInfo.maxLod = VK_LOD_CLAMP_NONE;
+
+		if (vkCreateSampler(VulkanLogicalDevice::Get().GetLogicalDevice(), &samplerInfo, nullptr, &m_Sampler) != VK_SUCCESS)
+			throw std::runtime_error("Failed to create Hi-Z sampler!");
+
+		m_Width = width;
+		m_Height = height;
+		CreateImage(commandPool);
+	}
+
+	void VulkanHiZPyramid::Cleanup() const
+	{
+		CleanupImage();
+		vkDestroySampler(VulkanLogicalDevice::Get().GetLogicalDevice(), m_Sampler, nullptr);
+		m_DownsamplePipeline.Cleanup();
+		m_DescriptorCache.Cleanup();
+	}
+
+	void VulkanHiZPyramid::Resize(const uint32_t width, const uint32_t height, VkCommandPool commandPool)
+	{
+		CleanupImage();
+		m_DescriptorCache.Reset();
+
+		m_Width = width;
+		m_Height = height;
+		CreateImage(commandPool);
+	}
+
+	void VulkanHiZPyramid::CreateImage(VkCommandPool commandPool)
+	{
+		const VkDevice device = VulkanLogicalDevice::Get().GetLogicalDevice();
+
+		m_MipCount = 1;
+		while ((std::max(m_Width, m_Height) >> m_MipCount) > 0)
+			++m_MipCount;
+		m_Valid = false;
+
+		//-- Image.
+		VkImageCreateInfo imageInfo{};
+		imageInfo.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+		imageInfo.imageType = VK_IMAGE_TYPE_2D;
+		imageInfo.format = VK_FORMAT_R32_SFLOAT;
+		imageInfo.extent = { m_Width, m_Height, 1 };
+		imageInfo.mipLevels = m_MipCount;
+		imageInfo.arrayLayers = 1;
+		imageInfo.samples = VK_SAMPLE_COUNT_1_BIT;
+		imageInfo.tiling = VK_IMAGE_TILING_OPTIMAL;
+		imageInfo.usage = VK_IMAGE_USAGE_STORAGE_BIT | VK_IMAGE_USAGE_SAMPLED_BIT;
+		imageInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+		imageInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+
+		if (vkCreateImage(device, &imageInfo, nullptr, &m_Image) != VK_SUCCESS)
+			throw std::runtime_error("Failed to create Hi-Z image!");
+
+		VkMemoryRequirements memRequirements;
+		vkGetImageMemoryRequirements(device, m_Image, &memRequirements);
+
+		VkMemoryAllocateInfo allocInfo{};
+		allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+		allocInfo.allocationSize = memRequirements.size;
+		allocInfo.memoryTypeIndex = VulkanQuery::FindMemoryType(VulkanPhysicalDevice::Get().GetPhysicalDevice(), memRequirements.memoryTypeBits, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+
+		if (vkAllocateMemory(device, &allocInfo, nullptr, &m_ImageMemory) != VK_SUCCESS)
+			throw std::runtime_error("Failed to allocate memory for Hi-Z image!");
+		vkBindImageMemory(device, m_Image, m_ImageMemory, 0);
+
+		//-- Views.
+		VkImageViewCreateInfo viewInfo{};
+		viewInfo.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
+		viewInfo.image = m_Image;
+		viewInfo.viewType = VK_IMAGE_VIEW_TYPE_2D;
+		viewInfo.format = VK_FORMAT_R32_SFLOAT;
+		viewInfo.subresourceRange = { VK_IMAGE_ASPECT_COLOR_BIT, 0, m_MipCount, 0, 1 };
+
+		if (vkCreateImageView(device, &viewInfo, nullptr, &m_View) != VK_SUCCESS)
+			throw std::runtime_error("Failed to create Hi-Z image view!");
+
+		m_MipViews.resize(m_MipCount);
+		for (uint32_t mip = 0; mip < m_MipCount; ++mip)
+		{
+			viewInfo.subresourceRange.baseMipLevel = mip;
+			viewInfo.subresourceRange.levelCount = 1;
+
+			if (vkCreateImageView(device, &viewInfo, nullptr, &m_MipViews[mip]) != VK_SUCCESS)
+				throw std::runtime_error("Failed to create Hi-Z mip view!");
+		}
+
+		//-- Move every level to GENERAL once, it never leaves it.
+		VkCommandBufferAllocateInfo commandInfo{};
+		commandInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+		commandInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+		commandInfo.commandPool = commandPool;
+		commandInfo.commandBufferCount = 1;
+
+		VkCommandBuffer commandBuffer;
+		vkAllocateCommandBuffers(device, &commandInfo, &commandBuffer);
+
+		VkCommandBufferBeginInfo beginInfo{};
+		beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+		beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+
+		vkBeginCommandBuffer(commandBuffer, &beginInfo);
+
+		VkImageMemoryBarrier barrier{};
+		barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+		barrier.oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+		barrier.newLayout = VK_IMAGE_LAYOUT_GENERAL;
+		barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+		barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+		barrier.image = m_Image;
+		barrier.subresourceRange = { VK_IMAGE_ASPECT_COLOR_BIT, 0, m_MipCount, 0, 1 };
+		barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT;
+		vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0, 0, nullptr, 0, nullptr, 1, &barrier);
+
+		vkEndCommandBuffer(commandBuffer);
+
+		VkSubmitInfo submitInfo{};
+		submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+		submitInfo.commandBufferCount = 1;
+		submitInfo.pCommandBuffers = &commandBuffer;
+
+		vkQueueSubmit(VulkanLogicalDevice::Get().GetGraphicsQueue(), 1, &submitInfo, VK_NULL_HANDLE);
+		vkQueueWaitIdle(VulkanLogicalDevice::Get().GetGraphicsQueue());
+
+		vkFreeCommandBuffers(device, commandPool, 1, &commandBuffer);
+	}
+
+	void VulkanHiZPyramid::CleanupImage() const
+	{
+		const VkDevice device = VulkanLogicalDevice::Get().GetLogicalDevice();
+
+		for (const VkImageView mipView : m_MipViews)
+			vkDestroyImageView(device, mipView, nullptr);
+		vkDestroyImageView(device, m_View, nullptr);
+		vkDestroyImage(device, m_Image, nullptr);
+		vkFreeMemory(device, m_ImageMemory, nullptr);
+	}
+
+	void VulkanHiZPyramid::Build(VkCommandBuffer commandBuffer, VkImageView depthView, const VkImageLayout depthLayout)
+	{
+		//-- Depth writes must land before the first level reads them, and earlier cull passes must be done reading the old pyramid.
+		VkMemoryBarrier depthBarrier{};
+		depthBarrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+		depthBarrier.srcAccessMask = VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
+		depthBarrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT;
+		vkCmdPipelineBarrier(commandBuffer,
+			VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT | VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT | VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+			VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0, 1, &depthBarrier, 0, nullptr, 0, nullptr);
+
+		m_DownsamplePipeline.Bind(commandBuffer);
+
+		//-- Level 0 copies depth, every level after reduces the one before it.
+		HiZDownsampleConstants constants{};
+		constants.m_SourceSize = { m_Width, m_Height };
+
+		for (uint32_t mip = 0; mip < m_MipCount; ++mip)
+		{
+			const DescriptorResource source = mip == 0
+				? DescriptorResource::Image(m_Sampler, depthView, depthLayout)
+				: DescriptorResource::Image(m_Sampler, m_MipViews[mip - 1], VK_IMAGE_LAYOUT_GENERAL);
+
+			const VkDescriptorSet descriptorSet = m_DescriptorCache.Request(
+			{
+				source,
+				DescriptorResource::Image(VK_NULL_HANDLE, m_MipViews[mip], VK_IMAGE_LAYOUT_GENERAL)
+			});
+
+			constants.m_DestinationSize = { std::max(m_Width >> mip, 1u), std::max(m_Height >> mip, 1u) };
+
+			m_DownsamplePipeline.BindDescriptorSet(commandBuffer, descriptorSet);
+			m_DownsamplePipeline.PushConstants(commandBuffer, constants);
+			vkCmdDispatch(commandBuffer, (constants.m_DestinationSize.x + s_GroupSize - 1) / s_GroupSize, (constants.m_DestinationSize.y + s_GroupSize - 1) / s_GroupSize, 1);
+
+			// Also makes the last level visible to the cull passes that follow.
+			VkMemoryBarrier mipBarrier{};
+			mipBarrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+			mipBarrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+			mipBarrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+			vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0, 1, &mipBarrier, 0, nullptr, 0, nullptr);
+
+			constants.m_SourceSize = constants.m_DestinationSize;
+		}
+
+		m_Valid = true;
+	}
+
+	bool VulkanHiZPyramid::IsValid() const
+	{
+		return m_Valid;
+	}
+
+	DescriptorResource VulkanHiZPyramid::GetDescriptor() const
+	{
+		return DescriptorResource::Image(m_Sampler, m_View, VK_IMAGE_LAYOUT_GENERAL);
+	}
+
+	uint32_t VulkanHiZPyramid::GetWidth() const
+	{
+		return m_Width;
+	}
+
+	uint32_t VulkanHiZPyramid::GetHeight() const
+	{
+		return m_Height;
+	}
+
+	uint32_t VulkanHiZPyramid::GetMipCount() const
+	{
+		return m_MipCount;
+	}
+}
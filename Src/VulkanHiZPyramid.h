@@ -0,0 +1,67 @@
+﻿/*!
+\file		VulkanHiZPyramid.h
+\date		19/10/2026
+
+\author		Adrian Tan
+\email		t.xingkhiangadrian\@digipen.edu
+
+\brief		Contains definition of VulkanHiZPyramid class.
+
+\copyright	All content © 2023 DigiPen (SINGAPORE) Corporation, all rights reserved.
+			Reproduction or disclosure of this file or its contents without the
+			prior written consent of DigiPen Institute of Technology is prohibited.
+__________________________________________________________________________________*/
+#pragma once
+
+#include "VulkanComputePipeline.h"
+#include "VulkanDescriptorCache.h"
+
+namespace Nya
+{
+	// Hierarchical depth: a mip chain of the depth buffer where every texel holds the farthest depth under it,
+	// so four fetches bound the depth behind any screen rectangle. Built by a compute downsample, and kept in
+	// VK_IMAGE_LAYOUT_GENERAL for its whole life so it can be written and sampled without transitions.
+	class VulkanHiZPyramid
+	{
+		VkImage m_Image{};
+		VkDeviceMemory m_ImageMemory{};
+		VkImageView m_View{};					// Every level, sampled by cull passes.
+		std::vector<VkImageView> m_MipViews;	// One level each, for the downsample.
+		VkSampler m_Sampler{};
+
+		uint32_t m_Width = 0;
+		uint32_t m_Height = 0;
+		uint32_t m_MipCount = 0;
+		bool m_Valid = false;					// Holds depth from an earlier Build.
+
+		VulkanComputePipeline m_DownsamplePipeline;
+		VulkanDescriptorCache m_DescriptorCache;
+
+		void CreateImage(VkCommandPool commandPool);
+		void CleanupImage() const;
+
+	public:
+		static constexpr uint32_t s_GroupSize = 8;	// Must match local_size_x and local_size_y in hiz_downsample.comp.
+
+		// Level 0 matches the depth buffer size.
+		void Init(uint32_t width, uint32_t height, VkCommandPool commandPool);
+		void Cleanup() const;
+
+		// Recreates the chain for a new depth buffer size, e.g. after a swapchain resize. Only call while it is not in flight.
+		void Resize(uint32_t width, uint32_t height, VkCommandPool commandPool);
+
+		// Records the downsample of depthView into every level. Must be recorded outside a render pass, after the depth writes
+		// it should capture. The depth image needs VK_IMAGE_USAGE_SAMPLED_BIT, and must already be in depthLayout, a layout
+		// it can be sampled in such as VK_IMAGE_LAYOUT_DEPTH_STENCIL_READ_ONLY_OPTIMAL.
+		void Build(VkCommandBuffer commandBuffer, VkImageView depthView, VkImageLayout depthLayout);
+
+		// False until the first Build, culling against the pyramid before that would read garbage.
+		bool IsValid() const;
+
+		// Every level as a combined image sampler, nearest filtering. Shaders fetch texels directly.
+		DescriptorResource GetDescriptor() const;
+		uint32_t GetWidth() const;
+		uint32_t GetHeight() const;
+		uint32_t GetMipCount() const;
+	};
+}
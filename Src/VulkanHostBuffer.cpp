@@ -0,0 +1,44 @@
+﻿/*!
+\file		VulkanHostBuffer.cpp
+\date		19/10/2026
+
+\author		Adrian Tan
+\email		t.xingkhiangadrian\@digipen.edu
+
+\brief		Contains implementation for VulkanHostBuffer class functions.
+
+\copyright	All content © 2023 DigiPen (SINGAPORE) Corporation, all rights reserved.
+			Reproduction or disclosure of this file or its contents without the
+			prior written consent of DigiPen Institute of Technology is prohibited.
+__________________________________________________________________________________*/
+
+#include "meowpch.h"
+
+#include "VulkanHostBuffer.h"
+#include "VulkanLogicalDevice.h"
+
+namespace Nya
+{
+	void VulkanHostBuffer::Init(const VkDeviceSize size, const VkBufferUsageFlags usage)
+	{
+		m_Size = size;
+		CreateBuffer(size, usage, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, m_Buffer, m_BufferMemory);
+
+		if (vkMapMemory(VulkanLogicalDevice::Get().GetLogicalDevice(), m_BufferMemory, 0, size, 0, &m_MappedData) != VK_SUCCESS)
+			throw std::runtime_error("Failed to map host buffer memory!");
+	}
+
+	void VulkanHostBuffer::Cleanup()
+	{
+		if (m_MappedData)
+			vkUnmapMemory(VulkanLogicalDevice::Get().GetLogicalDevice(), m_BufferMemory);
+		m_MappedData = nullptr;
+
+		VulkanBuffer::Cleanup();
+	}
+
+	void* VulkanHostBuffer::GetMappedData() const
+	{
+		return m_MappedData;
+	}
+}
@@ -0,0 +1,31 @@
+﻿/*!
+\file		VulkanHostBuffer.h
+\date		19/10/2026
+
+\author		Adrian Tan
+\email		t.xingkhiangadrian\@digipen.edu
+
+\brief		Contains definition of VulkanHostBuffer class.
+
+\copyright	All content © 2023 DigiPen (SINGAPORE) Corporation, all rights reserved.
+			Reproduction or disclosure of this file or its contents without the
+			prior written consent of DigiPen Institute of Technology is prohibited.
+__________________________________________________________________________________*/
+#pragma once
+
+#include "VulkanBuffers.h"
+
+namespace Nya
+{
+	// Host visible, coherent buffer that stays mapped for its whole lifetime, for data rewritten every frame.
+	class VulkanHostBuffer : public VulkanBuffer
+	{
+		void* m_MappedData = nullptr;
+
+	public:
+		void Init(VkDeviceSize size, VkBufferUsageFlags usage);
+		void Cleanup();
+
+		void* GetMappedData() const;
+	};
+}
@@ -23,27 +23,37 @@ namespace Nya
 {
 	void VulkanIndexBuffer::Init(const std::vector<uint32_t>& indices, VkCommandPool commandPool)
 	{
-		const VkDeviceSize bufferSize = sizeof(uint32_t) * indices.size();
-		constexpr VkMemoryPropertyFlags memProperties = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
-
-		// Staging buffer.
-		VkBuffer stagingBuffer;
-		VkDeviceMemory stagingBufferMemory;
-		CreateBuffer(bufferSize, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, memProperties, stagingBuffer, stagingBufferMemory);
-
-		// Map memory to CPU.
-		void* data;
-		vkMapMemory(VulkanLogicalDevice::Get().GetLogicalDevice(), stagingBufferMemory, 0, bufferSize, 0, &data);
-		memcpy(data, indices.data(), (size_t)bufferSize);
-		vkUnmapMemory(VulkanLogicalDevice::Get().GetLogicalDevice(), stagingBufferMemory);
-
-		// Vertex buffer, created in high-performance memory in GPU.
-		CreateBuffer(bufferSize, VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_INDEX_BUFFER_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, m_Buffer, m_BufferMemory);
-		// Copy from staging buffer to vertex buffer.
-		CopyBuffer(stagingBuffer, m_Buffer, bufferSize, commandPool);
-
-		// Cleanup staging buffer.
-		vkDestroyBuffer(VulkanLogicalDevice::Get().GetLogicalDevice(), stagingBuffer, nullptr);
-		vkFreeMemory(VulkanLogicalDevice::Get().GetLogicalDevice(), stagingBufferMemory, nullptr);
+		Init(indices.data(), static_cast<uint32_t>(indices.size()), VK_INDEX_TYPE_UINT32, commandPool);
+	}
+
+	void VulkanIndexBuffer::Init(const void* data, const uint32_t indexCount, const VkIndexType indexType, VkCommandPool commandPool)
+	{
+		const size_t bufferSize = static_cast<size_t>(indexCount) * (indexType == VK_INDEX_TYPE_UINT16 ? sizeof(uint16_t) : sizeof(uint32_t));
+		Init(indexCount, indexType, commandPool, [data, bufferSize](void* staging)
+		{
+			memcpy(staging, data, bufferSize);
+		});
+	}
+
+	void VulkanIndexBuffer::Init(const uint32_t indexCount, const VkIndexType indexType, VkCommandPool commandPool, const StagingWriteFn& writeStaging)
+	{
+		if (indexType != VK_INDEX_TYPE_UINT16 && indexType != VK_INDEX_TYPE_UINT32)
+			throw std::runtime_error("Index buffers only support 16 or 32 bit indices!");
+
+		m_IndexType = indexType;
+		m_IndexCount = indexCount;
+
+		const VkDeviceSize bufferSize = static_cast<VkDeviceSize>(indexCount) * (indexType == VK_INDEX_TYPE_UINT16 ? sizeof(uint16_t) : sizeof(uint32_t));
+		CreateDeviceLocalBuffer(bufferSize, VK_BUFFER_USAGE_INDEX_BUFFER_BIT, commandPool, writeStaging);
+	}
+
+	VkIndexType VulkanIndexBuffer::GetIndexType() const
+	{
+		return m_IndexType;
+	}
+
+	uint32_t VulkanIndexBuffer::GetIndexCount() const
+	{
+		return m_IndexCount;
 	}
 }
@@ -22,7 +22,15 @@ namespace Nya
 
 	class VulkanIndexBuffer : public VulkanBuffer
 	{
+		VkIndexType m_IndexType = VK_INDEX_TYPE_UINT32;
+		uint32_t m_IndexCount = 0;
+
 	public:
 		void Init(const std::vector<uint32_t>& indices, VkCommandPool commandPool);
+		void Init(const void* data, uint32_t indexCount, VkIndexType indexType, VkCommandPool commandPool);
+		void Init(uint32_t indexCount, VkIndexType indexType, VkCommandPool commandPool, const StagingWriteFn& writeStaging);
+
+		VkIndexType GetIndexType() const;
+		uint32_t GetIndexCount() const;
 	};
 }
@@ -0,0 +1,149 @@
+﻿/*!
+\file		VulkanInstanceRenderer.cpp
+\date		19/10/2026
+
+\author		Adrian Tan
+\email		t.xingkhiangadrian\@digipen.edu
+
+\brief		Contains implementation for VulkanInstanceRenderer class functions.
+
+\copyright	All content © 2023 DigiPen (SINGAPORE) Corporation, all rights reserved.
+			Reproduction or disclosure of this file or its contents without the
+			prior written consent of DigiPen Institute of Technology is prohibited.
+__________________________________________________________________________________*/
+
+#include "meowpch.h"
+
+#include "VulkanInstanceRenderer.h"
+#include "VulkanIndexBuffer.h"
+#include "VulkanMeshBuffer.h"
+#include "VulkanStaticBatch.h"
+
+namespace Nya
+{
+	void VulkanInstanceRenderer::Init(const uint32_t initialCapacity)
+	{
+		for (auto& buffer : m_InstanceBuffers)
+			buffer.Init(static_cast<VkDeviceSize>(std::max(initialCapacity, 1u)) * InstanceData::Layout::s_Stride, VK_BUFFER_USAGE_VERTEX_BUFFER_BIT);
+	}
+
+	void VulkanInstanceRenderer::Cleanup()
+	{
+		for (auto& buffer : m_InstanceBuffers)
+			buffer.Cleanup();
+
+		m_Meshes.clear();
+		m_Groups.clear();
+		m_GroupLookup.clear();
+		m_DrawOrder.clear();
+		m_InstanceCount = 0;
+	}
+
+	uint32_t VulkanInstanceRenderer::AddMesh(const VulkanMeshBuffer& meshBuffer, const VulkanIndexBuffer& indexBuffer)
+	{
+		m_Meshes.push_back({ &meshBuffer, &indexBuffer, indexBuffer.GetIndexCount(), 0, 0 });
+		return static_cast<uint32_t>(m_Meshes.size() - 1);
+	}
+
+	uint32_t VulkanInstanceRenderer::AddMesh(const VulkanStaticBatch& batch, const uint32_t range)
+	{
+		const StaticBatchRange& batchRange = batch.GetRange(range);
+		m_Meshes.push_back({ &batch.GetMeshBuffer(), &batch.GetIndexBuffer(), batchRange.m_IndexCount, batchRange.m_FirstIndex, batchRange.m_VertexOffset });
+		return static_cast<uint32_t>(m_Meshes.size() - 1);
+	}
+
+	void VulkanInstanceRenderer::Submit(const uint32_t mesh, const uint32_t material, const glm::mat4& transform, const glm::vec4& colour)
+	{
+		InstanceData instance;
+		instance.m_Transform = transform;
+		instance.m_Colour = colour;
+		Submit(mesh, material, instance);
+	}
+
+	void VulkanInstanceRenderer::Submit(const uint32_t mesh, const uint32_t material, const InstanceData& instance)
+	{
+		if (mesh >= m_Meshes.size())
+			throw std::runtime_error("Submitted instance of an unknown mesh!");
+
+		const uint64_t key = static_cast<uint64_t>(mesh) << 32 | material;
+		auto [it, inserted] = m_GroupLookup.try_emplace(key, static_cast<uint32_t>(m_Groups.size()));
+		if (inserted)
+			m_Groups.push_back({ key, {} });
+
+		Group& group = m_Groups[it->second];
+		group.m_Instances.push_back(instance);
+		group.m_Instances.back().m_MaterialIndex = material;
+		++m_InstanceCount;
+	}
+
+	uint32_t VulkanInstanceRenderer::Flush(const VkCommandBuffer commandBuffer, const uint32_t frameIndex)
+	{
+		if (m_InstanceCount == 0)
+			return 0;
+
+		//-- Grow this frame's instance stream if needed, safe since its last use has completed.
+		VulkanHostBuffer& instanceBuffer = m_InstanceBuffers[frameIndex];
+		const VkDeviceSize requiredSize = static_cast<VkDeviceSize>(m_InstanceCount) * InstanceData::Layout::s_Stride;
+		if (const VkDeviceSize size = instanceBuffer.GetSize(); size < requiredSize)
+		{
+			instanceBuffer.Cleanup();
+			instanceBuffer.Init(std::max(requiredSize, size * 2), VK_BUFFER_USAGE_VERTEX_BUFFER_BIT);
+		}
+
+		//-- Draw groups sorted by mesh, then material, so consecutive groups share geometry.
+		m_DrawOrder.clear();
+		for (uint32_t i = 0; i < m_Groups.size(); ++i)
+		{
+			if (!m_Groups[i].m_Instances.empty())
+				m_DrawOrder.push_back(i);
+		}
+		std::ranges::sort(m_DrawOrder, [this](const uint32_t a, const uint32_t b) { return m_Groups[a].m_Key < m_Groups[b].m_Key; });
+
+		//-- Pack every group contiguously, each group is one instance range.
+		uint8_t* mapped = static_cast<uint8_t*>(instanceBuffer.GetMappedData());
+		const VkBuffer instanceVkBuffer = instanceBuffer.GetBuffer();
+		constexpr VkDeviceSize instanceOffset = 0;
+		vkCmdBindVertexBuffers(commandBuffer, s_InstanceBinding, 1, &instanceVkBuffer, &instanceOffset);
+
+		uint32_t firstInstance = 0;
+		const VulkanMeshBuffer* boundMeshBuffer = nullptr;
+		const VulkanIndexBuffer* boundIndexBuffer = nullptr;
+		for (const uint32_t groupIndex : m_DrawOrder)
+		{
+			Group& group = m_Groups[groupIndex];
+			const uint32_t mesh = static_cast<uint32_t>(group.m_Key >> 32);
+			const uint32_t instanceCount = static_cast<uint32_t>(group.m_Instances.size());
+
+			InstanceData::Pack(group.m_Instances.data(), instanceCount, mapped + static_cast<size_t>(firstInstance) * InstanceData::Layout::s_Stride);
+
+			const Mesh& drawMesh = m_Meshes[mesh];
+			if (drawMesh.m_MeshBuffer != boundMeshBuffer || drawMesh.m_IndexBuffer != boundIndexBuffer)
+			{
+				drawMesh.m_MeshBuffer->Bind(commandBuffer, VertexStreams::All);
+				vkCmdBindIndexBuffer(commandBuffer, drawMesh.m_IndexBuffer->GetBuffer(), 0, drawMesh.m_IndexBuffer->GetIndexType());
+				boundMeshBuffer = drawMesh.m_MeshBuffer;
+				boundIndexBuffer = drawMesh.m_IndexBuffer;
+			}
+
+			vkCmdDrawIndexed(commandBuffer, drawMesh.m_IndexCount, instanceCount, drawMesh.m_FirstIndex, drawMesh.m_VertexOffset, firstInstance);
+
+			firstInstance += instanceCount;
+			group.m_Instances.clear();
+		}
+
+		m_InstanceCount = 0;
+		return static_cast<uint32_t>(m_DrawOrder.size());
+	}
+
+	void VulkanInstanceRenderer::AddVertexLayouts(VulkanPipelineConfig& config)
+	{
+		config.AddVertexLayout<Vertex::PositionLayout>(0)
+			.AddVertexLayout<Vertex::AttributeLayout>(1)
+			.AddVertexLayout<InstanceData::Layout>(s_InstanceBinding, VK_VERTEX_INPUT_RATE_INSTANCE);
+	}
+
+	uint32_t VulkanInstanceRenderer::GetQueuedInstanceCount() const
+	{
+		return m_InstanceCount;
+	}
+}
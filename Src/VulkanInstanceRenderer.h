@@ -0,0 +1,85 @@
+﻿/*!
+\file		VulkanInstanceRenderer.h
+\date		19/10/2026
+
+\author		Adrian Tan
+\email		t.xingkhiangadrian\@digipen.edu
+
+\brief		Contains definition of VulkanInstanceRenderer class.
+
+\copyright	All content © 2023 DigiPen (SINGAPORE) Corporation, all rights reserved.
+			Reproduction or disclosure of this file or its contents without the
+			prior written consent of DigiPen Institute of Technology is prohibited.
+__________________________________________________________________________________*/
+#pragma once
+
+#include "Vertex.h"
+#include "VulkanDefines.h"
+#include "VulkanHostBuffer.h"
+#include "VulkanPipeline.h"
+
+#include <array>
+#include <unordered_map>
+
+namespace Nya
+{
+	class VulkanMeshBuffer;
+	class VulkanIndexBuffer;
+	class VulkanStaticBatch;
+
+	// Hardware instancing: instances submitted during a frame are grouped by mesh and material, packed into
+	// a per-frame instance stream (VK_VERTEX_INPUT_RATE_INSTANCE) and each group is drawn with one
+	// vkCmdDrawIndexed, so any number of copies of a mesh costs a single draw call.
+	class VulkanInstanceRenderer
+	{
+		struct Mesh
+		{
+			const VulkanMeshBuffer* m_MeshBuffer = nullptr;
+			const VulkanIndexBuffer* m_IndexBuffer = nullptr;
+			uint32_t m_IndexCount = 0;
+			uint32_t m_FirstIndex = 0;
+			int32_t m_VertexOffset = 0;
+		};
+
+		struct Group
+		{
+			uint64_t m_Key = 0;		// Mesh in the high 32 bits, material in the low 32 bits.
+			std::vector<InstanceData> m_Instances;
+		};
+
+		std::vector<Mesh> m_Meshes;
+
+		// Groups persist across frames so their instance arrays keep their capacity.
+		std::vector<Group> m_Groups;
+		std::unordered_map<uint64_t, uint32_t> m_GroupLookup;
+		std::vector<uint32_t> m_DrawOrder;
+
+		std::array<VulkanHostBuffer, g_MaxFramesInFlight> m_InstanceBuffers;
+		uint32_t m_InstanceCount = 0;
+
+	public:
+		// Binding 0 and 1 are the VulkanMeshBuffer streams.
+		static constexpr uint32_t s_InstanceBinding = 2;
+
+		void Init(uint32_t initialCapacity = 1024);
+		void Cleanup();
+
+		// Buffers must outlive the renderer.
+		uint32_t AddMesh(const VulkanMeshBuffer& meshBuffer, const VulkanIndexBuffer& indexBuffer);
+		// A range of a built static batch. Consecutive groups in the same batch skip the rebind.
+		uint32_t AddMesh(const VulkanStaticBatch& batch, uint32_t range);
+
+		// Queues one instance for this frame. The material index is also written to the instance data.
+		void Submit(uint32_t mesh, uint32_t material, const glm::mat4& transform, const glm::vec4& colour = glm::vec4{ 1.f });
+		void Submit(uint32_t mesh, uint32_t material, const InstanceData& instance);
+
+		// Uploads this frame's instances and draws every group with the currently bound pipeline, then clears
+		// the queue. Must be called after the frame's in-flight fence was waited on. Returns the draw call count.
+		uint32_t Flush(VkCommandBuffer commandBuffer, uint32_t frameIndex);
+
+		// Mesh streams on binding 0 and 1, instance stream on s_InstanceBinding (see Shaders/instanced.vert).
+		static void AddVertexLayouts(VulkanPipelineConfig& config);
+
+		uint32_t GetQueuedInstanceCount() const;
+	};
+}
@@ -64,14 +64,46 @@ namespace Nya
 
 		VkPhysicalDeviceFeatures deviceFeatures{};
 
+		// Multi-draw indirect for GPU culled draws, otherwise they are issued one command at a time.
+		// Indirect firstInstance lets GPU written draws pass an instance index to the vertex shader.
+		const VkPhysicalDeviceFeatures& supportedFeatures = VulkanPhysicalDevice::Get().GetFeatures();
+		m_MultiDrawIndirectEnabled = supportedFeatures.multiDrawIndirect;
+		m_DrawIndirectFirstInstanceEnabled = supportedFeatures.drawIndirectFirstInstance;
+		deviceFeatures.multiDrawIndirect = m_MultiDrawIndirectEnabled;
+		deviceFeatures.drawIndirectFirstInstance = m_DrawIndirectFirstInstanceEnabled;
+
+		// Required extensions, plus whichever optional ones the GPU supports.
+		m_EnabledExtensions = g_DeviceExtensions;
+		for (const char* extension : g_OptionalDeviceExtensions)
+		{
+			if (VulkanPhysicalDevice::Get().IsExtensionSupported(extension))
+				m_EnabledExtensions.push_back(extension);
+		}
+
+		// Descriptor indexing features for the bindless path.
+		VkPhysicalDeviceDescriptorIndexingFeaturesEXT descriptorIndexingFeatures{};
+		descriptorIndexingFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES_EXT;
+		m_BindlessEnabled = VulkanPhysicalDevice::Get().SupportsBindless();
+		if (m_BindlessEnabled)
+		{
+			const auto& supported = VulkanPhysicalDevice::Get().GetDescriptorIndexingFeatures();
+			descriptorIndexingFeatures.runtimeDescriptorArray = VK_TRUE;
+			descriptorIndexingFeatures.descriptorBindingPartiallyBound = VK_TRUE;
+			descriptorIndexingFeatures.descriptorBindingSampledImageUpdateAfterBind = VK_TRUE;
+			descriptorIndexingFeatures.descriptorBindingStorageBufferUpdateAfterBind = VK_TRUE;
+			descriptorIndexingFeatures.descriptorBindingUpdateUnusedWhilePending = VK_TRUE;
+			descriptorIndexingFeatures.shaderSampledImageArrayNonUniformIndexing = VK_TRUE;
+			descriptorIndexingFeatures.shaderStorageBufferArrayNonUniformIndexing = supported.shaderStorageBufferArrayNonUniformIndexing;
+		}
+
 		VkDeviceCreateInfo createInfo{};
 		createInfo.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
 		createInfo.queueCreateInfoCount = static_cast<uint32_t>(queueCreateInfos.size());
 		createInfo.pQueueCreateInfos = queueCreateInfos.data();
 		createInfo.pEnabledFeatures = &deviceFeatures;
-		createInfo.enabledExtensionCount = static_cast<uint32_t>(g_DeviceExtensions.size());
-		createInfo.ppEnabledExtensionNames = g_DeviceExtensions.data();
-		createInfo.pNext = VK_NULL_HANDLE;
+		createInfo.enabledExtensionCount = static_cast<uint32_t>(m_EnabledExtensions.size());
+		createInfo.ppEnabledExtensionNames = m_EnabledExtensions.data();
+		createInfo.pNext = m_BindlessEnabled ? &descriptorIndexingFeatures : VK_NULL_HANDLE;
 
 		if (g_EnableValidationLayers)
 		{
@@ -90,6 +122,10 @@ namespace Nya
 		// Retrieve handles to device queues:
 		vkGetDeviceQueue(m_LogicalDevice, indices.m_GraphicsFamily.value(), 0, &m_GraphicsQueue);
 		vkGetDeviceQueue(m_LogicalDevice, indices.m_PresentFamily.value(), 0, &m_PresentQueue);
+
+		// Extension commands aren't exported by the loader, fetch them from the device.
+		if (IsExtensionEnabled(VK_KHR_DRAW_INDIRECT_COUNT_EXTENSION_NAME))
+			m_CmdDrawIndexedIndirectCount = reinterpret_cast<PFN_vkCmdDrawIndexedIndirectCountKHR>(vkGetDeviceProcAddr(m_LogicalDevice, "vkCmdDrawIndexedIndirectCountKHR"));
 	}
 
 	void VulkanLogicalDevice::Cleanup() const
@@ -113,4 +149,32 @@ namespace Nya
 	{
 		return m_PresentQueue;
 	}
+
+	bool VulkanLogicalDevice::IsExtensionEnabled(const char* extensionName) const
+	{
+		return std::ranges::any_of(m_EnabledExtensions, [extensionName](const char* enabled)
+		{
+			return strcmp(enabled, extensionName) == 0;
+		});
+	}
+
+	bool VulkanLogicalDevice::IsBindlessEnabled() const
+	{
+		return m_BindlessEnabled;
+	}
+
+	bool VulkanLogicalDevice::IsMultiDrawIndirectEnabled() const
+	{
+		return m_MultiDrawIndirectEnabled;
+	}
+
+	bool VulkanLogicalDevice::IsDrawIndirectFirstInstanceEnabled() const
+	{
+		return m_DrawIndirectFirstInstanceEnabled;
+	}
+
+	PFN_vkCmdDrawIndexedIndirectCountKHR VulkanLogicalDevice::GetCmdDrawIndexedIndirectCount() const
+	{
+		return m_CmdDrawIndexedIndirectCount;
+	}
 }
@@ -29,6 +29,13 @@ namespace Nya
 		VkQueue m_GraphicsQueue{};
 		VkQueue m_PresentQueue{};
 
+		std::vector<const char*> m_EnabledExtensions;
+		bool m_BindlessEnabled = false;
+		bool m_MultiDrawIndirectEnabled = false;
+		bool m_DrawIndirectFirstInstanceEnabled = false;
+
+		PFN_vkCmdDrawIndexedIndirectCountKHR m_CmdDrawIndexedIndirectCount = nullptr;
+
 	public:
 		static VulkanLogicalDevice& Get();
 
@@ -38,5 +45,13 @@ namespace Nya
 		VkDevice GetLogicalDevice() const;
 		VkQueue GetGraphicsQueue() const;
 		VkQueue GetPresentQueue() const;
+
+		bool IsExtensionEnabled(const char* extensionName) const;
+		bool IsBindlessEnabled() const;
+		bool IsMultiDrawIndirectEnabled() const;
+		bool IsDrawIndirectFirstInstanceEnabled() const;
+
+		// Null unless VK_KHR_draw_indirect_count is enabled.
+		PFN_vkCmdDrawIndexedIndirectCountKHR GetCmdDrawIndexedIndirectCount() const;
 	};
 }
@@ -0,0 +1,73 @@
+﻿/*!
+\file		VulkanMeshBuffer.cpp
+\date		19/10/2026
+
+\author		Adrian Tan
+\email		t.xingkhiangadrian\@digipen.edu
+
+\brief		Contains implementation for VulkanMeshBuffer class functions.
+
+\copyright	All content © 2023 DigiPen (SINGAPORE) Corporation, all rights reserved.
+			Reproduction or disclosure of this file or its contents without the
+			prior written consent of DigiPen Institute of Technology is prohibited.
+__________________________________________________________________________________*/
+
+#include "meowpch.h"
+
+#include "VulkanMeshBuffer.h"
+#include "Vertex.h"
+
+namespace Nya
+{
+	void VulkanMeshBuffer::Init(const std::vector<Vertex>& vertices, VkCommandPool commandPool)
+	{
+		const VkDeviceSize vertexCount = vertices.size();
+		Init(Vertex::PositionLayout::s_Stride * vertexCount, Vertex::AttributeLayout::s_Stride * vertexCount, commandPool,
+			[&vertices](void* staging) { Vertex::PackPositions(vertices, staging); },
+			[&vertices](void* staging) { Vertex::PackAttributes(vertices, staging); });
+
+#ifdef _DEBUG
+		// Bytes a depth pass fetches per draw of the whole mesh, split versus the interleaved Vertex::Layout.
+		const VkDeviceSize interleavedSize = Vertex::Layout::s_Stride * vertexCount;
+		std::cout << "\t" << "Depth pass vertex fetch: " << m_PositionSize << " bytes (interleaved " << interleavedSize << " bytes, "
+			<< 100 - m_PositionSize * 100 / std::max<VkDeviceSize>(interleavedSize, 1) << "% less)" << std::endl;
+#endif
+	}
+
+	void VulkanMeshBuffer::Init(const VkDeviceSize positionSize, const VkDeviceSize attributeSize, VkCommandPool commandPool, const StagingWriteFn& writePositions, const StagingWriteFn& writeAttributes)
+	{
+		m_PositionSize = positionSize;
+		m_AttributeOffset = (positionSize + s_StreamAlignment - 1) & ~(s_StreamAlignment - 1);
+		m_AttributeSize = attributeSize;
+
+		CreateDeviceLocalBuffer(m_AttributeOffset + m_AttributeSize, VK_BUFFER_USAGE_VERTEX_BUFFER_BIT, commandPool, [&](void* staging)
+		{
+			writePositions(staging);
+			writeAttributes(static_cast<uint8_t*>(staging) + m_AttributeOffset);
+		});
+	}
+
+	void VulkanMeshBuffer::Bind(const VkCommandBuffer commandBuffer, const VertexStreams streams, const uint32_t firstBinding) const
+	{
+		const VkBuffer buffers[] = { m_Buffer, m_Buffer };
+		const VkDeviceSize offsets[] = { 0, m_AttributeOffset };
+		const uint32_t bindingCount = streams == VertexStreams::All ? 2 : 1;
+
+		vkCmdBindVertexBuffers(commandBuffer, firstBinding, bindingCount, buffers, offsets);
+	}
+
+	VkDeviceSize VulkanMeshBuffer::GetPositionSize() const
+	{
+		return m_PositionSize;
+	}
+
+	VkDeviceSize VulkanMeshBuffer::GetAttributeOffset() const
+	{
+		return m_AttributeOffset;
+	}
+
+	VkDeviceSize VulkanMeshBuffer::GetAttributeSize() const
+	{
+		return m_AttributeSize;
+	}
+}
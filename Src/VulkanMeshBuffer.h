@@ -0,0 +1,53 @@
+﻿/*!
+\file		VulkanMeshBuffer.h
+\date		19/10/2026
+
+\author		Adrian Tan
+\email		t.xingkhiangadrian\@digipen.edu
+
+\brief		Contains definition of VulkanMeshBuffer class.
+
+\copyright	All content © 2023 DigiPen (SINGAPORE) Corporation, all rights reserved.
+			Reproduction or disclosure of this file or its contents without the
+			prior written consent of DigiPen Institute of Technology is prohibited.
+__________________________________________________________________________________*/
+#pragma once
+
+#include "VulkanBuffers.h"
+
+#include <vector>
+
+namespace Nya
+{
+	struct Vertex;
+
+	// Which vertex streams a draw binds.
+	enum class VertexStreams : uint32_t
+	{
+		Position = 1 << 0,		// Binding 0 only, for depth and shadow passes.
+		All = Position | 1 << 1	// Binding 0 positions and binding 1 remaining attributes.
+	};
+
+	// Device local vertex buffer holding positions and the remaining attributes as two
+	// separate streams in one allocation, so depth-only passes fetch positions alone.
+	class VulkanMeshBuffer : public VulkanBuffer
+	{
+		VkDeviceSize m_PositionSize = 0;
+		VkDeviceSize m_AttributeOffset = 0;
+		VkDeviceSize m_AttributeSize = 0;
+
+	public:
+		// Streams start at this alignment inside the buffer.
+		static constexpr VkDeviceSize s_StreamAlignment = 16;
+
+		void Init(const std::vector<Vertex>& vertices, VkCommandPool commandPool);
+		void Init(VkDeviceSize positionSize, VkDeviceSize attributeSize, VkCommandPool commandPool, const StagingWriteFn& writePositions, const StagingWriteFn& writeAttributes);
+
+		// Binds the requested streams starting at firstBinding.
+		void Bind(VkCommandBuffer commandBuffer, VertexStreams streams = VertexStreams::All, uint32_t firstBinding = 0) const;
+
+		VkDeviceSize GetPositionSize() const;
+		VkDeviceSize GetAttributeOffset() const;
+		VkDeviceSize GetAttributeSize() const;
+	};
+}
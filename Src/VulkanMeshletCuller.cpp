@@ -0,0 +1,86 @@
+﻿/*!
+\file		VulkanMeshletCuller.cpp
+\date		19/10/2026
+
+\author		Adrian Tan
+\email		t.xingkhiangadrian\@digipen.edu
+
+\brief		Contains implementation for VulkanMeshletCuller class functions.
+
+\copyright	All content © 2023 DigiPen (SINGAPORE) Corporation, all rights reserved.
+			Reproduction or disclosure of this file or its contents without the
+			prior written consent of DigiPen Institute of Technology is prohibited.
+__________________________________________________________________________________*/
+
+#include "meowpch.h"
+
+#include "VulkanMeshletCuller.h"
+#include "VulkanLogicalDevice.h"
+
+namespace Nya
+{
+	void VulkanMeshletCuller::Init()
+	{
+		m_DescriptorCache.Init(
+		{
+			{ 0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr },	// Meshlets.
+			{ 1, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr }	// Draw commands.
+		});
+
+		VulkanComputePipelineConfig config;
+		config.m_ShaderPath = "Shaders/output/meshlet_cull_comp.spv";
+		config.m_SetLayouts.push_back(m_DescriptorCache.GetLayout());
+		config.AddPushConstant<MeshletCullConstants>();
+
+		m_Pipeline.Init(config);
+	}
+
+	void VulkanMeshletCuller::Cleanup() const
+	{
+		m_Pipeline.Cleanup();
+		m_DescriptorCache.Cleanup();
+	}
+
+	void VulkanMeshletCuller::Cull(VkCommandBuffer commandBuffer, VkBuffer meshletBuffer, const VkDeviceSize meshletBufferOffset, VkBuffer drawBuffer,
+		const MeshletCullConstants& constants)
+	{
+		const VkDescriptorSet descriptorSet = m_DescriptorCache.Request(
+		{
+			DescriptorResource::Buffer(meshletBuffer, meshletBufferOffset),
+			DescriptorResource::Buffer(drawBuffer)
+		});
+
+		m_Pipeline.Bind(commandBuffer);
+		m_Pipeline.BindDescriptorSet(commandBuffer, descriptorSet);
+		m_Pipeline.PushConstants(commandBuffer, constants);
+		VulkanComputePipeline::Dispatch(commandBuffer, constants.m_MeshletCount, s_GroupSize);
+
+		// Draw commands are read by the indirect draw stage.
+		VkBufferMemoryBarrier barrier{};
+		barrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+		barrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+		barrier.dstAccessMask = VK_ACCESS_INDIRECT_COMMAND_READ_BIT;
+		barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+		barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+		barrier.buffer = drawBuffer;
+		barrier.offset = constants.m_DrawOffset * sizeof(VkDrawIndexedIndirectCommand);
+		barrier.size = constants.m_MeshletCount * sizeof(VkDrawIndexedIndirectCommand);
+
+		vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT, 0, 0, nullptr, 1, &barrier, 0, nullptr);
+	}
+
+	void VulkanMeshletCuller::Draw(VkCommandBuffer commandBuffer, VkBuffer drawBuffer, const uint32_t firstDraw, const uint32_t drawCount)
+	{
+		constexpr uint32_t stride = sizeof(VkDrawIndexedIndirectCommand);
+		const VkDeviceSize offset = static_cast<VkDeviceSize>(firstDraw) * stride;
+
+		if (VulkanLogicalDevice::Get().IsMultiDrawIndirectEnabled())
+		{
+			vkCmdDrawIndexedIndirect(commandBuffer, drawBuffer, offset, drawCount, stride);
+			return;
+		}
+
+		for (uint32_t i = 0; i < drawCount; ++i)
+			vkCmdDrawIndexedIndirect(commandBuffer, drawBuffer, offset + static_cast<VkDeviceSize>(i) * stride, 1, stride);
+	}
+}
@@ -0,0 +1,43 @@
+﻿/*!
+\file		VulkanMeshletCuller.h
+\date		19/10/2026
+
+\author		Adrian Tan
+\email		t.xingkhiangadrian\@digipen.edu
+
+\brief		Contains definition of VulkanMeshletCuller class.
+
+\copyright	All content © 2023 DigiPen (SINGAPORE) Corporation, all rights reserved.
+			Reproduction or disclosure of this file or its contents without the
+			prior written consent of DigiPen Institute of Technology is prohibited.
+__________________________________________________________________________________*/
+#pragma once
+
+#include "VulkanComputePipeline.h"
+#include "VulkanDescriptorCache.h"
+#include "ShaderData.h"
+
+namespace Nya
+{
+	// GPU counterpart of MeshletCuller: a compute pass writing one VkDrawIndexedIndirectCommand per meshlet,
+	// with instanceCount 0 for culled ones, then drawn with indexed indirect draws.
+	class VulkanMeshletCuller
+	{
+		VulkanComputePipeline m_Pipeline;
+		VulkanDescriptorCache m_DescriptorCache;
+
+	public:
+		static constexpr uint32_t s_GroupSize = 64;	// Must match local_size_x in meshlet_cull.comp.
+
+		void Init();
+		void Cleanup() const;
+
+		// Records the cull dispatch and the barrier making its commands visible to indirect draws.
+		// Must be recorded outside a render pass. meshletBuffer holds Meshlets, drawBuffer needs INDIRECT usage.
+		void Cull(VkCommandBuffer commandBuffer, VkBuffer meshletBuffer, VkDeviceSize meshletBufferOffset, VkBuffer drawBuffer,
+			const MeshletCullConstants& constants);
+
+		// Draws commands written by Cull, in one multi-draw if the device supports it.
+		static void Draw(VkCommandBuffer commandBuffer, VkBuffer drawBuffer, uint32_t firstDraw, uint32_t drawCount);
+	};
+}
@@ -0,0 +1,280 @@
+﻿/*!
+\file		VulkanMipGenerator.cpp
+\date		19/10/2026
+
+\author		Adrian Tan
+\email		t.xingkhiangadrian\@digipen.edu
+
+\brief		Contains implementation for VulkanMipGenerator class functions.
+
+\copyright	All content © 2023 DigiPen (SINGAPORE) Corporation, all rights reserved.
+			Reproduction or disclosure of this file or its contents without the
+			prior written consent of DigiPen Institute of Technology is prohibited.
+__________________________________________________________________________________*/
+
+#include "meowpch.h"
+
+#include "VulkanMipGenerator.h"
+#include "ShaderData.h"
+#include "VulkanLogicalDevice.h"
+#include "VulkanPhysicalDevice.h"
+
+namespace Nya
+{
+	void VulkanMipGenerator::Init()
+	{
+		m_DescriptorCache.Init(
+		{
+			{ 0, VK_DESCRIPTOR_TYPE_STORAGE_IMAGE, s_MaxLevelsPerPass + 1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr },	// Base level, then the levels to write.
+			{ 1, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr }						// Finished group counter.
+		});
+
+		VulkanComputePipelineConfig config;
+		config.m_ShaderPath = "Shaders/output/mip_downsample_comp.spv";
+		config.m_SetLayouts.push_back(m_DescriptorCache.GetLayout());
+		config.AddPushConstant<MipDownsampleConstants>();
+
+		m_Pipeline.Init(config);
+		m_CounterBuffer.Init(sizeof(uint32_t));
+	}
+
+	void VulkanMipGenerator::Cleanup()
+	{
+		ReleaseRecorded();
+		m_CounterBuffer.Cleanup();
+		m_Pipeline.Cleanup();
+		m_DescriptorCache.Cleanup();
+	}
+
+	uint32_t VulkanMipGenerator::GetMipCount(const uint32_t width, const uint32_t height)
+	{
+		uint32_t mipCount = 1;
+		while ((std::max(width, height) >> mipCount) > 0)
+			++mipCount;
+
+		return mipCount;
+	}
+
+	bool VulkanMipGenerator::SupportsCompute(const VkFormat format)
+	{
+		if (format != VK_FORMAT_R8G8B8A8_UNORM && format != VK_FORMAT_R8G8B8A8_SRGB)
+			return false;
+
+		// sRGB images are written through UNORM views, so only the UNORM format has to be a storage image.
+		VkFormatProperties properties;
+		vkGetPhysicalDeviceFormatProperties(VulkanPhysicalDevice::Get().GetPhysicalDevice(), VK_FORMAT_R8G8B8A8_UNORM, &properties);
+		return (properties.optimalTilingFeatures & VK_FORMAT_FEATURE_STORAGE_IMAGE_BIT) != 0;
+	}
+
+	VkImageUsageFlags VulkanMipGenerator::GetImageUsage(const VkFormat format)
+	{
+		const VkImageUsageFlags usage = VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT;
+		return usage | (SupportsCompute(format) ? VK_IMAGE_USAGE_STORAGE_BIT : VK_IMAGE_USAGE_TRANSFER_SRC_BIT);
+	}
+
+	VkImageCreateFlags VulkanMipGenerator::GetImageFlags(const VkFormat format)
+	{
+		return format == VK_FORMAT_R8G8B8A8_SRGB && SupportsCompute(format) ? VK_IMAGE_CREATE_MUTABLE_FORMAT_BIT : 0;
+	}
+
+	void VulkanMipGenerator::Record(VkCommandBuffer commandBuffer, VkImage image, const VkFormat format, const uint32_t width, const uint32_t height, const uint32_t mipCount)
+	{
+		// A single level only needs the final transition, which the blit path does without blitting.
+		if (mipCount > 1 && SupportsCompute(format))
+			RecordCompute(commandBuffer, image, format, width, height, mipCount);
+		else
+			RecordBlit(commandBuffer, image, format, width, height, mipCount);
+	}
+
+	void VulkanMipGenerator::RecordCompute(VkCommandBuffer commandBuffer, VkImage image, const VkFormat format, const uint32_t width, const uint32_t height, const uint32_t mipCount)
+	{
+		const VkDevice device = VulkanLogicalDevice::Get().GetLogicalDevice();
+
+		//-- One storage view per level, sRGB images go through UNORM and the shader converts.
+		const size_t firstView = m_PendingViews.size();
+
+		VkImageViewCreateInfo viewInfo{};
+		viewInfo.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
+		viewInfo.image = image;
+		viewInfo.viewType = VK_IMAGE_VIEW_TYPE_2D;
+		viewInfo.format = VK_FORMAT_R8G8B8A8_UNORM;
+		viewInfo.subresourceRange = { VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1 };
+
+		for (uint32_t mip = 0; mip < mipCount; ++mip)
+		{
+			viewInfo.subresourceRange.baseMipLevel = mip;
+
+			VkImageView view;
+			if (vkCreateImageView(device, &viewInfo, nullptr, &view) != VK_SUCCESS)
+				throw std::runtime_error("Failed to create mip view!");
+			m_PendingViews.push_back(view);
+		}
+
+		const VkImageView* views = m_PendingViews.data() + firstView;
+
+		//-- Clear the counter once the previous recording is done with it.
+		VkMemoryBarrier counterBarrier{};
+		counterBarrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+		counterBarrier.srcAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT;
+		counterBarrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+		vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 1, &counterBarrier, 0, nullptr, 0, nullptr);
+		vkCmdFillBuffer(commandBuffer, m_CounterBuffer.GetBuffer(), 0, VK_WHOLE_SIZE, 0);
+
+		//-- Level 0 after its upload, and every other level, move to GENERAL.
+		VkImageMemoryBarrier levelBarriers[2]{};
+		for (VkImageMemoryBarrier& barrier : levelBarriers)
+		{
+			barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+			barrier.newLayout = VK_IMAGE_LAYOUT_GENERAL;
+			barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+			barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+			barrier.image = image;
+			barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT;
+		}
+		levelBarriers[0].oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+		levelBarriers[0].srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+		levelBarriers[0].subresourceRange = { VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1 };
+		levelBarriers[1].oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+		levelBarriers[1].subresourceRange = { VK_IMAGE_ASPECT_COLOR_BIT, 1, mipCount - 1, 0, 1 };
+
+		VkMemoryBarrier clearBarrier{};
+		clearBarrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+		clearBarrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+		clearBarrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT;
+		vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0, 1, &clearBarrier, 0, nullptr, 2, levelBarriers);
+
+		//-- Downsample. One pass covers the whole chain up to 4096 texels, larger bases take more.
+		m_Pipeline.Bind(commandBuffer);
+
+		MipDownsampleConstants constants{};
+		constants.m_Srgb = format == VK_FORMAT_R8G8B8A8_SRGB ? 1 : 0;
+
+		for (uint32_t base = 0; base + 1 < mipCount;)
+		{
+			const uint32_t baseWidth = std::max(width >> base, 1u);
+			const uint32_t baseHeight = std::max(height >> base, 1u);
+
+			// The last group's second reduction needs level 6 in a single tile.
+			const uint32_t maxLevels = std::max(baseWidth, baseHeight) > s_TileSize * s_TileSize ? 6 : s_MaxLevelsPerPass;
+			const uint32_t levelCount = std::min(mipCount - 1 - base, maxLevels);
+
+			// Array elements past the pass's last level are never touched, but must still be valid.
+			std::vector<DescriptorResource> resources;
+			resources.reserve(s_MaxLevelsPerPass + 2);
+			for (uint32_t level = 0; level <= s_MaxLevelsPerPass; ++level)
+				resources.push_back(DescriptorResource::Image(VK_NULL_HANDLE, views[base + std::min(level, levelCount)], VK_IMAGE_LAYOUT_GENERAL));
+			resources.push_back(DescriptorResource::Buffer(m_CounterBuffer.GetBuffer()));
+
+			const uint32_t groupsX = (baseWidth + s_TileSize - 1) / s_TileSize;
+			const uint32_t groupsY = (baseHeight + s_TileSize - 1) / s_TileSize;
+			constants.m_BaseSize = { baseWidth, baseHeight };
+			constants.m_LevelCount = levelCount;
+			constants.m_GroupCount = groupsX * groupsY;
+
+			m_Pipeline.BindDescriptorSet(commandBuffer, m_DescriptorCache.Request(resources));
+			m_Pipeline.PushConstants(commandBuffer, constants);
+			vkCmdDispatch(commandBuffer, groupsX, groupsY, 1);
+
+			base += levelCount;
+
+			// The next pass starts from this one's last level.
+			VkMemoryBarrier passBarrier{};
+			passBarrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+			passBarrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+			passBarrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT;
+			if (base + 1 < mipCount)
+				vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0, 1, &passBarrier, 0, nullptr, 0, nullptr);
+		}
+
+		//-- Every level to sampling.
+		VkImageMemoryBarrier readBarrier{};
+		readBarrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+		readBarrier.oldLayout = VK_IMAGE_LAYOUT_GENERAL;
+		readBarrier.newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+		readBarrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+		readBarrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+		readBarrier.image = image;
+		readBarrier.subresourceRange = { VK_IMAGE_ASPECT_COLOR_BIT, 0, mipCount, 0, 1 };
+		readBarrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+		readBarrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+		vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, 0, 0, nullptr, 0, nullptr, 1, &readBarrier);
+	}
+
+	void VulkanMipGenerator::ReleaseRecorded()
+	{
+		const VkDevice device = VulkanLogicalDevice::Get().GetLogicalDevice();
+		for (const VkImageView view : m_PendingViews)
+			vkDestroyImageView(device, view, nullptr);
+
+		m_PendingViews.clear();
+		m_DescriptorCache.Reset();
+	}
+
+	void VulkanMipGenerator::RecordBlit(VkCommandBuffer commandBuffer, VkImage image, const VkFormat format, const uint32_t width, const uint32_t height, const uint32_t mipCount)
+	{
+		if (mipCount > 1)
+		{
+			VkFormatProperties properties;
+			vkGetPhysicalDeviceFormatProperties(VulkanPhysicalDevice::Get().GetPhysicalDevice(), format, &properties);
+			if (!(properties.optimalTilingFeatures & VK_FORMAT_FEATURE_SAMPLED_IMAGE_FILTER_LINEAR_BIT))
+				throw std::runtime_error("Texture format does not support linear blitting!");
+		}
+
+		VkImageMemoryBarrier barrier{};
+		barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+		barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+		barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+		barrier.image = image;
+		barrier.subresourceRange = { VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1 };
+
+		//-- Each level is blitted from the one before, which is then done and moves to sampling.
+		int32_t mipWidth = static_cast<int32_t>(width);
+		int32_t mipHeight = static_cast<int32_t>(height);
+
+		for (uint32_t mip = 1; mip < mipCount; ++mip)
+		{
+			barrier.subresourceRange.baseMipLevel = mip - 1;
+			barrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+			barrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+			barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+			barrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+			vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 0, nullptr, 1, &barrier);
+
+			// Later levels are still UNDEFINED, the blit destination must be TRANSFER_DST_OPTIMAL.
+			VkImageMemoryBarrier destinationBarrier = barrier;
+			destinationBarrier.subresourceRange.baseMipLevel = mip;
+			destinationBarrier.oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+			destinationBarrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+			destinationBarrier.srcAccessMask = 0;
+			destinationBarrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+			vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 0, nullptr, 1, &destinationBarrier);
+
+			const int32_t nextWidth = std::max(mipWidth / 2, 1);
+			const int32_t nextHeight = std::max(mipHeight / 2, 1);
+
+			VkImageBlit blit{};
+			blit.srcOffsets[1] = { mipWidth, mipHeight, 1 };
+			blit.srcSubresource = { VK_IMAGE_ASPECT_COLOR_BIT, mip - 1, 0, 1 };
+			blit.dstOffsets[1] = { nextWidth, nextHeight, 1 };
+			blit.dstSubresource = { VK_IMAGE_ASPECT_COLOR_BIT, mip, 0, 1 };
+			vkCmdBlitImage(commandBuffer, image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &blit, VK_FILTER_LINEAR);
+
+			barrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+			barrier.newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+			barrier.srcAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+			barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+			vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, 0, 0, nullptr, 0, nullptr, 1, &barrier);
+
+			mipWidth = nextWidth;
+			mipHeight = nextHeight;
+		}
+
+		//-- The last level was only ever written.
+		barrier.subresourceRange.baseMipLevel = mipCount - 1;
+		barrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+		barrier.newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+		barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+		barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+		vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, 0, 0, nullptr, 0, nullptr, 1, &barrier);
+	}
+}
@@ -0,0 +1,58 @@
+﻿/*!
+\file		VulkanMipGenerator.h
+\date		19/10/2026
+
+\author		Adrian Tan
+\email		t.xingkhiangadrian\@digipen.edu
+
+\brief		Contains definition of VulkanMipGenerator class.
+
+\copyright	All content © 2023 DigiPen (SINGAPORE) Corporation, all rights reserved.
+			Reproduction or disclosure of this file or its contents without the
+			prior written consent of DigiPen Institute of Technology is prohibited.
+__________________________________________________________________________________*/
+#pragma once
+
+#include "VulkanComputePipeline.h"
+#include "VulkanDescriptorCache.h"
+#include "VulkanStorageBuffer.h"
+
+namespace Nya
+{
+	// Fills a 2D image's mip chain from level 0. The default path is a single-pass compute downsampler
+	// (Shaders/mip_downsample.comp) that writes up to 12 levels per dispatch, for RGBA8 images whose
+	// format can be a storage image. Anything else falls back to a chain of linear vkCmdBlitImage.
+	class VulkanMipGenerator
+	{
+		VulkanComputePipeline m_Pipeline;
+		VulkanDescriptorCache m_DescriptorCache;
+		VulkanStorageBuffer m_CounterBuffer;		// Groups done with their tile, the last one reduces the rest.
+		std::vector<VkImageView> m_PendingViews;	// Per-level views of recorded generations.
+
+		void RecordCompute(VkCommandBuffer commandBuffer, VkImage image, VkFormat format, uint32_t width, uint32_t height, uint32_t mipCount);
+
+	public:
+		static constexpr uint32_t s_GroupSize = 256;		// Must match local_size_x in mip_downsample.comp.
+		static constexpr uint32_t s_TileSize = 64;			// Level 0 texels per group and axis.
+		static constexpr uint32_t s_MaxLevelsPerPass = 12;	// Must match the mips array size in mip_downsample.comp, minus one.
+
+		void Init();
+		void Cleanup();
+
+		static uint32_t GetMipCount(uint32_t width, uint32_t height);
+		// True if the compute path handles format. Such images need GetImageUsage and GetImageFlags at creation.
+		static bool SupportsCompute(VkFormat format);
+		static VkImageUsageFlags GetImageUsage(VkFormat format);
+		static VkImageCreateFlags GetImageFlags(VkFormat format);
+
+		// Records generation of levels 1..mipCount-1 from level 0, which must be in VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL.
+		// Leaves every level in VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, visible to fragment shaders.
+		// Recordings share a counter buffer, so run them in submission order on one queue.
+		void Record(VkCommandBuffer commandBuffer, VkImage image, VkFormat format, uint32_t width, uint32_t height, uint32_t mipCount);
+		// Destroys the views of everything recorded so far. Only call once those command buffers have completed.
+		void ReleaseRecorded();
+
+		// Fallback path, needs no Init. Throws if format cannot be blitted with linear filtering.
+		static void RecordBlit(VkCommandBuffer commandBuffer, VkImage image, VkFormat format, uint32_t width, uint32_t height, uint32_t mipCount);
+	};
+}
@@ -59,11 +59,82 @@ namespace Nya
 
 
 	//-- VulkanPhysicalDevice Functions.
+	void VulkanPhysicalDevice::QueryExtensionSupport()
+	{
+		uint32_t extensionCount = 0;
+		vkEnumerateDeviceExtensionProperties(m_PhysicalDevice, nullptr, &extensionCount, nullptr);
+
+		std::vector<VkExtensionProperties> extensions(extensionCount);
+		vkEnumerateDeviceExtensionProperties(m_PhysicalDevice, nullptr, &extensionCount, extensions.data());
+
+		m_SupportedExtensions.clear();
+		for (const auto& extension : extensions)
+			m_SupportedExtensions.insert(extension.extensionName);
+
+		vkGetPhysicalDeviceFeatures(m_PhysicalDevice, &m_Features);
+
+		// Descriptor indexing features and limits, needed for the bindless path.
+		m_DescriptorIndexingFeatures = {};
+		m_DescriptorIndexingFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES_EXT;
+		m_DescriptorIndexingProperties = {};
+		m_DescriptorIndexingProperties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_PROPERTIES_EXT;
+
+		if (!IsExtensionSupported(VK_EXT_DESCRIPTOR_INDEXING_EXTENSION_NAME))
+			return;
+
+		VkPhysicalDeviceFeatures2 features2{};
+		features2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+		features2.pNext = &m_DescriptorIndexingFeatures;
+		vkGetPhysicalDeviceFeatures2(m_PhysicalDevice, &features2);
+
+		VkPhysicalDeviceProperties2 properties2{};
+		properties2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2;
+		properties2.pNext = &m_DescriptorIndexingProperties;
+		vkGetPhysicalDeviceProperties2(m_PhysicalDevice, &properties2);
+
+		// Don't keep pointers into this stack frame.
+		m_DescriptorIndexingFeatures.pNext = nullptr;
+		m_DescriptorIndexingProperties.pNext = nullptr;
+	}
+
 	VkPhysicalDevice VulkanPhysicalDevice::GetPhysicalDevice() const
 	{
 		return m_PhysicalDevice;
 	}
 
+	bool VulkanPhysicalDevice::IsExtensionSupported(const char* extensionName) const
+	{
+		return m_SupportedExtensions.contains(extensionName);
+	}
+
+	bool VulkanPhysicalDevice::SupportsBindless() const
+	{
+		const auto& features = m_DescriptorIndexingFeatures;
+		return
+			IsExtensionSupported(VK_EXT_DESCRIPTOR_INDEXING_EXTENSION_NAME) &&
+			features.runtimeDescriptorArray &&
+			features.descriptorBindingPartiallyBound &&
+			features.descriptorBindingSampledImageUpdateAfterBind &&
+			features.descriptorBindingStorageBufferUpdateAfterBind &&
+			features.descriptorBindingUpdateUnusedWhilePending &&
+			features.shaderSampledImageArrayNonUniformIndexing;
+	}
+
+	const VkPhysicalDeviceFeatures& VulkanPhysicalDevice::GetFeatures() const
+	{
+		return m_Features;
+	}
+
+	const VkPhysicalDeviceDescriptorIndexingFeaturesEXT& VulkanPhysicalDevice::GetDescriptorIndexingFeatures() const
+	{
+		return m_DescriptorIndexingFeatures;
+	}
+
+	const VkPhysicalDeviceDescriptorIndexingPropertiesEXT& VulkanPhysicalDevice::GetDescriptorIndexingProperties() const
+	{
+		return m_DescriptorIndexingProperties;
+	}
+
 	void VulkanPhysicalDevice::Init()
 	{
 		// Retrieve all attached GPUs.
@@ -87,6 +158,7 @@ namespace Nya
 		if (deviceCandidates.rbegin()->first > 0)
 		{
 			m_PhysicalDevice = deviceCandidates.rbegin()->second;
+			QueryExtensionSupport();
 
 #ifdef MEOW_DEBUG
 			VkPhysicalDeviceProperties deviceProperties;
@@ -23,6 +23,13 @@ namespace Nya
 		static VulkanPhysicalDevice* s_Instance;
 
 		VkPhysicalDevice m_PhysicalDevice{};
+		std::set<std::string> m_SupportedExtensions;
+		VkPhysicalDeviceFeatures m_Features{};
+
+		VkPhysicalDeviceDescriptorIndexingFeaturesEXT m_DescriptorIndexingFeatures{};
+		VkPhysicalDeviceDescriptorIndexingPropertiesEXT m_DescriptorIndexingProperties{};
+
+		void QueryExtensionSupport();
 
 	public:
 		static VulkanPhysicalDevice& Get();
@@ -30,5 +37,13 @@ namespace Nya
 		VkPhysicalDevice GetPhysicalDevice() const;
 
 		void Init();
+
+		bool IsExtensionSupported(const char* extensionName) const;
+		bool SupportsBindless() const;
+
+		const VkPhysicalDeviceFeatures& GetFeatures() const;
+
+		const VkPhysicalDeviceDescriptorIndexingFeaturesEXT& GetDescriptorIndexingFeatures() const;
+		const VkPhysicalDeviceDescriptorIndexingPropertiesEXT& GetDescriptorIndexingProperties() const;
 	};
 }
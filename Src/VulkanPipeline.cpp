@@ -58,11 +58,11 @@ namespace Nya
 	
 
 	//-- VulkanPipeline Functions.
-	void VulkanPipeline::Init(VkRenderPass renderPass)
+	void VulkanPipeline::Init(VkRenderPass renderPass, const VulkanPipelineConfig& config)
 	{
 		//-- Shaders.
-		auto vertShaderCode = ReadShaderFile("Shaders/output/vert.spv");
-		auto fragShaderCode = ReadShaderFile("Shaders/output/frag.spv");
+		auto vertShaderCode = ReadShaderFile(config.m_VertShaderPath);
+		auto fragShaderCode = config.m_DepthOnly ? std::vector<char>() : ReadShaderFile(config.m_FragShaderPath);
 
 #ifdef _DEBUG
 		std::cout << "\t" << "Vert shader byte size: " << vertShaderCode.size() << std::endl;
@@ -71,7 +71,7 @@ namespace Nya
 
 		// Create shader modules.
 		VkShaderModule vertShaderModule = CreateShaderModule(vertShaderCode);
-		VkShaderModule fragShaderModule = CreateShaderModule(fragShaderCode);
+		VkShaderModule fragShaderModule = config.m_DepthOnly ? VK_NULL_HANDLE : CreateShaderModule(fragShaderCode);
 
 		VkPipelineShaderStageCreateInfo vertShaderStageInfo{};
 		vertShaderStageInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
@@ -92,15 +92,22 @@ namespace Nya
 			fragShaderStageInfo
 		};
 
-		//-- Vertex input.
-		auto bindingDescription = Vertex::GetBindingDescription();
-		auto attributeDescription = Vertex::GetAttributeDescription();
+		//-- Vertex input, defaults to Vertex's layout if the config has none.
+		std::vector<VkVertexInputBindingDescription> bindingDescriptions = config.m_VertexBindings;
+		std::vector<VkVertexInputAttributeDescription> attributeDescriptions = config.m_VertexAttributes;
+		if (bindingDescriptions.empty() && attributeDescriptions.empty())
+		{
+			const auto attributes = Vertex::GetAttributeDescription();
+			bindingDescriptions.push_back(Vertex::GetBindingDescription());
+			attributeDescriptions.assign(attributes.begin(), attributes.end());
+		}
+
 		VkPipelineVertexInputStateCreateInfo vertexInputInfo{};
 		vertexInputInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO;
-		vertexInputInfo.vertexBindingDescriptionCount = 1;
-		vertexInputInfo.pVertexBindingDescriptions = &bindingDescription;
-		vertexInputInfo.vertexAttributeDescriptionCount = static_cast<uint32_t>(attributeDescription.size());
-		vertexInputInfo.pVertexAttributeDescriptions = attributeDescription.data();
+		vertexInputInfo.vertexBindingDescriptionCount = static_cast<uint32_t>(bindingDescriptions.size());
+		vertexInputInfo.pVertexBindingDescriptions = bindingDescriptions.data();
+		vertexInputInfo.vertexAttributeDescriptionCount = static_cast<uint32_t>(attributeDescriptions.size());
+		vertexInputInfo.pVertexAttributeDescriptions = attributeDescriptions.data();
 
 		//-- Input assembly.
 		VkPipelineInputAssemblyStateCreateInfo inputAssembly{};
@@ -154,7 +161,15 @@ namespace Nya
 		multisampling.alphaToOneEnable = VK_FALSE;		// Optional.
 
 		//-- Depth and Stencil testing.
-		/// Disabled for now, so just passing nullptr when creating pipeline.
+		/// Used by depth-only pipelines and pipelines with m_DepthTest, others pass nullptr.
+		const bool depthTest = config.m_DepthOnly || config.m_DepthTest;
+		VkPipelineDepthStencilStateCreateInfo depthStencil{};
+		depthStencil.sType = VK_STRUCTURE_TYPE_PIPELINE_DEPTH_STENCIL_STATE_CREATE_INFO;
+		depthStencil.depthTestEnable = VK_TRUE;
+		depthStencil.depthWriteEnable = config.m_DepthOnly || config.m_DepthWrite ? VK_TRUE : VK_FALSE;
+		depthStencil.depthCompareOp = config.m_DepthCompareOp;
+		depthStencil.depthBoundsTestEnable = VK_FALSE;
+		depthStencil.stencilTestEnable = VK_FALSE;
 
 		//-- Color blending.
 		VkPipelineColorBlendAttachmentState colorBlendAttachment{};
@@ -165,7 +180,7 @@ namespace Nya
 		colorBlending.sType = VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO;
 		colorBlending.logicOpEnable = VK_FALSE;
 		colorBlending.logicOp = VK_LOGIC_OP_COPY;
-		colorBlending.attachmentCount = 1;
+		colorBlending.attachmentCount = config.m_DepthOnly ? 0 : 1;
 		colorBlending.pAttachments = &colorBlendAttachment;
 		colorBlending.blendConstants[0] = 0.f;
 		colorBlending.blendConstants[1] = 0.f;
@@ -186,10 +201,12 @@ namespace Nya
 		//-- Create pipeline layout.
 		VkPipelineLayoutCreateInfo pipelineLayout{};
 		pipelineLayout.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
-		pipelineLayout.setLayoutCount = 0;				// Optional.
-		pipelineLayout.pSetLayouts = nullptr;			// Optional.
-		pipelineLayout.pushConstantRangeCount = 0;		// Optional.
-		pipelineLayout.pPushConstantRanges = nullptr;	// Optional.
+		pipelineLayout.setLayoutCount = static_cast<uint32_t>(config.m_SetLayouts.size());
+		pipelineLayout.pSetLayouts = config.m_SetLayouts.data();
+		pipelineLayout.pushConstantRangeCount = static_cast<uint32_t>(config.m_PushConstantRanges.size());
+		pipelineLayout.pPushConstantRanges = config.m_PushConstantRanges.data();
+
+		m_PushConstantRanges = config.m_PushConstantRanges;
 
 		if (vkCreatePipelineLayout(VulkanLogicalDevice::Get().GetLogicalDevice(), &pipelineLayout, nullptr, &m_PipelineLayout) != VK_SUCCESS)
 			throw std::runtime_error("Failed to create pipeline layout!");
@@ -197,13 +214,14 @@ namespace Nya
 		//-- Create pipeline.
 		VkGraphicsPipelineCreateInfo pipelineInfo{};
 		pipelineInfo.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
-		pipelineInfo.stageCount = 2;
+		pipelineInfo.stageCount = config.m_DepthOnly ? 1 : 2;
 		pipelineInfo.pStages = shaderStages;
 		pipelineInfo.pVertexInputState = &vertexInputInfo;
 		pipelineInfo.pInputAssemblyState = &inputAssembly;
 		pipelineInfo.pViewportState = &viewportState;
 		pipelineInfo.pRasterizationState = &rasterizer;
 		pipelineInfo.pMultisampleState = &multisampling;
+		pipelineInfo.pDepthStencilState = depthTest ? &depthStencil : nullptr;
 		pipelineInfo.pColorBlendState = &colorBlending;
 		pipelineInfo.pDynamicState = &dynamicState;
 		pipelineInfo.layout = m_PipelineLayout;
@@ -216,7 +234,8 @@ namespace Nya
 
 		//-- Cleanup.
 		vkDestroyShaderModule(VulkanLogicalDevice::Get().GetLogicalDevice(), vertShaderModule, nullptr);
-		vkDestroyShaderModule(VulkanLogicalDevice::Get().GetLogicalDevice(), fragShaderModule, nullptr);
+		if (fragShaderModule)
+			vkDestroyShaderModule(VulkanLogicalDevice::Get().GetLogicalDevice(), fragShaderModule, nullptr);
 	}
 
 	void VulkanPipeline::Cleanup() const
@@ -15,17 +15,92 @@ ________________________________________________________________________________
 
 #include <vulkan/vulkan_core.h>
 
+#include "ShaderData.h"
+
 namespace Nya
 {
+	// Shader helpers, shared with VulkanComputePipeline.
+	std::vector<char> ReadShaderFile(const std::string& filePath);
+	VkShaderModule CreateShaderModule(const std::vector<char>& shaderCode);
+
+	// Push constant range sized for T, checked against the guaranteed push constant limit.
+	template <typename T>
+	VkPushConstantRange MakePushConstantRange(const VkShaderStageFlags stageFlags, const uint32_t offset = 0)
+	{
+		static_assert(std::is_trivially_copyable_v<T>, "Push constant data must be trivially copyable!");
+		static_assert(sizeof(T) % 4 == 0, "Push constant size must be a multiple of 4!");
+		static_assert(sizeof(T) <= g_MaxPushConstantSize, "Push constant data is too big!");
+
+		VkPushConstantRange range{};
+		range.stageFlags = stageFlags;
+		range.offset = offset;
+		range.size = static_cast<uint32_t>(sizeof(T));
+
+		return range;
+	}
+
+	struct VulkanPipelineConfig
+	{
+		std::string m_VertShaderPath = "Shaders/output/vert.spv";
+		std::string m_FragShaderPath = "Shaders/output/frag.spv";
+
+		// Depth and shadow passes: no fragment stage or colour output, depth test and write on.
+		// The render pass must have a depth attachment and no colour attachments.
+		bool m_DepthOnly = false;
+		// Colour passes with a depth attachment test against it, and write it unless a depth prepass already did.
+		bool m_DepthTest = false;
+		bool m_DepthWrite = true;
+		VkCompareOp m_DepthCompareOp = VK_COMPARE_OP_LESS;
+
+		std::vector<VkDescriptorSetLayout> m_SetLayouts;
+		std::vector<VkPushConstantRange> m_PushConstantRanges;
+
+		// Left empty to use Vertex::Layout on binding 0.
+		std::vector<VkVertexInputBindingDescription> m_VertexBindings;
+		std::vector<VkVertexInputAttributeDescription> m_VertexAttributes;
+
+		template <typename T>
+		VulkanPipelineConfig& AddPushConstant(const VkShaderStageFlags stageFlags, const uint32_t offset = 0)
+		{
+			m_PushConstantRanges.push_back(MakePushConstantRange<T>(stageFlags, offset));
+			return *this;
+		}
+
+		// Adds a binding fed by a VertexLayout, see VertexLayout.h.
+		template <typename TLayout>
+		VulkanPipelineConfig& AddVertexLayout(const uint32_t binding = 0, const VkVertexInputRate inputRate = VK_VERTEX_INPUT_RATE_VERTEX)
+		{
+			const auto attributes = TLayout::GetAttributeDescriptions(binding);
+			m_VertexBindings.push_back(TLayout::GetBindingDescription(binding, inputRate));
+			m_VertexAttributes.insert(m_VertexAttributes.end(), attributes.begin(), attributes.end());
+			return *this;
+		}
+	};
+
 	class VulkanPipeline
 	{
 		VkPipelineLayout m_PipelineLayout{};
 		VkPipeline m_GraphicsPipeline{};
 
+		std::vector<VkPushConstantRange> m_PushConstantRanges;
+
 	public:
-		void Init(VkRenderPass renderPass);
+		void Init(VkRenderPass renderPass, const VulkanPipelineConfig& config = {});
 		void Cleanup() const;
 
+		// Records push constants for T, using the stages of the layout's range at offset.
+		template <typename T>
+		void PushConstants(VkCommandBuffer commandBuffer, const T& data, uint32_t offset = 0) const
+		{
+			static_assert(std::is_trivially_copyable_v<T>, "Push constant data must be trivially copyable!");
+
+			const auto range = std::ranges::find_if(m_PushConstantRanges, [offset](const VkPushConstantRange& r) { return r.offset == offset; });
+			if (range == m_PushConstantRanges.end() || range->size < sizeof(T))
+				throw std::runtime_error("No push constant range in pipeline layout fits the pushed data!");
+
+			vkCmdPushConstants(commandBuffer, m_PipelineLayout, range->stageFlags, offset, static_cast<uint32_t>(sizeof(T)), &data);
+		}
+
 		VkPipeline GetPipeline() const;
 		VkPipelineLayout GetLayout() const;
 	};
@@ -22,7 +22,12 @@ namespace Nya
 		VkRenderPass m_RenderPass{};
 
 	public:
-		void Init();
+		// Colour pass onto the swapchain image. With a depthFormat, attachment 1 is depth: cleared and written here,
+		// or, with depthPrepass, loaded read only from an earlier InitDepthOnly pass that already wrote it.
+		void Init(VkFormat depthFormat = VK_FORMAT_UNDEFINED, bool depthPrepass = false);
+		// Depth prepass, the only attachment is depth. It is cleared, or with loadDepth loaded read only from an earlier
+		// depth-only pass, and left read only for the passes after it. Both variants share framebuffers.
+		void InitDepthOnly(VkFormat depthFormat, bool loadDepth = false);
 		void Cleanup() const;
 
 		VkRenderPass GetRenderPass() const;
@@ -1,11 +1,24 @@
 #include "VulkanRenderer.h"
 
+#include "BlockCompressor.h"
+#include "Bvh.h"
+#include "DrawList.h"
+#include "FrustumCuller.h"
+#include "GltfLoader.h"
+#include "MeshOptimizer.h"
+#include "MeshSimplifier.h"
+#include "Meshlet.h"
+#include "OcclusionRasterizer.h"
+#include "PixelConverter.h"
+#include "ThreadPool.h"
 #include "Vertex.h"
 #include "VulkanLogicalDevice.h"
 #include "VulkanPhysicalDevice.h"
 #include "VulkanSwapChain.h"
 #include "VulkanDebugger.h"
 
+#include <glm/gtc/matrix_transform.hpp>
+
 constexpr uint32_t WIN_WIDTH = 800;		// Window width.
 constexpr uint32_t WIN_HEIGHT = 600;	// Window height.
 
@@ -27,6 +40,103 @@ const std::vector<uint32_t> Indices =
 	0, 1, 2, 2, 3, 0
 };
 
+// Circle of diameter 1 in concentric rings of segments vertices around a center vertex, coloured by angle,
+// fading to white at the center.
+static void BuildDisc(const uint32_t segments, const uint32_t rings, std::vector<Nya::Vertex>& vertices, std::vector<uint32_t>& indices)
+{
+	vertices.clear();
+	indices.clear();
+	vertices.push_back({ { 0.f, 0.f }, { 1.f, 1.f, 1.f } });
+	for (uint32_t ring = 1; ring <= rings; ++ring)
+	{
+		const float radius = static_cast<float>(ring) / static_cast<float>(rings);
+		for (uint32_t i = 0; i < segments; ++i)
+		{
+			const float angle = glm::two_pi<float>() * static_cast<float>(i) / static_cast<float>(segments);
+			const glm::vec3 colour = glm::vec3(0.5f) + 0.5f * glm::cos(glm::vec3(angle, angle + 2.094f, angle + 4.189f));
+			vertices.push_back({ { std::cos(angle) * radius * 0.5f, std::sin(angle) * radius * 0.5f }, glm::mix(glm::vec3(1.f), colour, radius) });
+		}
+	}
+
+	// A fan around the center, then two triangles per segment between consecutive rings.
+	const auto vertex = [segments](const uint32_t ring, const uint32_t i) { return 1 + (ring - 1) * segments + i % segments; };
+	for (uint32_t i = 0; i < segments; ++i)
+		indices.insert(indices.end(), { 0, vertex(1, i), vertex(1, i + 1) });
+	for (uint32_t ring = 1; ring < rings; ++ring)
+	{
+		for (uint32_t i = 0; i < segments; ++i)
+			indices.insert(indices.end(), { vertex(ring, i), vertex(ring + 1, i), vertex(ring + 1, i + 1), vertex(ring, i), vertex(ring + 1, i + 1), vertex(ring, i + 1) });
+	}
+}
+
+// The disc's LODs, simplified from 64 segments and 8 rings. Its rim is a locked border, so every level keeps the
+// full outline, and it is flat, so the errors are only rounding.
+static Nya::LodChain BuildDiscLods(std::vector<Nya::Vertex>& vertices)
+{
+	std::vector<uint32_t> indices;
+	BuildDisc(64, 8, vertices, indices);
+
+	std::vector<glm::vec3> positions;
+	for (const Nya::Vertex& vertex : vertices)
+		positions.emplace_back(vertex.pos, 0.f);
+
+	return Nya::MeshSimplifier::BuildLodChain(indices, &positions[0].x, sizeof(glm::vec3), static_cast<uint32_t>(positions.size()));
+}
+
+// Prints the disc's LOD chain. Throws unless it has several levels, each with at most 9/10 of the triangles before it,
+// errors that start at 0 and never shrink, and every level keeps the rim within rounding of the full disc.
+static void CheckDiscLods()
+{
+	std::vector<Nya::Vertex> vertices;
+	const auto startTime = std::chrono::high_resolution_clock::now();
+	const Nya::LodChain chain = BuildDiscLods(vertices);
+	const auto endTime = std::chrono::high_resolution_clock::now();
+
+	if (chain.m_Lods.size() < 3)
+		throw std::runtime_error("Disc LOD chain has " + std::to_string(chain.m_Lods.size()) + " levels, expected at least 3!");
+	if (chain.m_Lods[0].m_Error != 0.f)
+		throw std::runtime_error("Disc LOD 0 has a non-zero error!");
+
+	constexpr float maxError = 1e-4f;
+	std::string triangles;
+	for (size_t lod = 0; lod < chain.m_Lods.size(); ++lod)
+	{
+		const Nya::MeshLod& level = chain.m_Lods[lod];
+		if (lod > 0)
+		{
+			const Nya::MeshLod& previous = chain.m_Lods[lod - 1];
+			if (level.m_IndexCount > previous.m_IndexCount * 9 / 10)
+				throw std::runtime_error("Disc LOD " + std::to_string(lod) + " doesn't reduce the triangles of the one before it!");
+			if (level.m_Error < previous.m_Error)
+				throw std::runtime_error("Disc LOD " + std::to_string(lod) + " has a smaller error than the one before it!");
+		}
+		if (!(level.m_Error <= maxError))
+			throw std::runtime_error("Disc LOD " + std::to_string(lod) + " error " + std::to_string(level.m_Error) + " is out of bounds for a flat mesh!");
+
+		// Every rim vertex still in use, so the outline matches LOD 0 exactly.
+		float maxRadius = 0.f;
+		uint32_t rimVertices = 0;
+		std::vector<uint8_t> used(vertices.size(), 0);
+		for (uint32_t i = level.m_FirstIndex; i < level.m_FirstIndex + level.m_IndexCount; ++i)
+			used[chain.m_Indices[i]] = 1;
+		for (size_t i = 0; i < vertices.size(); ++i)
+		{
+			if (!used[i])
+				continue;
+			const float radius = glm::length(vertices[i].pos);
+			maxRadius = std::max(maxRadius, radius);
+			rimVertices += radius > 0.5f - maxError;
+		}
+		if (rimVertices != 64 || std::abs(maxRadius - 0.5f) > maxError)
+			throw std::runtime_error("Disc LOD " + std::to_string(lod) + " lost part of the rim!");
+
+		triangles += (lod ? "/" : "") + std::to_string(level.m_IndexCount / 3);
+	}
+
+	std::cout << "\t" << "Disc LOD chain: " << chain.m_Lods.size() << " levels of " << triangles << " triangles, max error " << chain.m_Lods.back().m_Error
+		<< ", built in " << std::chrono::duration<float, std::chrono::milliseconds::period>(endTime - startTime).count() << "ms" << std::endl;
+}
+
 
 using namespace Nya;
 
@@ -53,20 +163,114 @@ void MeowRenderer::Init()
 	glfwSetFramebufferSizeCallback(m_Window, FrameBufferResizedCallbackFn);
 
 	// Initialize all singleton objects.
+	ThreadPool::Get().Init();
 	VulkanContext::Get().Init(m_Window);
 	VulkanPhysicalDevice::Get().Init();
 	VulkanLogicalDevice::Get().Init();
 	VulkanSwapchain::Get().Init();
 
-	// Create render pass.
+	// The GPU-driven path needs indirect draws with a non-zero firstInstance, see VulkanGpuScene.
+	const bool gpuDriven = VulkanLogicalDevice::Get().IsDrawIndirectFirstInstanceEnabled();
+
+	// Create depth buffer and render passes. The GPU-driven path writes depth in a prepass of positions only,
+	// so the colour pass shades each pixel once and only tests against it. Without it the colour pass writes depth.
+	const VkExtent2D extent = VulkanSwapchain::Get().GetSwapChainImageExtents();
+	m_DepthBuffer.Init(extent.width, extent.height);
+
 	m_RenderPass = std::make_shared<VulkanRenderpass>();
-	m_RenderPass->Init();
+	m_RenderPass->Init(m_DepthBuffer.GetFormat(), gpuDriven);
+	if (gpuDriven)
+	{
+		m_DepthPass = std::make_shared<VulkanRenderpass>();
+		m_DepthPass->InitDepthOnly(m_DepthBuffer.GetFormat());
+		m_DepthLatePass = std::make_shared<VulkanRenderpass>();
+		m_DepthLatePass->InitDepthOnly(m_DepthBuffer.GetFormat(), true);
+	}
 	// Create frame buffers.
-	VulkanSwapchain::Get().CreateSwapChainFramebuffers(m_RenderPass->GetRenderPass());
+	CreateFramebuffers();
+
+	// Create frame uniforms, one buffer per frame in flight, and the set 0 layouts that hold them.
+	for (auto& buffer : m_FrameUniformBuffers)
+		buffer.Init(sizeof(FrameUniforms), VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT);
+
+	m_FrameDescriptors.Init(
+	{
+		{ 0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1, VK_SHADER_STAGE_VERTEX_BIT, nullptr }	// Frame uniforms.
+	});
+	m_GpuFrameDescriptors.Init(
+	{
+		{ 0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1, VK_SHADER_STAGE_VERTEX_BIT, nullptr },	// Frame uniforms.
+		{ 1, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_VERTEX_BIT, nullptr }	// GPU scene instances.
+	});
+
+	// Create bindless descriptor heap, if the GPU supports descriptor indexing. It is set 1 of the colour pass pipelines,
+	// whose fragments sample their material's texture from it, see Shaders/bindless.frag.
+	if (VulkanBindlessHeap::IsSupported())
+	{
+		m_BindlessHeap = std::make_shared<VulkanBindlessHeap>();
+		m_BindlessHeap->Init();
+	}
+
+	// Create graphics pipeline. instanced.vert reads nothing per draw, the push constant range is there so the layout
+	// matches the draw list pipeline below, which pushes each packet's model and material.
+	VulkanPipelineConfig pipelineConfig;
+	pipelineConfig.AddPushConstant<DrawPushConstants>(VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT);
+	pipelineConfig.m_SetLayouts.push_back(m_FrameDescriptors.GetLayout());
+	if (m_BindlessHeap)
+	{
+		pipelineConfig.m_SetLayouts.push_back(m_BindlessHeap->GetLayout());
+		pipelineConfig.m_FragShaderPath = "Shaders/output/bindless_frag.spv";
+	}
+	pipelineConfig.m_DepthTest = true;
+	// Positions and colours come from separate streams (see VulkanMeshBuffer), per-instance data from a third.
+	pipelineConfig.m_VertShaderPath = "Shaders/output/instanced_vert.spv";
+	VulkanInstanceRenderer::AddVertexLayouts(pipelineConfig);
 
-	// Create graphics pipeline.
 	m_Pipeline = std::make_shared<VulkanPipeline>();
-	m_Pipeline->Init(m_RenderPass->GetRenderPass());
+	m_Pipeline->Init(m_RenderPass->GetRenderPass(), pipelineConfig);
+
+	// Create draw list pipeline, the same layout without the instance stream, so the sets stay bound between the two.
+	if (!gpuDriven)
+	{
+		VulkanPipelineConfig drawPipelineConfig = pipelineConfig;
+		drawPipelineConfig.m_VertexBindings.clear();
+		drawPipelineConfig.m_VertexAttributes.clear();
+		drawPipelineConfig.m_VertShaderPath = "Shaders/output/bindless_vert.spv";
+		drawPipelineConfig.AddVertexLayout<Vertex::PositionLayout>(0).AddVertexLayout<Vertex::AttributeLayout>(1);
+
+		m_DrawPipeline = std::make_shared<VulkanPipeline>();
+		m_DrawPipeline->Init(m_RenderPass->GetRenderPass(), drawPipelineConfig);
+	}
+
+	// Create GPU-driven pipelines, instances come from the GPU scene's buffer, indexed by firstInstance, instead of an instance stream.
+	if (gpuDriven)
+	{
+		// Nothing is pushed, the shaders only include Shaders/frame_uniforms.glsl.
+		VulkanPipelineConfig gpuPipelineConfig;
+		gpuPipelineConfig.m_SetLayouts.push_back(m_GpuFrameDescriptors.GetLayout());
+		gpuPipelineConfig.m_VertShaderPath = "Shaders/output/gpu_driven_depth_vert.spv";
+		gpuPipelineConfig.m_DepthOnly = true;
+		gpuPipelineConfig.AddVertexLayout<Vertex::PositionLayout>(0);
+
+		m_DepthPipeline = std::make_shared<VulkanPipeline>();
+		m_DepthPipeline->Init(m_DepthPass->GetRenderPass(), gpuPipelineConfig);
+
+		// The colour pass keeps only the fragments the prepass left in front.
+		gpuPipelineConfig.m_VertShaderPath = "Shaders/output/gpu_driven_vert.spv";
+		gpuPipelineConfig.m_DepthOnly = false;
+		gpuPipelineConfig.m_DepthTest = true;
+		gpuPipelineConfig.m_DepthWrite = false;
+		gpuPipelineConfig.m_DepthCompareOp = VK_COMPARE_OP_LESS_OR_EQUAL;
+		gpuPipelineConfig.AddVertexLayout<Vertex::AttributeLayout>(1);
+		if (m_BindlessHeap)
+		{
+			gpuPipelineConfig.m_SetLayouts.push_back(m_BindlessHeap->GetLayout());
+			gpuPipelineConfig.m_FragShaderPath = "Shaders/output/bindless_frag.spv";
+		}
+
+		m_GpuPipeline = std::make_shared<VulkanPipeline>();
+		m_GpuPipeline->Init(m_RenderPass->GetRenderPass(), gpuPipelineConfig);
+	}
 
 	/*// Create frame buffers.
 	for (size_t i = 0; i < VulkanSwapchain::Get().GetSwapChainImageViews().size(); ++i)
@@ -94,17 +298,253 @@ void MeowRenderer::Init()
 		m_CommandBuffers.push_back(commandBuffer);
 	}
 
+	// Create mip generator, a compute downsampler shared by every texture upload.
+	m_MipGenerator.Init();
+
+	// Create texture loader, image files decode on the thread pool and upload as they finish.
+	m_TextureLoader = std::make_shared<VulkanTextureLoader>();
+	m_TextureLoader->Init(m_CommandPool->GetCommandPool(), &m_MipGenerator);
+
 	// Create sync objects (semaphores and fences).
 	m_SyncObjects = std::make_shared<VulkanSyncObjects>();
 	m_SyncObjects->Init();
 
-	// Create vertex buffer.
-	m_VertexBuffer = std::make_shared<VulkanVertexBuffer>();
-	m_VertexBuffer->Init(Vertices, m_CommandPool->GetCommandPool());
+	// Create material textures. The checker is registered first, so it is material 0, the default of MaterialRef.
+	if (m_BindlessHeap)
+	{
+		std::array<uint32_t, 8 * 8> checker;
+		for (uint32_t i = 0; i < checker.size(); ++i)
+			checker[i] = ((i / 8 + i % 8) % 2) ? 0xffc0c0c0 : 0xffffffff;
+
+		m_DefaultTexture.Init(checker.data(), 8, 8, m_CommandPool->GetCommandPool(), &m_MipGenerator);
+		m_BindlessHeap->RegisterImage(m_DefaultTexture.GetView(), m_DefaultTexture.GetSampler());
+		m_WallTexture = m_TextureLoader->Load("Assets/sad cat.jpg");
+	}
+
+	// Create static batch, every mesh shares its vertex buffer (positions split from the other attributes) and index buffer.
+	// Filled by CreateScene.
+	m_StaticBatch = std::make_shared<VulkanStaticBatch>();
+
+	// Create instance renderer, entities are drawn through it when there is no GPU scene.
+	m_InstanceRenderer = std::make_shared<VulkanInstanceRenderer>();
+	m_InstanceRenderer->Init();
+
+	// Create GPU scene, culled in compute and drawn with one indirect draw per batch.
+	// Its culling also tests occlusion against a Hi-Z pyramid of the depth prepass.
+	if (m_GpuPipeline)
+	{
+		m_GpuScene = std::make_shared<VulkanGpuScene>();
+		m_GpuScene->Init();
+		m_HiZPyramid.Init(extent.width, extent.height, m_CommandPool->GetCommandPool());
+	}
+
+	// Create CPU occlusion buffer, the GPU scene has its own occlusion culling.
+	if (!m_GpuScene)
+		m_OcclusionRasterizer.Init();
+
+	// Pick LODs whose error stays under a pixel, see UpdateFrameUniforms for the field of view.
+	m_LodSelector.SetThreshold(1.f);
+
+	CreateScene();
+	m_StartTime = std::chrono::steady_clock::now();
+}
+
+void MeowRenderer::CreateFramebuffers()
+{
+	VulkanSwapchain::Get().CreateSwapChainFramebuffers(m_RenderPass->GetRenderPass(), m_DepthBuffer.GetView());
+	if (m_DepthPass)
+	{
+		VkImageView attachments[] = { m_DepthBuffer.GetView() };
+		m_DepthFramebuffer.Init(0, attachments, m_DepthPass->GetRenderPass());
+	}
+}
+
+void MeowRenderer::RecreateSwapchain()
+{
+	// Waits for the device to idle, so the depth attachment can go too.
+	VulkanSwapchain::Get().Recreate(VK_NULL_HANDLE);
+	if (m_DepthPass)
+		m_DepthFramebuffer.Cleanup();
+
+	const VkExtent2D extent = VulkanSwapchain::Get().GetSwapChainImageExtents();
+	m_DepthBuffer.Resize(extent.width, extent.height);
+	if (m_GpuScene)
+	{
+		m_HiZPyramid.Resize(extent.width, extent.height, m_CommandPool->GetCommandPool());
+		m_GpuScene->ResetPyramidSets();
+	}
+	CreateFramebuffers();
+}
+
+void MeowRenderer::RecordDepthPrepass(const VkCommandBuffer commandBuffer, const VulkanRenderpass& renderPass, const VkDescriptorSet frameSet, const bool late) const
+{
+	VkClearValue clearDepth{};
+	clearDepth.depthStencil = { 1.f, 0 };
+
+	// The late pass loads the depth instead, and ignores the clear value.
+	VkRenderPassBeginInfo depthPassInfo{};
+	depthPassInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
+	depthPassInfo.renderPass = renderPass.GetRenderPass();
+	depthPassInfo.framebuffer = m_DepthFramebuffer.GetFramebuffer();
+	depthPassInfo.renderArea.extent = VulkanSwapchain::Get().GetSwapChainImageExtents();
+	depthPassInfo.clearValueCount = 1;
+	depthPassInfo.pClearValues = &clearDepth;
+
+	vkCmdBeginRenderPass(commandBuffer, &depthPassInfo, VK_SUBPASS_CONTENTS_INLINE);
+	vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, m_DepthPipeline->GetPipeline());
+	vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, m_DepthPipeline->GetLayout(), 0, 1, &frameSet, 0, nullptr);
+	m_StaticBatch->Bind(commandBuffer, VertexStreams::Position);
+	if (late)
+		m_GpuScene->DrawLate(commandBuffer, m_GpuBatch);
+	else
+		m_GpuScene->Draw(commandBuffer, m_GpuBatch);
+	vkCmdEndRenderPass(commandBuffer);
+}
+
+uint32_t MeowRenderer::AddLodMesh(const std::vector<uint32_t>& ranges, const std::vector<float>& errors, const float radius)
+{
+	LodMesh& mesh = m_Meshes.emplace_back();
+	for (size_t lod = 0; lod < ranges.size(); ++lod)
+	{
+		const StaticBatchRange& range = m_StaticBatch->GetRange(ranges[lod]);
+		mesh.m_Lods.push_back({ range.m_FirstIndex, range.m_IndexCount, errors[lod] });
+		mesh.m_Meshes.push_back(m_InstanceRenderer->AddMesh(*m_StaticBatch, ranges[lod]));
+
+		DrawPacket& draw = mesh.m_Draws.emplace_back();
+		draw.m_Mesh = m_BatchDrawMesh;
+		draw.m_FirstIndex = range.m_FirstIndex;
+		draw.m_IndexCount = range.m_IndexCount;
+		draw.m_VertexOffset = range.m_VertexOffset;
+		if (m_GpuScene)
+			mesh.m_GpuMeshes.push_back(m_GpuScene->AddMesh(range.m_IndexCount, range.m_FirstIndex, range.m_VertexOffset, glm::vec3(0.f), radius));
+	}
 
-	// Create index buffer.
-	m_IndexBuffer = std::make_shared<VulkanIndexBuffer>();
-	m_IndexBuffer->Init(Indices, m_CommandPool->GetCommandPool());
+	return static_cast<uint32_t>(m_Meshes.size() - 1);
+}
+
+void MeowRenderer::CreateScene()
+{
+	//-- Meshes. The discs get a LOD chain from the mesh simplifier, each level a range of its own.
+	const uint32_t quadRange = m_StaticBatch->AddMesh(Vertices, Indices);
+
+	std::vector<Vertex> discVertices;
+	const LodChain discChain = BuildDiscLods(discVertices);
+	std::vector<uint32_t> discRanges;
+	std::vector<float> discErrors;
+	for (const MeshLod& lod : discChain.m_Lods)
+	{
+		const auto first = discChain.m_Indices.begin() + lod.m_FirstIndex;
+		discRanges.push_back(m_StaticBatch->AddMesh(discVertices, std::vector<uint32_t>(first, first + lod.m_IndexCount)));
+		discErrors.push_back(lod.m_Error);
+	}
+	m_StaticBatch->Build(m_CommandPool->GetCommandPool());
+
+	// Every range draws out of the batch's buffers, so the draw list sees them as one mesh.
+	uint32_t drawPipeline = MaterialRef::s_Instanced;
+	if (m_DrawPipeline)
+	{
+		drawPipeline = m_DrawListRecorder.AddPipeline(*m_DrawPipeline);
+		m_BatchDrawMesh = m_DrawListRecorder.AddMesh(m_StaticBatch->GetMeshBuffer(), m_StaticBatch->GetIndexBuffer());
+	}
+
+	const uint32_t quadMesh = AddLodMesh({ quadRange }, { 0.f }, std::sqrt(0.5f));
+
+	// The quad is its own occluder.
+	OccluderMesh& quadOccluder = m_OccluderMeshes.emplace_back();
+	for (const Vertex& vertex : Vertices)
+		quadOccluder.m_Positions.emplace_back(vertex.pos, 0.f);
+	quadOccluder.m_Indices = Indices;
+	const uint32_t discMesh = AddLodMesh(discRanges, discErrors, 0.5f);
+	if (m_GpuScene)
+		m_GpuBatch = m_GpuScene->AddBatch();
+
+	//-- Nodes first, so every entity starts with its world matrix.
+	constexpr uint32_t gridSize = 32;
+	constexpr float spacing = 1.25f;
+	std::vector<uint32_t> nodes;
+	for (uint32_t y = 0; y < gridSize; ++y)
+	{
+		for (uint32_t x = 0; x < gridSize; ++x)
+		{
+			const glm::vec3 position(static_cast<float>(x) - (gridSize - 1) * 0.5f, static_cast<float>(y) - (gridSize - 1) * 0.5f, 0.f);
+			nodes.push_back(m_Transforms.AddNode(TransformHierarchy::s_None, position * spacing));
+			if ((x + y) % 7 == 0)
+				m_SpinningNodes.push_back(nodes.back());
+		}
+	}
+	// Walls between the camera and the grid, so the Hi-Z cull has something to reject as the camera sweeps.
+	const size_t firstWall = nodes.size();
+	for (const float x : { -12.f, 0.f, 12.f })
+		nodes.push_back(m_Transforms.AddNode(TransformHierarchy::s_None, glm::vec3(x, 0.f, 6.f), glm::quat(1.f, 0.f, 0.f, 0.f), glm::vec3(5.f, 12.f, 1.f)));
+	m_Transforms.Update();
+
+	// Bounds are derived from these every SyncTransforms.
+	const LocalBounds quadBounds{ glm::vec3(0.f), glm::vec3(0.5f, 0.5f, 0.f) };
+	for (size_t i = 0; i < nodes.size(); ++i)
+	{
+		// Grid entities are instanced discs, the walls quads drawn one by one. Everything starts at LOD 0 and SelectLods
+		// takes it from there.
+		const bool wall = i >= firstWall;
+		const uint32_t mesh = wall ? quadMesh : discMesh;
+		const MaterialRef material{ 0, wall ? drawPipeline : MaterialRef::s_Instanced };
+
+		const glm::mat4& world = m_Transforms.GetWorldMatrix(nodes[i]);
+		const GpuInstanceRef instance = m_GpuScene ? GpuInstanceRef{ m_GpuScene->AddInstance(m_Meshes[mesh].m_GpuMeshes[0], m_GpuBatch, world, material.m_Material),
+			m_Meshes[mesh].m_GpuMeshes[0], material.m_Material } : GpuInstanceRef{};
+		const Entity entity = m_Entities.CreateEntity(Transform{ world }, TransformNode{ nodes[i] }, MeshRef{ mesh }, material, quadBounds, Bounds{},
+			Visibility{}, instance);
+		if (wall)
+		{
+			m_Entities.AddComponent(entity, Occluder{ 0 });
+			m_Walls.push_back(entity);
+		}
+		else
+			m_Entities.AddComponent(entity, Occludee{});
+	}
+
+	if (m_GpuScene)
+		m_GpuScene->Upload(m_CommandPool->GetCommandPool());
+}
+
+void MeowRenderer::UpdateMaterials()
+{
+	if (!m_BindlessHeap || m_WallMaterialReady || m_TextureLoader->GetState(m_WallTexture) != TextureLoadState::Ready)
+		return;
+
+	// A new slot, so frames in flight never see the slot they read change.
+	const VulkanTexture& texture = m_TextureLoader->GetTexture(m_WallTexture);
+	const uint32_t material = m_BindlessHeap->RegisterImage(texture.GetView(), texture.GetSampler());
+	for (const Entity wall : m_Walls)
+		m_Entities.GetComponent<MaterialRef>(wall)->m_Material = material;
+
+	m_WallMaterialReady = true;
+}
+
+void MeowRenderer::AnimateScene(const float time)
+{
+	const glm::quat rotation = glm::angleAxis(time, glm::vec3(0.f, 0.f, 1.f));
+	for (const uint32_t node : m_SpinningNodes)
+		m_Transforms.SetLocalRotation(node, rotation);
+}
+
+glm::mat4 MeowRenderer::UpdateFrameUniforms(const float time)
+{
+	// The camera sweeps across the grid, so the frustum culls a changing part of it, and moves in and out, so LODs change.
+	const VkExtent2D extent = VulkanSwapchain::Get().GetSwapChainImageExtents();
+	const glm::vec3 eye(std::sin(time * 0.25f) * 16.f, 0.f, 24.f + std::sin(time * 0.15f) * 14.f);
+	const float fovY = glm::radians(60.f);
+	m_CameraPosition = eye;
+	m_LodSelector.SetProjection(fovY, static_cast<float>(extent.height));
+
+	FrameUniforms uniforms;
+	uniforms.m_View = glm::lookAt(eye, glm::vec3(eye.x * 0.5f, 0.f, 0.f), glm::vec3(0.f, 1.f, 0.f));
+	uniforms.m_Proj = glm::perspective(fovY, static_cast<float>(extent.width) / static_cast<float>(std::max(extent.height, 1u)), 0.1f, 100.f);
+	uniforms.m_Proj[1][1] *= -1.f;	// Vulkan's clip space y points down.
+
+	// This frame's fence was waited on, so its buffer is no longer read.
+	memcpy(m_FrameUniformBuffers[m_CurrentFrame].GetMappedData(), &uniforms, sizeof(uniforms));
+
+	return uniforms.m_Proj * uniforms.m_View;
 }
 
 void MeowRenderer::Update()
@@ -112,6 +552,8 @@ void MeowRenderer::Update()
 	while (!glfwWindowShouldClose(m_Window))
 	{
 		glfwPollEvents();
+		m_TextureLoader->Update();
+		UpdateMaterials();
 		Draw();
 	}
 
@@ -128,31 +570,7 @@ void MeowRenderer::RecordCommandBuffer(const VkCommandBuffer commandBuffer, cons
 	if (vkBeginCommandBuffer(commandBuffer, &beginInfo) != VK_SUCCESS)
 		throw std::runtime_error("Failed to begin recording command buffer!");
 
-	VkRenderPassBeginInfo renderPassInfo{};
-	renderPassInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
-	renderPassInfo.renderPass = m_RenderPass->GetRenderPass();
-	renderPassInfo.framebuffer = VulkanSwapchain::Get().GetSwapChainFramebuffers()[imageIndex];
-	renderPassInfo.renderArea.offset = { 0,0 };
-	renderPassInfo.renderArea.extent = VulkanSwapchain::Get().GetSwapChainImageExtents();
-
-	constexpr VkClearValue clearColor = { 0.f, 0.f, 0.f, 1.f };
-	renderPassInfo.clearValueCount = 1;
-	renderPassInfo.pClearValues = &clearColor;
-
-	vkCmdBeginRenderPass(commandBuffer, &renderPassInfo, VK_SUBPASS_CONTENTS_INLINE);
-	vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, m_Pipeline->GetPipeline());
-
-	const VkBuffer vertexBuffers[] =
-	{
-		m_VertexBuffer->GetBuffer()
-	};
-	constexpr VkDeviceSize offsets[] =
-	{
-		0
-	};
-	vkCmdBindVertexBuffers(commandBuffer, 0, 1, vertexBuffers, offsets);
-	vkCmdBindIndexBuffer(commandBuffer, m_IndexBuffer->GetBuffer(), 0, VK_INDEX_TYPE_UINT32);
-
+	// Dynamic state lasts for the whole command buffer, across render passes.
 	VkViewport viewport;
 	viewport.x = 0.f;
 	viewport.y = 0.f;
@@ -167,8 +585,87 @@ void MeowRenderer::RecordCommandBuffer(const VkCommandBuffer commandBuffer, cons
 	scissor.extent = VulkanSwapchain::Get().GetSwapChainImageExtents();
 	vkCmdSetScissor(commandBuffer, 0, 1, &scissor);
 
-	//vkCmdDraw(commandBuffer, static_cast<uint32_t>(Vertices.size()), 1, 0, 0); // Redundant, doesn't use index buffer.
-	vkCmdDrawIndexed(commandBuffer, static_cast<uint32_t>(Indices.size()), 1, 0, 0, 0);
+	//-- Scene.
+	const float time = std::chrono::duration<float>(std::chrono::steady_clock::now() - m_StartTime).count();
+	AnimateScene(time);
+	m_Transforms.Update();
+	RenderSystems::SyncTransforms(m_Entities, m_Transforms);
+	const glm::mat4 viewProj = UpdateFrameUniforms(time);
+	const Frustum frustum = Frustum::FromMatrix(viewProj);
+	RenderSystems::SelectLods(m_Entities, m_Meshes, m_LodSelector, m_CameraPosition);
+
+	//-- GPU scene, this frame's edits go up and get culled with everything else, outside the render passes.
+	const VkBuffer frameUniforms = m_FrameUniformBuffers[m_CurrentFrame].GetBuffer();
+	VkDescriptorSet gpuFrameSet{};
+	if (m_GpuScene)
+	{
+		RenderSystems::SyncGpuScene(m_Entities, *m_GpuScene, m_Meshes);
+		m_GpuScene->UploadChanges(commandBuffer, m_CurrentFrame);
+		gpuFrameSet = m_GpuFrameDescriptors.Request({ DescriptorResource::Buffer(frameUniforms), DescriptorResource::Buffer(m_GpuScene->GetInstanceBuffer()) });
+
+		//-- Two-phase occlusion culling with depth prepasses, positions only.
+		// What last frame's pyramid shows visible writes depth first, the pyramid is rebuilt from that depth,
+		// and what the early phase rejected is retested against it and added to the depth.
+		m_GpuScene->CullEarly(commandBuffer, frustum, viewProj, m_HiZPyramid);
+		RecordDepthPrepass(commandBuffer, *m_DepthPass, gpuFrameSet, false);
+		m_HiZPyramid.Build(commandBuffer, m_DepthBuffer.GetView(), VK_IMAGE_LAYOUT_DEPTH_STENCIL_READ_ONLY_OPTIMAL);
+		m_GpuScene->CullLate(commandBuffer, m_HiZPyramid);
+		RecordDepthPrepass(commandBuffer, *m_DepthLatePass, gpuFrameSet, true);
+	}
+
+	VkRenderPassBeginInfo renderPassInfo{};
+	renderPassInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
+	renderPassInfo.renderPass = m_RenderPass->GetRenderPass();
+	renderPassInfo.framebuffer = VulkanSwapchain::Get().GetSwapChainFramebuffers()[imageIndex];
+	renderPassInfo.renderArea.offset = { 0,0 };
+	renderPassInfo.renderArea.extent = VulkanSwapchain::Get().GetSwapChainImageExtents();
+
+	// Depth is only cleared without a prepass, the render pass ignores the value otherwise.
+	VkClearValue clearValues[2]{};
+	clearValues[0].color = { 0.f, 0.f, 0.f, 1.f };
+	clearValues[1].depthStencil = { 1.f, 0 };
+	renderPassInfo.clearValueCount = 2;
+	renderPassInfo.pClearValues = clearValues;
+
+	vkCmdBeginRenderPass(commandBuffer, &renderPassInfo, VK_SUBPASS_CONTENTS_INLINE);
+
+	if (m_GpuScene)
+	{
+		// Every visible instance of the batch in one indirect draw per phase.
+		vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, m_GpuPipeline->GetPipeline());
+		vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, m_GpuPipeline->GetLayout(), 0, 1, &gpuFrameSet, 0, nullptr);
+		if (m_BindlessHeap)
+			m_BindlessHeap->Bind(commandBuffer, m_GpuPipeline->GetLayout(), 1);
+		m_StaticBatch->Bind(commandBuffer);
+		m_GpuScene->Draw(commandBuffer, m_GpuBatch);
+		m_GpuScene->DrawLate(commandBuffer, m_GpuBatch);
+	}
+	else
+	{
+		// Only entities in the frustum are drawn. Both pipelines share a layout, so the sets are bound once for them.
+		const VkDescriptorSet frameSet = m_FrameDescriptors.Request({ DescriptorResource::Buffer(frameUniforms) });
+		vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, m_Pipeline->GetLayout(), 0, 1, &frameSet, 0, nullptr);
+		if (m_BindlessHeap)
+			m_BindlessHeap->Bind(commandBuffer, m_Pipeline->GetLayout(), 1);
+		RenderSystems::Cull(m_Entities, frustum);
+
+		// What the walls hide is rejected too, against their depth rasterized on the CPU.
+		m_OcclusionRasterizer.Begin(viewProj);
+		RenderSystems::AddOccluders(m_Entities, m_OcclusionRasterizer, m_OccluderMeshes);
+		m_OcclusionRasterizer.Rasterize();
+		RenderSystems::CullOccluded(m_Entities, m_OcclusionRasterizer);
+
+		// Entities of their own first, sorted front to back per material with their data in push constants.
+		m_DrawList.Clear();
+		RenderSystems::BuildDrawList(m_Entities, m_Meshes, m_DrawList, viewProj);
+		m_DrawList.Sort();
+		m_DrawListRecorder.Record(commandBuffer, m_DrawList);
+
+		// Then the instanced ones, per-object data in the instance stream and one draw per mesh and material pair.
+		vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, m_Pipeline->GetPipeline());
+		RenderSystems::SubmitInstances(m_Entities, *m_InstanceRenderer, m_Meshes);
+		m_InstanceRenderer->Flush(commandBuffer, m_CurrentFrame);
+	}
 	vkCmdEndRenderPass(commandBuffer);
 
 	if (vkEndCommandBuffer(commandBuffer) != VK_SUCCESS)
@@ -181,6 +678,10 @@ void MeowRenderer::Draw()
 	const auto fence1 = m_SyncObjects->GetInFlightFenceAt(m_CurrentFrame);
 	vkWaitForFences(VulkanLogicalDevice::Get().GetLogicalDevice(), 1, &fence1, VK_TRUE, UINT64_MAX);
 
+	//-- Recycle bindless slots released the last time this frame was in flight.
+	if (m_BindlessHeap)
+		m_BindlessHeap->BeginFrame(m_CurrentFrame);
+
 	//-- Acquire image from swap chain.
 	uint32_t imageIndex;
 	VkResult result = vkAcquireNextImageKHR(VulkanLogicalDevice::Get().GetLogicalDevice(), VulkanSwapchain::Get().GetSwapChain(), UINT64_MAX, m_SyncObjects->GetImageAvailableSemaphoreAt(m_CurrentFrame), VK_NULL_HANDLE, &imageIndex);
@@ -188,7 +689,7 @@ void MeowRenderer::Draw()
 	//-- Check if swap chain is out of date.
 	if (result == VK_ERROR_OUT_OF_DATE_KHR)
 	{
-		VulkanSwapchain::Get().Recreate(m_RenderPass->GetRenderPass());
+		RecreateSwapchain();
 		return;
 	}
 	if (result != VK_SUCCESS)
@@ -249,7 +750,7 @@ void MeowRenderer::Draw()
 	if (result == VK_ERROR_OUT_OF_DATE_KHR || result == VK_SUBOPTIMAL_KHR || m_FrameBufferResized)
 	{
 		m_FrameBufferResized = !m_FrameBufferResized;
-		VulkanSwapchain::Get().Recreate(m_RenderPass->GetRenderPass());
+		RecreateSwapchain();
 	}
 	else if (result != VK_SUCCESS)
 		throw std::runtime_error("Failed to present swap-chain image!");
@@ -260,17 +761,49 @@ void MeowRenderer::Draw()
 
 void MeowRenderer::Release()
 {
+	m_TextureLoader->Cleanup();
+	m_MipGenerator.Cleanup();
 	m_SyncObjects->Cleanup();
 	m_CommandPool->Cleanup();
 	m_Pipeline->Cleanup();
+	if (m_DrawPipeline)
+		m_DrawPipeline->Cleanup();
+	if (m_GpuPipeline)
+		m_GpuPipeline->Cleanup();
+	if (m_DepthPipeline)
+		m_DepthPipeline->Cleanup();
 	m_RenderPass->Cleanup();
+	if (m_DepthPass)
+	{
+		m_DepthFramebuffer.Cleanup();
+		m_DepthPass->Cleanup();
+		m_DepthLatePass->Cleanup();
+	}
+	m_DepthBuffer.Cleanup();
 
-	m_VertexBuffer->Cleanup();
-	m_IndexBuffer->Cleanup();
+	m_FrameDescriptors.Cleanup();
+	m_GpuFrameDescriptors.Cleanup();
+	for (auto& buffer : m_FrameUniformBuffers)
+		buffer.Cleanup();
+
+	m_StaticBatch->Cleanup();
+	m_InstanceRenderer->Cleanup();
+	if (m_GpuScene)
+	{
+		m_GpuScene->Cleanup();
+		m_HiZPyramid.Cleanup();
+	}
+
+	if (m_BindlessHeap)
+	{
+		m_DefaultTexture.Cleanup();
+		m_BindlessHeap->Cleanup();
+	}
 
 	VulkanSwapchain::Get().Cleanup();
 	VulkanLogicalDevice::Get().Cleanup();
 	VulkanContext::Get().Cleanup();
+	ThreadPool::Get().Cleanup();
 }
 
 void MeowRenderer::FlagFrameBufferResized()
@@ -281,3 +814,31 @@ void MeowRenderer::FlagFrameBufferResized()
 
 	m_FrameBufferResized = true;
 }
+
+void MeowRenderer::RunBenchmarks(const std::string& gltfPath)
+{
+	// CPU-side systems only, no window or device is created. Each benchmark throws if its results are wrong.
+	ThreadPool::Get().Init();
+
+	constexpr std::array pathNames = { "scalar", "sse", "avx2" };
+	std::cout << "Benchmarks on " << ThreadPool::Get().GetConcurrency() << " threads, widest SIMD path "
+		<< pathNames[static_cast<uint32_t>(GetBestSimdPath())] << std::endl;
+#ifdef _DEBUG
+	std::cout << "Debug build, timings are not representative!" << std::endl;
+#endif
+
+	CheckDiscLods();
+	MeshOptimizer::Benchmark(100000);
+	MeshletCuller::Benchmark(100000);
+	FrustumCuller::BenchmarkCull(1000000);
+	Bvh::Benchmark(100000);
+	DrawList::BenchmarkSort(100000);
+	OcclusionRasterizer::Benchmark(20000);
+	TransformHierarchy::Benchmark(100000, 300);
+	BlockCompressor::Benchmark(256, 256);
+	VulkanTextureLoader::BenchmarkDecode("Assets/texture.jpeg", 64);
+	PixelConverter::Benchmark(1 << 20);
+	GltfLoader::Benchmark(gltfPath);
+
+	ThreadPool::Get().Cleanup();
+}
@@ -6,12 +6,23 @@
 #include "VulkanCommandPool.h"
 #include "VulkanContext.h"
 #include "VulkanDefines.h"
+#include "VulkanDepthBuffer.h"
+#include "VulkanDescriptorCache.h"
+#include "VulkanDrawList.h"
 #include "VulkanFrameBuffer.h"
+#include "VulkanGpuScene.h"
+#include "VulkanHiZPyramid.h"
+#include "VulkanHostBuffer.h"
+#include "VulkanMipGenerator.h"
 #include "VulkanPipeline.h"
 #include "VulkanRenderPass.h"
 #include "VulkanSyncObjects.h"
-#include "VulkanVertexBuffer.h"
-#include "VulkanIndexBuffer.h"
+#include "VulkanStaticBatch.h"
+#include "VulkanInstanceRenderer.h"
+#include "VulkanBindlessHeap.h"
+#include "OcclusionRasterizer.h"
+#include "VulkanTextureLoader.h"
+#include "RenderComponents.h"
 
 
 class MeowRenderer
@@ -19,21 +30,81 @@ class MeowRenderer
 	static std::unique_ptr<MeowRenderer> s_Instance;
 
 	std::shared_ptr<Nya::VulkanRenderpass> m_RenderPass;
-	std::shared_ptr<Nya::VulkanPipeline> m_Pipeline;
+	std::shared_ptr<Nya::VulkanPipeline> m_Pipeline;		// Instanced, used when there is no GPU scene.
+	std::shared_ptr<Nya::VulkanPipeline> m_DrawPipeline;	// One draw per entity through the draw list, null with a GPU scene.
+	std::shared_ptr<Nya::VulkanPipeline> m_GpuPipeline;	// Indirect draws of the GPU scene, null without one.
+
+	// Depth prepass of the GPU scene, all null without one. The late pass adds what the late cull found on top of the early depth.
+	std::shared_ptr<Nya::VulkanRenderpass> m_DepthPass;
+	std::shared_ptr<Nya::VulkanRenderpass> m_DepthLatePass;
+	std::shared_ptr<Nya::VulkanPipeline> m_DepthPipeline;
+	Nya::VulkanFramebuffer m_DepthFramebuffer;
+	Nya::VulkanDepthBuffer m_DepthBuffer;
+
+	// Set 0: frame uniforms, plus the GPU scene's instance buffer for m_GpuPipeline.
+	Nya::VulkanDescriptorCache m_FrameDescriptors;
+	Nya::VulkanDescriptorCache m_GpuFrameDescriptors;
+	std::array<Nya::VulkanHostBuffer, Nya::g_MaxFramesInFlight> m_FrameUniformBuffers;
 
 	std::shared_ptr<Nya::VulkanCommandPool> m_CommandPool;
 	std::vector<std::shared_ptr<Nya::VulkanCommandBuffer>> m_CommandBuffers;
 
 	std::shared_ptr<Nya::VulkanSyncObjects> m_SyncObjects;
 
+	std::shared_ptr<Nya::VulkanBindlessHeap> m_BindlessHeap;	// Null if descriptor indexing is unsupported.
+
+	Nya::VulkanMipGenerator m_MipGenerator;	// Fills every texture's mip chain, blits are only its fallback.
+	std::shared_ptr<Nya::VulkanTextureLoader> m_TextureLoader;
+
+	// Culls and draws on the GPU. Null if drawIndirectFirstInstance is unsupported, entities then go through m_InstanceRenderer.
+	std::shared_ptr<Nya::VulkanGpuScene> m_GpuScene;
+	uint32_t m_GpuBatch = 0;
+	Nya::VulkanHiZPyramid m_HiZPyramid;	// Built from the early depth each frame, only with a GPU scene.
+
 	// TESTING VARIABLES.
 	GLFWwindow* m_Window{};
 	bool m_FrameBufferResized = false;
 	int m_CurrentFrame = 0;
-	std::shared_ptr<Nya::VulkanVertexBuffer> m_VertexBuffer;
-	std::shared_ptr<Nya::VulkanIndexBuffer> m_IndexBuffer;
+	std::shared_ptr<Nya::VulkanStaticBatch> m_StaticBatch;
+	std::shared_ptr<Nya::VulkanInstanceRenderer> m_InstanceRenderer;
+	std::vector<Nya::LodMesh> m_Meshes;		// MeshRef::m_Mesh indexes these.
+	// Entities that aren't instanced, sorted and recorded through m_DrawListRecorder's tables when there is no GPU scene.
+	Nya::DrawList m_DrawList;
+	Nya::VulkanDrawList m_DrawListRecorder;
+	uint32_t m_BatchDrawMesh = 0;		// The static batch's buffers in m_DrawListRecorder.
+	// The walls, rasterized on the CPU to reject what they hide when there is no GPU scene and its Hi-Z cull.
+	Nya::OcclusionRasterizer m_OcclusionRasterizer;
+	std::vector<Nya::OccluderMesh> m_OccluderMeshes;
+	Nya::LodSelector m_LodSelector;
+	glm::vec3 m_CameraPosition{ 0.f };	// Written by UpdateFrameUniforms.
+	Nya::TransformHierarchy m_Transforms;
+	Nya::EntityWorld m_Entities;
+	std::vector<uint32_t> m_SpinningNodes;
+	// Bindless material textures. The walls use the checker until their image finishes loading.
+	Nya::VulkanTexture m_DefaultTexture;
+	uint32_t m_WallTexture = 0;			// Texture loader id.
+	bool m_WallMaterialReady = false;
+	std::vector<Nya::Entity> m_Walls;
+	std::chrono::steady_clock::time_point m_StartTime;
 	// ~TESTING VARIABLES
 
+	// Swapchain framebuffers and the depth prepass' framebuffer, sized to the swapchain.
+	void CreateFramebuffers();
+	void RecreateSwapchain();
+	// Writes the GPU scene's early or late draws into the depth buffer, positions only.
+	void RecordDepthPrepass(VkCommandBuffer commandBuffer, const Nya::VulkanRenderpass& renderPass, VkDescriptorSet frameSet, bool late) const;
+
+	// Registers every LOD of a mesh, static batch ranges finest first, with the instance renderer, the draw list and the GPU scene.
+	// Returns its index in m_Meshes.
+	uint32_t AddLodMesh(const std::vector<uint32_t>& ranges, const std::vector<float>& errors, float radius);
+	// Grid of disc entities with LODs, some of them spinning so the GPU scene gets per-frame edits, behind a few occluding walls.
+	void CreateScene();
+	void AnimateScene(float time);
+	// Points the walls' material at their image once the texture loader has it.
+	void UpdateMaterials();
+	// Writes this frame's camera, points the LOD selector at it and returns its view projection.
+	glm::mat4 UpdateFrameUniforms(float time);
+
 public:
 	static MeowRenderer& Get();
 
@@ -47,4 +118,8 @@ public:
 	void Release();
 
 	void FlagFrameBufferResized();
+
+	// Runs the CPU benchmarks and returns, see --bench in main.cpp. Build Release for representative timings.
+	// The glTF load is timed on gltfPath, or on a generated scene if it is empty.
+	static void RunBenchmarks(const std::string& gltfPath = {});
 };
\ No newline at end of file
@@ -0,0 +1,106 @@
+﻿/*!
+\file		VulkanStagingRing.cpp
+\date		19/10/2026
+
+\author		Adrian Tan
+\email		t.xingkhiangadrian\@digipen.edu
+
+\brief		Contains implementation of VulkanStagingRing class.
+
+\copyright	All content © 2023 DigiPen (SINGAPORE) Corporation, all rights reserved.
+			Reproduction or disclosure of this file or its contents without the
+			prior written consent of DigiPen Institute of Technology is prohibited.
+__________________________________________________________________________________*/
+
+#include "meowpch.h"
+
+#include "VulkanStagingRing.h"
+
+namespace Nya
+{
+	void VulkanStagingRing::Init(const VkDeviceSize capacity)
+	{
+		m_Capacity = capacity;
+		m_Head = 0;
+		m_Buffer.Init(capacity, VK_BUFFER_USAGE_TRANSFER_SRC_BIT);
+	}
+
+	void VulkanStagingRing::Cleanup()
+	{
+		m_Allocations.clear();
+		m_Buffer.Cleanup();
+	}
+
+	bool VulkanStagingRing::TryAllocateLocked(const VkDeviceSize size, StagingSlot& slot)
+	{
+		const VkDeviceSize alignedSize = (size + s_Alignment - 1) / s_Alignment * s_Alignment;
+		if (m_Allocations.empty())
+			m_Head = 0;
+
+		//-- Free space is [head, tail) once the head has wrapped, and [head, capacity) then [0, tail) before.
+		VkDeviceSize offset;
+		const VkDeviceSize tail = m_Allocations.empty() ? 0 : m_Allocations.front().m_Offset;
+		if (!m_Allocations.empty() && m_Head == tail)
+			return false;
+		if (m_Head >= tail)
+		{
+			if (m_Capacity - m_Head >= alignedSize)
+				offset = m_Head;
+			else if (tail >= alignedSize)
+				offset = 0;
+			else
+				return false;
+		}
+		else if (tail - m_Head >= alignedSize)
+			offset = m_Head;
+		else
+			return false;
+
+		m_Head = offset + alignedSize;
+		m_Allocations.push_back({ offset, alignedSize, false });
+
+		slot.m_Data = static_cast<uint8_t*>(m_Buffer.GetMappedData()) + offset;
+		slot.m_Buffer = m_Buffer.GetBuffer();
+		slot.m_Offset = offset;
+		slot.m_Size = size;
+		return true;
+	}
+
+	StagingSlot VulkanStagingRing::Allocate(const VkDeviceSize size)
+	{
+		if ((size + s_Alignment - 1) / s_Alignment * s_Alignment > m_Capacity)
+			throw std::runtime_error("Staging allocation is larger than the staging ring!");
+
+		StagingSlot slot;
+		std::unique_lock lock(m_Mutex);
+		m_SpaceReleased.wait(lock, [this, size, &slot] { return TryAllocateLocked(size, slot); });
+		return slot;
+	}
+
+	bool VulkanStagingRing::TryAllocate(const VkDeviceSize size, StagingSlot& slot)
+	{
+		std::lock_guard lock(m_Mutex);
+		return TryAllocateLocked(size, slot);
+	}
+
+	void VulkanStagingRing::Release(const StagingSlot& slot)
+	{
+		{
+			std::lock_guard lock(m_Mutex);
+			const auto allocation = std::find_if(m_Allocations.begin(), m_Allocations.end(),
+				[&slot](const Allocation& candidate) { return candidate.m_Offset == slot.m_Offset && !candidate.m_Released; });
+			if (allocation == m_Allocations.end())
+				throw std::runtime_error("Released a staging slot the ring does not own!");
+
+			allocation->m_Released = true;
+			while (!m_Allocations.empty() && m_Allocations.front().m_Released)
+				m_Allocations.pop_front();
+		}
+		m_SpaceReleased.notify_all();
+	}
+
+	VkDeviceSize VulkanStagingRing::GetCapacity() const
+	{
+		return m_Capacity;
+	}
+}
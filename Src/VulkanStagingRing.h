@@ -0,0 +1,73 @@
+﻿/*!
+\file		VulkanStagingRing.h
+\date		19/10/2026
+
+\author		Adrian Tan
+\email		t.xingkhiangadrian\@digipen.edu
+
+\brief		Contains definition of VulkanStagingRing class.
+			A persistently mapped staging buffer shared out in slots to producers
+			on any thread.
+
+\copyright	All content © 2023 DigiPen (SINGAPORE) Corporation, all rights reserved.
+			Reproduction or disclosure of this file or its contents without the
+			prior written consent of DigiPen Institute of Technology is prohibited.
+__________________________________________________________________________________*/
+#pragma once
+
+#include "VulkanHostBuffer.h"
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+
+namespace Nya
+{
+	// A range of a staging buffer, written through m_Data and copied from at m_Offset of m_Buffer.
+	struct StagingSlot
+	{
+		void* m_Data = nullptr;
+		VkBuffer m_Buffer{};
+		VkDeviceSize m_Offset = 0;
+		VkDeviceSize m_Size = 0;
+	};
+
+	// One host visible buffer that stays mapped, cut into slots so workers write upload data in place.
+	// Slots are taken in order from the head and may be released in any order. Space comes back once
+	// every slot taken before it has been released, which suits uploads that retire roughly in order.
+	class VulkanStagingRing
+	{
+		struct Allocation
+		{
+			VkDeviceSize m_Offset;
+			VkDeviceSize m_Size;
+			bool m_Released;
+		};
+
+		VulkanHostBuffer m_Buffer;
+		VkDeviceSize m_Capacity = 0;
+		VkDeviceSize m_Head = 0;
+		std::deque<Allocation> m_Allocations;		// Oldest first, the front's offset is the tail.
+
+		std::mutex m_Mutex;
+		std::condition_variable m_SpaceReleased;
+
+		bool TryAllocateLocked(VkDeviceSize size, StagingSlot& slot);
+
+	public:
+		// Slot offsets are aligned to this, enough for any texel or block size in a copy.
+		static constexpr VkDeviceSize s_Alignment = 16;
+
+		void Init(VkDeviceSize capacity);
+		void Cleanup();
+
+		// Blocks until size bytes are free. Throws if size is larger than the whole ring.
+		StagingSlot Allocate(VkDeviceSize size);
+		// Returns false instead of blocking.
+		bool TryAllocate(VkDeviceSize size, StagingSlot& slot);
+		// Hands a slot back once the GPU has finished reading it. Any thread.
+		void Release(const StagingSlot& slot);
+
+		VkDeviceSize GetCapacity() const;
+	};
+}
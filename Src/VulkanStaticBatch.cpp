@@ -0,0 +1,199 @@
+﻿/*!
+\file		VulkanStaticBatch.cpp
+\date		19/10/2026
+
+\author		Adrian Tan
+\email		t.xingkhiangadrian\@digipen.edu
+
+\brief		Contains implementation for VulkanStaticBatch class functions.
+
+\copyright	All content © 2023 DigiPen (SINGAPORE) Corporation, all rights reserved.
+			Reproduction or disclosure of this file or its contents without the
+			prior written consent of DigiPen Institute of Technology is prohibited.
+__________________________________________________________________________________*/
+
+#include "meowpch.h"
+
+#include "VulkanStaticBatch.h"
+
+namespace Nya
+{
+	void VulkanStaticBatch::ValidateIndices(const std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices)
+	{
+		if (indices.size() % 3 != 0)
+			throw std::runtime_error("Static batch meshes must be triangle lists!");
+
+		for (const uint32_t index : indices)
+		{
+			if (index >= vertices.size())
+				throw std::runtime_error("Static batch mesh index is out of range!");
+		}
+	}
+
+	uint32_t VulkanStaticBatch::AddMesh(const std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices)
+	{
+		if (m_Built)
+			throw std::runtime_error("Cannot add meshes to a static batch after it was built!");
+		ValidateIndices(vertices, indices);
+
+		const uint32_t range = static_cast<uint32_t>(m_Ranges.size());
+		m_Ranges.emplace_back();
+		m_Meshes.push_back({ range, vertices, indices });
+
+		return range;
+	}
+
+	uint32_t VulkanStaticBatch::AddStaticObject(const std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices, const glm::mat4& transform, const uint32_t material)
+	{
+		if (m_Built)
+			throw std::runtime_error("Cannot add objects to a static batch after it was built!");
+		ValidateIndices(vertices, indices);
+
+		//-- Find or start the material's merged mesh.
+		auto group = std::ranges::find(m_MaterialGroups, material, &MaterialGroup::m_Material);
+		if (group == m_MaterialGroups.end())
+		{
+			group = m_MaterialGroups.insert(group, { material, { static_cast<uint32_t>(m_Ranges.size()), {}, {} } });
+			m_Ranges.emplace_back();
+		}
+
+		//-- Append the object in world space.
+		Mesh& mesh = group->m_Mesh;
+		const uint32_t baseVertex = static_cast<uint32_t>(mesh.m_Vertices.size());
+
+		mesh.m_Vertices.reserve(mesh.m_Vertices.size() + vertices.size());
+		for (const Vertex& vertex : vertices)
+			mesh.m_Vertices.push_back({ glm::vec2{ transform * glm::vec4{ vertex.pos, 0.f, 1.f } }, vertex.color });
+
+		mesh.m_Indices.reserve(mesh.m_Indices.size() + indices.size());
+		for (const uint32_t index : indices)
+			mesh.m_Indices.push_back(baseVertex + index);
+
+		return group->m_Mesh.m_Range;
+	}
+
+	void VulkanStaticBatch::Build(VkCommandPool commandPool)
+	{
+		if (m_Built)
+			throw std::runtime_error("Static batch was already built!");
+
+		std::vector<const Mesh*> meshes;
+		meshes.reserve(m_Meshes.size() + m_MaterialGroups.size());
+		for (const Mesh& mesh : m_Meshes)
+			meshes.push_back(&mesh);
+		for (const MaterialGroup& group : m_MaterialGroups)
+			meshes.push_back(&group.m_Mesh);
+
+		//-- Lay ranges out back to back. Indices stay local to their range, so 16 bits suffice unless a single range is large.
+		uint32_t vertexCount = 0;
+		uint32_t indexCount = 0;
+		bool shortIndices = true;
+		for (const Mesh* mesh : meshes)
+		{
+			StaticBatchRange& range = m_Ranges[mesh->m_Range];
+			range.m_IndexCount = static_cast<uint32_t>(mesh->m_Indices.size());
+			range.m_FirstIndex = indexCount;
+			range.m_VertexOffset = static_cast<int32_t>(vertexCount);
+
+			vertexCount += static_cast<uint32_t>(mesh->m_Vertices.size());
+			indexCount += range.m_IndexCount;
+			shortIndices &= mesh->m_Vertices.size() <= UINT16_MAX;
+		}
+
+		if (indexCount == 0)
+			throw std::runtime_error("Cannot build an empty static batch!");
+
+		//-- One mesh buffer and one index buffer for everything.
+		std::vector<Vertex> vertices;
+		vertices.reserve(vertexCount);
+		for (const Mesh* mesh : meshes)
+			vertices.insert(vertices.end(), mesh->m_Vertices.begin(), mesh->m_Vertices.end());
+
+		m_MeshBuffer.Init(vertices, commandPool);
+
+		const VkIndexType indexType = shortIndices ? VK_INDEX_TYPE_UINT16 : VK_INDEX_TYPE_UINT32;
+		m_IndexBuffer.Init(indexCount, indexType, commandPool, [&meshes, shortIndices](void* staging)
+		{
+			uint16_t* shortOut = static_cast<uint16_t*>(staging);
+			uint32_t* out = static_cast<uint32_t*>(staging);
+			for (const Mesh* mesh : meshes)
+			{
+				if (shortIndices)
+				{
+					for (const uint32_t index : mesh->m_Indices)
+						*shortOut++ = static_cast<uint16_t>(index);
+					continue;
+				}
+
+				memcpy(out, mesh->m_Indices.data(), mesh->m_Indices.size() * sizeof(uint32_t));
+				out += mesh->m_Indices.size();
+			}
+		});
+
+		//-- Geometry lives on the GPU now.
+		for (Mesh& mesh : m_Meshes)
+		{
+			std::vector<Vertex>().swap(mesh.m_Vertices);
+			std::vector<uint32_t>().swap(mesh.m_Indices);
+		}
+		for (MaterialGroup& group : m_MaterialGroups)
+		{
+			std::vector<Vertex>().swap(group.m_Mesh.m_Vertices);
+			std::vector<uint32_t>().swap(group.m_Mesh.m_Indices);
+		}
+
+		m_Built = true;
+
+#ifdef _DEBUG
+		std::cout << "\t" << "Static batch: " << m_Ranges.size() << " ranges (" << m_MaterialGroups.size() << " merged static materials) in 2 buffers, "
+			<< vertexCount << " vertices, " << indexCount << (shortIndices ? " 16-bit" : " 32-bit") << " indices" << std::endl;
+#endif
+	}
+
+	void VulkanStaticBatch::Cleanup() const
+	{
+		if (!m_Built)
+			return;
+
+		m_MeshBuffer.Cleanup();
+		m_IndexBuffer.Cleanup();
+	}
+
+	void VulkanStaticBatch::Bind(VkCommandBuffer commandBuffer, const VertexStreams streams) const
+	{
+		m_MeshBuffer.Bind(commandBuffer, streams);
+		vkCmdBindIndexBuffer(commandBuffer, m_IndexBuffer.GetBuffer(), 0, m_IndexBuffer.GetIndexType());
+	}
+
+	void VulkanStaticBatch::Draw(VkCommandBuffer commandBuffer, const uint32_t range, const uint32_t instanceCount, const uint32_t firstInstance) const
+	{
+		const StaticBatchRange& drawRange = m_Ranges[range];
+		vkCmdDrawIndexed(commandBuffer, drawRange.m_IndexCount, instanceCount, drawRange.m_FirstIndex, drawRange.m_VertexOffset, firstInstance);
+	}
+
+	const StaticBatchRange& VulkanStaticBatch::GetRange(const uint32_t range) const
+	{
+		return m_Ranges.at(range);
+	}
+
+	uint32_t VulkanStaticBatch::GetRangeCount() const
+	{
+		return static_cast<uint32_t>(m_Ranges.size());
+	}
+
+	uint32_t VulkanStaticBatch::FindMaterialRange(const uint32_t material) const
+	{
+		const auto group = std::ranges::find(m_MaterialGroups, material, &MaterialGroup::m_Material);
+		return group == m_MaterialGroups.end() ? UINT32_MAX : group->m_Mesh.m_Range;
+	}
+
+	const VulkanMeshBuffer& VulkanStaticBatch::GetMeshBuffer() const
+	{
+		return m_MeshBuffer;
+	}
+
+	const VulkanIndexBuffer& VulkanStaticBatch::GetIndexBuffer() const
+	{
+		return m_IndexBuffer;
+	}
+}
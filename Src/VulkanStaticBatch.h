@@ -0,0 +1,87 @@
+﻿/*!
+\file		VulkanStaticBatch.h
+\date		19/10/2026
+
+\author		Adrian Tan
+\email		t.xingkhiangadrian\@digipen.edu
+
+\brief		Contains definition of VulkanStaticBatch class.
+
+\copyright	All content © 2023 DigiPen (SINGAPORE) Corporation, all rights reserved.
+			Reproduction or disclosure of this file or its contents without the
+			prior written consent of DigiPen Institute of Technology is prohibited.
+__________________________________________________________________________________*/
+#pragma once
+
+#include "Vertex.h"
+#include "VulkanIndexBuffer.h"
+#include "VulkanMeshBuffer.h"
+
+#include <vector>
+
+namespace Nya
+{
+	// Index range of one mesh inside a VulkanStaticBatch, drawn with vkCmdDrawIndexed(m_IndexCount, ..., m_FirstIndex, m_VertexOffset, ...).
+	struct StaticBatchRange
+	{
+		uint32_t m_IndexCount = 0;
+		uint32_t m_FirstIndex = 0;
+		int32_t m_VertexOffset = 0;
+	};
+
+	// Load time static batching: meshes sharing the Vertex format are merged into one mesh buffer and one
+	// index buffer, and addressed by firstIndex and vertexOffset, so they cost one allocation and one bind
+	// between them. Objects that never move can also be pre-transformed and merged per material, which
+	// turns all of a material's static objects into a single range, i.e. a single draw.
+	class VulkanStaticBatch
+	{
+		struct Mesh
+		{
+			uint32_t m_Range = 0;
+			std::vector<Vertex> m_Vertices;
+			std::vector<uint32_t> m_Indices;
+		};
+
+		struct MaterialGroup
+		{
+			uint32_t m_Material = 0;
+			Mesh m_Mesh;
+		};
+
+		// Geometry is only kept until Build.
+		std::vector<Mesh> m_Meshes;
+		std::vector<MaterialGroup> m_MaterialGroups;
+		std::vector<StaticBatchRange> m_Ranges;
+
+		VulkanMeshBuffer m_MeshBuffer;
+		VulkanIndexBuffer m_IndexBuffer;
+		bool m_Built = false;
+
+		static void ValidateIndices(const std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices);
+
+	public:
+		// Adds a mesh drawn as is, e.g. instanced or with its own transform. Returns its range.
+		uint32_t AddMesh(const std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices);
+		// Adds an object that never moves, transformed into world space now and merged with every other static
+		// object of the same material. Returns the material's merged range, shared by all of them.
+		// Positions keep Vertex::Layout's half precision, so keep world coordinates within its range.
+		uint32_t AddStaticObject(const std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices, const glm::mat4& transform, uint32_t material);
+
+		// Packs everything added into one mesh buffer and one index buffer, then drops the CPU copies.
+		// Indices are 16-bit when every range fits.
+		void Build(VkCommandPool commandPool);
+		void Cleanup() const;
+
+		// Binds the shared streams and index buffer, once for every range of the batch.
+		void Bind(VkCommandBuffer commandBuffer, VertexStreams streams = VertexStreams::All) const;
+		void Draw(VkCommandBuffer commandBuffer, uint32_t range, uint32_t instanceCount = 1, uint32_t firstInstance = 0) const;
+
+		const StaticBatchRange& GetRange(uint32_t range) const;
+		uint32_t GetRangeCount() const;
+		// Merged range of a material's static objects, UINT32_MAX if it has none.
+		uint32_t FindMaterialRange(uint32_t material) const;
+
+		const VulkanMeshBuffer& GetMeshBuffer() const;
+		const VulkanIndexBuffer& GetIndexBuffer() const;
+	};
+}
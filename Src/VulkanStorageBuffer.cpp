@@ -0,0 +1,31 @@
+﻿/*!
+\file		VulkanStorageBuffer.cpp
+\date		19/10/2026
+
+\author		Adrian Tan
+\email		t.xingkhiangadrian\@digipen.edu
+
+\brief		Contains implementation for VulkanStorageBuffer class functions.
+
+\copyright	All content © 2023 DigiPen (SINGAPORE) Corporation, all rights reserved.
+			Reproduction or disclosure of this file or its contents without the
+			prior written consent of DigiPen Institute of Technology is prohibited.
+__________________________________________________________________________________*/
+
+#include "meowpch.h"
+
+#include "VulkanStorageBuffer.h"
+
+namespace Nya
+{
+	void VulkanStorageBuffer::Init(const VkDeviceSize size, const VkBufferUsageFlags extraUsage)
+	{
+		m_Size = size;
+		CreateBuffer(size, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT | extraUsage, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, m_Buffer, m_BufferMemory);
+	}
+
+	void VulkanStorageBuffer::Init(const VkDeviceSize size, VkCommandPool commandPool, const StagingWriteFn& writeStaging, const VkBufferUsageFlags extraUsage)
+	{
+		CreateDeviceLocalBuffer(size, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | extraUsage, commandPool, writeStaging);
+	}
+}
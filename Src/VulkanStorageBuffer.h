@@ -0,0 +1,29 @@
+﻿/*!
+\file		VulkanStorageBuffer.h
+\date		19/10/2026
+
+\author		Adrian Tan
+\email		t.xingkhiangadrian\@digipen.edu
+
+\brief		Contains definition of VulkanStorageBuffer class.
+
+\copyright	All content © 2023 DigiPen (SINGAPORE) Corporation, all rights reserved.
+			Reproduction or disclosure of this file or its contents without the
+			prior written consent of DigiPen Institute of Technology is prohibited.
+__________________________________________________________________________________*/
+#pragma once
+
+#include "VulkanBuffers.h"
+
+namespace Nya
+{
+	// Device local storage buffer for data written by compute shaders, such as indirect draw commands.
+	class VulkanStorageBuffer : public VulkanBuffer
+	{
+	public:
+		// Uninitialized contents. extraUsage is added to STORAGE | TRANSFER_DST, e.g. VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT.
+		void Init(VkDeviceSize size, VkBufferUsageFlags extraUsage = 0);
+		// Initial contents written through a staging buffer.
+		void Init(VkDeviceSize size, VkCommandPool commandPool, const StagingWriteFn& writeStaging, VkBufferUsageFlags extraUsage = 0);
+	};
+}
@@ -177,7 +177,7 @@ namespace Nya
 		}
 	}
 
-	void VulkanSwapchain::CreateSwapChainFramebuffers(const VkRenderPass renderPass)
+	void VulkanSwapchain::CreateSwapChainFramebuffers(const VkRenderPass renderPass, const VkImageView depthView)
 	{
 		m_SwapChainFramebuffers.resize(m_SwapChainImageViews.size());
 
@@ -185,13 +185,14 @@ namespace Nya
 		{
 			const VkImageView attachments[] =
 			{
-				m_SwapChainImageViews[i]
+				m_SwapChainImageViews[i],
+				depthView
 			};
 
 			VkFramebufferCreateInfo frameBufferInfo{};
 			frameBufferInfo.sType = VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO;
 			frameBufferInfo.renderPass = renderPass;
-			frameBufferInfo.attachmentCount = 1;
+			frameBufferInfo.attachmentCount = depthView ? 2 : 1;
 			frameBufferInfo.pAttachments = attachments;
 			frameBufferInfo.width = m_SwapChainImageExtents.width;
 			frameBufferInfo.height = m_SwapChainImageExtents.height;
@@ -243,11 +244,13 @@ namespace Nya
 
 		// Cleanup current swap chain.
 		Cleanup();
+		m_SwapChainFramebuffers.clear();
 
 		// Recreate swap chain anew.
 		CreateSwapChain();
 		CreateSwapChainImageViews();
-		CreateSwapChainFramebuffers(renderPass);
+		if (renderPass)
+			CreateSwapChainFramebuffers(renderPass);
 	}
 
 	VkSwapchainKHR VulkanSwapchain::GetSwapChain() const
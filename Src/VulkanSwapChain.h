@@ -37,8 +37,11 @@ namespace Nya
 	public:
 		static VulkanSwapchain& Get();
 		void Init();
-		void CreateSwapChainFramebuffers(VkRenderPass renderPass);
+		// depthView, if any, is attachment 1 of every framebuffer.
+		void CreateSwapChainFramebuffers(VkRenderPass renderPass, VkImageView depthView = VK_NULL_HANDLE);
 		void Cleanup() const;
+		// Framebuffers are recreated for renderPass, or left to CreateSwapChainFramebuffers if it is null,
+		// so attachments sized to the new extent can be recreated first.
 		void Recreate(VkRenderPass renderPass);
 
 		VkSwapchainKHR GetSwapChain() const;
@@ -0,0 +1,516 @@
+﻿/*!
+\file		VulkanTexture.cpp
+\date		19/10/2026
+
+\author		Adrian Tan
+\email		t.xingkhiangadrian\@digipen.edu
+
+\brief		Contains implementation for VulkanTexture class functions.
+
+\copyright	All content © 2023 DigiPen (SINGAPORE) Corporation, all rights reserved.
+			Reproduction or disclosure of this file or its contents without the
+			prior written consent of DigiPen Institute of Technology is prohibited.
+__________________________________________________________________________________*/
+
+#include "meowpch.h"
+
+#include "VulkanTexture.h"
+#include "VulkanHostBuffer.h"
+#include "VulkanLogicalDevice.h"
+#include "VulkanMipGenerator.h"
+#include "VulkanPhysicalDevice.h"
+#include "VulkanQuery.h"
+
+namespace Nya
+{
+	namespace
+	{
+		VkFormat GetBlockFormat(const BlockFormat format, const bool srgb)
+		{
+			switch (format)
+			{
+			case BlockFormat::Bc1:
+				return srgb ? VK_FORMAT_BC1_RGB_SRGB_BLOCK : VK_FORMAT_BC1_RGB_UNORM_BLOCK;
+			case BlockFormat::Bc3:
+				return srgb ? VK_FORMAT_BC3_SRGB_BLOCK : VK_FORMAT_BC3_UNORM_BLOCK;
+			default:
+				return srgb ? VK_FORMAT_BC7_SRGB_BLOCK : VK_FORMAT_BC7_UNORM_BLOCK;
+			}
+		}
+
+		// Next mip level of tightly packed RGBA8 pixels, a 2x2 box filter that averages sRGB colour in linear space.
+		// Odd sizes repeat the last row and column.
+		std::vector<uint8_t> DownsampleRgba8(const uint8_t* pixels, const uint32_t width, const uint32_t height, const bool srgb)
+		{
+			static const std::array<float, 256> s_SrgbToLinear = []
+			{
+				std::array<float, 256> table{};
+				for (uint32_t i = 0; i < 256; ++i)
+				{
+					const float value = static_cast<float>(i) / 255.f;
+					table[i] = value <= 0.04045f ? value / 12.92f : std::pow((value + 0.055f) / 1.055f, 2.4f);
+				}
+				return table;
+			}();
+
+			const uint32_t levelWidth = std::max(width / 2, 1u);
+			const uint32_t levelHeight = std::max(height / 2, 1u);
+			std::vector<uint8_t> level(static_cast<size_t>(levelWidth) * levelHeight * 4);
+
+			for (uint32_t y = 0; y < levelHeight; ++y)
+			{
+				const uint32_t rows[2] = { std::min(y * 2, height - 1), std::min(y * 2 + 1, height - 1) };
+				for (uint32_t x = 0; x < levelWidth; ++x)
+				{
+					const uint32_t columns[2] = { std::min(x * 2, width - 1), std::min(x * 2 + 1, width - 1) };
+
+					float sum[4]{};
+					for (const uint32_t row : rows)
+					{
+						for (const uint32_t column : columns)
+						{
+							const uint8_t* texel = pixels + (static_cast<size_t>(row) * width + column) * 4;
+							for (uint32_t c = 0; c < 4; ++c)
+								sum[c] += srgb && c < 3 ? s_SrgbToLinear[texel[c]] : static_cast<float>(texel[c]) / 255.f;
+						}
+					}
+
+					uint8_t* output = &level[(static_cast<size_t>(y) * levelWidth + x) * 4];
+					for (uint32_t c = 0; c < 4; ++c)
+					{
+						float value = sum[c] / 4.f;
+						if (srgb && c < 3)
+							value = value <= 0.0031308f ? value * 12.92f : 1.055f * std::pow(value, 1.f / 2.4f) - 0.055f;
+						output[c] = static_cast<uint8_t>(std::clamp(value * 255.f + 0.5f, 0.f, 255.f));
+					}
+				}
+			}
+			return level;
+		}
+	}
+
+
+	void VulkanTexture::Init(const uint32_t width, const uint32_t height, const VkFormat format, const VkDeviceSize size, VkCommandPool commandPool,
+		const StagingWriteFn& writeStaging, VulkanMipGenerator* mipGenerator, const bool generateMips)
+	{
+		m_Format = format;
+		m_Width = width;
+		m_Height = height;
+		m_MipCount = generateMips ? VulkanMipGenerator::GetMipCount(width, height) : 1;
+
+		const bool computeMips = mipGenerator && m_MipCount > 1 && VulkanMipGenerator::SupportsCompute(format);
+		if (computeMips)
+			CreateImage(VulkanMipGenerator::GetImageFlags(format), VulkanMipGenerator::GetImageUsage(format));
+		else
+			CreateImage(0, VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT);
+
+		//-- Upload level 0 and generate the rest in one submission.
+		VulkanHostBuffer staging;
+		staging.Init(size, VK_BUFFER_USAGE_TRANSFER_SRC_BIT);
+		writeStaging(staging.GetMappedData());
+
+		const VkCommandBuffer commandBuffer = BeginUpload(commandPool);
+		RecordUpload(commandBuffer, staging.GetBuffer(), 0, computeMips ? mipGenerator : nullptr);
+		EndUpload(commandBuffer, commandPool);
+
+		staging.Cleanup();
+		if (computeMips)
+			mipGenerator->ReleaseRecorded();
+
+		CreateViewAndSampler();
+	}
+
+	void VulkanTexture::Init(VkCommandBuffer commandBuffer, VkBuffer staging, const VkDeviceSize stagingOffset, const uint32_t width, const uint32_t height,
+		VulkanMipGenerator* mipGenerator, const VkFormat format, const bool generateMips)
+	{
+		m_Format = format;
+		m_Width = width;
+		m_Height = height;
+		m_MipCount = generateMips ? VulkanMipGenerator::GetMipCount(width, height) : 1;
+
+		const bool computeMips = mipGenerator && m_MipCount > 1 && VulkanMipGenerator::SupportsCompute(format);
+		if (computeMips)
+			CreateImage(VulkanMipGenerator::GetImageFlags(format), VulkanMipGenerator::GetImageUsage(format));
+		else
+			CreateImage(0, VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT);
+
+		RecordUpload(commandBuffer, staging, stagingOffset, computeMips ? mipGenerator : nullptr);
+		CreateViewAndSampler();
+	}
+
+	void VulkanTexture::RecordUpload(VkCommandBuffer commandBuffer, VkBuffer staging, const VkDeviceSize stagingOffset, VulkanMipGenerator* mipGenerator) const
+	{
+		VkImageMemoryBarrier barrier{};
+		barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+		barrier.oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+		barrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+		barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+		barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+		barrier.image = m_Image;
+		barrier.subresourceRange = { VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1 };
+		barrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+		vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 0, nullptr, 1, &barrier);
+
+		VkBufferImageCopy region{};
+		region.bufferOffset = stagingOffset;
+		region.imageSubresource = { VK_IMAGE_ASPECT_COLOR_BIT, 0, 0, 1 };
+		region.imageExtent = { m_Width, m_Height, 1 };
+		vkCmdCopyBufferToImage(commandBuffer, staging, m_Image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &region);
+
+		// Both paths leave every level ready for sampling, a single level just gets transitioned.
+		if (mipGenerator)
+			mipGenerator->Record(commandBuffer, m_Image, m_Format, m_Width, m_Height, m_MipCount);
+		else
+			VulkanMipGenerator::RecordBlit(commandBuffer, m_Image, m_Format, m_Width, m_Height, m_MipCount);
+	}
+
+	void VulkanTexture::Init(const void* pixels, const uint32_t width, const uint32_t height, VkCommandPool commandPool, VulkanMipGenerator* mipGenerator,
+		const VkFormat format, const bool generateMips)
+	{
+		const VkDeviceSize size = static_cast<VkDeviceSize>(width) * height * 4;
+		Init(width, height, format, size, commandPool, [pixels, size](void* staging) { memcpy(staging, pixels, size); }, mipGenerator, generateMips);
+	}
+
+	void VulkanTexture::Init(const KtxTexture& texture, VkCommandPool commandPool, VulkanMipGenerator* mipGenerator, const KtxTranscodeFn& transcode)
+	{
+		const uint32_t levelCount = static_cast<uint32_t>(texture.m_Levels.size());
+		std::vector<std::vector<uint8_t>> transcoded;
+
+		//-- Pick the format, transcoding Basis Universal data to the best one both the GPU and the transcoder handle.
+		VkFormat format = texture.m_Format;
+		if (texture.IsBasisUniversal())
+		{
+			if (!transcode)
+				throw std::runtime_error("Basis Universal texture needs a transcoder!");
+
+			const VkFormat candidates[] =
+			{
+				texture.m_Srgb ? VK_FORMAT_BC7_SRGB_BLOCK : VK_FORMAT_BC7_UNORM_BLOCK,
+				texture.m_Srgb ? VK_FORMAT_ASTC_4x4_SRGB_BLOCK : VK_FORMAT_ASTC_4x4_UNORM_BLOCK,
+				texture.m_Srgb ? VK_FORMAT_BC3_SRGB_BLOCK : VK_FORMAT_BC3_UNORM_BLOCK,
+				texture.m_Srgb ? VK_FORMAT_ETC2_R8G8B8A8_SRGB_BLOCK : VK_FORMAT_ETC2_R8G8B8A8_UNORM_BLOCK,
+				texture.m_Srgb ? VK_FORMAT_R8G8B8A8_SRGB : VK_FORMAT_R8G8B8A8_UNORM
+			};
+
+			format = VK_FORMAT_UNDEFINED;
+			for (const VkFormat candidate : candidates)
+			{
+				if (!IsFormatSupported(candidate))
+					continue;
+
+				std::vector<uint8_t> level = transcode(texture, 0, candidate);
+				if (level.empty())
+					continue;
+
+				format = candidate;
+				transcoded.push_back(std::move(level));
+				break;
+			}
+
+			if (format == VK_FORMAT_UNDEFINED)
+				throw std::runtime_error("No transcode target for the Basis Universal texture is supported!");
+
+			for (uint32_t level = 1; level < levelCount; ++level)
+				transcoded.push_back(transcode(texture, level, format));
+		}
+		else if (!IsFormatSupported(format))
+			throw std::runtime_error("GPU cannot sample the KTX2 texture's format!");
+
+		//-- Level data, straight from the mapped file unless it was transcoded.
+		const TextureBlockInfo block = KtxLoader::GetBlockInfo(format);
+		std::vector<const uint8_t*> levelData(levelCount);
+		std::vector<VkDeviceSize> levelSizes(levelCount);
+		for (uint32_t level = 0; level < levelCount; ++level)
+		{
+			const KtxLevel& mip = texture.m_Levels[level];
+			levelSizes[level] = KtxLoader::GetLevelSize(format, mip.m_Width, mip.m_Height);
+			levelData[level] = transcoded.empty() ? mip.m_Data : transcoded[level].data();
+
+			if (!transcoded.empty() && transcoded[level].size() < levelSizes[level])
+				throw std::runtime_error("Basis Universal transcoder returned a short mip level!");
+		}
+
+		// A lone uncompressed level gets its chain generated, compressed formats keep what the file has.
+		const bool generateMips = levelCount == 1 && block.m_Width == 1 && block.m_Height == 1;
+		if (generateMips)
+		{
+			Init(texture.m_Width, texture.m_Height, format, levelSizes[0], commandPool,
+				[&levelData, &levelSizes](void* staging) { memcpy(staging, levelData[0], levelSizes[0]); }, mipGenerator);
+			return;
+		}
+
+		m_Format = format;
+		m_Width = texture.m_Width;
+		m_Height = texture.m_Height;
+		m_MipCount = levelCount;
+		CreateImage(0, VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT);
+		const VkDeviceSize stagingSize = UploadLevels(levelData, levelSizes, commandPool);
+		CreateViewAndSampler();
+
+#ifdef _DEBUG
+		// VRAM taken versus the same levels decoded to RGBA8.
+		std::cout << "\t" << "KTX2 texture: " << m_Width << "x" << m_Height << ", " << levelCount << " levels, " << stagingSize << " bytes (RGBA8 "
+			<< texture.GetRgba8Size() << " bytes, " << static_cast<float>(texture.GetRgba8Size()) / static_cast<float>(std::max<VkDeviceSize>(stagingSize, 1)) << "x)" << std::endl;
+#endif
+	}
+
+	void VulkanTexture::Init(const void* pixels, const uint32_t width, const uint32_t height, VkCommandPool commandPool, const BlockCompressSettings& compression,
+		VulkanMipGenerator* mipGenerator, const bool srgb, const bool generateMips)
+	{
+		const VkFormat format = GetBlockFormat(compression.m_Format, srgb);
+		if (!IsFormatSupported(format))
+		{
+			Init(pixels, width, height, commandPool, mipGenerator, srgb ? VK_FORMAT_R8G8B8A8_SRGB : VK_FORMAT_R8G8B8A8_UNORM, generateMips);
+			return;
+		}
+
+		m_Format = format;
+		m_Width = width;
+		m_Height = height;
+		m_MipCount = generateMips ? VulkanMipGenerator::GetMipCount(width, height) : 1;
+		CreateImage(0, VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT);
+
+		//-- Filter each level from the one above, then compress it. Compress spreads the blocks over the ThreadPool.
+		const auto startTime = std::chrono::high_resolution_clock::now();
+		std::vector<std::vector<uint8_t>> levels(m_MipCount);
+		std::vector<uint8_t> source;
+		const uint8_t* levelPixels = static_cast<const uint8_t*>(pixels);
+		for (uint32_t level = 0; level < m_MipCount; ++level)
+		{
+			const uint32_t levelWidth = std::max(width >> level, 1u);
+			const uint32_t levelHeight = std::max(height >> level, 1u);
+			if (level > 0)
+			{
+				source = DownsampleRgba8(levelPixels, std::max(width >> (level - 1), 1u), std::max(height >> (level - 1), 1u), srgb);
+				levelPixels = source.data();
+			}
+			levels[level] = BlockCompressor::Compress(levelPixels, levelWidth, levelHeight, compression);
+		}
+		const auto endTime = std::chrono::high_resolution_clock::now();
+
+		std::vector<const uint8_t*> levelData(m_MipCount);
+		std::vector<VkDeviceSize> levelSizes(m_MipCount);
+		for (uint32_t level = 0; level < m_MipCount; ++level)
+		{
+			levelData[level] = levels[level].data();
+			levelSizes[level] = levels[level].size();
+		}
+		const VkDeviceSize stagingSize = UploadLevels(levelData, levelSizes, commandPool);
+		CreateViewAndSampler();
+
+#ifdef _DEBUG
+		std::cout << "\t" << "Compressed texture: " << m_Width << "x" << m_Height << ", " << m_MipCount << " levels, " << stagingSize << " bytes in "
+			<< std::chrono::duration<float, std::chrono::milliseconds::period>(endTime - startTime).count() << "ms" << std::endl;
+#endif
+	}
+
+	VkDeviceSize VulkanTexture::UploadLevels(const std::vector<const uint8_t*>& levelData, const std::vector<VkDeviceSize>& levelSizes, VkCommandPool commandPool)
+	{
+		const uint32_t levelCount = m_MipCount;
+
+		//-- Every level in one staging buffer, offsets aligned for the copy.
+		const VkDeviceSize alignment = std::max<VkDeviceSize>(KtxLoader::GetBlockInfo(m_Format).m_Bytes, 4);
+		std::vector<VkBufferImageCopy> regions(levelCount);
+		VkDeviceSize stagingSize = 0;
+		for (uint32_t level = 0; level < levelCount; ++level)
+		{
+			stagingSize = (stagingSize + alignment - 1) / alignment * alignment;
+
+			VkBufferImageCopy& region = regions[level];
+			region.bufferOffset = stagingSize;
+			region.imageSubresource = { VK_IMAGE_ASPECT_COLOR_BIT, level, 0, 1 };
+			region.imageExtent = { std::max(m_Width >> level, 1u), std::max(m_Height >> level, 1u), 1 };
+
+			stagingSize += levelSizes[level];
+		}
+
+		VulkanHostBuffer staging;
+		staging.Init(stagingSize, VK_BUFFER_USAGE_TRANSFER_SRC_BIT);
+		uint8_t* mapped = static_cast<uint8_t*>(staging.GetMappedData());
+		for (uint32_t level = 0; level < levelCount; ++level)
+			memcpy(mapped + regions[level].bufferOffset, levelData[level], levelSizes[level]);
+
+		//-- Copy every level, then hand them all to sampling.
+		const VkCommandBuffer commandBuffer = BeginUpload(commandPool);
+
+		VkImageMemoryBarrier barrier{};
+		barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+		barrier.oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+		barrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+		barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+		barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+		barrier.image = m_Image;
+		barrier.subresourceRange = { VK_IMAGE_ASPECT_COLOR_BIT, 0, levelCount, 0, 1 };
+		barrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+		vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 0, nullptr, 1, &barrier);
+
+		vkCmdCopyBufferToImage(commandBuffer, staging.GetBuffer(), m_Image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, levelCount, regions.data());
+
+		barrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+		barrier.newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+		barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+		barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+		vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, 0, 0, nullptr, 0, nullptr, 1, &barrier);
+
+		EndUpload(commandBuffer, commandPool);
+		staging.Cleanup();
+		return stagingSize;
+	}
+
+	void VulkanTexture::CreateImage(const VkImageCreateFlags flags, const VkImageUsageFlags usage)
+	{
+		const VkDevice device = VulkanLogicalDevice::Get().GetLogicalDevice();
+
+		VkImageCreateInfo imageInfo{};
+		imageInfo.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+		imageInfo.flags = flags;
+		imageInfo.imageType = VK_IMAGE_TYPE_2D;
+		imageInfo.format = m_Format;
+		imageInfo.extent = { m_Width, m_Height, 1 };
+		imageInfo.mipLevels = m_MipCount;
+		imageInfo.arrayLayers = 1;
+		imageInfo.samples = VK_SAMPLE_COUNT_1_BIT;
+		imageInfo.tiling = VK_IMAGE_TILING_OPTIMAL;
+		imageInfo.usage = usage;
+		imageInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+		imageInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+
+		if (vkCreateImage(device, &imageInfo, nullptr, &m_Image) != VK_SUCCESS)
+			throw std::runtime_error("Failed to create texture image!");
+
+		VkMemoryRequirements memRequirements;
+		vkGetImageMemoryRequirements(device, m_Image, &memRequirements);
+
+		VkMemoryAllocateInfo allocInfo{};
+		allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+		allocInfo.allocationSize = memRequirements.size;
+		allocInfo.memoryTypeIndex = VulkanQuery::FindMemoryType(VulkanPhysicalDevice::Get().GetPhysicalDevice(), memRequirements.memoryTypeBits, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+
+		if (vkAllocateMemory(device, &allocInfo, nullptr, &m_ImageMemory) != VK_SUCCESS)
+			throw std::runtime_error("Failed to allocate texture image memory!");
+		vkBindImageMemory(device, m_Image, m_ImageMemory, 0);
+	}
+
+	void VulkanTexture::CreateViewAndSampler()
+	{
+		const VkDevice device = VulkanLogicalDevice::Get().GetLogicalDevice();
+
+		VkImageViewCreateInfo viewInfo{};
+		viewInfo.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
+		viewInfo.image = m_Image;
+		viewInfo.viewType = VK_IMAGE_VIEW_TYPE_2D;
+		viewInfo.format = m_Format;
+		viewInfo.subresourceRange = { VK_IMAGE_ASPECT_COLOR_BIT, 0, m_MipCount, 0, 1 };
+
+		if (vkCreateImageView(device, &viewInfo, nullptr, &m_View) != VK_SUCCESS)
+			throw std::runtime_error("Failed to create texture image view!");
+
+		VkSamplerCreateInfo samplerInfo{};
+		samplerInfo.sType = VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO;
+		samplerInfo.magFilter = VK_FILTER_LINEAR;
+		samplerInfo.minFilter = VK_FILTER_LINEAR;
+		samplerInfo.mipmapMode = VK_SAMPLER_MIPMAP_MODE_LINEAR;
+		samplerInfo.addressModeU = VK_SAMPLER_ADDRESS_MODE_REPEAT;
+		samplerInfo.addressModeV = VK_SAMPLER_ADDRESS_MODE_REPEAT;
+		samplerInfo.addressModeW = VK_SAMPLER_ADDRESS_MODE_REPEAT;
+		samplerInfo.maxAnisotropy = 1.f;
+		samplerInfo.compareOp = VK_COMPARE_OP_ALWAYS;
+		samplerInfo.borderColor = VK_BORDER_COLOR_INT_OPAQUE_BLACK;
+		samplerInfo.minLod = 0.f;
+		samplerInfo.maxLod = static_cast<float>(m_MipCount);
+
+		if (vkCreateSampler(device, &samplerInfo, nullptr, &m_Sampler) != VK_SUCCESS)
+			throw std::runtime_error("Failed to create texture sampler!");
+	}
+
+	VkCommandBuffer VulkanTexture::BeginUpload(VkCommandPool commandPool)
+	{
+		VkCommandBufferAllocateInfo commandInfo{};
+		commandInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+		commandInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+		commandInfo.commandPool = commandPool;
+		commandInfo.commandBufferCount = 1;
+
+		VkCommandBuffer commandBuffer;
+		vkAllocateCommandBuffers(VulkanLogicalDevice::Get().GetLogicalDevice(), &commandInfo, &commandBuffer);
+
+		VkCommandBufferBeginInfo beginInfo{};
+		beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+		beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+
+		vkBeginCommandBuffer(commandBuffer, &beginInfo);
+		return commandBuffer;
+	}
+
+	void VulkanTexture::EndUpload(VkCommandBuffer commandBuffer, VkCommandPool commandPool)
+	{
+		vkEndCommandBuffer(commandBuffer);
+
+		VkSubmitInfo submitInfo{};
+		submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+		submitInfo.commandBufferCount = 1;
+		submitInfo.pCommandBuffers = &commandBuffer;
+
+		vkQueueSubmit(VulkanLogicalDevice::Get().GetGraphicsQueue(), 1, &submitInfo, VK_NULL_HANDLE);
+		vkQueueWaitIdle(VulkanLogicalDevice::Get().GetGraphicsQueue());
+
+		vkFreeCommandBuffers(VulkanLogicalDevice::Get().GetLogicalDevice(), commandPool, 1, &commandBuffer);
+	}
+
+	void VulkanTexture::Cleanup() const
+	{
+		const VkDevice device = VulkanLogicalDevice::Get().GetLogicalDevice();
+
+		vkDestroySampler(device, m_Sampler, nullptr);
+		vkDestroyImageView(device, m_View, nullptr);
+		vkDestroyImage(device, m_Image, nullptr);
+		vkFreeMemory(device, m_ImageMemory, nullptr);
+	}
+
+	bool VulkanTexture::IsFormatSupported(const VkFormat format)
+	{
+		VkFormatProperties properties;
+		vkGetPhysicalDeviceFormatProperties(VulkanPhysicalDevice::Get().GetPhysicalDevice(), format, &properties);
+		return (properties.optimalTilingFeatures & VK_FORMAT_FEATURE_SAMPLED_IMAGE_BIT) != 0;
+	}
+
+	DescriptorResource VulkanTexture::GetDescriptor() const
+	{
+		return DescriptorResource::Image(m_Sampler, m_View);
+	}
+
+	VkImage VulkanTexture::GetImage() const
+	{
+		return m_Image;
+	}
+
+	VkImageView VulkanTexture::GetView() const
+	{
+		return m_View;
+	}
+
+	VkSampler VulkanTexture::GetSampler() const
+	{
+		return m_Sampler;
+	}
+
+	VkFormat VulkanTexture::GetFormat() const
+	{
+		return m_Format;
+	}
+
+	uint32_t VulkanTexture::GetWidth() const
+	{
+		return m_Width;
+	}
+
+	uint32_t VulkanTexture::GetHeight() const
+	{
+		return m_Height;
+	}
+
+	uint32_t VulkanTexture::GetMipCount() const
+	{
+		return m_MipCount;
+	}
+}
@@ -0,0 +1,86 @@
+﻿/*!
+\file		VulkanTexture.h
+\date		19/10/2026
+
+\author		Adrian Tan
+\email		t.xingkhiangadrian\@digipen.edu
+
+\brief		Contains definition of VulkanTexture class.
+
+\copyright	All content © 2023 DigiPen (SINGAPORE) Corporation, all rights reserved.
+			Reproduction or disclosure of this file or its contents without the
+			prior written consent of DigiPen Institute of Technology is prohibited.
+__________________________________________________________________________________*/
+#pragma once
+
+#include "BlockCompressor.h"
+#include "KtxLoader.h"
+#include "VulkanBuffers.h"
+#include "VulkanDescriptorCache.h"
+
+namespace Nya
+{
+	class VulkanMipGenerator;
+
+	// Sampled 2D texture with a full mip chain generated on upload, and a trilinear sampler over every level.
+	// Minified texels then come from the matching level instead of skipping across level 0, which keeps
+	// distant surfaces cache friendly and stops them aliasing.
+	class VulkanTexture
+	{
+		VkImage m_Image{};
+		VkDeviceMemory m_ImageMemory{};
+		VkImageView m_View{};
+		VkSampler m_Sampler{};
+
+		VkFormat m_Format = VK_FORMAT_UNDEFINED;
+		uint32_t m_Width = 0;
+		uint32_t m_Height = 0;
+		uint32_t m_MipCount = 0;
+
+		void CreateImage(VkImageCreateFlags flags, VkImageUsageFlags usage);
+		void CreateViewAndSampler();
+		// Copies level 0 from staging, then generates the chain with mipGenerator's compute path, or blits without one.
+		void RecordUpload(VkCommandBuffer commandBuffer, VkBuffer staging, VkDeviceSize stagingOffset, VulkanMipGenerator* mipGenerator) const;
+		// Copies every level to an image already created with m_MipCount levels, and returns the staging bytes used.
+		VkDeviceSize UploadLevels(const std::vector<const uint8_t*>& levelData, const std::vector<VkDeviceSize>& levelSizes, VkCommandPool commandPool);
+		static VkCommandBuffer BeginUpload(VkCommandPool commandPool);
+		static void EndUpload(VkCommandBuffer commandBuffer, VkCommandPool commandPool);
+
+	public:
+		// Level 0 is written by writeStaging, size bytes tightly packed. The chain is generated by mipGenerator's
+		// compute path where the format allows it. Blits are the fallback for other formats, or a null mipGenerator.
+		void Init(uint32_t width, uint32_t height, VkFormat format, VkDeviceSize size, VkCommandPool commandPool, const StagingWriteFn& writeStaging,
+			VulkanMipGenerator* mipGenerator, bool generateMips = true);
+		// Records the upload of level 0 from a tightly packed range of staging into commandBuffer instead of
+		// submitting it, chain included. The caller submits, and keeps the range alive until that completes.
+		// With the compute path, the caller also calls mipGenerator->ReleaseRecorded once it has.
+		void Init(VkCommandBuffer commandBuffer, VkBuffer staging, VkDeviceSize stagingOffset, uint32_t width, uint32_t height,
+			VulkanMipGenerator* mipGenerator, VkFormat format = VK_FORMAT_R8G8B8A8_SRGB, bool generateMips = true);
+		// Tightly packed RGBA8 pixels.
+		void Init(const void* pixels, uint32_t width, uint32_t height, VkCommandPool commandPool, VulkanMipGenerator* mipGenerator,
+			VkFormat format = VK_FORMAT_R8G8B8A8_SRGB, bool generateMips = true);
+		// Uploads a KTX2 file's stored levels as they are, so block compressed data goes to VRAM without a decode.
+		// Basis Universal data is transcoded by transcode to the best format the GPU samples, BC7 first, then
+		// ASTC, BC3, ETC2 and RGBA8. Uncompressed files with a single level get their chain generated.
+		// Throws if the GPU cannot sample the file's format, or Basis Universal data comes without a transcoder.
+		void Init(const KtxTexture& texture, VkCommandPool commandPool, VulkanMipGenerator* mipGenerator, const KtxTranscodeFn& transcode = {});
+		// Block compresses tightly packed RGBA8 pixels on the CPU before upload, for textures made at runtime.
+		// The chain is box filtered and compressed level by level, since compressed images cannot be blit or
+		// written by compute. Falls back to uncompressed RGBA8, chain from mipGenerator, if the GPU cannot sample the compressed format.
+		void Init(const void* pixels, uint32_t width, uint32_t height, VkCommandPool commandPool, const BlockCompressSettings& compression,
+			VulkanMipGenerator* mipGenerator, bool srgb = true, bool generateMips = true);
+		void Cleanup() const;
+
+		// Optimal tiling images of format can be sampled.
+		static bool IsFormatSupported(VkFormat format);
+
+		DescriptorResource GetDescriptor() const;
+		VkImage GetImage() const;
+		VkImageView GetView() const;
+		VkSampler GetSampler() const;
+		VkFormat GetFormat() const;
+		uint32_t GetWidth() const;
+		uint32_t GetHeight() const;
+		uint32_t GetMipCount() const;
+	};
+}
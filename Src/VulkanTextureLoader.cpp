@@ -0,0 +1,320 @@
+﻿/*!
+\file		VulkanTextureLoader.cpp
+\date		19/10/2026
+
+\author		Adrian Tan
+\email		t.xingkhiangadrian\@digipen.edu
+
+\brief		Contains implementation of VulkanTextureLoader class.
+
+\copyright	All content © 2023 DigiPen (SINGAPORE) Corporation, all rights reserved.
+			Reproduction or disclosure of this file or its contents without the
+			prior written consent of DigiPen Institute of Technology is prohibited.
+__________________________________________________________________________________*/
+
+#include "meowpch.h"
+
+#include "VulkanTextureLoader.h"
+#include "MappedFile.h"
+#include "PixelConverter.h"
+#include "ThreadPool.h"
+#include "VulkanLogicalDevice.h"
+#include "VulkanMipGenerator.h"
+
+#define STB_IMAGE_IMPLEMENTATION
+#include <stb_image.h>
+
+namespace Nya
+{
+	namespace
+	{
+		using StbPixels = std::unique_ptr<stbi_uc, decltype(&stbi_image_free)>;
+
+		using ConvertFn = void(*)(const uint8_t*, uint8_t*, size_t, SimdPath);
+
+		// RGB images stay RGB so the expansion runs in PixelConverter, everything else decodes to RGBA8.
+		StbPixels DecodeImage(const MappedFile& file, const std::string& filePath, int& width, int& height, int& channels)
+		{
+			const int size = static_cast<int>(file.GetSize());
+			int fileChannels = 0;
+			if (!stbi_info_from_memory(file.GetData(), size, &width, &height, &fileChannels))
+				throw std::runtime_error("Failed to decode image [" + filePath + "]: " + stbi_failure_reason());
+
+			channels = fileChannels == STBI_rgb ? STBI_rgb : STBI_rgb_alpha;
+			StbPixels pixels(stbi_load_from_memory(file.GetData(), size, &width, &height, &fileChannels, channels), stbi_image_free);
+			if (!pixels)
+				throw std::runtime_error("Failed to decode image [" + filePath + "]: " + stbi_failure_reason());
+			return pixels;
+		}
+
+		VkFormat GetLoadFormat(const TextureLoadSettings& settings)
+		{
+			const bool srgb = settings.m_Srgb && !settings.m_NormalMap;
+			if (settings.m_Bgra)
+				return srgb ? VK_FORMAT_B8G8R8A8_SRGB : VK_FORMAT_B8G8R8A8_UNORM;
+			return srgb ? VK_FORMAT_R8G8B8A8_SRGB : VK_FORMAT_R8G8B8A8_UNORM;
+		}
+	}
+
+
+	void VulkanTextureLoader::Init(VkCommandPool commandPool, VulkanMipGenerator* mipGenerator, const VkDeviceSize stagingSize)
+	{
+		m_CommandPool = commandPool;
+		m_MipGenerator = mipGenerator;
+		m_Staging.Init(stagingSize);
+	}
+
+	void VulkanTextureLoader::Cleanup()
+	{
+		WaitIdle();
+
+		for (const VulkanTexture& texture : m_Textures)
+			if (texture.GetImage() != VK_NULL_HANDLE)
+				texture.Cleanup();
+		m_Textures.clear();
+		m_States.clear();
+
+		m_Staging.Cleanup();
+	}
+
+	uint32_t VulkanTextureLoader::Load(const std::string& filePath, const TextureLoadSettings& settings)
+	{
+		const uint32_t id = static_cast<uint32_t>(m_Textures.size());
+		m_Textures.emplace_back();
+		m_States.push_back(TextureLoadState::Pending);
+		++m_PendingCount;
+
+		// The task only touches the staging ring and the decoded queue, both locked.
+		ThreadPool::Get().Submit([this, id, filePath, settings] { Decode(id, filePath, settings); });
+		return id;
+	}
+
+	void VulkanTextureLoader::Decode(const uint32_t id, const std::string& filePath, const TextureLoadSettings& settings)
+	{
+		DecodedImage image;
+		image.m_Id = id;
+		image.m_Format = GetLoadFormat(settings);
+
+		try
+		{
+			//-- stb_image decodes into a buffer of its own, so the slot is only taken, and the ring only held, for the final write.
+			const MappedFile file(filePath);
+			int width, height, channels;
+			const StbPixels pixels = DecodeImage(file, filePath, width, height, channels);
+
+			image.m_Width = static_cast<uint32_t>(width);
+			image.m_Height = static_cast<uint32_t>(height);
+			const size_t pixelCount = static_cast<size_t>(image.m_Width) * image.m_Height;
+			const VkDeviceSize size = static_cast<VkDeviceSize>(pixelCount) * 4;
+
+			// Without workers this runs inside Load, where waiting for the ring to drain would never end.
+			const bool fitsRing = size + VulkanStagingRing::s_Alignment <= m_Staging.GetCapacity();
+			bool allocated = false;
+			if (fitsRing && ThreadPool::Get().GetConcurrency() > 1)
+			{
+				image.m_Slot = m_Staging.Allocate(size);
+				allocated = true;
+			}
+			else if (fitsRing)
+				allocated = m_Staging.TryAllocate(size, image.m_Slot);
+
+			if (!allocated)
+			{
+				image.m_DedicatedStaging = std::make_shared<VulkanHostBuffer>();
+				image.m_DedicatedStaging->Init(size, VK_BUFFER_USAGE_TRANSFER_SRC_BIT);
+				image.m_Slot = { image.m_DedicatedStaging->GetMappedData(), image.m_DedicatedStaging->GetBuffer(), 0, size };
+			}
+
+			//-- Conversions run in place on stb's buffer and the last one writes the slot, so staging memory is only ever written.
+			std::vector<ConvertFn> steps;
+			if (settings.m_NormalMap)
+				steps.push_back(&PixelConverter::RenormalizeNormals);
+			else if (settings.m_PremultiplyAlpha && channels == STBI_rgb_alpha)
+				steps.push_back(&PixelConverter::PremultiplyAlpha);
+			if (settings.m_Bgra)
+				steps.push_back(&PixelConverter::SwapRedBlue);
+
+			uint8_t* destination = static_cast<uint8_t*>(image.m_Slot.m_Data);
+			const SimdPath path = GetBestSimdPath();
+			if (steps.empty())
+			{
+				if (channels == STBI_rgb)
+					PixelConverter::ExpandRgbToRgba(pixels.get(), destination, pixelCount, path);
+				else
+					memcpy(destination, pixels.get(), static_cast<size_t>(size));
+			}
+			else
+			{
+				// RGB has no room to grow in place.
+				std::vector<uint8_t> expanded;
+				uint8_t* texels = pixels.get();
+				if (channels == STBI_rgb)
+				{
+					expanded.resize(static_cast<size_t>(size));
+					PixelConverter::ExpandRgbToRgba(texels, expanded.data(), pixelCount, path);
+					texels = expanded.data();
+				}
+
+				for (size_t step = 0; step < steps.size(); ++step)
+					steps[step](texels, step + 1 == steps.size() ? destination : texels, pixelCount, path);
+			}
+		}
+		catch (const std::exception& exception)
+		{
+			image.m_Error = exception.what();
+		}
+
+		std::lock_guard lock(m_DecodedMutex);
+		m_Decoded.push_back(std::move(image));
+	}
+
+	uint32_t VulkanTextureLoader::Update()
+	{
+		RetireBatches(false);
+
+		std::vector<DecodedImage> decoded;
+		{
+			std::lock_guard lock(m_DecodedMutex);
+			decoded.swap(m_Decoded);
+		}
+		if (decoded.empty())
+			return 0;
+
+		const VkDevice device = VulkanLogicalDevice::Get().GetLogicalDevice();
+
+		//-- One command buffer for every finished decode.
+		UploadBatch batch;
+		VkCommandBufferAllocateInfo commandInfo{};
+		commandInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+		commandInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+		commandInfo.commandPool = m_CommandPool;
+		commandInfo.commandBufferCount = 1;
+		if (vkAllocateCommandBuffers(device, &commandInfo, &batch.m_CommandBuffer) != VK_SUCCESS)
+			throw std::runtime_error("Failed to allocate texture upload command buffer!");
+
+		VkCommandBufferBeginInfo beginInfo{};
+		beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+		beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+		vkBeginCommandBuffer(batch.m_CommandBuffer, &beginInfo);
+
+		uint32_t readyCount = 0;
+		for (DecodedImage& image : decoded)
+		{
+			--m_PendingCount;
+			if (!image.m_Error.empty())
+			{
+				std::cerr << "Texture load failed: " << image.m_Error << std::endl;
+				m_States[image.m_Id] = TextureLoadState::Failed;
+				continue;
+			}
+
+			m_Textures[image.m_Id].Init(batch.m_CommandBuffer, image.m_Slot.m_Buffer, image.m_Slot.m_Offset, image.m_Width, image.m_Height,
+				m_MipGenerator, image.m_Format);
+			m_States[image.m_Id] = TextureLoadState::Ready;
+			++readyCount;
+
+			if (image.m_DedicatedStaging)
+				batch.m_DedicatedStaging.push_back(std::move(image.m_DedicatedStaging));
+			else
+				batch.m_Slots.push_back(image.m_Slot);
+		}
+
+		vkEndCommandBuffer(batch.m_CommandBuffer);
+
+		//-- Later submissions on the queue are ordered behind the upload's barriers, so the textures are usable now.
+		VkFenceCreateInfo fenceInfo{};
+		fenceInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+		if (vkCreateFence(device, &fenceInfo, nullptr, &batch.m_Fence) != VK_SUCCESS)
+			throw std::runtime_error("Failed to create texture upload fence!");
+
+		VkSubmitInfo submitInfo{};
+		submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+		submitInfo.commandBufferCount = 1;
+		submitInfo.pCommandBuffers = &batch.m_CommandBuffer;
+		if (vkQueueSubmit(VulkanLogicalDevice::Get().GetGraphicsQueue(), 1, &submitInfo, batch.m_Fence) != VK_SUCCESS)
+			throw std::runtime_error("Failed to submit texture uploads!");
+
+		m_Batches.push_back(std::move(batch));
+		return readyCount;
+	}
+
+	void VulkanTextureLoader::RetireBatches(const bool wait)
+	{
+		const VkDevice device = VulkanLogicalDevice::Get().GetLogicalDevice();
+
+		std::erase_if(m_Batches, [this, device, wait](UploadBatch& batch)
+		{
+			if (wait)
+				vkWaitForFences(device, 1, &batch.m_Fence, VK_TRUE, UINT64_MAX);
+			else if (vkGetFenceStatus(device, batch.m_Fence) != VK_SUCCESS)
+				return false;
+
+			for (const StagingSlot& slot : batch.m_Slots)
+				m_Staging.Release(slot);
+			for (const std::shared_ptr<VulkanHostBuffer>& staging : batch.m_DedicatedStaging)
+				staging->Cleanup();
+
+			vkDestroyFence(device, batch.m_Fence, nullptr);
+			vkFreeCommandBuffers(device, m_CommandPool, 1, &batch.m_CommandBuffer);
+			return true;
+		});
+
+		// The generator only frees views all at once, so wait for a moment with nothing of ours in flight.
+		if (m_MipGenerator && m_Batches.empty())
+			m_MipGenerator->ReleaseRecorded();
+	}
+
+	void VulkanTextureLoader::WaitIdle()
+	{
+		// Workers may be blocked on a full ring, which only Update's retirements free up.
+		while (m_PendingCount > 0)
+			if (Update() == 0)
+				std::this_thread::yield();
+
+		RetireBatches(true);
+	}
+
+	TextureLoadState VulkanTextureLoader::GetState(const uint32_t id) const
+	{
+		return m_States.at(id);
+	}
+
+	const VulkanTexture& VulkanTextureLoader::GetTexture(const uint32_t id) const
+	{
+		return m_Textures.at(id);
+	}
+
+	uint32_t VulkanTextureLoader::GetPendingCount() const
+	{
+		return m_PendingCount;
+	}
+
+	void VulkanTextureLoader::BenchmarkDecode(const std::string& filePath, const uint32_t imageCount)
+	{
+		const MappedFile file(filePath);
+
+		auto startTime = std::chrono::high_resolution_clock::now();
+		for (uint32_t i = 0; i < imageCount; ++i)
+		{
+			int width, height, channels;
+			DecodeImage(file, filePath, width, height, channels);
+		}
+		auto endTime = std::chrono::high_resolution_clock::now();
+		const float serialMs = std::chrono::duration<float, std::chrono::milliseconds::period>(endTime - startTime).count();
+
+		startTime = std::chrono::high_resolution_clock::now();
+		ThreadPool::Get().ParallelFor(imageCount, 1, [&file, &filePath](const uint32_t begin, const uint32_t end)
+		{
+			for (uint32_t i = begin; i < end; ++i)
+			{
+				int width, height, channels;
+				DecodeImage(file, filePath, width, height, channels);
+			}
+		});
+		endTime = std::chrono::high_resolution_clock::now();
+		const float parallelMs = std::chrono::duration<float, std::chrono::milliseconds::period>(endTime - startTime).count();
+
+		std::cout << "\t" << "Decode of " << imageCount << " images: " << serialMs << "ms on one thread, " << parallelMs << "ms on "
+			<< ThreadPool::Get().GetConcurrency() << " threads (" << serialMs / parallelMs << "x)" << std::endl;
+	}
+}
@@ -0,0 +1,108 @@
+﻿/*!
+\file		VulkanTextureLoader.h
+\date		19/10/2026
+
+\author		Adrian Tan
+\email		t.xingkhiangadrian\@digipen.edu
+
+\brief		Contains definition of VulkanTextureLoader class.
+			Decodes JPEG and PNG textures on the ThreadPool into a shared staging
+			ring, and uploads them as decodes finish.
+
+\copyright	All content © 2023 DigiPen (SINGAPORE) Corporation, all rights reserved.
+			Reproduction or disclosure of this file or its contents without the
+			prior written consent of DigiPen Institute of Technology is prohibited.
+__________________________________________________________________________________*/
+#pragma once
+
+#include "VulkanStagingRing.h"
+#include "VulkanTexture.h"
+
+#include <memory>
+#include <string>
+
+namespace Nya
+{
+	enum class TextureLoadState : uint32_t
+	{
+		Pending,	// Queued or decoding.
+		Ready,		// Upload submitted, the texture can be bound.
+		Failed
+	};
+
+	struct TextureLoadSettings
+	{
+		bool m_Srgb = true;
+		bool m_NormalMap = false;			// Renormalizes xyz after 8 bit quantization, and forces a UNORM format.
+		bool m_PremultiplyAlpha = false;	// Ignored for normal maps and images without alpha.
+		bool m_Bgra = false;				// Stores B8G8R8A8 for consumers that expect it.
+	};
+
+	// Streams image files into textures without stalling the calling thread. Load queues a decode task,
+	// workers decode with stb_image and convert to RGBA8 (or BGRA8) while writing into a slot of the staging ring, and Update
+	// records and submits copies for whatever has finished since the last call. Staging slots return to
+	// the ring when their upload's fence signals.
+	class VulkanTextureLoader
+	{
+		struct DecodedImage
+		{
+			uint32_t m_Id = 0;
+			uint32_t m_Width = 0;
+			uint32_t m_Height = 0;
+			VkFormat m_Format = VK_FORMAT_R8G8B8A8_SRGB;
+			StagingSlot m_Slot;
+			std::shared_ptr<VulkanHostBuffer> m_DedicatedStaging;	// Images larger than the ring, or a full ring without workers.
+			std::string m_Error;
+		};
+
+		struct UploadBatch
+		{
+			VkCommandBuffer m_CommandBuffer{};
+			VkFence m_Fence{};
+			std::vector<StagingSlot> m_Slots;
+			std::vector<std::shared_ptr<VulkanHostBuffer>> m_DedicatedStaging;
+		};
+
+		VkCommandPool m_CommandPool{};
+		VulkanMipGenerator* m_MipGenerator = nullptr;	// Its views are released whenever no batch is in flight.
+		VulkanStagingRing m_Staging;
+
+		std::vector<VulkanTexture> m_Textures;
+		std::vector<TextureLoadState> m_States;
+		std::vector<UploadBatch> m_Batches;
+		uint32_t m_PendingCount = 0;
+
+		std::mutex m_DecodedMutex;
+		std::vector<DecodedImage> m_Decoded;		// Written by workers, drained by Update.
+
+		void Decode(uint32_t id, const std::string& filePath, const TextureLoadSettings& settings);
+		// Frees the command buffers and staging of completed uploads, waiting on all of them with wait.
+		void RetireBatches(bool wait);
+
+	public:
+		static constexpr VkDeviceSize s_DefaultStagingSize = 64ull << 20;
+
+		// commandPool must belong to the graphics queue family, and only be used from the thread calling Update.
+		// Mip chains come from mipGenerator's compute path, or blits where it cannot take the format or it is null.
+		void Init(VkCommandPool commandPool, VulkanMipGenerator* mipGenerator, VkDeviceSize stagingSize = s_DefaultStagingSize);
+		// Waits for every queued load, then destroys the textures.
+		void Cleanup();
+
+		// Queues a file for decoding and returns the id of its texture. Any format stb_image reads works,
+		// the texture is RGBA8, or BGRA8 with m_Bgra, with a full mip chain.
+		uint32_t Load(const std::string& filePath, const TextureLoadSettings& settings = {});
+		// Uploads every image decoded since the last call in one submission, and returns how many became Ready.
+		// Call once per frame from the thread that owns the command pool.
+		uint32_t Update();
+		// Blocks until no load is Pending and every upload has completed.
+		void WaitIdle();
+
+		TextureLoadState GetState(uint32_t id) const;
+		// Only valid once the state is Ready.
+		const VulkanTexture& GetTexture(uint32_t id) const;
+		uint32_t GetPendingCount() const;
+
+		// Decodes filePath imageCount times on the calling thread, then across the ThreadPool, and prints the speedup.
+		static void BenchmarkDecode(const std::string& filePath, uint32_t imageCount);
+	};
+}
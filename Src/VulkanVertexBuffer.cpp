@@ -23,27 +23,22 @@ namespace Nya
 {
 	void VulkanVertexBuffer::Init(const std::vector<Vertex>& vertices, VkCommandPool commandPool)
 	{
-		const VkDeviceSize bufferSize = sizeof(Vertex) * vertices.size();
-		constexpr VkMemoryPropertyFlags memProperties = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
-
-		// Staging buffer.
-		VkBuffer stagingBuffer;
-		VkDeviceMemory stagingBufferMemory;
-		CreateBuffer(bufferSize, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, memProperties, stagingBuffer, stagingBufferMemory);
-
-		// Map memory to CPU.
-		void* data;
-		vkMapMemory(VulkanLogicalDevice::Get().GetLogicalDevice(), stagingBufferMemory, 0, bufferSize, 0, &data);
-		memcpy(data, vertices.data(), (size_t)bufferSize);
-		vkUnmapMemory(VulkanLogicalDevice::Get().GetLogicalDevice(), stagingBufferMemory);
-
-		// Vertex buffer, created in high-performance memory in GPU.
-		CreateBuffer(bufferSize, VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_VERTEX_BUFFER_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, m_Buffer, m_BufferMemory);
-		// Copy from staging buffer to vertex buffer.
-		CopyBuffer(stagingBuffer, m_Buffer, bufferSize, commandPool);
-
-		// Cleanup staging buffer.
-		vkDestroyBuffer(VulkanLogicalDevice::Get().GetLogicalDevice(), stagingBuffer, nullptr);
-		vkFreeMemory(VulkanLogicalDevice::Get().GetLogicalDevice(), stagingBufferMemory, nullptr);
+		Init(static_cast<VkDeviceSize>(Vertex::Layout::s_Stride) * vertices.size(), commandPool, [&vertices](void* staging)
+		{
+			Vertex::Pack(vertices, staging);
+		});
+	}
+
+	void VulkanVertexBuffer::Init(const void* data, const VkDeviceSize size, VkCommandPool commandPool)
+	{
+		Init(size, commandPool, [data, size](void* staging)
+		{
+			memcpy(staging, data, static_cast<size_t>(size));
+		});
+	}
+
+	void VulkanVertexBuffer::Init(const VkDeviceSize size, VkCommandPool commandPool, const StagingWriteFn& writeStaging)
+	{
+		CreateDeviceLocalBuffer(size, VK_BUFFER_USAGE_VERTEX_BUFFER_BIT, commandPool, writeStaging);
 	}
 }
@@ -24,5 +24,7 @@ namespace Nya
 	{
 	public:
 		void Init(const std::vector<Vertex>& vertices, VkCommandPool commandPool);
+		void Init(const void* data, VkDeviceSize size, VkCommandPool commandPool);
+		void Init(VkDeviceSize size, VkCommandPool commandPool, const StagingWriteFn& writeStaging);
 	};
 }
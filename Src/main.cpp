@@ -1,12 +1,29 @@
 #include <iostream>
+#include <string_view>
 
 #define USE_VER 0
 
 #include "Renderer.h"
 #include "VulkanRenderer.h"
 
-int main()
+int main(int argc, char** argv)
 {
+	// --bench [file.glb] runs the CPU benchmarks instead of a renderer, in any configuration.
+	if (argc > 1 && std::string_view(argv[1]) == "--bench")
+	{
+		try
+		{
+			MeowRenderer::RunBenchmarks(argc > 2 ? argv[2] : "");
+		}
+		catch (const std::exception& e)
+		{
+			std::cerr << e.what() << std::endl;
+			return EXIT_FAILURE;
+		}
+
+		return 0;
+	}
+
 #if USE_VER == 0
 	try
 	{